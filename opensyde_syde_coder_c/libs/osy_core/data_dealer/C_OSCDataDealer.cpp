@@ -606,19 +606,19 @@ void C_OSCDataDealer::m_ReadDataPoolDataEventReceived(const uint8 ou8_DataPoolIn
          }
          else
          {
-            //size OK; cut off potential cruft
-            std::vector<uint8> c_Data = orc_Value;
-            c_Data.resize(pc_Element->GetSizeByte());
+            //size OK; only use the element's part (cut off potential cruft)
+            const uint32 u32_Size = pc_Element->GetSizeByte();
+            const uint8 * const pu8_Data = (orc_Value.size() > 0UL) ? &orc_Value[0] : NULL;
 
             //convert to native endianness depending on the type ...
             //no possible problem we did not check for already ...
             if (mpc_DiagProtocol->GetEndianness() == C_OSCDiagProtocolBase::mhu8_ENDIANNESS_BIG)
             {
-               (void)pc_Element->c_Value.SetValueFromBigEndianBlob(c_Data);
+               (void)pc_Element->c_Value.SetValueFromBigEndianBlob(pu8_Data, u32_Size);
             }
             else
             {
-               (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(c_Data);
+               (void)pc_Element->c_Value.SetValueFromLittleEndianBlob(pu8_Data, u32_Size);
             }
             //inform application
             m_OnReadDataPoolEventReceived(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex);
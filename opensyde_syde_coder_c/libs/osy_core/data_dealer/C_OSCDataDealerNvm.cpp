@@ -23,6 +23,8 @@ using namespace stw_errors;
 using namespace stw_opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+//maximum number of unused NVM bytes between two lists that are read along to save an additional request
+static const uint32 mu32_NVM_READ_MAX_GAP = 64U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -88,11 +90,11 @@ uint16 C_OSCDataDealerNvm::NvmCalcCrc(const C_OSCNodeDataPoolList & orc_List) co
    {
       uint32 u32_Counter;
       const uint8 u8_Endianness = this->mpc_DiagProtocol->GetEndianness();
+      std::vector<uint8> c_Data; //reused for all elements to avoid reallocations
 
       for (u32_Counter = 0U; u32_Counter < orc_List.c_Elements.size(); ++u32_Counter)
       {
          const C_OSCNodeDataPoolListElement * const pc_Element = &orc_List.c_Elements[u32_Counter];
-         std::vector<uint8> c_Data;
 
          //convert to native endianness depending on the type ...
          //no possible problem we did not check for already ...
@@ -250,6 +252,126 @@ sint32 C_OSCDataDealerNvm::m_NvmReadListRaw(const C_OSCNodeDataPoolList & orc_Li
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Reads the dumps of multiple NVM lists of ECU
+
+   Lists following each other in NVM are read with one request sequence covering the whole address range
+   (the protocol driver splits it up into maximum sized services).
+   Small unused areas between lists are read along if this saves a request.
+   The order of orc_Lists is kept; only lists that are next to each other in orc_Lists are combined.
+   If the server sends an error response for a combined range the lists of that range are read one by one.
+
+   \param[in]      orc_Lists      Lists with read information
+   \param[out]     orc_Values     List dumps (one entry per list in orc_Lists)
+   \param[out]     opu8_NrCode    if != NULL: negative response code in case of an error response
+
+   \return
+   C_NO_ERR   Request sent, positive response received
+   C_OVERFLOW At least one list has no elements. Nothing was read
+   C_TIMEOUT  Expected response not received within timeout
+   C_NOACT    Could not send request (e.g. Tx buffer full)
+   C_WARN     Error response
+   C_CONFIG   Pre-requisites not correct; e.g. driver not initialized or
+              parameter out of range (checked by client side)
+   C_COM      expected server response not received because of communication error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCDataDealerNvm::m_NvmReadListsRaw(const std::vector<const C_OSCNodeDataPoolList *> & orc_Lists,
+                                             std::vector<std::vector<uint8> > & orc_Values,
+                                             uint8 * const opu8_NrCode)
+{
+   sint32 s32_Return = C_NO_ERR;
+   std::vector<uint32> c_NumBytes;
+   uint32 u32_ItList;
+
+   orc_Values.clear();
+   orc_Values.resize(orc_Lists.size());
+   c_NumBytes.resize(orc_Lists.size());
+
+   //check all lists before starting the communication
+   for (u32_ItList = 0U; u32_ItList < orc_Lists.size(); ++u32_ItList)
+   {
+      const C_OSCNodeDataPoolList & rc_List = *orc_Lists[u32_ItList];
+
+      // If CRC is active, at least 2 byte are necessary for the CRC
+      if ((rc_List.u32_NvMSize > 2U) ||
+          ((rc_List.u32_NvMSize > 0U) && (rc_List.q_NvMCRCActive == false)))
+      {
+         c_NumBytes[u32_ItList] = rc_List.GetNumBytesUsed();
+      }
+      else
+      {
+         s32_Return = C_OVERFLOW;
+         break;
+      }
+   }
+
+   u32_ItList = 0U;
+   while ((s32_Return == C_NO_ERR) && (u32_ItList < orc_Lists.size()))
+   {
+      const uint32 u32_StartAddress = orc_Lists[u32_ItList]->u32_NvMStartAddress;
+      uint32 u32_EndAddress = u32_StartAddress + c_NumBytes[u32_ItList];
+      uint32 u32_ItLastList = u32_ItList;
+      std::vector<uint8> c_Range;
+
+      //add following lists as long as they are located right behind the current range
+      while ((u32_ItLastList + 1U) < orc_Lists.size())
+      {
+         const uint32 u32_NextStartAddress = orc_Lists[static_cast<size_t>(u32_ItLastList) + 1U]->u32_NvMStartAddress;
+         if ((u32_NextStartAddress >= u32_EndAddress) &&
+             ((u32_NextStartAddress - u32_EndAddress) <= mu32_NVM_READ_MAX_GAP))
+         {
+            ++u32_ItLastList;
+            u32_EndAddress = u32_NextStartAddress + c_NumBytes[u32_ItLastList];
+         }
+         else
+         {
+            break;
+         }
+      }
+
+      // Read the entire range
+      c_Range.resize(u32_EndAddress - u32_StartAddress);
+      s32_Return = this->mpc_DiagProtocol->NvmRead(u32_StartAddress, c_Range, opu8_NrCode);
+
+      // Adapt return value
+      s32_Return = this->m_AdaptProtocolReturnValue(s32_Return);
+
+      if (s32_Return == C_NO_ERR)
+      {
+         //distribute to the lists
+         for (; u32_ItList <= u32_ItLastList; ++u32_ItList)
+         {
+            if (c_NumBytes[u32_ItList] > 0U)
+            {
+               const uint8 * const pu8_Start =
+                  &c_Range[orc_Lists[u32_ItList]->u32_NvMStartAddress - u32_StartAddress];
+               orc_Values[u32_ItList].assign(pu8_Start, pu8_Start + c_NumBytes[u32_ItList]);
+            }
+         }
+      }
+      else if ((s32_Return == C_WARN) && (u32_ItLastList > u32_ItList))
+      {
+         //the server refused the combined range (e.g. a gap between the lists is protected):
+         //read the lists one by one so only lists that can not be read on their own fail
+         s32_Return = C_NO_ERR;
+         for (; (s32_Return == C_NO_ERR) && (u32_ItList <= u32_ItLastList); ++u32_ItList)
+         {
+            if (c_NumBytes[u32_ItList] > 0U)
+            {
+               s32_Return = this->m_NvmReadListRaw(*orc_Lists[u32_ItList], orc_Values[u32_ItList], opu8_NrCode);
+            }
+         }
+      }
+      else
+      {
+         //error reading a single list: nothing else to try
+      }
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Interprets the value and if necessary the CRC of the container orc_Values into the datapool list
 
@@ -336,23 +458,17 @@ sint32 C_OSCDataDealerNvm::m_SaveDumpValuesToListValues(std::vector<uint8> & orc
 
       if (orc_Values.size() >= (u32_Index + u32_SizeElement))
       {
-         std::vector<uint8> c_ElementData;
-
-         // Get the relevant data for this element
-         c_ElementData.resize(u32_SizeElement);
-         //lint -e{419} //std::vector reference returned by [] is linear; we allocated enough memory
-         (void)std::memcpy(&c_ElementData[0], &orc_Values[u32_Index], u32_SizeElement);
-
          //we have data
-         //convert to native endianness depending on the type ...
+         //convert the relevant part of the dump to native endianness depending on the type ...
          //no possible problem we did not check for already ...
+         //lint -e{419} //std::vector reference returned by [] is linear; we checked the size above
          if (this->mpc_DiagProtocol->GetEndianness() == C_OSCDiagProtocolBase::mhu8_ENDIANNESS_BIG)
          {
-            (void)pc_Element->c_NvmValue.SetValueFromBigEndianBlob(c_ElementData);
+            (void)pc_Element->c_NvmValue.SetValueFromBigEndianBlob(&orc_Values[u32_Index], u32_SizeElement);
          }
          else
          {
-            (void)pc_Element->c_NvmValue.SetValueFromLittleEndianBlob(c_ElementData);
+            (void)pc_Element->c_NvmValue.SetValueFromLittleEndianBlob(&orc_Values[u32_Index], u32_SizeElement);
          }
          pc_Element->q_NvmValueIsValid = true;
       }
@@ -41,6 +41,9 @@ public:
 protected:
    stw_types::sint32 m_NvmReadListRaw(const C_OSCNodeDataPoolList & orc_List,
                                       std::vector<stw_types::uint8> & orc_Values, stw_types::uint8 * const opu8_NrCode);
+   stw_types::sint32 m_NvmReadListsRaw(const std::vector<const C_OSCNodeDataPoolList *> & orc_Lists,
+                                       std::vector<std::vector<stw_types::uint8> > & orc_Values,
+                                       stw_types::uint8 * const opu8_NrCode);
    stw_types::sint32 m_SaveDumpToList(std::vector<stw_types::uint8> & orc_Values,
                                       C_OSCNodeDataPoolList & orc_List) const;
    stw_types::sint32 m_SaveDumpValuesToListValues(std::vector<stw_types::uint8> & orc_Values,
@@ -395,6 +395,7 @@ sint32 C_OSCDataDealerNvmSafe::NvmSafeWriteChangedValues(
    "NvmSafeWriteChangedValues". The function stores the read values in the copy of
    the original "C_OSCNode" instance of "C_OSCDataDealer".
    Read values are marked by setting the "Valid" flag to true.
+   Changed lists located next to each other in NVM are read with combined requests.
 
    \param[out] orpc_NodeCopy Parameter to access the read values
    \param[out] opu8_NrCode   if != NULL: negative response code in case of an error response
@@ -432,8 +433,12 @@ sint32 C_OSCDataDealerNvmSafe::NvmSafeReadValues(const C_OSCNode * (&orpc_NodeCo
       if (this->mc_ChangedLists.size() > 0)
       {
          std::set<C_OSCNodeDataPoolListId>::const_iterator c_ItChangedList;
+         std::vector<C_OSCNodeDataPoolList *> c_Lists;
 
-         // Read all changed lists
+         s32_Return = C_NO_ERR;
+         c_Lists.reserve(this->mc_ChangedLists.size());
+
+         // Check all changed lists before starting the communication
          for (c_ItChangedList = this->mc_ChangedLists.begin();
               c_ItChangedList != this->mc_ChangedLists.end();
               ++c_ItChangedList)
@@ -445,7 +450,6 @@ sint32 C_OSCDataDealerNvmSafe::NvmSafeReadValues(const C_OSCNode * (&orpc_NodeCo
                C_OSCNodeDataPoolList & rc_List =
                   this->mc_NodeCopy.c_DataPools[(*c_ItChangedList).u32_DataPoolIndex].c_Lists[(*c_ItChangedList).
                                                                                               u32_ListIndex];
-               std::vector<uint8> c_Values;
                uint32 u32_ElementCounter;
 
                // Reset of all valid flags
@@ -453,30 +457,34 @@ sint32 C_OSCDataDealerNvmSafe::NvmSafeReadValues(const C_OSCNode * (&orpc_NodeCo
                {
                   rc_List.c_Elements[u32_ElementCounter].q_NvmValueIsValid = false;
                }
-
-               s32_Return = this->m_NvmReadListRaw(rc_List, c_Values, opu8_NrCode);
-
-               if (s32_Return == C_NO_ERR)
-               {
-                  // Store the read values into the copy without checking and updating the CRC.
-                  // The valid flag will be set to true if the element was read
-                  s32_Return = this->m_SaveDumpValuesToListValues(c_Values, rc_List);
-
-                  if (s32_Return == C_RD_WR)
-                  {
-                     // Remap the error
-                     s32_Return = C_RANGE;
-                  }
-               }
+               c_Lists.push_back(&rc_List);
             }
             else
             {
                s32_Return = C_RANGE;
+               break;
             }
+         }
 
-            if (s32_Return != C_NO_ERR)
+         if (s32_Return == C_NO_ERR)
+         {
+            // Read all changed lists; lists located next to each other in NVM are read in one go
+            const std::vector<const C_OSCNodeDataPoolList *> c_ConstLists(c_Lists.begin(), c_Lists.end());
+            std::vector<std::vector<uint8> > c_Values;
+
+            s32_Return = this->m_NvmReadListsRaw(c_ConstLists, c_Values, opu8_NrCode);
+
+            for (uint32 u32_ItList = 0U; (u32_ItList < c_Lists.size()) && (s32_Return == C_NO_ERR); ++u32_ItList)
             {
-               break;
+               // Store the read values into the copy without checking and updating the CRC.
+               // The valid flag will be set to true if the element was read
+               s32_Return = this->m_SaveDumpValuesToListValues(c_Values[u32_ItList], *c_Lists[u32_ItList]);
+
+               if (s32_Return == C_RD_WR)
+               {
+                  // Remap the error
+                  s32_Return = C_RANGE;
+               }
             }
          }
       }
@@ -769,7 +777,9 @@ sint32 C_OSCDataDealerNvmSafe::NvmSafeReadParameterValues(const std::vector<C_OS
             }
             if (s32_Retval == C_NO_ERR)
             {
+               std::vector<std::vector<uint8> > c_ListValues;
                //Read list values
+               s32_Retval = this->m_ReadParameterLists(orc_ListIds, c_ListValues, opu8_NrCode);
                for (uint32 u32_ItList = 0; (u32_ItList < orc_ListIds.size()) && (s32_Retval == C_NO_ERR); ++u32_ItList)
                {
                   const C_OSCNodeDataPoolListId & rc_DataPoolListId = orc_ListIds[u32_ItList];
@@ -782,7 +792,8 @@ sint32 C_OSCDataDealerNvmSafe::NvmSafeReadParameterValues(const std::vector<C_OS
                      {
                         C_OSCParamSetRawEntry c_RawEntry;
                         C_OSCNodeDataPoolList & rc_List = rc_DataPool.c_Lists[rc_DataPoolListId.u32_ListIndex];
-                        s32_Retval = m_CreateRawEntryAndPrepareInterpretedData(rc_List, c_RawEntry, opu8_NrCode);
+                        s32_Retval = m_CreateRawEntryAndPrepareInterpretedData(rc_List, c_ListValues[u32_ItList],
+                                                                               c_RawEntry);
                         c_RawNode.c_Entries.push_back(c_RawEntry);
                      }
                      else
@@ -1489,77 +1500,103 @@ sint32 C_OSCDataDealerNvmSafe::m_CheckParameterFileContent(const C_OSCParamSetRa
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Create raw entry for list and write bytes to interpreted data
+/*! \brief   Read the dumps of all lists of a parameter set
 
-   \param[in]  orc_List    List to set raw entry from
-   \param[out] orc_Entry   Raw entry from list
-   \param[out] opu8_NrCode if != NULL: negative response code in case of an error response
+   Lists located next to each other in NVM are read in one go.
+   The list IDs must have been checked by the caller.
+
+   \param[in]  orc_ListIds    List IDs
+   \param[out] orc_Values     List dumps (one entry per list ID)
+   \param[out] opu8_NrCode    if != NULL: negative response code in case of an error response
 
    \return
-   C_NO_ERR   Entry successfully created
-   C_RANGE    List has no elements. Nothing to read.
-              Datapool element size configuration does not match with count of read bytes
+   C_NO_ERR   Lists read
+   C_RANGE    At least one list has no elements. Nothing to read.
    C_TIMEOUT  Expected response not received within timeout
    C_NOACT    Could not send request (e.g. Tx buffer full)
    C_WARN     Error response or malformed protocol response
-   C_CONFIG   Pre-requisites not correct; e.g. driver not initialized or
-              parameter out of range (checked by client side)
-   C_RD_WR    Datapool element size configuration does not match with count of read bytes
-   C_CHECKSUM Checksum of read datapool list is invalid
-   C_COM      expected server response not received because of communication error
+   C_UNKNOWN_ERR  Not documented error
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCDataDealerNvmSafe::m_CreateRawEntryAndPrepareInterpretedData(C_OSCNodeDataPoolList & orc_List,
-                                                                         C_OSCParamSetRawEntry & orc_Entry,
-                                                                         uint8 * const opu8_NrCode)
+sint32 C_OSCDataDealerNvmSafe::m_ReadParameterLists(const std::vector<C_OSCNodeDataPoolListId> & orc_ListIds,
+                                                    std::vector<std::vector<uint8> > & orc_Values,
+                                                    uint8 * const opu8_NrCode)
 {
-   std::vector<uint8> c_Values;
-   sint32 s32_Retval = this->m_NvmReadListRaw(orc_List, c_Values, opu8_NrCode);
-   if (s32_Retval == C_NO_ERR)
+   sint32 s32_Retval;
+   std::vector<const C_OSCNodeDataPoolList *> c_Lists;
+
+   c_Lists.reserve(orc_ListIds.size());
+   for (uint32 u32_ItList = 0; u32_ItList < orc_ListIds.size(); ++u32_ItList)
    {
-      //Raw
-      orc_Entry.u32_StartAddress = orc_List.u32_NvMStartAddress;
-      orc_Entry.c_Bytes = c_Values;
-      s32_Retval = this->m_SaveDumpToList(c_Values, orc_List);
-      if (s32_Retval != C_NO_ERR)
-      {
-         //Translate error values if necessary
-         switch (s32_Retval)
-         {
-         case C_RD_WR:
-            s32_Retval = C_RANGE;
-            break;
-         case C_CHECKSUM:
-            s32_Retval = C_CHECKSUM;
-            break;
-         case C_NO_ERR: //Unexpected
-         default:
-            //Not documented error was returned by function
-            s32_Retval = C_UNKNOWN_ERR;
-            osc_write_log_info("parametrization",
-                               "Not documented error was returned by m_InterpretDumbToList");
-         }
-      }
+      const C_OSCNodeDataPoolListId & rc_DataPoolListId = orc_ListIds[u32_ItList];
+      c_Lists.push_back(&this->mpc_Node->c_DataPools[rc_DataPoolListId.u32_DataPoolIndex].c_Lists[rc_DataPoolListId.
+                                                                                                 u32_ListIndex]);
    }
-   else
+
+   s32_Retval = this->m_NvmReadListsRaw(c_Lists, orc_Values, opu8_NrCode);
+
+   //Translate error values if necessary
+   switch (s32_Retval)
+   {
+   case C_NO_ERR:
+   case C_TIMEOUT:
+   case C_WARN:
+   case C_NOACT:
+      //Same error value
+      break;
+   case C_OVERFLOW:
+      s32_Retval = C_RANGE;
+      break;
+   default:
+      //Not documented error was returned by function
+      s32_Retval = C_UNKNOWN_ERR;
+      osc_write_log_info("parametrization",
+                         "Not documented error was returned by m_NvmReadListsRaw");
+      break;
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create raw entry for list and write bytes to interpreted data
+
+   \param[in,out] orc_List    List to set raw entry from
+   \param[in]     orc_Values  Dump of list read from ECU
+   \param[out]    orc_Entry   Raw entry from list
+
+   \return
+   C_NO_ERR   Entry successfully created
+   C_RANGE    Datapool element size configuration does not match with count of read bytes
+   C_CHECKSUM Checksum of read datapool list is invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCDataDealerNvmSafe::m_CreateRawEntryAndPrepareInterpretedData(C_OSCNodeDataPoolList & orc_List,
+                                                                         std::vector<uint8> & orc_Values,
+                                                                         C_OSCParamSetRawEntry & orc_Entry) const
+{
+   //Raw
+   sint32 s32_Retval;
+
+   orc_Entry.u32_StartAddress = orc_List.u32_NvMStartAddress;
+   orc_Entry.c_Bytes = orc_Values;
+   s32_Retval = this->m_SaveDumpToList(orc_Values, orc_List);
+   if (s32_Retval != C_NO_ERR)
    {
       //Translate error values if necessary
       switch (s32_Retval)
       {
-      case C_TIMEOUT:
-      case C_WARN:
-      case C_NOACT:
-         //Same error value
-         break;
-      case C_OVERFLOW:
+      case C_RD_WR:
          s32_Retval = C_RANGE;
          break;
-      case C_NO_ERR: //Unexpected
+      case C_CHECKSUM:
+         s32_Retval = C_CHECKSUM;
+         break;
       default:
          //Not documented error was returned by function
          s32_Retval = C_UNKNOWN_ERR;
          osc_write_log_info("parametrization",
-                            "Not documented error was returned by m_NvmReadListRaw");
+                            "Not documented error was returned by m_InterpretDumbToList");
+         break;
       }
    }
    return s32_Retval;
@@ -18,7 +18,6 @@
 #include "stwerrors.h"
 
 #include "C_OSCUtils.h"
-#include "CSCLStringList.h"
 #include "C_OSCExportCommunicationStack.h"
 #include "C_OSCLoggingHandler.h"
 #include "C_OSCExportUti.h"
@@ -251,7 +250,7 @@ sint32 C_OSCExportCommunicationStack::mh_CreateHeaderFile(const C_SCLString & or
                                                           const C_SCLString & orc_ProjectId)
 {
    sint32 s32_Retval;
-   C_SCLStringList c_Data;
+   C_OSCExportCodeWriter c_Data;
 
    c_Data.Clear();
 
@@ -328,7 +327,7 @@ sint32 C_OSCExportCommunicationStack::mh_CreateImplementationFile(const C_SCLStr
    if ((C_OSCCanProtocol::h_GetComListIndex(orc_DataPool, ou8_InterfaceIndex, true, u32_TxListIndex) == C_NO_ERR) &&
        (C_OSCCanProtocol::h_GetComListIndex(orc_DataPool, ou8_InterfaceIndex, false, u32_RxListIndex) == C_NO_ERR))
    {
-      C_SCLStringList c_Data;
+      C_OSCExportCodeWriter c_Data;
       const bool q_TxMessagesPresent =
          (orc_ComProtocol.c_ComMessages[ou8_InterfaceIndex].c_TxMessages.size() > 0) ? true : false;
       const bool q_RxMessagesPresent =
@@ -383,13 +382,14 @@ sint32 C_OSCExportCommunicationStack::mh_CreateImplementationFile(const C_SCLStr
 /*! \brief   Add file header
 
    \param[in]      orc_ExportToolInfo  information about calling executable (name + version)
-   \param[in,out]  orc_Data            converted data to string list
+   \param[in,out]  orc_Data            converted data
    \param[in]      ou8_InterfaceIndex  index of interface
    \param[in]      ore_Protocol        protocol type (CL2, ECeS, ECoS)
    \param[in]      oq_FileType         .c or .h file selected
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C_SCLStringList & orc_Data,
+void C_OSCExportCommunicationStack::mh_AddHeader(const C_SCLString & orc_ExportToolInfo,
+                                                 C_OSCExportCodeWriter & orc_Data,
                                                  const uint8 ou8_InterfaceIndex,
                                                  const C_OSCCanProtocol::E_Type & ore_Protocol, const bool oq_FileType)
 {
@@ -428,14 +428,15 @@ void C_OSCExportCommunicationStack::mh_AddHeader(const C_SCLString & orc_ExportT
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add includes into C file
 
-   \param[in,out]  orc_Data            converted data to string list
+   \param[in,out]  orc_Data            converted data
    \param[in]      orc_DataPool        name of Datapool
    \param[in]      ou8_InterfaceIndex  index of interface
    \param[in]      ore_Protocol        protocol type (CL2, ECeS, ECoS)
    \param[in]      oq_NullRequired     true: definition of NULL required in .c file
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddCIncludes(C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+void C_OSCExportCommunicationStack::mh_AddCIncludes(C_OSCExportCodeWriter & orc_Data,
+                                                    const C_OSCNodeDataPool & orc_DataPool,
                                                     const uint8 ou8_InterfaceIndex,
                                                     const C_OSCCanProtocol::E_Type & ore_Protocol,
                                                     const bool oq_NullRequired)
@@ -462,7 +463,7 @@ void C_OSCExportCommunicationStack::mh_AddCIncludes(C_SCLStringList & orc_Data,
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add defines
 
-   \param[in,out]  orc_Data               converted data to string list
+   \param[in,out]  orc_Data               converted data
    \param[in]      orc_ComMessage         communication protocol message definition
    \param[in]      ou8_InterfaceIndex     index of interface
    \param[in]      ore_Protocol           protocol type (CL2, ECeS, ECoS)
@@ -471,7 +472,7 @@ void C_OSCExportCommunicationStack::mh_AddCIncludes(C_SCLStringList & orc_Data,
    \param[in]      oq_FileType            .c or .h file selected
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddDefines(C_SCLStringList & orc_Data,
+void C_OSCExportCommunicationStack::mh_AddDefines(C_OSCExportCodeWriter & orc_Data,
                                                   const C_OSCCanMessageContainer & orc_ComMessage,
                                                   const uint8 ou8_InterfaceIndex,
                                                   const C_OSCCanProtocol::E_Type & ore_Protocol,
@@ -614,7 +615,7 @@ void C_OSCExportCommunicationStack::mh_AddDefines(C_SCLStringList & orc_Data,
 
    Implementation file .C only.
 
-   \param[in,out]  orc_Data               converted data to string list
+   \param[in,out]  orc_Data               converted data
    \param[in]      oq_SafeData            true: place status data in safe RAM
    \param[in]      orc_ComMessage         communication protocol message definition
    \param[in]      ou8_InterfaceIndex     index of interface
@@ -624,7 +625,7 @@ void C_OSCExportCommunicationStack::mh_AddDefines(C_SCLStringList & orc_Data,
    \param[in]      ou32_RxListIndex       Datapool list index for Rx messages
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddCModuleGlobal(C_SCLStringList & orc_Data, const bool oq_SafeData,
+void C_OSCExportCommunicationStack::mh_AddCModuleGlobal(C_OSCExportCodeWriter & orc_Data, const bool oq_SafeData,
                                                         const C_OSCCanMessageContainer & orc_ComMessage,
                                                         const uint8 ou8_InterfaceIndex,
                                                         const C_OSCCanProtocol::E_Type & ore_Protocol,
@@ -748,7 +749,7 @@ void C_OSCExportCommunicationStack::mh_AddCModuleGlobal(C_SCLStringList & orc_Da
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add global variables
 
-   \param[in,out]  orc_Data               converted data to string list
+   \param[in,out]  orc_Data               converted data
    \param[in]      orc_DataPoolName       name of Datapool
    \param[in]      ou8_InterfaceIndex     index of interface
    \param[in]      ore_Protocol           protocol type (CL2, ECeS, ECoS)
@@ -756,7 +757,7 @@ void C_OSCExportCommunicationStack::mh_AddCModuleGlobal(C_SCLStringList & orc_Da
    \param[in]      oq_RxMessagesPresent   true: There is at least one Rx message defined
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddCGlobalVariables(C_SCLStringList & orc_Data,
+void C_OSCExportCommunicationStack::mh_AddCGlobalVariables(C_OSCExportCodeWriter & orc_Data,
                                                            const C_SCLString & orc_DataPoolName,
                                                            const uint8 ou8_InterfaceIndex,
                                                            const C_OSCCanProtocol::E_Type & ore_Protocol,
@@ -830,7 +831,7 @@ void C_OSCExportCommunicationStack::mh_AddCGlobalVariables(C_SCLStringList & orc
    \param[in]      ou16_GenCodeVersion    version of structure (generate code as specified for this version)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddSignalDefinitions(C_SCLStringList & orc_Data,
+void C_OSCExportCommunicationStack::mh_AddSignalDefinitions(C_OSCExportCodeWriter & orc_Data,
                                                             const uint32 ou32_SignalListIndex,
                                                             const std::vector<C_OSCCanMessage> & orc_Messages,
                                                             const stw_types::uint16 ou16_GenCodeVersion)
@@ -852,7 +853,7 @@ void C_OSCExportCommunicationStack::mh_AddSignalDefinitions(C_SCLStringList & or
             // get signals grouped by mux value
             mh_GroupSignalsByMuxValue(rc_Message, u32_MultiplexerIndex, c_SignalsPerValue);
 
-            // add signal definitions to data string list
+            // add signal definitions to data
             for (c_ItValue = c_SignalsPerValue.begin(); c_ItValue != c_SignalsPerValue.end(); ++c_ItValue)
             {
                // skip no-mux signals
@@ -904,7 +905,7 @@ void C_OSCExportCommunicationStack::mh_AddSignalDefinitions(C_SCLStringList & or
    \param[in]      orc_TxRxString   "Tx" or "Rx"
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddMessageMuxDefinitions(C_SCLStringList & orc_Data,
+void C_OSCExportCommunicationStack::mh_AddMessageMuxDefinitions(C_OSCExportCodeWriter & orc_Data,
                                                                 const std::vector<C_OSCCanMessage> & orc_Messages,
                                                                 const C_SCLString & orc_TxRxString)
 {
@@ -932,7 +933,7 @@ void C_OSCExportCommunicationStack::mh_AddMessageMuxDefinitions(C_SCLStringList
          // get signals grouped by mux value
          mh_GroupSignalsByMuxValue(rc_Message, u32_MultiplexerIndex, c_SignalsPerValue);
 
-         // add signal definitions to data string list
+         // add signal definitions to data
          for (c_ItValue = c_SignalsPerValue.begin(); c_ItValue != c_SignalsPerValue.end(); ++c_ItValue)
          {
             // skip no-mux signals
@@ -978,7 +979,8 @@ void C_OSCExportCommunicationStack::mh_AddMessageMuxDefinitions(C_SCLStringList
    \param[in]      oq_Tx                  true: messages are Tx, false: messages are Rx
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_AddMessageDefinitions(C_SCLStringList & orc_Data, const uint8 ou8_InterfaceIndex,
+void C_OSCExportCommunicationStack::mh_AddMessageDefinitions(C_OSCExportCodeWriter & orc_Data,
+                                                             const uint8 ou8_InterfaceIndex,
                                                              const C_OSCCanProtocol::E_Type & ore_Protocol,
                                                              const std::vector<C_OSCCanMessage> & orc_Messages,
                                                              const uint16 ou16_GenCodeVersion, const bool oq_Tx)
@@ -1274,13 +1276,13 @@ C_SCLString C_OSCExportCommunicationStack::mh_GetMagicName(const C_SCLString & o
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Utility function for creating signal declarations
 
-   \param[in,out]  orc_Data               converted data to string list
+   \param[in,out]  orc_Data               converted data
    \param[in]      orc_Signals            list of signals for creating signal declarations for
    \param[in]      ou32_SignalListIndex   index of Datapool list containing signals
    \param[in]      oq_RemoveLastComma     flag to handle comma (very last signals string should not end on comma)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportCommunicationStack::mh_ConvertSignalsToStrings(C_SCLStringList & orc_Data,
+void C_OSCExportCommunicationStack::mh_ConvertSignalsToStrings(C_OSCExportCodeWriter & orc_Data,
                                                                const std::vector<C_OSCCanSignal> & orc_Signals,
                                                                const uint32 ou32_SignalListIndex,
                                                                const bool oq_RemoveLastComma)
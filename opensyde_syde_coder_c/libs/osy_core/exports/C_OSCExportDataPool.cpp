@@ -16,7 +16,6 @@
 #include "stwtypes.h"
 #include "stwerrors.h"
 
-#include "CSCLStringList.h"
 #include "C_OSCExportDataPool.h"
 #include "C_OSCNodeDataPoolContent.h"
 #include "C_OSCUtils.h"
@@ -225,7 +224,7 @@ sint32 C_OSCExportDataPool::mh_CreateHeaderFile(const C_SCLString & orc_ExportTo
                                                 const C_OSCNodeCodeExportSettings::E_Scaling oe_ScalingSupport)
 {
    sint32 s32_Retval;
-   C_SCLStringList c_Data;
+   C_OSCExportCodeWriter c_Data;
 
    // add header
    mh_AddHeader(orc_ExportToolInfo, c_Data, orc_DataPool, mhq_IS_HEADER_FILE);
@@ -285,7 +284,7 @@ sint32 C_OSCExportDataPool::mh_CreateImplementationFile(const C_SCLString & orc_
                                                         const E_Linkage oe_Linkage)
 {
    sint32 s32_Retval;
-   C_SCLStringList c_Data;
+   C_OSCExportCodeWriter c_Data;
 
    // add header
    mh_AddHeader(orc_ExportToolInfo, c_Data, orc_DataPool, mhq_IS_IMPLEMENTATION_FILE);
@@ -322,12 +321,12 @@ sint32 C_OSCExportDataPool::mh_CreateImplementationFile(const C_SCLString & orc_
 /*! \brief   Add file header
 
    \param[in]  orc_ExportToolInfo       information about calling executable (name + version)
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  oq_FileType              .c or .h file selected
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C_SCLStringList & orc_Data,
+void C_OSCExportDataPool::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C_OSCExportCodeWriter & orc_Data,
                                        const C_OSCNodeDataPool & orc_DataPool, const bool oq_FileType)
 {
    orc_Data.Append(C_OSCExportUti::h_GetHeaderSeparator());
@@ -365,12 +364,12 @@ void C_OSCExportDataPool::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add includes
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  oq_FileType              .c or .h file selected
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddIncludes(C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+void C_OSCExportDataPool::mh_AddIncludes(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                          const bool oq_FileType)
 {
    orc_Data.Append("");
@@ -394,7 +393,7 @@ void C_OSCExportDataPool::mh_AddIncludes(C_SCLStringList & orc_Data, const C_OSC
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add defines for header file
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  ou8_DataPoolIndex        index of Datapool
    \param[in]  orc_ProjectId            project id for consistency check
@@ -408,7 +407,8 @@ void C_OSCExportDataPool::mh_AddIncludes(C_SCLStringList & orc_Data, const C_OSC
    C_CONFIG Datapool list element factor negative or would be generated as zero
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_OSCExportCodeWriter & orc_Data,
+                                                const C_OSCNodeDataPool & orc_DataPool,
                                                 const uint8 ou8_DataPoolIndex, const C_SCLString & orc_ProjectId,
                                                 const uint16 ou16_GenCodeVersion, const E_Linkage oe_Linkage,
                                                 const C_OSCNodeCodeExportSettings::E_Scaling oe_ScalingSupport)
@@ -429,12 +429,16 @@ sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, cons
 
    if ((oe_Linkage == eLOCAL) || ((ou16_GenCodeVersion >= 4U) && (oe_Linkage == eREMOTEPUBLIC)))
    {
+      const C_SCLString c_ListIndexPrefix = "#define " + c_DataPoolName + "_LIST_INDEX_";
+
       orc_Data.Append("///Index of lists");
       for (u16_ListIndex = 0U; u16_ListIndex < orc_DataPool.c_Lists.size(); u16_ListIndex++)
       {
-         const C_SCLString c_ListName = orc_DataPool.c_Lists[u16_ListIndex].c_Name.UpperCase();
-         orc_Data.Append("#define " + c_DataPoolName + "_LIST_INDEX_" + c_ListName + " (" +
-                         C_SCLString::IntToStr(u16_ListIndex) + "U)");
+         orc_Data.WriteText(c_ListIndexPrefix);
+         orc_Data.WriteText(orc_DataPool.c_Lists[u16_ListIndex].c_Name.UpperCase());
+         orc_Data.WriteText(" (");
+         orc_Data.WriteUnsigned(u16_ListIndex);
+         orc_Data.Append("U)");
       }
       orc_Data.Append("#define " + c_DataPoolName + "_NUMBER_OF_LISTS " + "(" + C_SCLString::IntToStr(
                          u16_ListIndex) + "U)");
@@ -445,11 +449,14 @@ sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, cons
       {
          const C_OSCNodeDataPoolList & rc_List = orc_DataPool.c_Lists[u16_ListIndex];
          const C_SCLString c_ListName = rc_List.c_Name.UpperCase();
+         const C_SCLString c_ElementIndexPrefix = "#define " + c_DataPoolName + "_ELEM_INDEX_" + c_ListName + "_";
          for (uint16 u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
          {
-            const C_SCLString c_ElementName = rc_List.c_Elements[u16_ElementIndex].c_Name.UpperCase();
-            orc_Data.Append("#define " + c_DataPoolName + "_ELEM_INDEX_" + c_ListName + "_" + c_ElementName +
-                            " (" + C_SCLString::IntToStr(u16_ElementIndex) + "U)");
+            orc_Data.WriteText(c_ElementIndexPrefix);
+            orc_Data.WriteText(rc_List.c_Elements[u16_ElementIndex].c_Name.UpperCase());
+            orc_Data.WriteText(" (");
+            orc_Data.WriteUnsigned(u16_ElementIndex);
+            orc_Data.Append("U)");
          }
          orc_Data.Append("#define " + c_DataPoolName + "_" + c_ListName + "_NUMBER_OF_ELEMENTS " + "(" +
                          C_SCLString::IntToStr(rc_List.c_Elements.size()) + "U)");
@@ -490,27 +497,32 @@ sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, cons
             const C_SCLString c_FloatType = (oe_ScalingSupport == C_OSCNodeCodeExportSettings::eFLOAT64) ? "" : "F";
             for (uint16 u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
             {
-               const C_SCLString c_ElementName = rc_List.c_Elements[u16_ElementIndex].c_Name.UpperCase();
-               const C_SCLString c_Factor =
-                  C_OSCExportUti::h_FloatToStrCutZeroes(rc_List.c_Elements[u16_ElementIndex].f64_Factor);
+               const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
+               const C_SCLString c_ElementName = rc_Element.c_Name.UpperCase();
 
-               if ((rc_List.c_Elements[u16_ElementIndex].f64_Factor <= 0.0) || (c_Factor == "0.0"))
+               //WriteFloat prints 6 decimals, so factors up to 5.0e-7 would be generated as 0.0
+               if (rc_Element.f64_Factor <= 5.0e-7)
                {
                   osc_write_log_error("Creating source code",
                                       "Did not generate code because factor of element \"" + orc_DataPool.c_Name +
-                                      "::" + rc_List.c_Name + "::" + rc_List.c_Elements[u16_ElementIndex].c_Name +
+                                      "::" + rc_List.c_Name + "::" + rc_Element.c_Name +
                                       "\" is negative or would be generated as 0.0.");
                   s32_Retval = C_CONFIG;
                }
 
-               orc_Data.Append("#define " +
-                               mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, true) +
-                               " (" + c_Factor + c_FloatType + ")");
-
-               orc_Data.Append("#define " +
-                               mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, false) + " (" +
-                               C_OSCExportUti::h_FloatToStrCutZeroes(rc_List.c_Elements[u16_ElementIndex].f64_Offset) +
-                               c_FloatType + ")");
+               orc_Data.WriteText("#define ");
+               orc_Data.WriteText(mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, true));
+               orc_Data.WriteText(" (");
+               orc_Data.WriteFloat(rc_Element.f64_Factor);
+               orc_Data.WriteText(c_FloatType);
+               orc_Data.Append(")");
+
+               orc_Data.WriteText("#define ");
+               orc_Data.WriteText(mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, false));
+               orc_Data.WriteText(" (");
+               orc_Data.WriteFloat(rc_Element.f64_Offset);
+               orc_Data.WriteText(c_FloatType);
+               orc_Data.Append(")");
             }
             if (rc_List.c_Elements.size() > 0)
             {
@@ -523,25 +535,33 @@ sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, cons
          {
             const C_OSCNodeDataPoolList & rc_List = orc_DataPool.c_Lists[u16_ListIndex];
             const C_SCLString c_ListName = rc_List.c_Name.UpperCase();
+            const C_SCLString c_SetterPrefix = "#define " + c_DataPoolName + "_SET_VALUE_FROM_SCALED_" + c_ListName +
+                                               "_";
+            const C_SCLString c_GetterPrefix = "#define " + c_DataPoolName + "_GET_SCALED_VALUE_" + c_ListName + "_";
+            C_SCLString c_ListStruct;
+
+            if ((ou16_GenCodeVersion >= 4U) && (oe_Linkage == eREMOTEPUBLIC))
+            {
+               c_ListStruct = "gpt_" + orc_DataPool.c_Name + "_DataPoolValues->";
+            }
+            else
+            {
+               c_ListStruct = "gt_" + orc_DataPool.c_Name + "_DataPoolValues.";
+            }
+            c_ListStruct += "t_" + rc_List.c_Name + "Values.";
+
             for (uint16 u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
             {
                const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
                const C_SCLString c_ElementName = rc_Element.c_Name.UpperCase();
-               C_SCLString c_ElementStruct;
-               C_SCLString c_Makro;
-
-               if ((ou16_GenCodeVersion >= 4U) && (oe_Linkage == eREMOTEPUBLIC))
-               {
-                  c_ElementStruct = "gpt_" + orc_DataPool.c_Name + "_DataPoolValues->";
-               }
-               else
-               {
-                  c_ElementStruct = "gt_" + orc_DataPool.c_Name + "_DataPoolValues.";
-               }
-
-               c_ElementStruct += "t_" + rc_List.c_Name + "Values." +
-                                  C_OSCExportUti::h_GetTypePrefix(rc_Element.GetType(), rc_Element.GetArray()) +
-                                  "_" + rc_Element.c_Name;
+               const C_SCLString c_FactorDefine =
+                  mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, true);
+               const C_SCLString c_OffsetDefine =
+                  mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, false);
+               C_SCLString c_ElementStruct = c_ListStruct +
+                                             C_OSCExportUti::h_GetTypePrefix(rc_Element.GetType(),
+                                                                             rc_Element.GetArray()) +
+                                             "_" + rc_Element.c_Name;
 
                if (rc_Element.GetArray() == true)
                {
@@ -549,32 +569,36 @@ sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, cons
                }
 
                // setter
-               c_Makro = "#define " + c_DataPoolName + "_SET_VALUE_FROM_SCALED_" + c_ListName + "_" +
-                         c_ElementName + "(";
+               orc_Data.WriteText(c_SetterPrefix);
+               orc_Data.WriteText(c_ElementName);
+               orc_Data.WriteText("(");
                if (rc_Element.GetArray() == true)
                {
-                  c_Makro += "INDEX, ";
+                  orc_Data.WriteText("INDEX, ");
                }
-               c_Makro += "SCALED_VALUE) (" + c_ElementStruct + " = (SCALED_VALUE - " +
-                          mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, false) +
-                          ") / " + mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, true) +
-                          ")";
-
-               orc_Data.Append(c_Makro);
+               orc_Data.WriteText("SCALED_VALUE) (");
+               orc_Data.WriteText(c_ElementStruct);
+               orc_Data.WriteText(" = (SCALED_VALUE - ");
+               orc_Data.WriteText(c_OffsetDefine);
+               orc_Data.WriteText(") / ");
+               orc_Data.WriteText(c_FactorDefine);
+               orc_Data.Append(")");
 
                // getter
-               c_Makro = "#define " + c_DataPoolName + "_GET_SCALED_VALUE_" + c_ListName + "_" +
-                         c_ElementName + "(";
-
+               orc_Data.WriteText(c_GetterPrefix);
+               orc_Data.WriteText(c_ElementName);
+               orc_Data.WriteText("(");
                if (rc_Element.GetArray() == true)
                {
-                  c_Makro += "INDEX";
+                  orc_Data.WriteText("INDEX");
                }
-               c_Makro += ") ((" + c_ElementStruct +
-                          " * " + mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, true) +
-                          ") + " + mh_GetElementScaleDefine(c_DataPoolName, c_ListName, c_ElementName, false) +
-                          ")";
-               orc_Data.Append(c_Makro);
+               orc_Data.WriteText(") ((");
+               orc_Data.WriteText(c_ElementStruct);
+               orc_Data.WriteText(" * ");
+               orc_Data.WriteText(c_FactorDefine);
+               orc_Data.WriteText(") + ");
+               orc_Data.WriteText(c_OffsetDefine);
+               orc_Data.Append(")");
             }
 
             if (rc_List.c_Elements.size() > 0)
@@ -590,13 +614,13 @@ sint32 C_OSCExportDataPool::mh_AddDefinesHeader(C_SCLStringList & orc_Data, cons
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief Add defines for implementation file
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  orc_ProjectId            project id for consistency check
    \param[in]  ou16_GenCodeVersion      version of structure (generate code as specified for this version)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddDefinesImpl(C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+void C_OSCExportDataPool::mh_AddDefinesImpl(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                             const C_SCLString & orc_ProjectId, const uint16 ou16_GenCodeVersion)
 {
    const C_SCLString c_MagicName = mh_GetMagicName(orc_ProjectId, orc_DataPool);
@@ -622,13 +646,13 @@ void C_OSCExportDataPool::mh_AddDefinesImpl(C_SCLStringList & orc_Data, const C_
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add types
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  oq_FileType              .c or .h file selected
    \param[in]  oe_Linkage               flag for linkage context
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddTypes(C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+void C_OSCExportDataPool::mh_AddTypes(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                       const bool oq_FileType, const E_Linkage oe_Linkage)
 {
    orc_Data.Append(C_OSCExportUti::h_GetSectionSeparator("Types"));
@@ -648,25 +672,26 @@ void C_OSCExportDataPool::mh_AddTypes(C_SCLStringList & orc_Data, const C_OSCNod
             orc_Data.Append("typedef struct");
             orc_Data.Append("{");
 
+            orc_Data.IncIndent();
             for (uint16 u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
             {
                const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
-               const C_SCLString c_TypePrefix =
-                  C_OSCExportUti::h_GetTypePrefix(rc_Element.GetType(), rc_Element.GetArray());
-               const C_SCLString c_ElementType =  mh_GetType(rc_Element.GetType());
+               orc_Data.WriteText(mh_GetType(rc_Element.GetType()));
+               orc_Data.WriteText(" ");
+               orc_Data.WriteText(C_OSCExportUti::h_GetTypePrefix(rc_Element.GetType(), rc_Element.GetArray()));
+               orc_Data.WriteText("_");
+               orc_Data.WriteText(rc_Element.c_Name);
                if (rc_Element.GetArray() == true)
                {
-                  const C_SCLString c_String = C_SCLString::IntToStr(rc_Element.GetArraySize());
-                  orc_Data.Append("   " + c_ElementType + " " + c_TypePrefix + "_" + rc_Element.c_Name + "[" +
-                                  c_String + "]; /* " + C_OSCUtils::h_NiceifyStringForCComment(rc_Element.c_Comment) +
-                                  " */");
-               }
-               else
-               {
-                  orc_Data.Append("   " + c_ElementType + " " + c_TypePrefix + "_" + rc_Element.c_Name + "; /* " +
-                                  C_OSCUtils::h_NiceifyStringForCComment(rc_Element.c_Comment) + " */");
+                  orc_Data.WriteText("[");
+                  orc_Data.WriteUnsigned(rc_Element.GetArraySize());
+                  orc_Data.WriteText("]");
                }
+               orc_Data.WriteText("; /* ");
+               orc_Data.WriteText(C_OSCUtils::h_NiceifyStringForCComment(rc_Element.c_Comment));
+               orc_Data.Append(" */");
             }
+            orc_Data.DecIndent();
             orc_Data.Append("} T_" + orc_DataPool.c_Name + "_" + rc_List.c_Name + "_Values;");
             orc_Data.Append("");
          }
@@ -697,14 +722,15 @@ void C_OSCExportDataPool::mh_AddTypes(C_SCLStringList & orc_Data, const C_OSCNod
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add global variables
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  ou16_GenCodeVersion      version of structure (generate code as specified for this version)
    \param[in]  oq_FileType              .c or .h file selected
    \param[in]  oe_Linkage               flag for linkage context
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddGlobalVariables(C_SCLStringList & orc_Data,  const C_OSCNodeDataPool & orc_DataPool,
+void C_OSCExportDataPool::mh_AddGlobalVariables(C_OSCExportCodeWriter & orc_Data,
+                                                const C_OSCNodeDataPool & orc_DataPool,
                                                 const uint16 ou16_GenCodeVersion, const bool oq_FileType,
                                                 const E_Linkage oe_Linkage)
 {
@@ -790,7 +816,7 @@ void C_OSCExportDataPool::mh_AddGlobalVariables(C_SCLStringList & orc_Data,  con
 
    Implementation file only.
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  ou16_GenCodeVersion      version of structure (generate code as specified for this version)
    \param[in]  ou8_ProcessId            ID of process owning this Datapool
@@ -798,7 +824,7 @@ void C_OSCExportDataPool::mh_AddGlobalVariables(C_SCLStringList & orc_Data,  con
    \param[in]  oe_Linkage               flag for linkage context
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+void C_OSCExportDataPool::mh_AddModuleGlobal(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                              const uint16 ou16_GenCodeVersion, const uint8 ou8_ProcessId,
                                              const uint8 ou8_DataPoolIndexRemote, const E_Linkage oe_Linkage)
 {
@@ -824,89 +850,62 @@ void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C
 
       for (u16_ListIndex = 0U; u16_ListIndex < orc_DataPool.c_Lists.size(); u16_ListIndex++)
       {
-         C_OSCNodeDataPoolList c_List = orc_DataPool.c_Lists[u16_ListIndex];
-         if (c_List.c_Elements.size() != 0)
+         const C_OSCNodeDataPoolList & rc_List = orc_DataPool.c_Lists[u16_ListIndex];
+         if (rc_List.c_Elements.size() != 0)
          {
             orc_Data.Append("///Minimum values");
-            orc_Data.Append("static const T_" + orc_DataPool.c_Name + "_" + c_List.c_Name + "_Values mt_" +
-                            c_List.c_Name + "MinValues =");
+            orc_Data.Append("static const T_" + orc_DataPool.c_Name + "_" + rc_List.c_Name + "_Values mt_" +
+                            rc_List.c_Name + "MinValues =");
             orc_Data.Append("{");
-            for (u16_ElementIndex = 0U; u16_ElementIndex < c_List.c_Elements.size(); u16_ElementIndex++)
+            orc_Data.IncIndent();
+            for (u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
             {
-               const C_OSCNodeDataPoolListElement & rc_Element = c_List.c_Elements[u16_ElementIndex];
-               c_String = "   " + mh_GetElementValueString(rc_Element.c_MinValue,
-                                                           rc_Element.GetType(), rc_Element.GetArray());
-               if (u16_ElementIndex == (c_List.c_Elements.size() - 1U))
-               {
-                  c_String += " ";
-               }
-               else
-               {
-                  c_String += ",";
-               }
-               c_String += ("   ///< " + rc_Element.c_Name + " (" +
-                            C_OSCUtils::h_NiceifyStringForCComment(rc_Element.c_Comment) + ")");
-               orc_Data.Append(c_String);
+               const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
+               mh_AddElementValueLine(orc_Data, rc_Element, rc_Element.c_MinValue,
+                                      u16_ElementIndex == (rc_List.c_Elements.size() - 1U));
             }
+            orc_Data.DecIndent();
             orc_Data.Append("};");
             orc_Data.Append("");
             orc_Data.Append("///Maximum values");
-            orc_Data.Append("static const T_" + orc_DataPool.c_Name + "_" + c_List.c_Name + "_Values mt_" +
-                            c_List.c_Name + "MaxValues =");
+            orc_Data.Append("static const T_" + orc_DataPool.c_Name + "_" + rc_List.c_Name + "_Values mt_" +
+                            rc_List.c_Name + "MaxValues =");
             orc_Data.Append("{");
-            for (u16_ElementIndex = 0U; u16_ElementIndex < c_List.c_Elements.size(); u16_ElementIndex++)
+            orc_Data.IncIndent();
+            for (u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
             {
-               const C_OSCNodeDataPoolListElement & rc_Element = c_List.c_Elements[u16_ElementIndex];
-               c_String = "   " + mh_GetElementValueString(rc_Element.c_MaxValue,
-                                                           rc_Element.GetType(), rc_Element.GetArray());
-               if (u16_ElementIndex == (c_List.c_Elements.size() - 1U))
-               {
-                  c_String += " ";
-               }
-               else
-               {
-                  c_String += ",";
-               }
-               c_String += ("   ///< " + rc_Element.c_Name + " (" +
-                            C_OSCUtils::h_NiceifyStringForCComment(rc_Element.c_Comment) + ")");
-               orc_Data.Append(c_String);
+               const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
+               mh_AddElementValueLine(orc_Data, rc_Element, rc_Element.c_MaxValue,
+                                      u16_ElementIndex == (rc_List.c_Elements.size() - 1U));
             }
+            orc_Data.DecIndent();
             orc_Data.Append("};");
             orc_Data.Append("");
 
-            if (c_List.c_DataSets.size() > 0)
+            if (rc_List.c_DataSets.size() > 0)
             {
                uint8 u8_DataSetIndex;
                orc_Data.Append("///Dataset values");
-               c_ListName = c_List.c_Name;
-               orc_Data.Append("static const T_" + c_DataPoolName + "_" + c_List.c_Name + "_Values mat_" + c_List.c_Name +
-                               "DataSetValues [" + c_DataPoolName.UpperCase() + "_" + c_ListName.UpperCase() +
-                               "_NUMBER_OF_DATA_SETS] =");
-               orc_Data.Add("{");
+               c_ListName = rc_List.c_Name;
+               orc_Data.Append("static const T_" + c_DataPoolName + "_" + rc_List.c_Name + "_Values mat_" +
+                               rc_List.c_Name + "DataSetValues [" + c_DataPoolName.UpperCase() + "_" +
+                               c_ListName.UpperCase() + "_NUMBER_OF_DATA_SETS] =");
+               orc_Data.Append("{");
 
-               for (u8_DataSetIndex = 0U; u8_DataSetIndex < c_List.c_DataSets.size(); u8_DataSetIndex++)
+               for (u8_DataSetIndex = 0U; u8_DataSetIndex < rc_List.c_DataSets.size(); u8_DataSetIndex++)
                {
                   orc_Data.Append("   {");
-                  for (u16_ElementIndex = 0U; u16_ElementIndex < c_List.c_Elements.size(); u16_ElementIndex++)
+                  orc_Data.IncIndent();
+                  orc_Data.IncIndent();
+                  for (u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
                   {
-                     C_OSCNodeDataPoolListElement c_Element = c_List.c_Elements[u16_ElementIndex];
-                     c_String = "      ";
-                     c_String += mh_GetElementValueString(c_Element.c_DataSetValues[u8_DataSetIndex],
-                                                          c_Element.GetType(),
-                                                          c_Element.GetArray());
-                     if (u16_ElementIndex == (c_List.c_Elements.size() - 1U))
-                     {
-                        c_String += " ";
-                     }
-                     else
-                     {
-                        c_String += ",";
-                     }
-                     c_String += ("   ///< " + c_Element.c_Name + " (" +
-                                  C_OSCUtils::h_NiceifyStringForCComment(c_Element.c_Comment) + ")");
-                     orc_Data.Append(c_String);
+                     const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
+                     mh_AddElementValueLine(orc_Data, rc_Element, rc_Element.c_DataSetValues[u8_DataSetIndex],
+                                            u16_ElementIndex == (rc_List.c_Elements.size() - 1U));
                   }
-                  if (u8_DataSetIndex == (c_List.c_DataSets.size() - 1U))
+                  orc_Data.DecIndent();
+                  orc_Data.DecIndent();
+                  if (u8_DataSetIndex == (rc_List.c_DataSets.size() - 1U))
                   {
                      orc_Data.Append("   }");
                   }
@@ -919,18 +918,17 @@ void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C
                orc_Data.Append("");
 
                orc_Data.Append("///Dataset table:");
-               c_ListName = c_List.c_Name;
-               orc_Data.Append("static const T_osy_dpa_data_set mat_" + c_List.c_Name + "DataSetTable[" +
+               orc_Data.Append("static const T_osy_dpa_data_set mat_" + rc_List.c_Name + "DataSetTable[" +
                                c_DataPoolName.UpperCase() + "_" +  c_ListName.UpperCase() +
                                "_NUMBER_OF_DATA_SETS] =");
-               orc_Data.Add("{");
+               orc_Data.Append("{");
 
-               for (u8_DataSetIndex = 0U; u8_DataSetIndex < c_List.c_DataSets.size(); u8_DataSetIndex++)
+               for (u8_DataSetIndex = 0U; u8_DataSetIndex < rc_List.c_DataSets.size(); u8_DataSetIndex++)
                {
-                  c_String = "   { &mat_" + c_List.c_Name + "DataSetValues[" + C_SCLString::IntToStr(u8_DataSetIndex) +
+                  c_String = "   { &mat_" + rc_List.c_Name + "DataSetValues[" + C_SCLString::IntToStr(u8_DataSetIndex) +
                              "] }";
 
-                  if (u8_DataSetIndex != (c_List.c_DataSets.size() - 1U))
+                  if (u8_DataSetIndex != (rc_List.c_DataSets.size() - 1U))
                   {
                      c_String += ",";
                   }
@@ -948,6 +946,10 @@ void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C
          const C_OSCNodeDataPoolList & rc_List = orc_DataPool.c_Lists[u16_ListIndex];
          if (rc_List.c_Elements.size() != 0)
          {
+            const C_SCLString c_ValuesPrefix = "U, &gt_" + c_DataPoolName + "_DataPoolValues.t_" + rc_List.c_Name +
+                                               "Values.";
+            const C_SCLString c_MinValuesPrefix = ", &mt_" + rc_List.c_Name + "MinValues.";
+            const C_SCLString c_MaxValuesPrefix = ", &mt_" + rc_List.c_Name + "MaxValues.";
             c_ListName = rc_List.c_Name;
             orc_Data.Append("static const T_osy_dpa_element_definition mat_DataPool" + rc_List.c_Name + "Elements[" +
                             c_DataPoolName.UpperCase() + "_" + c_ListName.UpperCase() + "_NUMBER_OF_ELEMENTS] =");
@@ -956,9 +958,6 @@ void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C
             for (u16_ElementIndex = 0U; u16_ElementIndex < rc_List.c_Elements.size(); u16_ElementIndex++)
             {
                const C_OSCNodeDataPoolListElement & rc_Element = rc_List.c_Elements[u16_ElementIndex];
-               const C_SCLString c_ElementSize = mh_GetElementSize(rc_Element.GetType(), rc_Element.GetArraySize(),
-                                                                   rc_Element.GetArray());
-               const C_SCLString c_TriggerEvent = (rc_Element.q_DiagEventCall == true) ? "1U" : "0U";
                const C_SCLString c_ElementName = C_OSCExportUti::h_GetElementCName(rc_Element.c_Name,
                                                                                    rc_Element.GetArray(),
                                                                                    rc_Element.GetType());
@@ -967,17 +966,23 @@ void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C
                {
                   c_ElementType = "a" + c_ElementType;
                }
-               c_String = "   { OSY_DPA_ELEMENT_TYPE_" + c_ElementType.UpperCase() + ", " + c_TriggerEvent + ", " +
-                          c_ElementSize + "U, &gt_" + c_DataPoolName + "_DataPoolValues.t_" + c_ListName + "Values." +
-                          c_ElementName +
-                          ", &mt_" + c_ListName + "MinValues." + c_ElementName +
-                          ", &mt_" + c_ListName + "MaxValues." + c_ElementName + " }";
+               orc_Data.WriteText("   { OSY_DPA_ELEMENT_TYPE_");
+               orc_Data.WriteText(c_ElementType.UpperCase());
+               orc_Data.WriteText((rc_Element.q_DiagEventCall == true) ? ", 1U, " : ", 0U, ");
+               orc_Data.WriteText(mh_GetElementSize(rc_Element.GetType(), rc_Element.GetArraySize(),
+                                                    rc_Element.GetArray()));
+               orc_Data.WriteText(c_ValuesPrefix);
+               orc_Data.WriteText(c_ElementName);
+               orc_Data.WriteText(c_MinValuesPrefix);
+               orc_Data.WriteText(c_ElementName);
+               orc_Data.WriteText(c_MaxValuesPrefix);
+               orc_Data.WriteText(c_ElementName);
+               orc_Data.WriteText(" }");
                if (u16_ElementIndex != (rc_List.c_Elements.size() - 1U))
                {
-                  c_String += ",";
+                  orc_Data.WriteText(",");
                }
-
-               orc_Data.Append(c_String);
+               orc_Data.EndLine();
             }
             orc_Data.Append("};");
             orc_Data.Append("");
@@ -1241,11 +1246,11 @@ void C_OSCExportDataPool::mh_AddModuleGlobal(C_SCLStringList & orc_Data, const C
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Add implementation
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  oq_FileType              .c or .h file selected
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportDataPool::mh_AddImplementation(C_SCLStringList & orc_Data, const bool oq_FileType)
+void C_OSCExportDataPool::mh_AddImplementation(C_OSCExportCodeWriter & orc_Data, const bool oq_FileType)
 {
    orc_Data.Append(C_OSCExportUti::h_GetSectionSeparator("Implementation"));
 
@@ -1313,21 +1318,18 @@ C_SCLString C_OSCExportDataPool::mh_GetType(const C_OSCNodeDataPoolContent::E_Ty
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Get value string from list element
+/*! \brief   Write value of list element
 
-   \param[in] orc_Value                value to be converted
-   \param[in] oe_Type                  type of element
-   \param[in] oq_IsArray               indicator for array type
-
-   \return
-   element with unsigned indicator as string
+   \param[in,out] orc_Data             writer to add the value to
+   \param[in]     orc_Value            value to be converted
+   \param[in]     oe_Type              type of element
+   \param[in]     oq_IsArray           indicator for array type
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_SCLString C_OSCExportDataPool::mh_GetElementValueString(const C_OSCNodeDataPoolContent & orc_Value,
-                                                          const C_OSCNodeDataPoolContent::E_Type oe_Type,
-                                                          const bool oq_IsArray)
+void C_OSCExportDataPool::mh_WriteElementValue(C_OSCExportCodeWriter & orc_Data,
+                                               const C_OSCNodeDataPoolContent & orc_Value,
+                                               const C_OSCNodeDataPoolContent::E_Type oe_Type, const bool oq_IsArray)
 {
-   C_SCLString c_String;
    sint64 s64_Value;
    sint32 s32_Value;
 
@@ -1336,33 +1338,39 @@ C_SCLString C_OSCExportDataPool::mh_GetElementValueString(const C_OSCNodeDataPoo
       switch (oe_Type)
       {
       case C_OSCNodeDataPoolContent::eUINT8: ///< Data type unsigned 8 bit integer
-         c_String += C_SCLString::IntToStr(orc_Value.GetValueU8()) + "U";
+         orc_Data.WriteUnsigned(orc_Value.GetValueU8());
+         orc_Data.WriteText("U");
          break;
       case C_OSCNodeDataPoolContent::eUINT16: ///< Data type unsigned 16 bit integer
-         c_String += C_SCLString::IntToStr(orc_Value.GetValueU16()) + "U";
+         orc_Data.WriteUnsigned(orc_Value.GetValueU16());
+         orc_Data.WriteText("U");
          break;
       case C_OSCNodeDataPoolContent::eUINT32: ///< Data type unsigned 32 bit integer
-         c_String += C_SCLString::IntToStr(orc_Value.GetValueU32()) + "UL";
+         orc_Data.WriteUnsigned(orc_Value.GetValueU32());
+         orc_Data.WriteText("UL");
          break;
       case C_OSCNodeDataPoolContent::eUINT64: ///< Data type unsigned 64 bit integer
-         c_String += C_SCLString::IntToStr(orc_Value.GetValueU64()) + "ULL";
+         orc_Data.WriteUnsigned(orc_Value.GetValueU64());
+         orc_Data.WriteText("ULL");
          break;
       case C_OSCNodeDataPoolContent::eSINT8: ///< Data type signed 8 bit integer
-         c_String += C_SCLString::IntToStr(orc_Value.GetValueS8());
+         orc_Data.WriteSigned(orc_Value.GetValueS8());
          break;
       case C_OSCNodeDataPoolContent::eSINT16: ///< Data type signed 16 bit integer
-         c_String += C_SCLString::IntToStr(orc_Value.GetValueS16());
+         orc_Data.WriteSigned(orc_Value.GetValueS16());
          break;
       case C_OSCNodeDataPoolContent::eSINT32: ///< Data type signed 32 bit integer
          s32_Value = orc_Value.GetValueS32();
          if (s32_Value == std::numeric_limits<sint32>::min())
          {
             //workaround for GCC warning when reaching lowest possible value
-            c_String += C_SCLString::IntToStr(std::numeric_limits<sint32>::min() + 1) + "L - 1";
+            orc_Data.WriteSigned(std::numeric_limits<sint32>::min() + 1);
+            orc_Data.WriteText("L - 1");
          }
          else
          {
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueS32()) + "L";
+            orc_Data.WriteSigned(s32_Value);
+            orc_Data.WriteText("L");
          }
          break;
       case C_OSCNodeDataPoolContent::eSINT64: ///< Data type signed 64 bit integer
@@ -1370,20 +1378,23 @@ C_SCLString C_OSCExportDataPool::mh_GetElementValueString(const C_OSCNodeDataPoo
          if (s64_Value == std::numeric_limits<sint64>::min())
          {
             //workaround for GCC warning when reaching lowest possible value
-            c_String += C_SCLString::IntToStr(std::numeric_limits<sint64>::min() + 1) + "LL - 1";
+            orc_Data.WriteSigned(std::numeric_limits<sint64>::min() + 1);
+            orc_Data.WriteText("LL - 1");
          }
          else
          {
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueS64()) + "LL";
+            orc_Data.WriteSigned(s64_Value);
+            orc_Data.WriteText("LL");
          }
          break;
       case C_OSCNodeDataPoolContent::eFLOAT32: ///< Data type 32 bit floating point
-         c_String += C_OSCExportUti::h_FloatToStrCutZeroes(orc_Value.GetValueF32()) + "F";
+         orc_Data.WriteFloat(orc_Value.GetValueF32());
+         orc_Data.WriteText("F");
          break;
       case C_OSCNodeDataPoolContent::eFLOAT64: ///< Data type 64 bit floating point
          //depending on the value this could result in a very long string
          //but with other approaches (e.g. "printf formatter %g" we might lose precision)
-         c_String += C_OSCExportUti::h_FloatToStrCutZeroes(orc_Value.GetValueF64());
+         orc_Data.WriteFloat(orc_Value.GetValueF64());
          break;
       default:
          break;
@@ -1392,39 +1403,45 @@ C_SCLString C_OSCExportDataPool::mh_GetElementValueString(const C_OSCNodeDataPoo
    else
    {
       const uint32 u32_ArraySize = orc_Value.GetArraySize();
-      c_String = "{ ";
+      orc_Data.WriteText("{ ");
       for (uint32 u32_ArrayIndex = 0U; u32_ArrayIndex < u32_ArraySize; u32_ArrayIndex++)
       {
          switch (oe_Type)
          {
          case C_OSCNodeDataPoolContent::eUINT8: ///< Data type unsigned 8 bit integer
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueAU8Element(u32_ArrayIndex)) + "U";
+            orc_Data.WriteUnsigned(orc_Value.GetValueAU8Element(u32_ArrayIndex));
+            orc_Data.WriteText("U");
             break;
          case C_OSCNodeDataPoolContent::eUINT16: ///< Data type unsigned 16 bit integer
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueAU16Element(u32_ArrayIndex)) + "U";
+            orc_Data.WriteUnsigned(orc_Value.GetValueAU16Element(u32_ArrayIndex));
+            orc_Data.WriteText("U");
             break;
          case C_OSCNodeDataPoolContent::eUINT32: ///< Data type unsigned 32 bit integer
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueAU32Element(u32_ArrayIndex)) + "UL";
+            orc_Data.WriteUnsigned(orc_Value.GetValueAU32Element(u32_ArrayIndex));
+            orc_Data.WriteText("UL");
             break;
          case C_OSCNodeDataPoolContent::eUINT64: ///< Data type unsigned 64 bit integer
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueAU64Element(u32_ArrayIndex)) + "ULL";
+            orc_Data.WriteUnsigned(orc_Value.GetValueAU64Element(u32_ArrayIndex));
+            orc_Data.WriteText("ULL");
             break;
          case C_OSCNodeDataPoolContent::eSINT8: ///< Data type signed 8 bit integer
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueAS8Element(u32_ArrayIndex));
+            orc_Data.WriteSigned(orc_Value.GetValueAS8Element(u32_ArrayIndex));
             break;
          case C_OSCNodeDataPoolContent::eSINT16: ///< Data type signed 16 bit integer
-            c_String += C_SCLString::IntToStr(orc_Value.GetValueAS16Element(u32_ArrayIndex));
+            orc_Data.WriteSigned(orc_Value.GetValueAS16Element(u32_ArrayIndex));
             break;
          case C_OSCNodeDataPoolContent::eSINT32: ///< Data type signed 32 bit integer
             s32_Value = orc_Value.GetValueAS32Element(u32_ArrayIndex);
             if (s32_Value == std::numeric_limits<sint32>::min())
             {
                //workaround for GCC warning when reaching lowest possible value
-               c_String += C_SCLString::IntToStr(std::numeric_limits<sint32>::min() + 1) + "L - 1";
+               orc_Data.WriteSigned(std::numeric_limits<sint32>::min() + 1);
+               orc_Data.WriteText("L - 1");
             }
             else
             {
-               c_String += C_SCLString::IntToStr(orc_Value.GetValueAS32Element(u32_ArrayIndex)) + "L";
+               orc_Data.WriteSigned(s32_Value);
+               orc_Data.WriteText("L");
             }
             break;
          case C_OSCNodeDataPoolContent::eSINT64: ///< Data type signed 64 bit integer
@@ -1432,18 +1449,21 @@ C_SCLString C_OSCExportDataPool::mh_GetElementValueString(const C_OSCNodeDataPoo
             if (s64_Value == std::numeric_limits<sint64>::min())
             {
                //workaround for GCC warning when reaching lowest possible value
-               c_String += C_SCLString::IntToStr(std::numeric_limits<sint64>::min() + 1) + "LL - 1";
+               orc_Data.WriteSigned(std::numeric_limits<sint64>::min() + 1);
+               orc_Data.WriteText("LL - 1");
             }
             else
             {
-               c_String += C_SCLString::IntToStr(orc_Value.GetValueAS64Element(u32_ArrayIndex)) + "LL";
+               orc_Data.WriteSigned(s64_Value);
+               orc_Data.WriteText("LL");
             }
             break;
          case C_OSCNodeDataPoolContent::eFLOAT32: ///< Data type 32 bit floating point
-            c_String += C_OSCExportUti::h_FloatToStrCutZeroes(orc_Value.GetValueAF32Element(u32_ArrayIndex)) + "F";
+            orc_Data.WriteFloat(orc_Value.GetValueAF32Element(u32_ArrayIndex));
+            orc_Data.WriteText("F");
             break;
          case C_OSCNodeDataPoolContent::eFLOAT64: ///< Data type 64 bit floating point
-            c_String += C_OSCExportUti::h_FloatToStrCutZeroes(orc_Value.GetValueAF64Element(u32_ArrayIndex));
+            orc_Data.WriteFloat(orc_Value.GetValueAF64Element(u32_ArrayIndex));
             break;
          default:
             break;
@@ -1451,16 +1471,38 @@ C_SCLString C_OSCExportDataPool::mh_GetElementValueString(const C_OSCNodeDataPoo
 
          if (u32_ArrayIndex == (u32_ArraySize - 1U))
          {
-            c_String += " }";
+            orc_Data.WriteText(" }");
          }
          else
          {
-            c_String += ", ";
+            orc_Data.WriteText(", ");
          }
       }
    }
+}
 
-   return c_String;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add one line of an element value table
+
+   Format: "<value>,   ///< <name> (<comment>)"; the final entry of the table gets a blank instead of the ",".
+
+   \param[in,out] orc_Data             writer to add the line to
+   \param[in]     orc_Element          element the value belongs to
+   \param[in]     orc_Value            value to be converted
+   \param[in]     oq_IsLastEntry       true: final entry of table
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportDataPool::mh_AddElementValueLine(C_OSCExportCodeWriter & orc_Data,
+                                                 const C_OSCNodeDataPoolListElement & orc_Element,
+                                                 const C_OSCNodeDataPoolContent & orc_Value, const bool oq_IsLastEntry)
+{
+   mh_WriteElementValue(orc_Data, orc_Value, orc_Element.GetType(), orc_Element.GetArray());
+   orc_Data.WriteText((oq_IsLastEntry == true) ? " " : ",");
+   orc_Data.WriteText("   ///< ");
+   orc_Data.WriteText(orc_Element.c_Name);
+   orc_Data.WriteText(" (");
+   orc_Data.WriteText(C_OSCUtils::h_NiceifyStringForCComment(orc_Element.c_Comment));
+   orc_Data.Append(")");
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1558,7 +1600,7 @@ C_SCLString C_OSCExportDataPool::mh_ConvertLinkageToString(const C_OSCExportData
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get magic name for consistency checks.
 
-   \param[out] orc_Data                 converted data to string list
+   \param[out] orc_Data                 converted data
    \param[in]  orc_DataPool             Datapool configuration
    \param[in]  orc_ProjectId            project id for consistency check
 
@@ -16,7 +16,7 @@
 
 #include "stwtypes.h"
 
-#include "CSCLStringList.h"
+#include "C_OSCExportCodeWriter.h"
 #include "C_OSCNodeDataPool.h"
 #include "C_OSCNodeCodeExportSettings.h"
 
@@ -71,32 +71,34 @@ private:
                                                 const stw_types::uint16 ou16_GenCodeVersion, const E_Linkage oe_Linkage,
                                                 const C_OSCNodeCodeExportSettings::E_Scaling oe_ScalingSupport);
 
-   static void mh_AddHeader(const stw_scl::C_SCLString & orc_ExportToolInfo, stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddHeader(const stw_scl::C_SCLString & orc_ExportToolInfo, C_OSCExportCodeWriter & orc_Data,
                             const C_OSCNodeDataPool & orc_DataPool, const bool oq_FileType);
-   static void mh_AddIncludes(stw_scl::C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+   static void mh_AddIncludes(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                               const bool oq_FileType);
-   static stw_types::sint32 mh_AddDefinesHeader(stw_scl::C_SCLStringList & orc_Data,
+   static stw_types::sint32 mh_AddDefinesHeader(C_OSCExportCodeWriter & orc_Data,
                                                 const C_OSCNodeDataPool & orc_DataPool,
                                                 const stw_types::uint8 ou8_DataPoolIndex,
                                                 const stw_scl::C_SCLString & orc_ProjectId,
                                                 const stw_types::uint16 ou16_GenCodeVersion, const E_Linkage oe_Linkage,
                                                 const C_OSCNodeCodeExportSettings::E_Scaling oe_ScalingSupport);
-   static void mh_AddDefinesImpl(stw_scl::C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+   static void mh_AddDefinesImpl(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                  const stw_scl::C_SCLString & orc_ProjectId,
                                  const stw_types::uint16 ou16_GenCodeVersion);
-   static void mh_AddTypes(stw_scl::C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+   static void mh_AddTypes(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                            const bool oq_FileType, const E_Linkage oe_Linkage);
-   static void mh_AddGlobalVariables(stw_scl::C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+   static void mh_AddGlobalVariables(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                      const stw_types::uint16 ou16_GenCodeVersion, const bool oq_FileType,
                                      const E_Linkage oe_Linkage);
-   static void mh_AddModuleGlobal(stw_scl::C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+   static void mh_AddModuleGlobal(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                   const stw_types::uint16 ou16_GenCodeVersion, const stw_types::uint8 ou8_ProcessId,
                                   const stw_types::uint8 ou8_DataPoolIndexRemote, const E_Linkage oe_Linkage);
-   static void mh_AddImplementation(stw_scl::C_SCLStringList & orc_Data, const bool oq_FileType);
+   static void mh_AddImplementation(C_OSCExportCodeWriter & orc_Data, const bool oq_FileType);
    static stw_scl::C_SCLString mh_GetType(const C_OSCNodeDataPoolContent::E_Type oe_Type);
-   static stw_scl::C_SCLString mh_GetElementValueString(const C_OSCNodeDataPoolContent & orc_Value,
-                                                        const C_OSCNodeDataPoolContent::E_Type oe_Type,
-                                                        const bool oq_IsArray);
+   static void mh_WriteElementValue(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPoolContent & orc_Value,
+                                    const C_OSCNodeDataPoolContent::E_Type oe_Type, const bool oq_IsArray);
+   static void mh_AddElementValueLine(C_OSCExportCodeWriter & orc_Data,
+                                      const C_OSCNodeDataPoolListElement & orc_Element,
+                                      const C_OSCNodeDataPoolContent & orc_Value, const bool oq_IsLastEntry);
    static stw_scl::C_SCLString mh_GetElementSize(const C_OSCNodeDataPoolContent::E_Type oe_Type,
                                                  const stw_types::uint32 ou32_ArraySize, const bool oq_IsArray);
    static stw_scl::C_SCLString mh_ConvertLinkageToString(const E_Linkage oe_Linkage);
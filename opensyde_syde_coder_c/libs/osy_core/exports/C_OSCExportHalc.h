@@ -11,7 +11,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "stwtypes.h"
-#include "CSCLStringList.h"
+#include "C_OSCExportCodeWriter.h"
 #include "C_OSCHalcConfig.h"
 #include "C_OSCNodeDataPool.h"
 
@@ -53,16 +53,16 @@ private:
                                                         const bool oq_IsSafe,
                                                         const stw_types::uint16 ou16_GenCodeVersion);
 
-   static void mh_AddHeader(const stw_scl::C_SCLString & orc_ExportToolInfo, stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddHeader(const stw_scl::C_SCLString & orc_ExportToolInfo, C_OSCExportCodeWriter & orc_Data,
                             const bool oq_FileType, const bool oq_IsSafe);
-   static void mh_AddIncludes(stw_scl::C_SCLStringList & orc_Data, const bool oq_FileType, const bool oq_IsSafe);
-   static void mh_AddDefines(stw_scl::C_SCLStringList & orc_Data,  const C_OSCHalcConfig & orc_HalcConfig,
+   static void mh_AddIncludes(C_OSCExportCodeWriter & orc_Data, const bool oq_FileType, const bool oq_IsSafe);
+   static void mh_AddDefines(C_OSCExportCodeWriter & orc_Data,  const C_OSCHalcConfig & orc_HalcConfig,
                              const stw_scl::C_SCLString & orc_ProjectId, const bool oq_FileType, const bool oq_IsSafe,
                              const stw_types::uint16 ou16_GenCodeVersion);
-   static void mh_AddGlobalVariables(stw_scl::C_SCLStringList & orc_Data, const C_OSCHalcConfig & orc_HalcConfig,
+   static void mh_AddGlobalVariables(C_OSCExportCodeWriter & orc_Data, const C_OSCHalcConfig & orc_HalcConfig,
                                      const bool oq_FileType, const bool oq_IsSafe);
    static stw_scl::C_SCLString mh_GetMagicName(const stw_scl::C_SCLString & orc_ProjectId, const bool oq_IsSafe);
-   static void mh_AddDpListElementReferences(stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddDpListElementReferences(C_OSCExportCodeWriter & orc_Data,
                                              const std::vector<C_OSCHalcDefStruct> & orc_DefinitionArray,
                                              const std::vector<C_OSCHalcConfigChannel> & orc_ConfigArray,
                                              const C_OSCHalcDefDomain::E_VariableSelector & ore_Type,
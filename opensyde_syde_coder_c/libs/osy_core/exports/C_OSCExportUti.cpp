@@ -109,7 +109,7 @@ C_SCLString C_OSCExportUti::h_GetCreationToolInfo(const C_SCLString & orc_Export
    \param[in]  orc_Data    File data to append structure to
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportUti::h_AddExternCStart(C_SCLStringList & orc_Data)
+void C_OSCExportUti::h_AddExternCStart(C_OSCExportCodeWriter & orc_Data)
 {
    orc_Data.Append("#ifdef __cplusplus");
    orc_Data.Append("extern \"C\" {");
@@ -123,7 +123,7 @@ void C_OSCExportUti::h_AddExternCStart(C_SCLStringList & orc_Data)
    \param[in]  orc_Data    File data to append structure to
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportUti::h_AddExternCEnd(C_SCLStringList & orc_Data)
+void C_OSCExportUti::h_AddExternCEnd(C_OSCExportCodeWriter & orc_Data)
 {
    orc_Data.Append("#ifdef __cplusplus");
    orc_Data.Append("} /* end of extern \"C\" */");
@@ -134,12 +134,12 @@ void C_OSCExportUti::h_AddExternCEnd(C_SCLStringList & orc_Data)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add define with project ID to ensure file consistency between .c and .h file.
 
-   \param[out]  orc_Data         File data as string list
+   \param[out]  orc_Data         File data
    \param[in]   orc_MagicName    Magic name including project ID
    \param[in]   oq_HeaderFile    Flag if .c or .h file (true: header file)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportUti::h_AddProjectIdDef(C_SCLStringList & orc_Data, const C_SCLString & orc_MagicName,
+void C_OSCExportUti::h_AddProjectIdDef(C_OSCExportCodeWriter & orc_Data, const C_SCLString & orc_MagicName,
                                        const bool oq_HeaderFile)
 {
    if (oq_HeaderFile == true)
@@ -159,11 +159,11 @@ void C_OSCExportUti::h_AddProjectIdDef(C_SCLStringList & orc_Data, const C_SCLSt
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add function prototype section with magic name
 
-   \param[out]  orc_Data         File data as string list
+   \param[out]  orc_Data         File data
    \param[in]   orc_MagicName    Magic name including project ID
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportUti::h_AddProjIdFunctionPrototype(C_SCLStringList & orc_Data, const C_SCLString & orc_MagicName)
+void C_OSCExportUti::h_AddProjIdFunctionPrototype(C_OSCExportCodeWriter & orc_Data, const C_SCLString & orc_MagicName)
 {
    orc_Data.Append(C_OSCExportUti::h_GetSectionSeparator("Function Prototypes"));
    orc_Data.Append("///unique ID to ensure consistency between .h and .c files");
@@ -174,7 +174,7 @@ void C_OSCExportUti::h_AddProjIdFunctionPrototype(C_SCLStringList & orc_Data, co
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Store assembled data in file
 
-   \param[in]  orc_Data       File data as string list
+   \param[in]  orc_Data       File data
    \param[in]  orc_Path       Directory path for created file excluding file name
    \param[in]  orc_FileName   File name excluding file extension
    \param[in]  oq_HeaderFile  Flag if .c or .h file (true: header file)
@@ -184,8 +184,8 @@ void C_OSCExportUti::h_AddProjIdFunctionPrototype(C_SCLStringList & orc_Data, co
    C_RD_WR  Operation failure: cannot store file
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCExportUti::h_SaveToFile(stw_scl::C_SCLStringList & orc_Data, const stw_scl::C_SCLString & orc_Path,
-                                    const stw_scl::C_SCLString & orc_FileName, const bool oq_HeaderFile)
+sint32 C_OSCExportUti::h_SaveToFile(const C_OSCExportCodeWriter & orc_Data, const C_SCLString & orc_Path,
+                                    const C_SCLString & orc_FileName, const bool oq_HeaderFile)
 {
    sint32 s32_Retval = C_NO_ERR;
    C_SCLString c_PathAndFilename;
@@ -203,15 +203,11 @@ sint32 C_OSCExportUti::h_SaveToFile(stw_scl::C_SCLStringList & orc_Data, const s
       c_PathAndFilename += ".c";
    }
 
-   // store into file
-   try
-   {
-      orc_Data.SaveToFile(c_PathAndFilename);
-   }
-   catch (...)
+   // store into file; unchanged files are kept untouched by the writer
+   s32_Retval = orc_Data.SaveToFile(c_PathAndFilename);
+   if (s32_Retval != C_NO_ERR)
    {
       osc_write_log_error("Creating source code", "Could not write to file \"" + c_PathAndFilename + "\"");
-      s32_Retval = C_RD_WR;
    }
 
    return s32_Retval;
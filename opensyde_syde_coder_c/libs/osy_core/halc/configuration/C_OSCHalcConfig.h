@@ -9,6 +9,8 @@
 #define C_OSCHALCCONFIG_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <map>
+#include <set>
 #include "C_OSCHalcDefBase.h"
 #include "C_OSCHalcConfigDomain.h"
 
@@ -110,12 +112,27 @@ public:
                                std::vector<stw_types::uint32> * const opc_InvalidChannelIndices) const;
    virtual void CalcHash(stw_types::uint32 & oru32_HashValue) const;
 
+   //Change tracking for HALC Datapool generation
+   bool IsDatapoolStructureChanged(void) const;
+   void GetChangedChannels(const stw_types::uint32 ou32_DomainIndex,
+                           std::vector<stw_types::uint32> & orc_ChannelIndices, bool & orq_DomainValuesChanged) const;
+   void SetDatapoolStructureChanged(void);
+   void ResetDatapoolChanges(void);
+
 private:
    std::vector<C_OSCHalcConfigDomain> mc_Domains; ///< Domains of HALC configuration (synced with C_OSCHalcDefBase)
    bool mq_SafeDatablockAssigned;                 ///< Flag if safe datablock is assigned
    stw_types::uint32 mu32_SafeDatablockIndex;     ///< Safe datablock index
    bool mq_UnsafeDatablockAssigned;               ///< Flag if unsafe datablock is assigned
    stw_types::uint32 mu32_UnsafeDatablockIndex;   ///< Unsafe datablock index
+
+   ///Changes since last HALC Datapool generation
+   bool mq_DatapoolStructureChanged;                                             ///< Datapools need full regeneration
+   std::set<stw_types::uint32> mc_ChangedDomainValues;                           ///< Domains with changed domain values
+   std::map<stw_types::uint32, std::set<stw_types::uint32> > mc_ChangedChannels; ///< Changed channels per domain
+
+   void m_MarkValuesChanged(const stw_types::uint32 ou32_DomainIndex, const stw_types::uint32 ou32_ChannelIndex,
+                            const bool oq_UseChannelIndex);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -155,7 +155,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadData(C_OSCHalcConfig & orc_IOData, C_OSCXMLPa
    s32_Retval = mh_LoadIODataBase(orc_IOData, orc_XMLParser, orc_BasePath);
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("ref-content-version") == "ref-content-version")
+      if (orc_XMLParser.TrySelectNodeChild("ref-content-version") == true)
       {
          uint32 u32_RefId = 0UL;
          try
@@ -196,7 +196,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadData(C_OSCHalcConfig & orc_IOData, C_OSCXMLPa
       }
       if (s32_Retval == C_NO_ERR)
       {
-         if (orc_XMLParser.SelectNodeChild("general") == "general")
+         if (orc_XMLParser.TrySelectNodeChild("general") == true)
          {
             if (orc_XMLParser.AttributeExists("is-safe-datablock-set"))
             {
@@ -397,13 +397,13 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("config") == "config")
+   if (orc_XMLParser.TrySelectNodeChild("config") == true)
    {
       s32_Retval = mh_LoadIOChannel(orc_IODomain.c_DomainConfig, orc_XMLParser, "config");
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "domain");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("domain"));
       }
    }
    else
@@ -411,16 +411,16 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
       osc_write_log_error("Loading IO data", "Could not find \"config\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("channels") == "channels")
+   if (orc_XMLParser.TrySelectNodeChild("channels") == true)
    {
       if (orc_XMLParser.AttributeExists("length"))
       {
          const uint32 u32_ExpectedCount = orc_XMLParser.GetAttributeUint32("length");
          uint32 u32_ActualCount = 0UL;
-         stw_scl::C_SCLString c_NodeChannel = orc_XMLParser.SelectNodeChild("channel");
+         bool q_NodeChannelFound = orc_XMLParser.TrySelectNodeChild("channel");
          //Clear any existing configuration
          orc_IODomain.c_ChannelConfigs.clear();
-         if (c_NodeChannel == "channel")
+         if (q_NodeChannelFound == true)
          {
             do
             {
@@ -432,14 +432,14 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
                   //Count
                   ++u32_ActualCount;
                   //Iterate
-                  c_NodeChannel = orc_XMLParser.SelectNodeNext("channel");
+                  q_NodeChannelFound = orc_XMLParser.TrySelectNodeNext("channel");
                }
             }
-            while ((c_NodeChannel == "channel") && (s32_Retval == C_NO_ERR));
+            while ((q_NodeChannelFound == true) && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "channels");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("channels"));
             }
          }
          if (u32_ExpectedCount != u32_ActualCount)
@@ -457,7 +457,7 @@ sint32 C_OSCHalcConfigFiler::h_LoadIODomain(C_OSCHalcConfigDomain & orc_IODomain
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "domain");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("domain"));
       }
    }
    else
@@ -558,7 +558,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIODomains(const C_OSCHalcConfig & orc_IOData
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "domains");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("domains"));
          }
       }
       else
@@ -602,7 +602,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOChannels(const std::vector<C_OSCHalcConfig
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "domain");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("domain"));
    }
    return s32_Retval;
 }
@@ -636,7 +636,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOChannel(const C_OSCHalcConfigChannel & orc
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeParentName);
+      tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_NodeParentName.c_str()));
    }
    return s32_Retval;
 }
@@ -669,13 +669,13 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameterStructs(
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-structs");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("parameter-structs"));
       }
    }
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+      tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_NodeName.c_str()));
    }
    return s32_Retval;
 }
@@ -707,7 +707,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameterStruct(const C_OSCHalcConfigParam
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("parameter-struct"));
       }
    }
    return s32_Retval;
@@ -739,13 +739,13 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameters(const std::vector<C_OSCHalcConf
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameters");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("parameters"));
       }
    }
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("parameter-struct"));
    }
    return s32_Retval;
 }
@@ -802,7 +802,7 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameter(const C_OSCHalcConfigParameter &
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "value");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("value"));
          }
       }
    }
@@ -820,10 +820,10 @@ sint32 C_OSCHalcConfigFiler::mh_SaveIOParameter(const C_OSCHalcConfigParameter &
          orc_XMLParser.SetAttributeString("value", c_Mask.str().c_str());
          orc_XMLParser.CreateNodeChild("comment", rc_BitmaskItem.c_Comment);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "value");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("value"));
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == orc_BaseNode);
+      tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_BaseNode.c_str()));
       orc_XMLParser.CreateNodeChild("comment", orc_Parameter.c_Comment);
    }
    return s32_Retval;
@@ -846,7 +846,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODataBase(C_OSCHalcDefBase & orc_IOData, C_
 {
    sint32 s32_Retval;
 
-   if (orc_XMLParser.SelectNodeChild("io-base-file") == "io-base-file")
+   if (orc_XMLParser.TrySelectNodeChild("io-base-file") == true)
    {
       if (orc_BasePath.IsEmpty())
       {
@@ -894,14 +894,14 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("domains") == "domains")
+   if (orc_XMLParser.TrySelectNodeChild("domains") == true)
    {
       if (orc_XMLParser.AttributeExists("length"))
       {
          const uint32 u32_ExpectedCount = orc_XMLParser.GetAttributeUint32("length");
          uint32 u32_ActualCount = 0UL;
-         stw_scl::C_SCLString c_NodeDomain = orc_XMLParser.SelectNodeChild("domain");
-         if (c_NodeDomain == "domain")
+         bool q_NodeDomainFound = orc_XMLParser.TrySelectNodeChild("domain");
+         if (q_NodeDomainFound == true)
          {
             do
             {
@@ -916,7 +916,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
                      //Count
                      ++u32_ActualCount;
                      //Iterate
-                     c_NodeDomain = orc_XMLParser.SelectNodeNext("domain");
+                     q_NodeDomainFound = orc_XMLParser.TrySelectNodeNext("domain");
                   }
                }
                else
@@ -925,11 +925,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
                   s32_Retval = C_CONFIG;
                }
             }
-            while ((c_NodeDomain == "domain") && (s32_Retval == C_NO_ERR));
+            while ((q_NodeDomainFound == true) && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "domains");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("domains"));
             }
          }
          if (u32_ExpectedCount != u32_ActualCount)
@@ -947,7 +947,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIODomains(C_OSCHalcConfig & orc_IOData, C_OS
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "opensyde-node-io-config");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("opensyde-node-io-config"));
       }
    }
    else
@@ -1000,11 +1000,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOChannel(C_OSCHalcConfigChannel & orc_IOCha
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("name") == "name")
+      if (orc_XMLParser.TrySelectNodeChild("name") == true)
       {
          orc_IOChannel.c_Name = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_NodeName.c_str()));
       }
       else
       {
@@ -1014,11 +1014,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOChannel(C_OSCHalcConfigChannel & orc_IOCha
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.TrySelectNodeChild("comment") == true)
       {
          orc_IOChannel.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_NodeName.c_str()));
       }
       else
       {
@@ -1051,7 +1051,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("parameter-structs") == "parameter-structs")
+   if (orc_XMLParser.TrySelectNodeChild("parameter-structs") == true)
    {
       uint32 u32_ExpectedLength = 0UL;
       //Clean up existing
@@ -1069,8 +1069,8 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
       }
       if (s32_Retval == C_NO_ERR)
       {
-         stw_scl::C_SCLString c_CurrentParameterNode = orc_XMLParser.SelectNodeChild("parameter-struct");
-         if (c_CurrentParameterNode == "parameter-struct")
+         bool q_CurrentParameterNodeFound = orc_XMLParser.TrySelectNodeChild("parameter-struct");
+         if (q_CurrentParameterNodeFound == true)
          {
             do
             {
@@ -1080,14 +1080,14 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
                {
                   orc_ParameterStructs.push_back(c_Parameter);
                   //Iterate
-                  c_CurrentParameterNode = orc_XMLParser.SelectNodeNext("parameter-struct");
+                  q_CurrentParameterNodeFound = orc_XMLParser.TrySelectNodeNext("parameter-struct");
                }
             }
-            while ((c_CurrentParameterNode == "parameter-struct") && (s32_Retval == C_NO_ERR));
+            while ((q_CurrentParameterNodeFound == true) && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-structs");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("parameter-structs"));
             }
          }
          if (s32_Retval == C_NO_ERR)
@@ -1108,7 +1108,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStructs(
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_NodeName.c_str()));
       }
    }
    else
@@ -1137,13 +1137,13 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameterStruct(C_OSCHalcConfigParameterSt
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("single-value") == "single-value")
+      if (orc_XMLParser.TrySelectNodeChild("single-value") == true)
       {
          s32_Retval = mh_LoadIOParameter(orc_ParameterStruct, orc_XMLParser, "single-value");
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("parameter-struct"));
          }
       }
    }
@@ -1166,7 +1166,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("parameters") == "parameters")
+   if (orc_XMLParser.TrySelectNodeChild("parameters") == true)
    {
       uint32 u32_ExpectedLength = 0UL;
       //Reserve
@@ -1182,8 +1182,8 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
       }
       if (s32_Retval == C_NO_ERR)
       {
-         stw_scl::C_SCLString c_CurrentParameterNode = orc_XMLParser.SelectNodeChild("parameter");
-         if (c_CurrentParameterNode == "parameter")
+         bool q_CurrentParameterNodeFound = orc_XMLParser.TrySelectNodeChild("parameter");
+         if (q_CurrentParameterNodeFound == true)
          {
             do
             {
@@ -1193,14 +1193,14 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
                {
                   orc_Parameters.push_back(c_Parameter);
                   //Iterate
-                  c_CurrentParameterNode = orc_XMLParser.SelectNodeNext("parameter");
+                  q_CurrentParameterNodeFound = orc_XMLParser.TrySelectNodeNext("parameter");
                }
             }
-            while ((c_CurrentParameterNode == "parameter") && (s32_Retval == C_NO_ERR));
+            while ((q_CurrentParameterNodeFound == true) && (s32_Retval == C_NO_ERR));
             if (s32_Retval == C_NO_ERR)
             {
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "parameters");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("parameters"));
             }
          }
          if (s32_Retval == C_NO_ERR)
@@ -1221,7 +1221,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameters(std::vector<C_OSCHalcConfigPara
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "parameter-struct");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("parameter-struct"));
       }
    }
    return s32_Retval;
@@ -1248,7 +1248,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameter(C_OSCHalcConfigParameter & orc_P
    stw_scl::C_SCLString c_TypeStr;
    stw_scl::C_SCLString c_BaseTypeStr;
 
-   if (orc_XMLParser.SelectNodeChild("value") == "value")
+   if (orc_XMLParser.TrySelectNodeChild("value") == true)
    {
       s32_Retval = C_OSCHalcDefStructFiler::h_SetType(orc_XMLParser, orc_Parameter.c_Value, c_TypeStr,
                                                       c_BaseTypeStr, "value",
@@ -1263,7 +1263,7 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameter(C_OSCHalcConfigParameter & orc_P
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_BaseName);
+         tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_BaseName.c_str()));
       }
    }
    else
@@ -1273,11 +1273,11 @@ sint32 C_OSCHalcConfigFiler::mh_LoadIOParameter(C_OSCHalcConfigParameter & orc_P
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.TrySelectNodeChild("comment") == true)
       {
          orc_Parameter.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_BaseName);
+         tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_BaseName.c_str()));
       }
       else
       {
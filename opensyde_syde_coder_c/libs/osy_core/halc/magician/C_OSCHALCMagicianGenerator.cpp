@@ -72,6 +72,65 @@ sint32 C_OSCHALCMagicianGenerator::GenerateHALCDatapools(std::vector<C_OSCNodeDa
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Update HALC datapools with the changes of the HALC configuration
+
+   Only the values of the domains and channels changed since the last generation are filled again
+   (see C_OSCHalcConfig::GetChangedChannels). All other lists and elements are kept as they are.
+
+   \param[in,out]  orc_Datapools    HALC datapools of the last generation (non safe and safe), updated in place
+
+   \return
+   C_NO_ERR Datapools updated
+   C_NOACT  Update not possible (structure changed or unexpected datapools): use GenerateHALCDatapools
+   C_CONFIG Configuration invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCHALCMagicianGenerator::UpdateHALCDatapools(std::vector<C_OSCNodeDataPool> & orc_Datapools) const
+{
+   const uint16 u16_TimerId = osc_write_log_performance_start();
+   sint32 s32_Retval = C_NO_ERR;
+
+   if (this->mpc_Node == NULL)
+   {
+      s32_Retval = C_CONFIG;
+      osc_write_log_warning("HALC datapool generation", "node not assigned");
+   }
+   else if ((this->mpc_Node->c_HALCConfig.IsDatapoolStructureChanged() == true) ||
+            (this->m_CheckHALCDatapoolsStructure(orc_Datapools) == false))
+   {
+      s32_Retval = C_NOACT;
+   }
+   else
+   {
+      C_OSCNodeDataPoolList & rc_ListNonSafe = orc_Datapools[0UL].c_Lists[0UL];
+      C_OSCNodeDataPoolList & rc_ListSafe = orc_Datapools[1UL].c_Lists[0UL];
+      const C_OSCHALCMagicianDatapoolListHandler c_Handler(this->mpc_Node->c_HALCConfig);
+      for (uint32 u32_ItDomain = 0UL;
+           (u32_ItDomain < this->mpc_Node->c_HALCConfig.GetDomainSize()) && (s32_Retval == C_NO_ERR); ++u32_ItDomain)
+      {
+         const C_OSCHalcConfigDomain * const pc_Config =
+            this->mpc_Node->c_HALCConfig.GetDomainConfigDataConst(u32_ItDomain);
+         tgl_assert(pc_Config != NULL);
+         if (pc_Config != NULL)
+         {
+            std::vector<uint32> c_ChangedChannels;
+            bool q_DomainValuesChanged;
+            this->mpc_Node->c_HALCConfig.GetChangedChannels(u32_ItDomain, c_ChangedChannels, q_DomainValuesChanged);
+            if ((c_ChangedChannels.size() > 0UL) || (q_DomainValuesChanged == true))
+            {
+               s32_Retval = this->m_UpdateHALCDatapoolsDomain(rc_ListNonSafe, rc_ListSafe, *pc_Config, c_Handler,
+                                                              u32_ItDomain, c_ChangedChannels, q_DomainValuesChanged);
+            }
+         }
+      }
+   }
+
+   osc_write_log_performance_stop(u16_TimerId, "Update of HAL Datapools");
+
+   return s32_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Generate HALC datapools definition
 
@@ -250,7 +309,6 @@ sint32 C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsDomain(C_OSCNodeDataPoolLi
 
    if (u32_CountRelevant > 0UL)
    {
-      std::vector<uint32> c_RelevantParameters;
       uint32 u32_ItRelevantChannel = 0UL;
 
       if (orc_Domain.c_ChannelConfigs.size() == 0UL)
@@ -258,19 +316,7 @@ sint32 C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsDomain(C_OSCNodeDataPoolLi
          //Fill domain values
          if (orc_Domain.c_DomainConfig.q_SafetyRelevant == oq_IsSafe)
          {
-            if (orc_Domain.GetRelevantIndicesForSelectedUseCase(0UL, false, &c_RelevantParameters, NULL,
-                                                                NULL, NULL) == C_NO_ERR)
-            {
-               s32_Retval = this->m_FillHALCDatapoolsChannel(orc_List, orc_Domain.c_DomainConfig, orc_Handler,
-                                                             ou32_ItDomain,
-                                                             0UL, c_RelevantParameters,
-                                                             orc_Domain.c_DomainValues.c_Parameters);
-            }
-            else
-            {
-               s32_Retval = C_CONFIG;
-               osc_write_log_warning("HALC datapool generation", "unexpected error: failed relevancy check");
-            }
+            s32_Retval = this->m_FillHALCDatapoolsDomainValues(orc_List, orc_Domain, orc_Handler, ou32_ItDomain);
          }
       }
 
@@ -281,42 +327,406 @@ sint32 C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsDomain(C_OSCNodeDataPoolLi
          const C_OSCHalcConfigChannel & rc_Channel = orc_Domain.c_ChannelConfigs[u32_ItChannel];
          if (rc_Channel.q_SafetyRelevant == oq_IsSafe)
          {
-            //Fill channel
-            s32_Retval = C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsChanNum(orc_List, orc_Handler, ou32_ItDomain,
-                                                                                oq_IsSafe, u32_ItRelevantChannel,
-                                                                                u32_ItChannel);
+            s32_Retval = this->m_FillHALCDatapoolsDomainChannel(orc_List, orc_Domain, orc_Handler, ou32_ItDomain,
+                                                                u32_ItChannel, u32_ItRelevantChannel);
+            //Iterate
+            ++u32_ItRelevantChannel;
+         }
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Fill HALC datapools domain values
+
+   For domains without channels.
+
+   \param[in,out]  orc_List         List
+   \param[in]      orc_Domain       Domain
+   \param[in]      orc_Handler      Handler
+   \param[in]      ou32_ItDomain    Iterator domain
 
-            if (s32_Retval == C_NO_ERR)
+   \return
+   C_NO_ERR Datapool definition generated
+   C_CONFIG Configuration invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsDomainValues(C_OSCNodeDataPoolList & orc_List,
+                                                                   const C_OSCHalcConfigDomain & orc_Domain,
+                                                                   const C_OSCHALCMagicianDatapoolListHandler &
+                                                                   orc_Handler, const uint32 ou32_ItDomain) const
+{
+   sint32 s32_Retval;
+   std::vector<uint32> c_RelevantParameters;
+
+   if (orc_Domain.GetRelevantIndicesForSelectedUseCase(0UL, false, &c_RelevantParameters, NULL,
+                                                       NULL, NULL) == C_NO_ERR)
+   {
+      s32_Retval = this->m_FillHALCDatapoolsChannel(orc_List, orc_Domain.c_DomainConfig, orc_Handler,
+                                                    ou32_ItDomain,
+                                                    0UL, c_RelevantParameters,
+                                                    orc_Domain.c_DomainValues.c_Parameters);
+   }
+   else
+   {
+      s32_Retval = C_CONFIG;
+      osc_write_log_warning("HALC datapool generation", "unexpected error: failed relevancy check");
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Fill all HALC datapools values of one channel
+
+   \param[in,out]  orc_List                  List matching the safety relevance of the channel
+   \param[in]      orc_Domain                Domain
+   \param[in]      orc_Handler               Handler
+   \param[in]      ou32_ItDomain             Iterator domain
+   \param[in]      ou32_ItChannel            Iterator channel
+   \param[in]      ou32_ItRelevantChannel    Index of channel within all channels with same safety relevance
+
+   \return
+   C_NO_ERR Datapool definition generated
+   C_CONFIG Configuration invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsDomainChannel(C_OSCNodeDataPoolList & orc_List,
+                                                                    const C_OSCHalcConfigDomain & orc_Domain,
+                                                                    const C_OSCHALCMagicianDatapoolListHandler &
+                                                                    orc_Handler, const uint32 ou32_ItDomain,
+                                                                    const uint32 ou32_ItChannel,
+                                                                    const uint32 ou32_ItRelevantChannel) const
+{
+   sint32 s32_Retval;
+   const C_OSCHalcConfigChannel & rc_Channel = orc_Domain.c_ChannelConfigs[ou32_ItChannel];
+
+   //Fill channel
+   s32_Retval = C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsChanNum(orc_List, orc_Handler, ou32_ItDomain,
+                                                                       rc_Channel.q_SafetyRelevant,
+                                                                       ou32_ItRelevantChannel, ou32_ItChannel);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      //Fill Use-case
+      s32_Retval = C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsUseCase(orc_List, orc_Handler, ou32_ItDomain,
+                                                                          rc_Channel.q_SafetyRelevant,
+                                                                          ou32_ItRelevantChannel,
+                                                                          rc_Channel.u32_UseCaseIndex);
+   }
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      std::vector<uint32> c_RelevantParameters;
+      if (orc_Domain.GetRelevantIndicesForSelectedUseCase(ou32_ItChannel, true, &c_RelevantParameters, NULL,
+                                                          NULL, NULL) == C_NO_ERR)
+      {
+         s32_Retval = this->m_FillHALCDatapoolsChannel(orc_List, rc_Channel, orc_Handler, ou32_ItDomain,
+                                                       ou32_ItRelevantChannel, c_RelevantParameters,
+                                                       orc_Domain.c_ChannelValues.c_Parameters);
+      }
+      else
+      {
+         s32_Retval = C_CONFIG;
+         osc_write_log_warning("HALC datapool generation", "unexpected error: failed relevancy check");
+      }
+   }
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Update HALC datapools values of changed channels of one domain
+
+   \param[in,out]  orc_ListNonSafe           Parameter list of non safe datapool
+   \param[in,out]  orc_ListSafe              Parameter list of safe datapool
+   \param[in]      orc_Domain                Domain
+   \param[in]      orc_Handler               Handler
+   \param[in]      ou32_ItDomain             Iterator domain
+   \param[in]      orc_ChangedChannels       Indices of changed channels (ascending)
+   \param[in]      oq_DomainValuesChanged    Flag if domain values changed
+
+   \return
+   C_NO_ERR Datapool values updated
+   C_CONFIG Configuration invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCHALCMagicianGenerator::m_UpdateHALCDatapoolsDomain(C_OSCNodeDataPoolList & orc_ListNonSafe,
+                                                               C_OSCNodeDataPoolList & orc_ListSafe,
+                                                               const C_OSCHalcConfigDomain & orc_Domain,
+                                                               const C_OSCHALCMagicianDatapoolListHandler & orc_Handler,
+                                                               const uint32 ou32_ItDomain,
+                                                               const std::vector<uint32> & orc_ChangedChannels,
+                                                               const bool oq_DomainValuesChanged) const
+{
+   sint32 s32_Retval = C_NO_ERR;
+
+   if (orc_Domain.c_ChannelConfigs.size() == 0UL)
+   {
+      if (oq_DomainValuesChanged)
+      {
+         C_OSCNodeDataPoolList & rc_List = orc_Domain.c_DomainConfig.q_SafetyRelevant ? orc_ListSafe : orc_ListNonSafe;
+         s32_Retval = this->m_FillHALCDatapoolsDomainValues(rc_List, orc_Domain, orc_Handler, ou32_ItDomain);
+      }
+   }
+   else
+   {
+      //Relevant index of a channel is its index within all channels with the same safety relevance
+      uint32 u32_ItRelevantChannelNonSafe = 0UL;
+      uint32 u32_ItRelevantChannelSafe = 0UL;
+      uint32 u32_ItChanged = 0UL;
+
+      for (uint32 u32_ItChannel = 0UL;
+           (u32_ItChannel < orc_Domain.c_ChannelConfigs.size()) && (u32_ItChanged < orc_ChangedChannels.size()) &&
+           (s32_Retval == C_NO_ERR); ++u32_ItChannel)
+      {
+         const bool q_IsSafe = orc_Domain.c_ChannelConfigs[u32_ItChannel].q_SafetyRelevant;
+         if (orc_ChangedChannels[u32_ItChanged] == u32_ItChannel)
+         {
+            if (q_IsSafe)
             {
-               //Fill Use-case
-               s32_Retval = C_OSCHALCMagicianGenerator::m_FillHALCDatapoolsUseCase(orc_List, orc_Handler, ou32_ItDomain,
-                                                                                   oq_IsSafe, u32_ItRelevantChannel,
-                                                                                   rc_Channel.u32_UseCaseIndex);
+               s32_Retval = this->m_FillHALCDatapoolsDomainChannel(orc_ListSafe, orc_Domain, orc_Handler,
+                                                                   ou32_ItDomain, u32_ItChannel,
+                                                                   u32_ItRelevantChannelSafe);
             }
-
-            if (s32_Retval == C_NO_ERR)
+            else
             {
-               if (orc_Domain.GetRelevantIndicesForSelectedUseCase(u32_ItChannel, true, &c_RelevantParameters, NULL,
-                                                                   NULL, NULL) == C_NO_ERR)
-               {
-                  s32_Retval = this->m_FillHALCDatapoolsChannel(orc_List, rc_Channel, orc_Handler, ou32_ItDomain,
-                                                                u32_ItRelevantChannel, c_RelevantParameters,
-                                                                orc_Domain.c_ChannelValues.c_Parameters);
-               }
-               else
-               {
-                  s32_Retval = C_CONFIG;
-                  osc_write_log_warning("HALC datapool generation", "unexpected error: failed relevancy check");
-               }
+               s32_Retval = this->m_FillHALCDatapoolsDomainChannel(orc_ListNonSafe, orc_Domain, orc_Handler,
+                                                                   ou32_ItDomain, u32_ItChannel,
+                                                                   u32_ItRelevantChannelNonSafe);
             }
-            //Iterate
-            ++u32_ItRelevantChannel;
+            ++u32_ItChanged;
+         }
+         if (q_IsSafe)
+         {
+            ++u32_ItRelevantChannelSafe;
+         }
+         else
+         {
+            ++u32_ItRelevantChannelNonSafe;
          }
       }
    }
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if datapools have the structure expected for the current HALC configuration
+
+   Each list element is checked for the expected name, type and array size, so only values need to be updated.
+
+   \param[in]  orc_Datapools    Datapools (non safe and safe)
+
+   \retval   true    Datapools match current HALC configuration
+   \retval   false   Datapools do not match: regeneration necessary
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCHALCMagicianGenerator::m_CheckHALCDatapoolsStructure(const std::vector<C_OSCNodeDataPool> & orc_Datapools)
+const
+{
+   bool q_Retval = false;
+
+   if (orc_Datapools.size() == 2UL)
+   {
+      q_Retval = true;
+      for (uint32 u32_ItDp = 0UL; (u32_ItDp < orc_Datapools.size()) && (q_Retval == true); ++u32_ItDp)
+      {
+         const C_OSCNodeDataPool & rc_Datapool = orc_Datapools[u32_ItDp];
+         const bool q_IsSafe = (u32_ItDp == 1UL);
+         if ((rc_Datapool.e_Type == C_OSCNodeDataPool::eHALC) && (rc_Datapool.q_IsSafety == q_IsSafe) &&
+             (rc_Datapool.c_Lists.size() == 4UL))
+         {
+            const C_OSCHalcDefDomain::E_VariableSelector ae_Selectors[4] =
+            {
+               C_OSCHalcDefDomain::eVA_PARAM, C_OSCHalcDefDomain::eVA_INPUT, C_OSCHalcDefDomain::eVA_OUTPUT,
+               C_OSCHalcDefDomain::eVA_STATUS
+            };
+            for (uint32 u32_ItList = 0UL; (u32_ItList < rc_Datapool.c_Lists.size()) && (q_Retval == true);
+                 ++u32_ItList)
+            {
+               q_Retval = this->m_CheckHALCListElements(rc_Datapool.c_Lists[u32_ItList], ae_Selectors[u32_ItList],
+                                                        q_IsSafe);
+            }
+         }
+         else
+         {
+            q_Retval = false;
+         }
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if HALC datapool list elements are the ones generated for the current HALC configuration
+
+   Same order of elements as mh_GenerateVariablesForDomain creates them.
+
+   \param[in]  orc_List      List to check
+   \param[in]  oe_Selector   List selector
+   \param[in]  oq_IsSafe     Is safe
+
+   \retval   true    Names, types and array sizes of all elements match
+   \retval   false   List does not match
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCHALCMagicianGenerator::m_CheckHALCListElements(const C_OSCNodeDataPoolList & orc_List,
+                                                         const C_OSCHalcDefDomain::E_VariableSelector oe_Selector,
+                                                         const bool oq_IsSafe) const
+{
+   bool q_Retval = true;
+   uint32 u32_ItElement = 0UL;
+
+   for (uint32 u32_ItDomain = 0UL; (u32_ItDomain < this->mpc_Node->c_HALCConfig.GetDomainSize()) && (q_Retval == true);
+        ++u32_ItDomain)
+   {
+      const C_OSCHalcConfigDomain * const pc_Config =
+         this->mpc_Node->c_HALCConfig.GetDomainConfigDataConst(u32_ItDomain);
+      uint32 u32_CountRelevant = 0UL;
+      if (pc_Config != NULL)
+      {
+         u32_CountRelevant = C_OSCHALCMagicianDatapoolListHandler::h_CountRelevantItems(pc_Config->c_ChannelConfigs,
+                                                                                        pc_Config->c_DomainConfig,
+                                                                                        oq_IsSafe);
+      }
+      if (u32_CountRelevant > 0UL)
+      {
+         const C_OSCHalcDefChannelValues & rc_Values =
+            (pc_Config->c_ChannelConfigs.size() == 0UL) ? pc_Config->c_DomainValues : pc_Config->c_ChannelValues;
+         switch (oe_Selector)
+         {
+         case C_OSCHalcDefDomain::eVA_PARAM:
+            if (C_OSCHALCMagicianUtil::h_CheckChanNumVariableNecessary(*pc_Config) == true)
+            {
+               q_Retval = mh_CheckHALCElement(orc_List, u32_ItElement,
+                                              C_OSCHALCMagicianUtil::h_GetChanNumVariableName(
+                                                 pc_Config->c_SingularName), C_OSCNodeDataPoolContent::eUINT16,
+                                              u32_CountRelevant);
+            }
+            if ((q_Retval == true) && (C_OSCHALCMagicianUtil::h_CheckUseCaseVariableNecessary(*pc_Config) == true))
+            {
+               q_Retval = mh_CheckHALCElement(orc_List, u32_ItElement,
+                                              C_OSCHALCMagicianUtil::h_GetUseCaseVariableName(
+                                                 pc_Config->c_SingularName), C_OSCNodeDataPoolContent::eUINT8,
+                                              u32_CountRelevant);
+            }
+            if (q_Retval == true)
+            {
+               q_Retval = mh_CheckHALCElementsForVector(orc_List, u32_ItElement, rc_Values.c_Parameters,
+                                                        pc_Config->c_SingularName, u32_CountRelevant);
+            }
+            break;
+         case C_OSCHalcDefDomain::eVA_INPUT:
+            q_Retval = mh_CheckHALCElementsForVector(orc_List, u32_ItElement, rc_Values.c_InputValues,
+                                                     pc_Config->c_SingularName, u32_CountRelevant);
+            break;
+         case C_OSCHalcDefDomain::eVA_OUTPUT:
+            q_Retval = mh_CheckHALCElementsForVector(orc_List, u32_ItElement, rc_Values.c_OutputValues,
+                                                     pc_Config->c_SingularName, u32_CountRelevant);
+            break;
+         case C_OSCHalcDefDomain::eVA_STATUS:
+            q_Retval = mh_CheckHALCElementsForVector(orc_List, u32_ItElement, rc_Values.c_StatusValues,
+                                                     pc_Config->c_SingularName, u32_CountRelevant);
+            break;
+         default:
+            break;
+         }
+      }
+   }
+   if (q_Retval == true)
+   {
+      if (u32_ItElement == 0UL)
+      {
+         //Empty lists are filled with one placeholder element (see mh_CleanUpHALCDatapools)
+         q_Retval = mh_CheckHALCElement(orc_List, u32_ItElement, "UnusedElement", C_OSCNodeDataPoolContent::eUINT8,
+                                        1UL);
+      }
+      q_Retval = (q_Retval == true) && (u32_ItElement == orc_List.c_Elements.size());
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check HALC datapool list elements generated for one vector of definitions
+
+   \param[in]      orc_List                  List to check
+   \param[in,out]  oru32_ItElement           Index of next element to check; increased by checked elements
+   \param[in]      orc_Definition            Definition
+   \param[in]      orc_DomainSingularName    Domain singular name
+   \param[in]      ou32_NumChannels          Num channels
+
+   \retval   true    Elements match
+   \retval   false   Elements do not match
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCHALCMagicianGenerator::mh_CheckHALCElementsForVector(const C_OSCNodeDataPoolList & orc_List,
+                                                               uint32 & oru32_ItElement,
+                                                               const std::vector<C_OSCHalcDefStruct> & orc_Definition,
+                                                               const stw_scl::C_SCLString & orc_DomainSingularName,
+                                                               const uint32 ou32_NumChannels)
+{
+   bool q_Retval = true;
+
+   for (uint32 u32_ItStruct = 0UL; (u32_ItStruct < orc_Definition.size()) && (q_Retval == true); ++u32_ItStruct)
+   {
+      const C_OSCHalcDefStruct & rc_Struct = orc_Definition[u32_ItStruct];
+      const uint32 u32_ElementCount = (rc_Struct.c_StructElements.size() > 0UL) ?
+                                      static_cast<uint32>(rc_Struct.c_StructElements.size()) : 1UL;
+      for (uint32 u32_ItElem = 0UL; (u32_ItElem < u32_ElementCount) && (q_Retval == true); ++u32_ItElem)
+      {
+         const C_OSCHalcDefElement & rc_Element = (rc_Struct.c_StructElements.size() > 0UL) ?
+                                                  rc_Struct.c_StructElements[u32_ItElem] : rc_Struct;
+         stw_scl::C_SCLString c_Name;
+         q_Retval = (C_OSCHALCMagicianUtil::h_GetVariableName(orc_Definition, u32_ItStruct, u32_ItElem,
+                                                              orc_DomainSingularName, c_Name) == C_NO_ERR) &&
+                    mh_CheckHALCElement(orc_List, oru32_ItElement, c_Name, rc_Element.c_MinValue.GetType(),
+                                        ou32_NumChannels);
+      }
+   }
+   return q_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check next HALC datapool list element
+
+   The element is an array with one entry per channel if there is more than one channel (see
+   mh_ConvertToDatapoolAndResize).
+
+   \param[in]      orc_List            List to check
+   \param[in,out]  oru32_ItElement     Index of element to check; increased by one if it matches
+   \param[in]      orc_Name            Expected name
+   \param[in]      oe_Type             Expected type
+   \param[in]      ou32_NumChannels    Num channels
+
+   \retval   true    Element matches
+   \retval   false   Element does not match or does not exist
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCHALCMagicianGenerator::mh_CheckHALCElement(const C_OSCNodeDataPoolList & orc_List, uint32 & oru32_ItElement,
+                                                     const stw_scl::C_SCLString & orc_Name,
+                                                     const C_OSCNodeDataPoolContent::E_Type oe_Type,
+                                                     const uint32 ou32_NumChannels)
+{
+   bool q_Retval = false;
+
+   if (oru32_ItElement < orc_List.c_Elements.size())
+   {
+      const C_OSCNodeDataPoolContent & rc_Value = orc_List.c_Elements[oru32_ItElement].c_Value;
+      if ((orc_List.c_Elements[oru32_ItElement].c_Name == orc_Name) && (rc_Value.GetType() == oe_Type))
+      {
+         if (ou32_NumChannels > 1UL)
+         {
+            q_Retval = (rc_Value.GetArray() == true) && (rc_Value.GetArraySize() == ou32_NumChannels);
+         }
+         else
+         {
+            q_Retval = (rc_Value.GetArray() == false);
+         }
+      }
+      ++oru32_ItElement;
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Fill HALC datapools channel number
 
@@ -13,6 +13,8 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 
+#include <vector>
+#include <map>
 #include "stwtypes.h"
 #include "CSCLString.h"
 #include "CSCLIniFile.h"
@@ -102,13 +104,18 @@ private:
                                             const stw_scl::C_SCLStringList & orc_SectionValues,
                                             C_OSCCanOpenObject & orc_Object);
 
+   void m_RebuildObjectIndex(void);
+
    stw_scl::C_SCLString mc_LastError;
+   std::map<stw_types::uint32, stw_types::uint32> mc_ObjectIndex; //(index << 8) | sub-index -> position in c_Objects
 
 public:
-   stw_scl::SCLDynamicArray<C_OSCCanOpenObject> c_Objects;
+   std::vector<C_OSCCanOpenObject> c_Objects;
 
    stw_types::sint32 LoadFromFile(const stw_scl::C_SCLString & orc_File);
    stw_scl::C_SCLString GetLastErrorText(void) const;
+   const C_OSCCanOpenObject * GetCanOpenObject(const stw_types::uint16 ou16_Index,
+                                               const stw_types::uint8 ou8_SubIndex) const;
 };
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
@@ -19,6 +19,7 @@
 #include <sys/select.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 //#include <netdb.h>
@@ -136,6 +137,20 @@ bool C_OSCIpDispatcherLinuxSock::C_BufferIdentifier::operator <(
    return q_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up class
+
+   Initialize class elements
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCIpDispatcherLinuxSock::C_TcpConnection::C_TcpConnection(void) :
+   sn_Socket(INVALID_SOCKET),
+   u32_RxBufferStart(0U),
+   u32_RxBufferEnd(0U)
+{
+   (void)memset(&au8_IpAddress[0], 0, sizeof(au8_IpAddress));
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Set up class
 
@@ -186,7 +201,6 @@ sint32 C_OSCIpDispatcherLinuxSock::InitTcp(const uint8 (&orau8_Ip)[4], uint32 &
    C_TcpConnection c_NewConnection;
 
    (void)memcpy(&c_NewConnection.au8_IpAddress[0], &orau8_Ip[0], 4U);
-   c_NewConnection.sn_Socket = INVALID_SOCKET;
 
    this->mc_SocketsTcp.push_back(c_NewConnection);
    oru32_Handle = static_cast<uint32>(mc_SocketsTcp.size() - 1U);
@@ -277,6 +291,10 @@ sint32 C_OSCIpDispatcherLinuxSock::m_ConnectTcp(C_TcpConnection & orc_Connection
    sintn sn_Return;
    bool q_Error = false;
 
+   //data of previous connection is of no use anymore:
+   orc_Connection.u32_RxBufferStart = 0U;
+   orc_Connection.u32_RxBufferEnd = 0U;
+
    //create TCP socket:
    orc_Connection.sn_Socket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
    if (orc_Connection.sn_Socket < 0)
@@ -829,6 +847,159 @@ sint32 C_OSCIpDispatcherLinuxSock::SendTcp(const uint32 ou32_Handle, const std::
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Send package composed of header and payload on TCP socket
+
+   Jobs to perform:
+   - send specified header and payload to configured TCP socket
+
+   Both parts are passed to the socket with one sendmsg() call (scatter/gather).
+   So they do not need to be copied into one buffer first.
+
+   \param[in]   ou32_Handle       handle obtained by InitTcp()
+   \param[in]   opu8_Header       header data to send first
+   \param[in]   ou32_HeaderSize   number of bytes in opu8_Header
+   \param[in]   orc_Payload       payload data to send after header
+
+   \return
+   C_NO_ERR   data sent successfully
+   C_CONFIG   required socket not initialized
+   C_RD_WR    error sending data
+   C_RANGE    handle invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCIpDispatcherLinuxSock::SendTcpWithHeader(const uint32 ou32_Handle, const uint8 * const opu8_Header,
+                                                     const uint32 ou32_HeaderSize,
+                                                     const std::vector<uint8> & orc_Payload)
+{
+   sint32 s32_Return;
+
+   if (ou32_Handle >= this->mc_SocketsTcp.size())
+   {
+      osc_write_log_error("openSYDE IP-TP", "SendTcpWithHeader called with invalid handle.");
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      s32_Return = C_NO_ERR;
+
+      if (this->mc_SocketsTcp[ou32_Handle].sn_Socket == INVALID_SOCKET)
+      {
+         osc_write_log_error("openSYDE IP-TP", "SendTcpWithHeader called with invalid socket.");
+         s32_Return = C_CONFIG;
+      }
+      else
+      {
+         const uintn un_TotalSize = static_cast<uintn>(ou32_HeaderSize) + orc_Payload.size();
+         iovec at_Parts[2];
+         msghdr t_Message;
+         sintn sn_BytesSent;
+
+         //lint -e{9005} //the API does not modify the data; it's only not declared as const
+         at_Parts[0].iov_base = const_cast<uint8 *>(opu8_Header);
+         at_Parts[0].iov_len = ou32_HeaderSize;
+         //lint -e{9005} //the API does not modify the data; it's only not declared as const
+         at_Parts[1].iov_base = (orc_Payload.size() > 0) ? const_cast<uint8 *>(&orc_Payload[0]) : NULL;
+         at_Parts[1].iov_len = orc_Payload.size();
+
+         (void)memset(&t_Message, 0, sizeof(t_Message));
+         t_Message.msg_iov = &at_Parts[0];
+         t_Message.msg_iovlen = 2;
+
+         sn_BytesSent = static_cast<sintn>(sendmsg(this->mc_SocketsTcp[ou32_Handle].sn_Socket, &t_Message, 0));
+         if (sn_BytesSent != static_cast<sintn>(un_TotalSize))
+         {
+            if (sn_BytesSent == -1)
+            {
+               C_SCLString c_ErrnoStr = strerror(errno);
+               osc_write_log_error("openSYDE IP-TP",
+                                   "SendTcpWithHeader: Could not send TCP service. Data lost. Error: " + c_ErrnoStr +
+                                   " IP-Address: " + mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+               if ((errno == ENOTCONN) || (errno == ECONNRESET))
+               {
+                  //we got kicked out; we'll remember that ...
+                  osc_write_log_warning("openSYDE IP-TP",
+                                        "SendTcpWithHeader: Connection aborted or reset ... IP-Address: " +
+                                        mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+                  (void)close(this->mc_SocketsTcp[ou32_Handle].sn_Socket);
+                  this->mc_SocketsTcp[ou32_Handle].sn_Socket = INVALID_SOCKET;
+                  m_OnTcpConnectionDropped(ou32_Handle);
+               }
+            }
+            else
+            {
+               osc_write_log_error("openSYDE IP-TP",
+                                   "SendTcpWithHeader: Could not send all data: tried: " +
+                                   C_SCLString::IntToStr(static_cast<sintn>(un_TotalSize)) +
+                                   "sent: " + C_SCLString::IntToStr(sn_BytesSent));
+            }
+            s32_Return = C_RD_WR;
+         }
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Read available data from TCP socket into receive buffer of connection
+
+   Reads as many bytes as currently available (up to the free size of the buffer) with one recv() call.
+   Unread data is moved to the start of the buffer first; the buffer is enlarged if it cannot hold
+   ou32_NumBytesRequired bytes.
+
+   Problems are only logged. The caller can find out by the number of bytes in the buffer whether enough data
+   is available.
+
+   \param[in,out]  orc_Connection          connection to read from
+   \param[in]      ou32_NumBytesRequired   number of bytes the caller wants to read from the buffer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCIpDispatcherLinuxSock::m_FillRxBuffer(C_TcpConnection & orc_Connection,
+                                                const uint32 ou32_NumBytesRequired) const
+{
+   sintn sn_BytesRead;
+
+   //move unread data to the start of the buffer:
+   if (orc_Connection.u32_RxBufferStart > 0U)
+   {
+      const uint32 u32_NumUnread = orc_Connection.u32_RxBufferEnd - orc_Connection.u32_RxBufferStart;
+      if (u32_NumUnread > 0U)
+      {
+         (void)memmove(&orc_Connection.c_RxBuffer[0], &orc_Connection.c_RxBuffer[orc_Connection.u32_RxBufferStart],
+                       u32_NumUnread);
+      }
+      orc_Connection.u32_RxBufferStart = 0U;
+      orc_Connection.u32_RxBufferEnd = u32_NumUnread;
+   }
+   if (orc_Connection.c_RxBuffer.size() < mhu32_TCP_RX_BUFFER_SIZE)
+   {
+      orc_Connection.c_RxBuffer.resize(mhu32_TCP_RX_BUFFER_SIZE);
+   }
+   if (orc_Connection.c_RxBuffer.size() < ou32_NumBytesRequired)
+   {
+      orc_Connection.c_RxBuffer.resize(ou32_NumBytesRequired);
+   }
+
+   //lint -e{926}  Side-effect of the "char"-based API. No side effects as long as we are on the Windows platform.
+   sn_BytesRead = recv(orc_Connection.sn_Socket,
+                       reinterpret_cast<charn *>(&orc_Connection.c_RxBuffer[orc_Connection.u32_RxBufferEnd]),
+                       orc_Connection.c_RxBuffer.size() - orc_Connection.u32_RxBufferEnd, 0);
+   if (sn_BytesRead > 0)
+   {
+      orc_Connection.u32_RxBufferEnd += static_cast<uint32>(sn_BytesRead);
+   }
+   else if ((sn_BytesRead == -1) && (errno != EWOULDBLOCK) && (errno != EAGAIN))
+   {
+      C_SCLString c_ErrnoStr = strerror(errno);
+      osc_write_log_error("openSYDE IP-TP", "Could not read TCP. Error: " + c_ErrnoStr + " IP-Address: " +
+                          mh_IpToText(orc_Connection.au8_IpAddress));
+   }
+   else
+   {
+      //no data available (or connection closed by peer; detected by IsTcpConnected) -> done here
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read data from TCP socket
 
@@ -836,6 +1007,10 @@ sint32 C_OSCIpDispatcherLinuxSock::SendTcp(const uint32 ou32_Handle, const std::
    - check whether TCP receive buffer contains required number of data bytes
    - read those bytes
 
+   The socket is read in larger blocks into a receive buffer per connection.
+   So a response split into multiple TCP segments or multiple responses in one segment can be handled
+   without additional system calls per requested block.
+
     The function shall not return any data unless it can provide as many data bytes as specified.
 
    \param[in]      ou32_Handle   handle obtained by InitTcp()
@@ -846,7 +1021,6 @@ sint32 C_OSCIpDispatcherLinuxSock::SendTcp(const uint32 ou32_Handle, const std::
    C_NO_ERR   data read successfully
    C_CONFIG   required socket not initialized
    C_NOACT    not enough bytes
-   C_RD_WR    error reading data
    C_RANGE    handle invalid
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -861,45 +1035,38 @@ sint32 C_OSCIpDispatcherLinuxSock::ReadTcp(const uint32 ou32_Handle, std::vector
    }
    else
    {
+      C_TcpConnection & rc_Connection = this->mc_SocketsTcp[ou32_Handle];
+      const uint32 u32_NumBytesRequired = static_cast<uint32>(orc_Data.size());
+
       s32_Return = C_NOACT;
 
-      if (this->mc_SocketsTcp[ou32_Handle].sn_Socket == INVALID_SOCKET)
+      if (rc_Connection.sn_Socket == INVALID_SOCKET)
       {
          osc_write_log_error("openSYDE IP-TP", "ReadTcp called with invalid socket.");
          s32_Return = C_CONFIG;
       }
       else
       {
-         sintn sn_Return;
-         sintn sn_SizeInBuffer;
-         //do we have enough bytes in RX buffer ?
-         sn_Return = ioctl(this->mc_SocketsTcp[ou32_Handle].sn_Socket, FIONREAD, &sn_SizeInBuffer);
-         if ((sn_Return == 0) && (sn_SizeInBuffer >= static_cast<sintn>(orc_Data.size())))
+         //do we have enough bytes in our buffer ?
+         if ((rc_Connection.u32_RxBufferEnd - rc_Connection.u32_RxBufferStart) < u32_NumBytesRequired)
+         {
+            this->m_FillRxBuffer(rc_Connection, u32_NumBytesRequired);
+         }
+         if ((rc_Connection.u32_RxBufferEnd - rc_Connection.u32_RxBufferStart) >= u32_NumBytesRequired)
          {
-            //enough bytes: read
-            //lint -e{926}  Side-effect of the "char"-based API. No side effects as long as we are on the Windows
-            // platform.
-            sintn sn_BytesRead = recv(this->mc_SocketsTcp[ou32_Handle].sn_Socket,
-                                      reinterpret_cast<charn *>(&orc_Data[0]), orc_Data.size(), 0);
-            if (sn_BytesRead == static_cast<sintn>(orc_Data.size()))
+            if (u32_NumBytesRequired > 0U)
             {
-               s32_Return = C_NO_ERR;
+               (void)memcpy(&orc_Data[0], &rc_Connection.c_RxBuffer[rc_Connection.u32_RxBufferStart],
+                            u32_NumBytesRequired);
             }
-            else
+            rc_Connection.u32_RxBufferStart += u32_NumBytesRequired;
+            if (rc_Connection.u32_RxBufferStart == rc_Connection.u32_RxBufferEnd)
             {
-               //comm error: no data read even though it was reported by ioctl
-               osc_write_log_error("openSYDE IP-TP",
-                                   "TCP unexpected error: data reported as available but reading failed. IP-Address: " +
-                                   mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
-               s32_Return = C_RD_WR;
+               //all read: start from the beginning again
+               rc_Connection.u32_RxBufferStart = 0U;
+               rc_Connection.u32_RxBufferEnd = 0U;
             }
-         }
-         else if (sn_Return == -1)
-         {
-            C_SCLString c_ErrnoStr = strerror(errno);
-            osc_write_log_error("openSYDE IP-TP", "Could not read TCP: buffer count could not be read. Error: " +
-                                c_ErrnoStr + " IP-Address: " +
-                                mh_IpToText(this->mc_SocketsTcp[ou32_Handle].au8_IpAddress));
+            s32_Return = C_NO_ERR;
          }
          else
          {
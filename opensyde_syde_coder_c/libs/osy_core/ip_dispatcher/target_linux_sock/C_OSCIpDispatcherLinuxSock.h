@@ -38,8 +38,13 @@ private:
    class C_TcpConnection
    {
    public:
-      stw_types::sintn sn_Socket;        ///< client socket
-      stw_types::uint8 au8_IpAddress[4]; ///< server's IP (remembered for reconnecting)
+      C_TcpConnection(void);
+
+      stw_types::sintn sn_Socket;                ///< client socket
+      stw_types::uint8 au8_IpAddress[4];         ///< server's IP (remembered for reconnecting)
+      std::vector<stw_types::uint8> c_RxBuffer;  ///< received data not yet read by the application
+      stw_types::uint32 u32_RxBufferStart;       ///< index of first unread byte in c_RxBuffer
+      stw_types::uint32 u32_RxBufferEnd;         ///< index after last received byte in c_RxBuffer
    };
 
    class C_BufferIdentifier
@@ -74,8 +79,12 @@ private:
    static std::map<C_BufferIdentifier, std::list<std::vector<stw_types::uint8> > > mhc_TcpBuffer; ///< dispatcher buffer
    static stw_tgl::C_TGLCriticalSection mhc_LockBuffer;
 
+   ///minimum size of receive buffer per TCP connection; big enough to take multiple responses with one recv() call
+   static const stw_types::uint32 mhu32_TCP_RX_BUFFER_SIZE = 0x10000U;
+
    stw_types::sint32 m_GetAllInstalledInterfaceIps(void);
    stw_types::sint32 m_ConnectTcp(C_TcpConnection & orc_Connection) const;
+   void m_FillRxBuffer(C_TcpConnection & orc_Connection, const stw_types::uint32 ou32_NumBytesRequired) const;
    stw_types::sint32 m_ConfigureUdpSocket(const bool oq_ServerPort, const stw_types::uint32 ou32_IpToBindTo,
                                           stw_types::sintn & orsn_Socket) const;
 
@@ -94,6 +103,10 @@ public:
    virtual stw_types::sint32 CloseUdp(void);
    virtual stw_types::sint32 SendTcp(const stw_types::uint32 ou32_Handle,
                                      const std::vector<stw_types::uint8> & orc_Data);
+   virtual stw_types::sint32 SendTcpWithHeader(const stw_types::uint32 ou32_Handle,
+                                               const stw_types::uint8 * const opu8_Header,
+                                               const stw_types::uint32 ou32_HeaderSize,
+                                               const std::vector<stw_types::uint8> & orc_Payload);
    virtual stw_types::sint32 ReadTcp(const stw_types::uint32 ou32_Handle, std::vector<stw_types::uint8> & orc_Data);
    virtual stw_types::sint32 ReadTcp(const stw_types::uint32 ou32_Handle,
                                      const stw_types::uint8 ou8_ClientBusIdentifier,
@@ -5,6 +5,12 @@
 
    Handler class for logging operations
 
+   By default each entry is formatted and written in the context of the calling thread.
+   With asynchronous writing active the calling thread only stores the raw entry data in a ring buffer.
+   A background thread formats the buffered entries and writes them in one block.
+   If the ring buffer is full new entries are dropped and the number of dropped entries is logged.
+   Errors and explicit flush requests write all buffered entries immediately.
+
    \copyright   Copyright 2017 Sensor-Technik Wiedemann GmbH. All rights reserved.
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -15,6 +21,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include "TGLFile.h"
 #include "C_OSCLoggingHandler.h"
 #include "stwerrors.h"
@@ -27,10 +34,23 @@ using namespace stw_errors;
 using namespace stw_opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const charn * const mpc_UNKNOWN_CLASS = "UNKNOWN_CLASS";
+static const charn * const mpc_UNKNOWN_FUNCTION = "UNKNOWN_FUNCTION";
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
+///Stops asynchronous writing on application exit so no buffered log entries get lost
+class C_OSCLoggingHandlerAsyncWriteShutdown
+{
+public:
+   ~C_OSCLoggingHandlerAsyncWriteShutdown(void)
+   {
+      C_OSCLoggingHandler::h_SetAsyncWriteActive(false);
+   }
+};
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
+const uint32 C_OSCLoggingHandler::mhu32_RECORD_BUFFER_SIZE = 4096U;
+const uint32 C_OSCLoggingHandler::mhu32_ASYNC_WRITE_INTERVAL = 20U;
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 bool C_OSCLoggingHandler::mhq_WriteToFile = false;
@@ -41,6 +61,18 @@ C_SCLString C_OSCLoggingHandler::mhc_FileName = "";
 C_TGLCriticalSection C_OSCLoggingHandler::mhc_ConsoleCriticalSection;
 C_TGLCriticalSection C_OSCLoggingHandler::mhc_FileCriticalSection;
 std::ofstream C_OSCLoggingHandler::mhc_File;
+bool C_OSCLoggingHandler::mhq_AsyncWrite = false;
+bool C_OSCLoggingHandler::mhq_AsyncWriterStop = false;
+std::vector<C_OSCLoggingHandler::C_LogRecord> C_OSCLoggingHandler::mhc_Records;
+std::vector<C_OSCLoggingHandler::C_LogRecord> C_OSCLoggingHandler::mhc_WriteBatch;
+uint32 C_OSCLoggingHandler::mhu32_RecordReadIndex = 0U;
+uint32 C_OSCLoggingHandler::mhu32_RecordCount = 0U;
+uint32 C_OSCLoggingHandler::mhu32_RecordsDropped = 0U;
+C_TGLCriticalSection C_OSCLoggingHandler::mhc_RecordCriticalSection;
+C_TGLCriticalSection C_OSCLoggingHandler::mhc_WriteBatchCriticalSection;
+C_TGLThread C_OSCLoggingHandler::mhc_AsyncWriter;
+//needs to be defined after all other members so it gets destroyed first
+static C_OSCLoggingHandlerAsyncWriteShutdown mc_AsyncWriteShutdown;
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
@@ -54,12 +86,23 @@ std::ofstream C_OSCLoggingHandler::mhc_File;
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCLoggingHandler::h_SetWriteToFileActive(const bool oq_Active)
 {
+   //Critical section (no output while the file is switched; entries queued before are written to the old file)
+   C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Acquire();
+   mh_OutputQueuedLogs();
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Acquire();
    if (C_OSCLoggingHandler::mhc_File.is_open() == true)
    {
       C_OSCLoggingHandler::mhc_File.close();
    }
    C_OSCLoggingHandler::mhq_WriteToFile = oq_Active;
    mh_OpenFile();
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Release();
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Release();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -92,12 +135,76 @@ void C_OSCLoggingHandler::h_SetMeasurePerformanceActive(const bool oq_Active)
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCLoggingHandler::h_SetCompleteLogFileLocation(const C_SCLString & orc_CompleteLogFileLocation)
 {
+   //Critical section (no output while the file is switched; entries queued before are written to the old file)
+   C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Acquire();
+   mh_OutputQueuedLogs();
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Acquire();
    if (C_OSCLoggingHandler::mhc_File.is_open() == true)
    {
       C_OSCLoggingHandler::mhc_File.close();
    }
    C_OSCLoggingHandler::mhc_FileName = orc_CompleteLogFileLocation;
    mh_OpenFile();
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Release();
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set asynchronous write active flag
+
+   If active, log entries are written by a background thread so the logging thread is not blocked by file I/O.
+   Deactivated automatically on application exit so all buffered entries get written.
+
+   \param[in] oq_Active New asynchronous write active flag
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::h_SetAsyncWriteActive(const bool oq_Active)
+{
+   if (oq_Active == true)
+   {
+      if (C_OSCLoggingHandler::mhc_AsyncWriter.IsRunning() == false)
+      {
+         C_OSCLoggingHandler::mhc_RecordCriticalSection.Acquire();
+         C_OSCLoggingHandler::mhc_Records.resize(mhu32_RECORD_BUFFER_SIZE);
+         C_OSCLoggingHandler::mhq_AsyncWriterStop = false;
+         C_OSCLoggingHandler::mhc_RecordCriticalSection.Release();
+
+         C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Acquire();
+         C_OSCLoggingHandler::mhc_WriteBatch.resize(mhu32_RECORD_BUFFER_SIZE);
+         C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Release();
+
+         if (C_OSCLoggingHandler::mhc_AsyncWriter.Start(&C_OSCLoggingHandler::mh_AsyncWriterThread, NULL) == C_NO_ERR)
+         {
+            C_OSCLoggingHandler::mhc_RecordCriticalSection.Acquire();
+            C_OSCLoggingHandler::mhq_AsyncWrite = true;
+            C_OSCLoggingHandler::mhc_RecordCriticalSection.Release();
+         }
+      }
+   }
+   else
+   {
+      //Critical section (entries written directly from now on wait until the buffered ones are written)
+      C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Acquire();
+
+      //new entries are written directly from now on
+      C_OSCLoggingHandler::mhc_RecordCriticalSection.Acquire();
+      C_OSCLoggingHandler::mhq_AsyncWrite = false;
+      C_OSCLoggingHandler::mhq_AsyncWriterStop = true;
+      C_OSCLoggingHandler::mhc_RecordCriticalSection.Release();
+
+      //write whatever the writer did not get to
+      mh_OutputQueuedLogs();
+
+      //Critical section
+      C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Release();
+
+      (void)C_OSCLoggingHandler::mhc_AsyncWriter.WaitFor();
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -158,6 +265,12 @@ void C_OSCLoggingHandler::h_WriteLogError(const C_SCLString & orc_Activity, cons
                                           const stw_types::charn * const opc_Function)
 {
    C_OSCLoggingHandler::mh_WriteLog("ERROR", orc_Activity, orc_Message, opc_Class, opc_Function);
+
+   //do not risk losing the context of an error
+   if (C_OSCLoggingHandler::mhq_AsyncWrite == true)
+   {
+      C_OSCLoggingHandler::h_Flush();
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -271,10 +384,14 @@ C_SCLString C_OSCLoggingHandler::h_StwError(const sint32 os32_Error)
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Utility to flush current log entries (No manual call necessary)
+
+   Also writes all entries buffered for asynchronous writing.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCLoggingHandler::h_Flush(void)
 {
+   mh_WriteQueuedLogs();
+
    if (C_OSCLoggingHandler::mhq_WriteToConsole == true)
    {
       //Critical section
@@ -285,14 +402,14 @@ void C_OSCLoggingHandler::h_Flush(void)
    }
 
    //File
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Acquire();
    if ((C_OSCLoggingHandler::mhq_WriteToFile == true) && (C_OSCLoggingHandler::mhc_File.is_open() == true))
    {
-      //Critical section
-      C_OSCLoggingHandler::mhc_FileCriticalSection.Acquire();
       C_OSCLoggingHandler::mhc_File.flush();
-      //Critical section
-      C_OSCLoggingHandler::mhc_FileCriticalSection.Release();
    }
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Release();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -335,68 +452,310 @@ void C_OSCLoggingHandler::mh_WriteLog(const C_SCLString & orc_Type, const C_SCLS
                                       const C_SCLString & orc_Message, const stw_types::charn * const opc_Class,
                                       const stw_types::charn * const opc_Function)
 {
-   std::string c_DateTimeFormatted;
    C_TGLDateTime c_DateTime;
-   std::stringstream c_LogEntryStream;
-   C_SCLString c_Class;
-   C_SCLString c_Function;
-   C_SCLString c_CombinedClassAndFunction;
-   if (opc_Class != NULL)
+   const charn * const pc_Class = (opc_Class != NULL) ? opc_Class : mpc_UNKNOWN_CLASS;
+   const charn * const pc_Function = (opc_Function != NULL) ? opc_Function : mpc_UNKNOWN_FUNCTION;
+
+   TGL_GetDateTimeNow(c_DateTime);
+
+   if (C_OSCLoggingHandler::mh_QueueLog(c_DateTime, orc_Type, orc_Activity, orc_Message, pc_Class,
+                                        pc_Function) == false)
    {
-      c_Class = TGL_ChangeFileExtension(TGL_ExtractFileName(opc_Class), "");
+      std::string c_LogEntry;
+      C_OSCLoggingHandler::mh_FormatLogEntry(c_DateTime, orc_Type.c_str(), orc_Activity.c_str(), orc_Message.c_str(),
+                                             pc_Class, pc_Function, c_LogEntry);
+
+      //Critical section (keeps order with entries buffered before asynchronous writing was deactivated)
+      C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Acquire();
+      C_OSCLoggingHandler::mh_OutputLogEntries(c_LogEntry);
+      //Critical section
+      C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Release();
    }
-   else
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store message in ring buffer for asynchronous writing
+
+   The string buffers of the ring buffer entries are reused, so no memory is allocated once the buffer is warmed up.
+
+   \param[in] orc_DateTime Time stamp of message
+   \param[in] orc_Type     Message type
+   \param[in] orc_Activity Current activity
+   \param[in] orc_Message  Message to write
+   \param[in] opc_Class    Current class
+   \param[in] opc_Function Current function
+
+   \return
+   true   message was stored or dropped because the buffer is full
+   false  asynchronous writing is not active; message needs to be written directly
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCLoggingHandler::mh_QueueLog(const C_TGLDateTime & orc_DateTime, const C_SCLString & orc_Type,
+                                      const C_SCLString & orc_Activity, const C_SCLString & orc_Message,
+                                      const charn * const opc_Class, const charn * const opc_Function)
+{
+   bool q_Queued = false;
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_RecordCriticalSection.Acquire();
+   if (C_OSCLoggingHandler::mhq_AsyncWrite == true)
+   {
+      if (C_OSCLoggingHandler::mhu32_RecordCount < mhu32_RECORD_BUFFER_SIZE)
+      {
+         C_LogRecord & rc_Record =
+            C_OSCLoggingHandler::mhc_Records[(C_OSCLoggingHandler::mhu32_RecordReadIndex +
+                                              C_OSCLoggingHandler::mhu32_RecordCount) % mhu32_RECORD_BUFFER_SIZE];
+         rc_Record.c_DateTime = orc_DateTime;
+         rc_Record.c_Type = orc_Type.c_str();
+         rc_Record.c_Activity = orc_Activity.c_str();
+         rc_Record.c_Message = orc_Message.c_str();
+         rc_Record.c_Class = opc_Class;
+         rc_Record.c_Function = opc_Function;
+         ++C_OSCLoggingHandler::mhu32_RecordCount;
+      }
+      else
+      {
+         ++C_OSCLoggingHandler::mhu32_RecordsDropped;
+      }
+      q_Queued = true;
+   }
+   //Critical section
+   C_OSCLoggingHandler::mhc_RecordCriticalSection.Release();
+
+   return q_Queued;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write all messages stored in ring buffer
+
+   The ring buffer is only locked while the entries are moved to the write batch.
+   Formatting and output are done without blocking logging threads.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_WriteQueuedLogs(void)
+{
+   //Critical section (keeps order of entries if multiple threads write)
+   C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Acquire();
+
+   C_OSCLoggingHandler::mh_OutputQueuedLogs();
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_WriteBatchCriticalSection.Release();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write all messages stored in ring buffer without locking the write batch
+
+   Caller must hold mhc_WriteBatchCriticalSection.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_OutputQueuedLogs(void)
+{
+   uint32 u32_Count;
+   uint32 u32_Dropped;
+
+   //Critical section
+   C_OSCLoggingHandler::mhc_RecordCriticalSection.Acquire();
+   u32_Count = C_OSCLoggingHandler::mhu32_RecordCount;
+   u32_Dropped = C_OSCLoggingHandler::mhu32_RecordsDropped;
+   for (uint32 u32_It = 0U; u32_It < u32_Count; ++u32_It)
    {
-      c_Class = "UNKNOWN_CLASS";
+      C_OSCLoggingHandler::mhc_Records[(C_OSCLoggingHandler::mhu32_RecordReadIndex + u32_It) %
+                                       mhu32_RECORD_BUFFER_SIZE].Swap(C_OSCLoggingHandler::mhc_WriteBatch[u32_It]);
    }
-   if (opc_Function != NULL)
+   if (u32_Count > 0U)
    {
-      c_Function = opc_Function;
+      C_OSCLoggingHandler::mhu32_RecordReadIndex = (C_OSCLoggingHandler::mhu32_RecordReadIndex + u32_Count) %
+                                                   mhu32_RECORD_BUFFER_SIZE;
    }
-   else
+   C_OSCLoggingHandler::mhu32_RecordCount = 0U;
+   C_OSCLoggingHandler::mhu32_RecordsDropped = 0U;
+   //Critical section
+   C_OSCLoggingHandler::mhc_RecordCriticalSection.Release();
+
+   if ((u32_Count > 0U) || (u32_Dropped > 0U))
    {
-      c_Function = "UNKNOWN_FUNCTION";
+      std::string c_LogEntries;
+      for (uint32 u32_It = 0U; u32_It < u32_Count; ++u32_It)
+      {
+         const C_LogRecord & rc_Record = C_OSCLoggingHandler::mhc_WriteBatch[u32_It];
+         C_OSCLoggingHandler::mh_FormatLogEntry(rc_Record.c_DateTime, rc_Record.c_Type.c_str(),
+                                                rc_Record.c_Activity.c_str(), rc_Record.c_Message.c_str(),
+                                                rc_Record.c_Class.c_str(), rc_Record.c_Function.c_str(),
+                                                c_LogEntries);
+      }
+      if (u32_Dropped > 0U)
+      {
+         C_TGLDateTime c_DateTime;
+         const C_SCLString c_Message = C_SCLString::IntToStr(u32_Dropped) +
+                                       " log entries dropped because the log buffer was full.";
+         TGL_GetDateTimeNow(c_DateTime);
+         C_OSCLoggingHandler::mh_FormatLogEntry(c_DateTime, "WARNING", "Logging", c_Message.c_str(), __FILE__,
+                                                TGL_UTIL_FUNC_ID, c_LogEntries);
+      }
+      C_OSCLoggingHandler::mh_OutputLogEntries(c_LogEntries);
    }
-   c_CombinedClassAndFunction = c_Class + "::" + c_Function;
+}
 
-   TGL_GetDateTimeNow(c_DateTime);
-   c_DateTimeFormatted = C_OSCLoggingHandler::h_UtilConvertDateTimeToString(c_DateTime);
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Background thread writing buffered messages
+
+   Runs until asynchronous writing is deactivated.
+
+   \param[in] opv_Instance Unused
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_AsyncWriterThread(void * const opv_Instance)
+{
+   bool q_Stop = false;
+
+   (void)opv_Instance;
+
+   while (q_Stop == false)
+   {
+      C_OSCLoggingHandler::mh_WriteQueuedLogs();
+      TGL_Sleep(mhu32_ASYNC_WRITE_INTERVAL);
+
+      //Critical section
+      C_OSCLoggingHandler::mhc_RecordCriticalSection.Acquire();
+      q_Stop = C_OSCLoggingHandler::mhq_AsyncWriterStop;
+      //Critical section
+      C_OSCLoggingHandler::mhc_RecordCriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Format log entry and append it to string
+
+   \param[in]     orc_DateTime   Time stamp of message
+   \param[in]     opc_Type       Message type (maximum 7 characters)
+   \param[in]     opc_Activity   Current activity (maximum 26 characters)
+   \param[in]     opc_Message    Message to write
+   \param[in]     opc_Class      Current class (combined with function: maximum 50 characters)
+                                 May be file path string which is reduced to file base name automatically
+   \param[in]     opc_Function   Current function (combined with function: maximum 50 characters)
+   \param[in,out] orc_LogEntries String to append formatted log entry to
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_FormatLogEntry(const C_TGLDateTime & orc_DateTime, const charn * const opc_Type,
+                                            const charn * const opc_Activity, const charn * const opc_Message,
+                                            const charn * const opc_Class, const charn * const opc_Function,
+                                            std::string & orc_LogEntries)
+{
+   const C_SCLString c_Class = TGL_ChangeFileExtension(TGL_ExtractFileName(opc_Class), "");
+   const uintn un_Start = static_cast<uintn>(orc_LogEntries.size());
 
    //Format:
    //[DATE/TIME] [TYPE_OF_REPORT (Info, Warning, Error)] [ACTIVITY] [CLASS::FUNCTION] [MESSAGE]
    //2017-08-29 07:32:19.123      INFO       Startup         Main                            Application started.
-   c_LogEntryStream << &std::left << std::setw(25) << c_DateTimeFormatted;
-   c_LogEntryStream << &std::left << std::setw(7) << orc_Type.c_str();
-   c_LogEntryStream << "  ";
-   c_LogEntryStream << &std::left << std::setw(26) << orc_Activity.c_str();
-   c_LogEntryStream << "  ";
-   c_LogEntryStream << &std::left << std::setw(52) << c_CombinedClassAndFunction.c_str();
-   c_LogEntryStream << "  ";
-   c_LogEntryStream << &std::left << orc_Message.c_str() << &std::endl;
+   //same as h_UtilConvertDateTimeToString but without the stream overhead
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu16_Year, 4U);
+   orc_LogEntries += '-';
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu8_Month, 2U);
+   orc_LogEntries += '-';
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu8_Day, 2U);
+   orc_LogEntries += ' ';
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu8_Hour, 2U);
+   orc_LogEntries += ':';
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu8_Minute, 2U);
+   orc_LogEntries += ':';
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu8_Second, 2U);
+   orc_LogEntries += '.';
+   C_OSCLoggingHandler::mh_AppendDecimal(orc_LogEntries, orc_DateTime.mu16_MilliSeconds, 3U);
+   C_OSCLoggingHandler::mh_PadToColumn(orc_LogEntries, un_Start + 25U);
+   orc_LogEntries += opc_Type;
+   C_OSCLoggingHandler::mh_PadToColumn(orc_LogEntries, un_Start + 25U + 7U);
+   orc_LogEntries += "  ";
+   orc_LogEntries += opc_Activity;
+   C_OSCLoggingHandler::mh_PadToColumn(orc_LogEntries, un_Start + 25U + 7U + 2U + 26U);
+   orc_LogEntries += "  ";
+   orc_LogEntries += c_Class.c_str();
+   orc_LogEntries += "::";
+   orc_LogEntries += opc_Function;
+   C_OSCLoggingHandler::mh_PadToColumn(orc_LogEntries, un_Start + 25U + 7U + 2U + 26U + 2U + 52U);
+   orc_LogEntries += "  ";
+   orc_LogEntries += opc_Message;
+   orc_LogEntries += '\n';
+}
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append decimal number with leading zeros
+
+   \param[in,out] orc_Text    String to append number to
+   \param[in]     ou32_Value  Number to append
+   \param[in]     ou32_Digits Minimum number of digits
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_AppendDecimal(std::string & orc_Text, const uint32 ou32_Value, const uint32 ou32_Digits)
+{
+   charn acn_Digits[10];
+   uint32 u32_Value = ou32_Value;
+   uint32 u32_Count = 0U;
+
+   do
+   {
+      acn_Digits[u32_Count] = static_cast<charn>('0' + static_cast<charn>(u32_Value % 10U));
+      u32_Value /= 10U;
+      ++u32_Count;
+   }
+   while (u32_Value > 0U);
+
+   for (uint32 u32_It = u32_Count; u32_It < ou32_Digits; ++u32_It)
+   {
+      orc_Text += '0';
+   }
+   while (u32_Count > 0U)
+   {
+      --u32_Count;
+      orc_Text += acn_Digits[u32_Count];
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Fill string with spaces up to column
+
+   Nothing is done if the string is already longer (same as std::setw with std::left).
+
+   \param[in,out] orc_Text   String to fill
+   \param[in]     oun_Column Target length of string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_PadToColumn(std::string & orc_Text, const uintn oun_Column)
+{
+   if (orc_Text.size() < oun_Column)
+   {
+      orc_Text.append(oun_Column - orc_Text.size(), ' ');
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Write formatted log entries to console and file
+
+   \param[in] orc_LogEntries Formatted log entries
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::mh_OutputLogEntries(const std::string & orc_LogEntries)
+{
    //Console
    if (C_OSCLoggingHandler::mhq_WriteToConsole == true)
    {
       //Critical section
       C_OSCLoggingHandler::mhc_ConsoleCriticalSection.Acquire();
-      std::cout << c_LogEntryStream.str();
+      std::cout << orc_LogEntries << &std::flush;
       //Critical section
       C_OSCLoggingHandler::mhc_ConsoleCriticalSection.Release();
    }
 
    //File
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Acquire();
    if ((C_OSCLoggingHandler::mhq_WriteToFile == true) && (C_OSCLoggingHandler::mhc_File.is_open() == true))
    {
-      const std::string c_Message = c_LogEntryStream.str();
-      //Critical section
-      C_OSCLoggingHandler::mhc_FileCriticalSection.Acquire();
-
       //TGL critical section -> file
-      C_OSCLoggingHandler::mhc_File.write(c_Message.c_str(), c_Message.size());
-
-      //Critical section
-      C_OSCLoggingHandler::mhc_FileCriticalSection.Release();
+      C_OSCLoggingHandler::mhc_File.write(orc_LogEntries.c_str(), orc_LogEntries.size());
    }
+   //Critical section
+   C_OSCLoggingHandler::mhc_FileCriticalSection.Release();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -439,3 +798,21 @@ C_OSCLoggingHandler::~C_OSCLoggingHandler(void)
       C_OSCLoggingHandler::mhc_File.close();
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Exchange content with other record
+
+   Swapping instead of copying keeps the allocated string buffers in the ring buffer for reuse.
+
+   \param[in,out] orc_Other Record to exchange content with
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCLoggingHandler::C_LogRecord::Swap(C_LogRecord & orc_Other)
+{
+   std::swap(this->c_DateTime, orc_Other.c_DateTime);
+   this->c_Type.swap(orc_Other.c_Type);
+   this->c_Activity.swap(orc_Other.c_Activity);
+   this->c_Message.swap(orc_Other.c_Message);
+   this->c_Class.swap(orc_Other.c_Class);
+   this->c_Function.swap(orc_Other.c_Function);
+}
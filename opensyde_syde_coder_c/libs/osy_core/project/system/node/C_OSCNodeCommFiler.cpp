@@ -58,7 +58,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComProtocolFile(C_OSCCanProtocol & orc_Node
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (c_XMLParser.SelectNodeChild("com-protocol") == "com-protocol")
+      if (c_XMLParser.TrySelectNodeChild("com-protocol") == true)
       {
          s32_Retval = C_OSCNodeCommFiler::h_LoadNodeComProtocol(orc_NodeComProtocol, c_XMLParser, orc_NodeDataPools);
       }
@@ -126,7 +126,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComProtocol(C_OSCCanProtocol & orc_NodeComP
       s32_Retval = C_CONFIG;
    }
 
-   if ((orc_XMLParser.SelectNodeChild("communication-protocol") == "communication-protocol") &&
+   if ((orc_XMLParser.TrySelectNodeChild("communication-protocol") == true) &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_StringToCommunicationProtocol(orc_XMLParser.GetNodeContent(), orc_NodeComProtocol.e_Type);
@@ -139,7 +139,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComProtocol(C_OSCCanProtocol & orc_NodeComP
       s32_Retval = C_CONFIG;
    }
 
-   if ((orc_XMLParser.SelectNodeChild("com-message-containers") == "com-message-containers") &&
+   if ((orc_XMLParser.TrySelectNodeChild("com-message-containers") == true) &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadNodeComMessageContainers(orc_NodeComProtocol.c_ComMessages, orc_XMLParser);
@@ -220,7 +220,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComProtocol(const C_OSCCanProtocol & orc_Node
    orc_XMLParser.CreateAndSelectNodeChild("com-message-containers");
    h_SaveNodeComMessageContainers(orc_NodeComProtocol.c_ComMessages, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-protocol");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("com-protocol"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -243,7 +243,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainers(
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComMessageContainer;
+   bool q_CurNodeComMessageContainerFound;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -254,11 +254,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainers(
       orc_NodeComMessageContainers.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComMessageContainer = orc_XMLParser.SelectNodeChild("com-message-container");
+   q_CurNodeComMessageContainerFound = orc_XMLParser.TrySelectNodeChild("com-message-container");
 
    //Clear
    orc_NodeComMessageContainers.clear();
-   if (c_CurNodeComMessageContainer == "com-message-container")
+   if (q_CurNodeComMessageContainerFound == true)
    {
       C_OSCCanMessageContainer c_CurComMessageContainer;
       do
@@ -272,11 +272,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainers(
          orc_NodeComMessageContainers.push_back(c_CurComMessageContainer);
 
          //Next
-         c_CurNodeComMessageContainer = orc_XMLParser.SelectNodeNext("com-message-container");
+         q_CurNodeComMessageContainerFound = orc_XMLParser.TrySelectNodeNext("com-message-container");
       }
-      while (c_CurNodeComMessageContainer == "com-message-container");
+      while (q_CurNodeComMessageContainerFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-containers");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message-containers"));
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -313,7 +313,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessageContainers(
       orc_XMLParser.CreateAndSelectNodeChild("com-message-container");
       h_SaveNodeComMessageContainer(orc_NodeComMessageContainers[u32_ItComMessageContainer], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-containers");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message-containers"));
    }
 }
 
@@ -340,13 +340,13 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainer(C_OSCCanMessageContaine
    orc_NodeComMessageContainer.q_IsComProtocolUsedByInterface =
       orc_XMLParser.GetAttributeBool("com-protocol-usage-flag");
 
-   if (orc_XMLParser.SelectNodeChild("tx-messages") == "tx-messages")
+   if (orc_XMLParser.TrySelectNodeChild("tx-messages") == true)
    {
       s32_Retval = h_LoadNodeComMessages(orc_NodeComMessageContainer.c_TxMessages, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message-container"));
       }
    }
    else
@@ -355,13 +355,13 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessageContainer(C_OSCCanMessageContaine
       s32_Retval = C_CONFIG;
    }
 
-   if ((orc_XMLParser.SelectNodeChild("rx-messages") == "rx-messages") && (s32_Retval == C_NO_ERR))
+   if ((orc_XMLParser.TrySelectNodeChild("rx-messages") == true) && (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadNodeComMessages(orc_NodeComMessageContainer.c_RxMessages, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message-container"));
       }
    }
    else
@@ -392,12 +392,12 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessageContainer(const C_OSCCanMessageCont
    orc_XMLParser.CreateAndSelectNodeChild("tx-messages");
    h_SaveNodeComMessages(orc_NodeComMessageContainer.c_TxMessages, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message-container"));
    //Rx messages
    orc_XMLParser.CreateAndSelectNodeChild("rx-messages");
    h_SaveNodeComMessages(orc_NodeComMessageContainer.c_RxMessages, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message-container");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message-container"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -420,7 +420,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessages(std::vector<C_OSCCanMessage> &
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComMessage;
+   bool q_CurNodeComMessageFound;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -431,11 +431,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessages(std::vector<C_OSCCanMessage> &
       orc_NodeComMessages.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComMessage = orc_XMLParser.SelectNodeChild("com-message");
+   q_CurNodeComMessageFound = orc_XMLParser.TrySelectNodeChild("com-message");
 
    //Clear
    orc_NodeComMessages.clear();
-   if (c_CurNodeComMessage == "com-message")
+   if (q_CurNodeComMessageFound == true)
    {
       do
       {
@@ -450,9 +450,9 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessages(std::vector<C_OSCCanMessage> &
          orc_NodeComMessages.push_back(c_CurComMessage);
 
          //Next
-         c_CurNodeComMessage = orc_XMLParser.SelectNodeNext("com-message");
+         q_CurNodeComMessageFound = orc_XMLParser.TrySelectNodeNext("com-message");
       }
-      while (c_CurNodeComMessage == "com-message");
+      while (q_CurNodeComMessageFound == true);
       //Return
       orc_XMLParser.SelectNodeParent();
    }
@@ -531,43 +531,43 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComMessage(C_OSCCanMessage & orc_NodeComMes
       orc_NodeComMessage.u32_TimeoutMs = (3UL * orc_NodeComMessage.u32_CycleTimeMs) + 10UL;
    }
 
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.TrySelectNodeChild("name") == true)
    {
       orc_NodeComMessage.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message"));
    }
    else
    {
       osc_write_log_error("Loading node definition", "Could not find \"com-message\".\"name\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+   if (orc_XMLParser.TrySelectNodeChild("comment") == true)
    {
       orc_NodeComMessage.c_Comment = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message"));
    }
-   if ((orc_XMLParser.SelectNodeChild("tx-method") == "tx-method") &&
+   if ((orc_XMLParser.TrySelectNodeChild("tx-method") == true) &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = mh_StringToNodeComMessageTxMethod(orc_XMLParser.GetNodeContent(), orc_NodeComMessage.e_TxMethod);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message"));
    }
    else
    {
       osc_write_log_error("Loading node definition", "Could not find \"com-message\".\"tx-method\" node.");
       s32_Retval = C_CONFIG;
    }
-   if ((orc_XMLParser.SelectNodeChild("com-signals") == "com-signals") &&
+   if ((orc_XMLParser.TrySelectNodeChild("com-signals") == true) &&
        (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadNodeComSignals(orc_NodeComMessage.c_Signals, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message"));
       }
    }
    else
@@ -604,7 +604,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComMessage(const C_OSCCanMessage & orc_NodeCo
    orc_XMLParser.CreateAndSelectNodeChild("com-signals");
    h_SaveNodeComSignals(orc_NodeComMessage.c_Signals, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "com-message");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("com-message"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -627,7 +627,7 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignals(std::vector<C_OSCCanSignal> & or
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComSignal;
+   bool q_CurNodeComSignalFound;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -638,11 +638,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignals(std::vector<C_OSCCanSignal> & or
       orc_NodeComSignals.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComSignal = orc_XMLParser.SelectNodeChild("com-signal");
+   q_CurNodeComSignalFound = orc_XMLParser.TrySelectNodeChild("com-signal");
 
    //Clear
    orc_NodeComSignals.clear();
-   if (c_CurNodeComSignal == "com-signal")
+   if (q_CurNodeComSignalFound == true)
    {
       do
       {
@@ -657,11 +657,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignals(std::vector<C_OSCCanSignal> & or
          orc_NodeComSignals.push_back(c_CurComSignal);
 
          //Next
-         c_CurNodeComSignal = orc_XMLParser.SelectNodeNext("com-signal");
+         q_CurNodeComSignalFound = orc_XMLParser.TrySelectNodeNext("com-signal");
       }
-      while (c_CurNodeComSignal == "com-signal");
+      while (q_CurNodeComSignalFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signals");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-signals"));
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -697,7 +697,7 @@ void C_OSCNodeCommFiler::h_SaveNodeComSignals(const std::vector<C_OSCCanSignal>
       orc_XMLParser.CreateAndSelectNodeChild("com-signal");
       h_SaveNodeComSignal(orc_NodeComSignals[u32_ItComSignal], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signals");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-signals"));
    }
 }
 
@@ -724,11 +724,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignal(C_OSCCanSignal & orc_NodeComSigna
    orc_NodeComSignal.u16_ComBitStart = static_cast<uint16>(orc_XMLParser.GetAttributeUint32("bit-start"));
    orc_NodeComSignal.u16_ComBitLength = static_cast<uint16>(orc_XMLParser.GetAttributeUint32("bit-length"));
 
-   if (orc_XMLParser.SelectNodeChild("byte-order") == "byte-order")
+   if (orc_XMLParser.TrySelectNodeChild("byte-order") == true)
    {
       s32_Retval = mh_StringToCommunicationByteOrder(orc_XMLParser.GetNodeContent(), orc_NodeComSignal.e_ComByteOrder);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signal");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-signal"));
    }
    else
    {
@@ -736,11 +736,11 @@ sint32 C_OSCNodeCommFiler::h_LoadNodeComSignal(C_OSCCanSignal & orc_NodeComSigna
                           "Could not find \"com-message\".\"com-signals\".\nbyte-order\" node.");
       s32_Retval = C_CONFIG;
    }
-   if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("multiplexer-type") == "multiplexer-type"))
+   if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("multiplexer-type") == true))
    {
       s32_Retval = mh_StringToCommunicationMuxType(orc_XMLParser.GetNodeContent(), orc_NodeComSignal.e_MultiplexerType);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-signal");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-signal"));
    }
    else
    {
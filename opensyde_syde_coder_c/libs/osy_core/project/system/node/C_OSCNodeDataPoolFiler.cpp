@@ -68,7 +68,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolFile(C_OSCNodeDataPool & orc_NodeDa
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (c_XMLParser.SelectNodeChild("data-pool") == "data-pool")
+      if (c_XMLParser.TrySelectNodeChild("data-pool") == true)
       {
          s32_Retval = C_OSCNodeDataPoolFiler::h_LoadDataPool(orc_NodeDataPool, c_XMLParser);
       }
@@ -125,13 +125,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPool(C_OSCNodeDataPool & orc_NodeDataPo
    }
    orc_NodeDataPool.u32_NvMStartAddress = orc_XMLParser.GetAttributeUint32("nvm-start-address");
    orc_NodeDataPool.u32_NvMSize = orc_XMLParser.GetAttributeUint32("nvm-size");
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.TrySelectNodeChild("type") == true)
    {
       s32_Retval = h_StringToDataPool(orc_XMLParser.GetNodeContent(), orc_NodeDataPool.e_Type);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
       }
    }
    else
@@ -139,49 +139,49 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPool(C_OSCNodeDataPool & orc_NodeDataPo
       osc_write_log_error("Loading Datapool", "Could not find \"type\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.TrySelectNodeChild("name") == true)
    {
       orc_NodeDataPool.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"name\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("version") == "version")
+   if (orc_XMLParser.TrySelectNodeChild("version") == true)
    {
       orc_NodeDataPool.au8_Version[0] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("major"));
       orc_NodeDataPool.au8_Version[1] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("minor"));
       orc_NodeDataPool.au8_Version[2] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("release"));
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"version\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+   if (orc_XMLParser.TrySelectNodeChild("comment") == true)
    {
       orc_NodeDataPool.c_Comment = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"comment\" node.");
       s32_Retval = C_CONFIG;
    }
-   if ((orc_XMLParser.SelectNodeChild("lists") == "lists") && (s32_Retval == C_NO_ERR))
+   if ((orc_XMLParser.TrySelectNodeChild("lists") == true) && (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadDataPoolLists(orc_NodeDataPool.c_Lists, orc_XMLParser);
 
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
       }
    }
    else
@@ -219,14 +219,14 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPool(const C_OSCNodeDataPool & orc_NodeDa
    orc_XMLParser.SetAttributeUint32("minor", orc_NodeDataPool.au8_Version[1]);
    orc_XMLParser.SetAttributeUint32("release", orc_NodeDataPool.au8_Version[2]);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
 
    orc_XMLParser.CreateNodeChild("comment", orc_NodeDataPool.c_Comment);
    //Lists
    orc_XMLParser.CreateAndSelectNodeChild("lists");
    h_SaveDataPoolLists(orc_NodeDataPool.c_Lists, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pool");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pool"));
    orc_XMLParser.CreateNodeChild("export-settings", "");
 }
 
@@ -254,22 +254,22 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolList(C_OSCNodeDataPoolList & orc_No
    orc_NodeDataPoolList.u32_NvMCRC = orc_XMLParser.GetAttributeUint32("nvm-crc");
    orc_NodeDataPoolList.u32_NvMStartAddress = orc_XMLParser.GetAttributeUint32("nvm-start-address");
    orc_NodeDataPoolList.u32_NvMSize = orc_XMLParser.GetAttributeUint32("nvm-size");
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.TrySelectNodeChild("name") == true)
    {
       orc_NodeDataPoolList.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("list"));
    }
    else
    {
       osc_write_log_error("Loading Datapool", "Could not find \"lists\".\"list\".\"name\" node.");
       s32_Retval = C_CONFIG;
    }
-   if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+   if (orc_XMLParser.TrySelectNodeChild("comment") == true)
    {
       orc_NodeDataPoolList.c_Comment = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("list"));
    }
    else
    {
@@ -279,13 +279,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolList(C_OSCNodeDataPoolList & orc_No
    //Data elements
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("data-elements") == "data-elements")
+      if (orc_XMLParser.TrySelectNodeChild("data-elements") == true)
       {
          s32_Retval = h_LoadDataPoolListElements(orc_NodeDataPoolList.c_Elements, orc_XMLParser);
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("list"));
          }
       }
       else
@@ -295,13 +295,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolList(C_OSCNodeDataPoolList & orc_No
       }
    }
    //Data sets
-   if ((orc_XMLParser.SelectNodeChild("data-sets") == "data-sets") && (s32_Retval == C_NO_ERR))
+   if ((orc_XMLParser.TrySelectNodeChild("data-sets") == true) && (s32_Retval == C_NO_ERR))
    {
       s32_Retval = h_LoadDataPoolListDataSets(orc_NodeDataPoolList.c_DataSets, orc_XMLParser);
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("list"));
       }
    }
    else
@@ -336,12 +336,12 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolList(const C_OSCNodeDataPoolList & or
    orc_XMLParser.CreateAndSelectNodeChild("data-elements");
    h_SaveDataPoolListElements(orc_NodeDataPoolList.c_Elements, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("list"));
    //Data sets
    orc_XMLParser.CreateAndSelectNodeChild("data-sets");
    h_SaveDataPoolListDataSets(orc_NodeDataPoolList.c_DataSets, orc_XMLParser);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "list");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("list"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -368,11 +368,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
    orc_NodeDataPoolListElement.f64_Offset = orc_XMLParser.GetAttributeFloat64("offset");
    orc_NodeDataPoolListElement.q_DiagEventCall = orc_XMLParser.GetAttributeBool("diag-event-call");
    orc_NodeDataPoolListElement.u32_NvMStartAddress = orc_XMLParser.GetAttributeUint32("nvm-start-address");
-   if (orc_XMLParser.SelectNodeChild("name") == "name")
+   if (orc_XMLParser.TrySelectNodeChild("name") == true)
    {
       orc_NodeDataPoolListElement.c_Name = orc_XMLParser.GetNodeContent();
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
    }
    else
    {
@@ -385,7 +385,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("min-value") == "min-value")
+      if (orc_XMLParser.TrySelectNodeChild("min-value") == true)
       {
          //copy over value so we have the correct type:
          orc_NodeDataPoolListElement.c_MinValue = orc_NodeDataPoolListElement.c_Value;
@@ -395,7 +395,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
          orc_NodeDataPoolListElement.c_NvmValue = orc_NodeDataPoolListElement.c_MinValue;
          orc_NodeDataPoolListElement.c_Value = orc_NodeDataPoolListElement.c_MinValue;
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
       }
       else
       {
@@ -406,14 +406,14 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("max-value") == "max-value")
+      if (orc_XMLParser.TrySelectNodeChild("max-value") == true)
       {
          //copy over value so we have the correct type:
          orc_NodeDataPoolListElement.c_MaxValue = orc_NodeDataPoolListElement.c_Value;
 
          s32_Retval = h_LoadDataPoolElementValue(orc_NodeDataPoolListElement.c_MaxValue, orc_XMLParser, false);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
       }
       else
       {
@@ -424,11 +424,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.TrySelectNodeChild("comment") == true)
       {
          orc_NodeDataPoolListElement.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
       }
       else
       {
@@ -439,11 +439,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("unit") == "unit")
+      if (orc_XMLParser.TrySelectNodeChild("unit") == true)
       {
          orc_NodeDataPoolListElement.c_Unit = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
       }
       else
       {
@@ -454,12 +454,12 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("access") == "access")
+      if (orc_XMLParser.TrySelectNodeChild("access") == true)
       {
          s32_Retval =
             mh_StringToNodeDataPoolElementAccess(orc_XMLParser.GetNodeContent(), orc_NodeDataPoolListElement.e_Access);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
       }
       else
       {
@@ -470,13 +470,13 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElement(C_OSCNodeDataPoolListElemen
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("data-set-values") == "data-set-values")
+      if (orc_XMLParser.TrySelectNodeChild("data-set-values") == true)
       {
          s32_Retval = h_LoadDataPoolListElementDataSetValues(orc_NodeDataPoolListElement.c_Value,
                                                              orc_NodeDataPoolListElement.c_DataSetValues,
                                                              orc_XMLParser);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
       }
       else
       {
@@ -516,7 +516,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolElement(const C_OSCNodeDataPoolListEl
    orc_XMLParser.CreateAndSelectNodeChild("data-set-values");
    h_SaveDataPoolListElementDataSetValues(orc_NodeDataPoolListElement.c_DataSetValues, orc_XMLParser);
    //Return to parent
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "data-element");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("data-element"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -538,7 +538,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolLists(std::vector<C_OSCNodeDataPool
                                                    C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeList;
+   bool q_CurNodeListFound;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -549,11 +549,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolLists(std::vector<C_OSCNodeDataPool
       orc_NodeDataPoolLists.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeList = orc_XMLParser.SelectNodeChild("list");
+   q_CurNodeListFound = orc_XMLParser.TrySelectNodeChild("list");
 
    //Clear
    orc_NodeDataPoolLists.clear();
-   if (c_CurNodeList == "list")
+   if (q_CurNodeListFound == true)
    {
       do
       {
@@ -566,14 +566,14 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolLists(std::vector<C_OSCNodeDataPool
 
          orc_NodeDataPoolLists.push_back(c_CurList);
          //Next
-         c_CurNodeList = orc_XMLParser.SelectNodeNext("list");
+         q_CurNodeListFound = orc_XMLParser.TrySelectNodeNext("list");
       }
-      while (c_CurNodeList == "list");
+      while (q_CurNodeListFound == true);
 
       if (s32_Retval == C_NO_ERR)
       {
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "lists");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("lists"));
       }
    }
    //Compare length
@@ -610,7 +610,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolLists(const std::vector<C_OSCNodeData
       orc_XMLParser.CreateAndSelectNodeChild("list");
       h_SaveDataPoolList(orc_NodeDataPoolLists[u32_ItList], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "lists");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("lists"));
    }
 }
 
@@ -633,7 +633,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElements(
    std::vector<C_OSCNodeDataPoolListElement> & orc_NodeDataPoolListElements, C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeDataElement;
+   bool q_CurNodeDataElementFound;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -644,11 +644,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElements(
       orc_NodeDataPoolListElements.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeDataElement = orc_XMLParser.SelectNodeChild("data-element");
+   q_CurNodeDataElementFound = orc_XMLParser.TrySelectNodeChild("data-element");
 
    //Clear
    orc_NodeDataPoolListElements.clear();
-   if (c_CurNodeDataElement == "data-element")
+   if (q_CurNodeDataElementFound == true)
    {
       do
       {
@@ -663,11 +663,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElements(
          orc_NodeDataPoolListElements.push_back(c_CurDataElement);
 
          //Next
-         c_CurNodeDataElement = orc_XMLParser.SelectNodeNext("data-element");
+         q_CurNodeDataElementFound = orc_XMLParser.TrySelectNodeNext("data-element");
       }
-      while (c_CurNodeDataElement == "data-element");
+      while (q_CurNodeDataElementFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-elements");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-elements"));
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -704,7 +704,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolListElements(
       orc_XMLParser.CreateAndSelectNodeChild("data-element");
       h_SaveDataPoolElement(orc_NodeDataPoolListElements[u32_ItDataElement], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-elements");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-elements"));
    }
 }
 
@@ -731,9 +731,9 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElementDataSetValues(const C_OS
                                                                       C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeDataSetValue = orc_XMLParser.SelectNodeChild("data-set-value");
+   bool q_CurNodeDataSetValueFound = orc_XMLParser.TrySelectNodeChild("data-set-value");
 
-   if (c_CurNodeDataSetValue == "data-set-value")
+   if (q_CurNodeDataSetValueFound == true)
    {
       do
       {
@@ -748,11 +748,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListElementDataSetValues(const C_OS
          orc_NodeDataPoolListElementDataSetValues.push_back(c_CurDataSetValue);
 
          //Next
-         c_CurNodeDataSetValue = orc_XMLParser.SelectNodeNext("data-set-value");
+         q_CurNodeDataSetValueFound = orc_XMLParser.TrySelectNodeNext("data-set-value");
       }
-      while (c_CurNodeDataSetValue == "data-set-value");
+      while (q_CurNodeDataSetValueFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-set-values");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-set-values"));
    }
    return s32_Retval;
 }
@@ -800,31 +800,31 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListDataSets(
    std::vector<C_OSCNodeDataPoolDataSet> & orc_NodeDataPoolListDataSets, C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNodeDataSet = orc_XMLParser.SelectNodeChild("data-set");
+   bool q_CurNodeDataSetFound = orc_XMLParser.TrySelectNodeChild("data-set");
 
    orc_NodeDataPoolListDataSets.clear();
-   if (c_CurNodeDataSet == "data-set")
+   if (q_CurNodeDataSetFound == true)
    {
       do
       {
          C_OSCNodeDataPoolDataSet c_CurDataSet;
 
-         if (orc_XMLParser.SelectNodeChild("name") == "name")
+         if (orc_XMLParser.TrySelectNodeChild("name") == true)
          {
             c_CurDataSet.c_Name = orc_XMLParser.GetNodeContent();
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "data-set");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("data-set"));
          }
          else
          {
             s32_Retval = C_CONFIG;
          }
 
-         if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+         if (orc_XMLParser.TrySelectNodeChild("comment") == true)
          {
             c_CurDataSet.c_Comment = orc_XMLParser.GetNodeContent();
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "data-set");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("data-set"));
          }
          else
          {
@@ -835,11 +835,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolListDataSets(
          orc_NodeDataPoolListDataSets.push_back(c_CurDataSet);
 
          //Next
-         c_CurNodeDataSet = orc_XMLParser.SelectNodeNext("data-set");
+         q_CurNodeDataSetFound = orc_XMLParser.TrySelectNodeNext("data-set");
       }
-      while (c_CurNodeDataSet == "data-set");
+      while (q_CurNodeDataSetFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-sets");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-sets"));
    }
    return s32_Retval;
 }
@@ -866,7 +866,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolListDataSets(
       orc_XMLParser.CreateNodeChild("name", rc_DataSet.c_Name);
       orc_XMLParser.CreateNodeChild("comment", rc_DataSet.c_Comment);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-sets");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-sets"));
    }
 }
 
@@ -965,7 +965,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementType(C_OSCNodeDataPoolConten
 {
    sint32 s32_Retval = C_CONFIG;
 
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.TrySelectNodeChild("type") == true)
    {
       C_OSCNodeDataPoolContent::E_Type e_Type;
       s32_Retval = mh_StringToNodeDataPoolContent(orc_XMLParser.GetAttributeString("base-type"), e_Type);
@@ -1087,8 +1087,8 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
    else
    {
       //Array
-      C_SCLString c_CurNode = orc_XMLParser.SelectNodeChild("element");
-      if (c_CurNode == "element")
+      bool q_CurNodeFound = orc_XMLParser.TrySelectNodeChild("element");
+      if (q_CurNodeFound == true)
       {
          uint32 u32_CurIndex = 0U;
          do
@@ -1147,9 +1147,9 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolElementValue(C_OSCNodeDataPoolConte
                break;
             }
             u32_CurIndex++; //next element
-            c_CurNode = orc_XMLParser.SelectNodeNext("element");
+            q_CurNodeFound = orc_XMLParser.TrySelectNodeNext("element");
          }
-         while ((c_CurNode == "element") && (s32_Retval == C_NO_ERR));
+         while ((q_CurNodeFound == true) && (s32_Retval == C_NO_ERR));
 
          //check whether we have the correct number of elements:
          if (u32_CurIndex != orc_NodeDataPoolContent.GetArraySize())
@@ -1267,7 +1267,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolElementValue(const stw_scl::C_SCLStri
             break;
          }
          //Return to parent
-         tgl_assert(orc_XMLParser.SelectNodeParent() == orc_NodeName);
+         tgl_assert(orc_XMLParser.TrySelectNodeParent(orc_NodeName.c_str()));
       }
    }
    //Return to parent
@@ -1379,7 +1379,7 @@ void C_OSCNodeDataPoolFiler::h_SaveDataPoolContentV1(const C_OSCNodeDataPoolCont
             break;
          }
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "array");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("array"));
       }
       //Return
       orc_XMLParser.SelectNodeParent();
@@ -1567,7 +1567,7 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.TrySelectNodeChild("type") == true)
    {
       C_OSCNodeDataPoolContent::E_Type e_Type;
       s32_Retval = mh_StringToNodeDataPoolContent(orc_XMLParser.GetNodeContent(), e_Type);
@@ -1589,10 +1589,10 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
    else
    {
       //Array
-      if (orc_XMLParser.SelectNodeChild("array") == "array")
+      if (orc_XMLParser.TrySelectNodeChild("array") == true)
       {
-         C_SCLString c_CurNode = orc_XMLParser.SelectNodeChild("element");
-         if (c_CurNode == "element")
+         bool q_CurNodeFound = orc_XMLParser.TrySelectNodeChild("element");
+         if (q_CurNodeFound == true)
          {
             uint32 u32_CurIndex;
             do
@@ -1645,11 +1645,11 @@ sint32 C_OSCNodeDataPoolFiler::h_LoadDataPoolContentV1(C_OSCNodeDataPoolContent
                                                               u32_CurIndex);
                   break;
                }
-               c_CurNode = orc_XMLParser.SelectNodeNext("element");
+               q_CurNodeFound = orc_XMLParser.TrySelectNodeNext("element");
             }
-            while (c_CurNode == "element");
+            while (q_CurNodeFound == true);
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "array");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("array"));
          }
          //Return
          orc_XMLParser.SelectNodeParent();
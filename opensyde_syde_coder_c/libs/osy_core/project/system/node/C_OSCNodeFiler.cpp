@@ -60,7 +60,7 @@ sint32 C_OSCNodeFiler::h_LoadNodeFile(C_OSCNode & orc_Node, const C_SCLString &
 
    if (s32_Retval == C_NO_ERR)
    {
-      if (c_XMLParser.SelectNodeChild("node") == "node")
+      if (c_XMLParser.TrySelectNodeChild("node") == true)
       {
          s32_Retval = C_OSCNodeFiler::h_LoadNode(orc_Node, c_XMLParser, orc_FilePath);
       }
@@ -102,7 +102,7 @@ sint32 C_OSCNodeFiler::h_LoadNode(C_OSCNode & orc_Node, C_OSCXMLParserBase & orc
    orc_Node.Initialize();
 
    //Type
-   if (orc_XMLParser.SelectNodeChild("type") == "type")
+   if (orc_XMLParser.TrySelectNodeChild("type") == true)
    {
       orc_Node.c_DeviceType = orc_XMLParser.GetNodeContent();
       //Return
@@ -120,14 +120,14 @@ sint32 C_OSCNodeFiler::h_LoadNode(C_OSCNode & orc_Node, C_OSCXMLParserBase & orc
          {
             s32_Retval = mh_LoadHALC(orc_Node.c_HALCConfig, orc_XMLParser, orc_BasePath);
             //AFTER loading the datapools
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("com-protocols") == "com-protocols"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("com-protocols") == true))
             {
                s32_Retval = h_LoadNodeComProtocols(orc_Node.c_ComProtocols, orc_Node.c_DataPools, orc_XMLParser,
                                                    orc_BasePath);
                if (s32_Retval == C_NO_ERR)
                {
                   //Return
-                  tgl_assert(orc_XMLParser.SelectNodeParent() == "node"); //back up to node
+                  tgl_assert(orc_XMLParser.TrySelectNodeParent("node")); //back up to node
                }
             }
             else
@@ -217,7 +217,7 @@ sint32 C_OSCNodeFiler::h_SaveNode(const C_OSCNode & orc_Node, C_OSCXMLParserBase
    if (s32_Retval == C_NO_ERR)
    {
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
       s32_Retval = mh_SaveDataPools(orc_Node.c_DataPools, orc_XMLParser, orc_BasePath, opc_CreatedFiles);
    }
    if (s32_Retval == C_NO_ERR)
@@ -251,7 +251,7 @@ sint32 C_OSCNodeFiler::h_LoadNodeComProtocols(std::vector<C_OSCCanProtocol> & or
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   C_SCLString c_CurNodeComProtocol;
+   bool q_CurNodeComProtocolFound;
    uint32 u32_ExpectedSize = 0UL;
    const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -262,11 +262,11 @@ sint32 C_OSCNodeFiler::h_LoadNodeComProtocols(std::vector<C_OSCCanProtocol> & or
       orc_NodeComProtocols.reserve(u32_ExpectedSize);
    }
 
-   c_CurNodeComProtocol = orc_XMLParser.SelectNodeChild("com-protocol");
+   q_CurNodeComProtocolFound = orc_XMLParser.TrySelectNodeChild("com-protocol");
 
    //Clear
    orc_NodeComProtocols.clear();
-   if (c_CurNodeComProtocol == "com-protocol")
+   if (q_CurNodeComProtocolFound == true)
    {
       do
       {
@@ -292,11 +292,11 @@ sint32 C_OSCNodeFiler::h_LoadNodeComProtocols(std::vector<C_OSCCanProtocol> & or
          orc_NodeComProtocols.push_back(c_CurComProtocol);
 
          //Next
-         c_CurNodeComProtocol = orc_XMLParser.SelectNodeNext("com-protocol");
+         q_CurNodeComProtocolFound = orc_XMLParser.TrySelectNodeNext("com-protocol");
       }
-      while (c_CurNodeComProtocol == "com-protocol");
+      while (q_CurNodeComProtocolFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-protocols");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-protocols"));
    }
    //Compare length
    if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -378,7 +378,7 @@ sint32 C_OSCNodeFiler::h_SaveNodeComProtocols(const std::vector<C_OSCCanProtocol
                                 rc_CurProtocol.u32_DataPoolIndex) + " for comm protocol");
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "com-protocols");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("com-protocols"));
    }
    return s32_Retval;
 }
@@ -428,14 +428,14 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("properties") == "properties")
+   if (orc_XMLParser.TrySelectNodeChild("properties") == true)
    {
       //Name
-      if (orc_XMLParser.SelectNodeChild("name") == "name")
+      if (orc_XMLParser.TrySelectNodeChild("name") == true)
       {
          orc_NodeProperties.c_Name = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
       }
       else
       {
@@ -443,19 +443,19 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
          s32_Retval = C_CONFIG;
       }
       //Comment
-      if (orc_XMLParser.SelectNodeChild("comment") == "comment")
+      if (orc_XMLParser.TrySelectNodeChild("comment") == true)
       {
          orc_NodeProperties.c_Comment = orc_XMLParser.GetNodeContent();
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
       }
       //Diagnostic server
-      if ((orc_XMLParser.SelectNodeChild("diagnostic-server") == "diagnostic-server") && (s32_Retval == C_NO_ERR))
+      if ((orc_XMLParser.TrySelectNodeChild("diagnostic-server") == true) && (s32_Retval == C_NO_ERR))
       {
          s32_Retval =
             mh_StringToDiagnosticServer(orc_XMLParser.GetNodeContent(), orc_NodeProperties.e_DiagnosticServer);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
       }
       else
       {
@@ -463,11 +463,11 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
          s32_Retval = C_CONFIG;
       }
       //Flash loader
-      if ((orc_XMLParser.SelectNodeChild("flash-loader") == "flash-loader") && (s32_Retval == C_NO_ERR))
+      if ((orc_XMLParser.TrySelectNodeChild("flash-loader") == true) && (s32_Retval == C_NO_ERR))
       {
          s32_Retval = mh_StringToFlashLoader(orc_XMLParser.GetNodeContent(), orc_NodeProperties.e_FlashLoader);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
       }
       else
       {
@@ -476,14 +476,14 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
       }
 
       //Communication interfaces
-      if ((orc_XMLParser.SelectNodeChild("communication-interfaces") == "communication-interfaces") &&
+      if ((orc_XMLParser.TrySelectNodeChild("communication-interfaces") == true) &&
           (s32_Retval == C_NO_ERR))
       {
          s32_Retval = mh_LoadComInterface(orc_NodeProperties.c_ComInterfaces, orc_XMLParser);
       }
 
       //openSYDE server settings
-      if (orc_XMLParser.SelectNodeChild("open-syde-server-settings") == "open-syde-server-settings")
+      if (orc_XMLParser.TrySelectNodeChild("open-syde-server-settings") == true)
       {
          if (orc_XMLParser.AttributeExists("max-clients") == true)
          {
@@ -532,7 +532,7 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
          }
 
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
       }
       else
       {
@@ -546,14 +546,14 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
       }
 
       //Code export settings
-      if ((orc_XMLParser.SelectNodeChild("code-export-settings") == "code-export-settings") && (s32_Retval == C_NO_ERR))
+      if ((orc_XMLParser.TrySelectNodeChild("code-export-settings") == true) && (s32_Retval == C_NO_ERR))
       {
-         if (orc_XMLParser.SelectNodeChild("scaling-support") == "scaling-support")
+         if (orc_XMLParser.TrySelectNodeChild("scaling-support") == true)
          {
             s32_Retval = C_OSCSystemFilerUtil::h_StringToCodeExportScalingType(
                orc_XMLParser.GetNodeContent(), orc_NodeProperties.c_CodeExportSettings.e_ScalingSupport);
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "code-export-settings");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("code-export-settings"));
          }
          else
          {
@@ -561,7 +561,7 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
          }
 
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
       }
       else
       {
@@ -569,7 +569,7 @@ sint32 C_OSCNodeFiler::mh_LoadProperties(C_OSCNodeProperties & orc_NodePropertie
       }
 
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
    }
    else
    {
@@ -616,7 +616,7 @@ void C_OSCNodeFiler::mh_SaveProperties(const C_OSCNodeProperties & orc_NodePrope
    orc_XMLParser.SetAttributeUint32("max-rx-routing-message-buffer",
                                     orc_NodeProperties.c_OpenSYDEServerSettings.u16_MaxRoutingMessageBufferRx);
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
 
    //Flashloader options
    mh_SaveStwFlashloaderOptions(orc_NodeProperties.c_STWFlashloaderSettings, orc_XMLParser);
@@ -628,10 +628,10 @@ void C_OSCNodeFiler::mh_SaveProperties(const C_OSCNodeProperties & orc_NodePrope
                                                                                        c_CodeExportSettings.
                                                                                        e_ScalingSupport));
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
 
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -654,9 +654,9 @@ sint32 C_OSCNodeFiler::mh_LoadStwFlashloaderOptions(C_OSCNodeStwFlashloaderSetti
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("stw-flashloader-settings") == "stw-flashloader-settings")
+   if (orc_XMLParser.TrySelectNodeChild("stw-flashloader-settings") == true)
    {
-      if (orc_XMLParser.SelectNodeChild("reset-message") == "reset-message")
+      if (orc_XMLParser.TrySelectNodeChild("reset-message") == true)
       {
          if (orc_XMLParser.AttributeExists("active") == true)
          {
@@ -693,10 +693,10 @@ sint32 C_OSCNodeFiler::mh_LoadStwFlashloaderOptions(C_OSCNodeStwFlashloaderSetti
             orc_StwFlashloaderSettings.u8_ResetMessageDlc = 8;
          }
          orc_StwFlashloaderSettings.c_Data.clear();
-         if (orc_XMLParser.SelectNodeChild("data-bytes") == "data-bytes")
+         if (orc_XMLParser.TrySelectNodeChild("data-bytes") == true)
          {
-            C_SCLString c_CurNode = orc_XMLParser.SelectNodeChild("data-byte");
-            if (c_CurNode == "data-byte")
+            bool q_CurNodeFound = orc_XMLParser.TrySelectNodeChild("data-byte");
+            if (q_CurNodeFound == true)
             {
                do
                {
@@ -711,17 +711,17 @@ sint32 C_OSCNodeFiler::mh_LoadStwFlashloaderOptions(C_OSCNodeStwFlashloaderSetti
                                          "Could not find \"value\" attribute in \"data-byte\" node.");
                      s32_Retval = C_CONFIG;
                   }
-                  c_CurNode = orc_XMLParser.SelectNodeNext("data-byte");
+                  q_CurNodeFound = orc_XMLParser.TrySelectNodeNext("data-byte");
                }
-               while ((c_CurNode == "data-byte") && (s32_Retval == C_NO_ERR));
+               while ((q_CurNodeFound == true) && (s32_Retval == C_NO_ERR));
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "data-bytes");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("data-bytes"));
             }
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "reset-message");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("reset-message"));
          }
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "stw-flashloader-settings");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("stw-flashloader-settings"));
       }
       else
       {
@@ -729,7 +729,7 @@ sint32 C_OSCNodeFiler::mh_LoadStwFlashloaderOptions(C_OSCNodeStwFlashloaderSetti
          s32_Retval = C_CONFIG;
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
    }
    else
    {
@@ -765,14 +765,14 @@ void C_OSCNodeFiler::mh_SaveStwFlashloaderOptions(const C_OSCNodeStwFlashloaderS
       orc_XMLParser.CreateAndSelectNodeChild("data-byte");
       orc_XMLParser.SetAttributeUint32("value", static_cast<uint32>(orc_StwFlashloaderSettings.c_Data[u32_ItDataByte]));
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-bytes");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-bytes"));
    }
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "reset-message");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("reset-message"));
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "stw-flashloader-settings");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("stw-flashloader-settings"));
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -794,9 +794,9 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
                                            C_OSCXMLParserBase & orc_XMLParser)
 {
    sint32 s32_Retval = C_NO_ERR;
-   C_SCLString c_CurNode = orc_XMLParser.SelectNodeChild("communication-interface");
+   bool q_CurNodeFound = orc_XMLParser.TrySelectNodeChild("communication-interface");
 
-   if (c_CurNode == "communication-interface")
+   if (q_CurNodeFound == true)
    {
       do
       {
@@ -809,12 +809,12 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
          c_ComInterface.q_IsRoutingEnabled = orc_XMLParser.GetAttributeBool("routing-available");
          c_ComInterface.q_IsDiagnosisEnabled = orc_XMLParser.GetAttributeBool("diagnosis-available");
          //Type
-         if ((orc_XMLParser.SelectNodeChild("type") == "type") && (s32_Retval == C_NO_ERR))
+         if ((orc_XMLParser.TrySelectNodeChild("type") == true) && (s32_Retval == C_NO_ERR))
          {
             s32_Retval = C_OSCSystemFilerUtil::h_BusTypeStringToEnum(
                orc_XMLParser.GetNodeContent(), c_ComInterface.e_InterfaceType);
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          }
          else
          {
@@ -824,14 +824,14 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
          }
 
          //IP address
-         if ((orc_XMLParser.SelectNodeChild("ip-address") == "ip-address") && (s32_Retval == C_NO_ERR))
+         if ((orc_XMLParser.TrySelectNodeChild("ip-address") == true) && (s32_Retval == C_NO_ERR))
          {
             c_ComInterface.c_Ip.au8_IpAddress[0] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte1"));
             c_ComInterface.c_Ip.au8_IpAddress[1] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte2"));
             c_ComInterface.c_Ip.au8_IpAddress[2] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte3"));
             c_ComInterface.c_Ip.au8_IpAddress[3] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte4"));
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          }
          else
          {
@@ -842,14 +842,14 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
          }
 
          //net mask
-         if ((orc_XMLParser.SelectNodeChild("net-mask") == "net-mask") && (s32_Retval == C_NO_ERR))
+         if ((orc_XMLParser.TrySelectNodeChild("net-mask") == true) && (s32_Retval == C_NO_ERR))
          {
             c_ComInterface.c_Ip.au8_NetMask[0] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte1"));
             c_ComInterface.c_Ip.au8_NetMask[1] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte2"));
             c_ComInterface.c_Ip.au8_NetMask[2] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte3"));
             c_ComInterface.c_Ip.au8_NetMask[3] = static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte4"));
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          }
          else
          {
@@ -860,7 +860,7 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
          }
 
          //default gateway
-         if ((orc_XMLParser.SelectNodeChild("default-gateway") == "default-gateway") && (s32_Retval == C_NO_ERR))
+         if ((orc_XMLParser.TrySelectNodeChild("default-gateway") == true) && (s32_Retval == C_NO_ERR))
          {
             c_ComInterface.c_Ip.au8_DefaultGateway[0] =
                static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte1"));
@@ -871,7 +871,7 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
             c_ComInterface.c_Ip.au8_DefaultGateway[3] =
                static_cast<uint8>(orc_XMLParser.GetAttributeUint32("byte4"));
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          }
          else
          {
@@ -881,12 +881,12 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
             c_ComInterface.c_Ip.au8_DefaultGateway[3] = 0U;
          }
          //Bus
-         if (orc_XMLParser.SelectNodeChild("bus") == "bus")
+         if (orc_XMLParser.TrySelectNodeChild("bus") == true)
          {
             c_ComInterface.q_IsBusConnected = orc_XMLParser.GetAttributeBool("connected");
             c_ComInterface.u32_BusIndex = orc_XMLParser.GetAttributeUint32("bus-index");
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          }
          else
          {
@@ -895,14 +895,14 @@ sint32 C_OSCNodeFiler::mh_LoadComInterface(std::vector<C_OSCNodeComInterfaceSett
             s32_Retval = C_CONFIG;
          }
          orc_ComInterfaces.push_back(c_ComInterface);
-         c_CurNode = orc_XMLParser.SelectNodeNext("communication-interface");
+         q_CurNodeFound = orc_XMLParser.TrySelectNodeNext("communication-interface");
       }
-      while (c_CurNode == "communication-interface");
+      while (q_CurNodeFound == true);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interfaces");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interfaces"));
    }
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
 
    return s32_Retval;
 }
@@ -943,36 +943,36 @@ void C_OSCNodeFiler::mh_SaveComInterface(const std::vector<C_OSCNodeComInterface
          orc_XMLParser.SetAttributeUint32("byte3", rc_CurComInterface.c_Ip.au8_IpAddress[2]);
          orc_XMLParser.SetAttributeUint32("byte4", rc_CurComInterface.c_Ip.au8_IpAddress[3]);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          orc_XMLParser.CreateAndSelectNodeChild("net-mask");
          orc_XMLParser.SetAttributeUint32("byte1", rc_CurComInterface.c_Ip.au8_NetMask[0]);
          orc_XMLParser.SetAttributeUint32("byte2", rc_CurComInterface.c_Ip.au8_NetMask[1]);
          orc_XMLParser.SetAttributeUint32("byte3", rc_CurComInterface.c_Ip.au8_NetMask[2]);
          orc_XMLParser.SetAttributeUint32("byte4", rc_CurComInterface.c_Ip.au8_NetMask[3]);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
          orc_XMLParser.CreateAndSelectNodeChild("default-gateway");
          orc_XMLParser.SetAttributeUint32("byte1", rc_CurComInterface.c_Ip.au8_DefaultGateway[0]);
          orc_XMLParser.SetAttributeUint32("byte2", rc_CurComInterface.c_Ip.au8_DefaultGateway[1]);
          orc_XMLParser.SetAttributeUint32("byte3", rc_CurComInterface.c_Ip.au8_DefaultGateway[2]);
          orc_XMLParser.SetAttributeUint32("byte4", rc_CurComInterface.c_Ip.au8_DefaultGateway[3]);
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
       }
       //Create this section for compatibility reasons (had content and was required by previous openSYDE versions)
       orc_XMLParser.CreateAndSelectNodeChild("communication-protocol");
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
       orc_XMLParser.CreateAndSelectNodeChild("bus");
       orc_XMLParser.SetAttributeBool("connected", rc_CurComInterface.q_IsBusConnected);
       orc_XMLParser.SetAttributeUint32("bus-index", rc_CurComInterface.u32_BusIndex);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interface");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interface"));
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "communication-interfaces");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("communication-interfaces"));
    }
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "properties");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("properties"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -995,9 +995,9 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("applications") == "applications")
+   if (orc_XMLParser.TrySelectNodeChild("applications") == true)
    {
-      C_SCLString c_CurNode;
+      bool q_CurNodeFound;
       uint32 u32_ExpectedSize = 0UL;
       const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -1008,8 +1008,8 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
          orc_NodeApplications.reserve(u32_ExpectedSize);
       }
 
-      c_CurNode = orc_XMLParser.SelectNodeChild("application");
-      if (c_CurNode == "application")
+      q_CurNodeFound = orc_XMLParser.TrySelectNodeChild("application");
+      if (q_CurNodeFound == true)
       {
          do
          {
@@ -1045,23 +1045,23 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
             }
 
             //Type
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("type") == "type"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("type") == true))
             {
                s32_Retval = C_OSCNodeApplication::h_StringToApplication(
                   orc_XMLParser.GetNodeContent(), c_CurApplication.e_Type);
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
                s32_Retval = C_CONFIG;
             }
             //Name
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("name") == "name"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("name") == true))
             {
                c_CurApplication.c_Name = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
@@ -1069,22 +1069,22 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
             }
 
             //Comment
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("comment") == "comment"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("comment") == true))
             {
                c_CurApplication.c_Comment = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
                s32_Retval = C_CONFIG;
             }
 
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("project-path") == "project-path"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("project-path") == true))
             {
                c_CurApplication.c_ProjectPath = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
@@ -1092,11 +1092,11 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
                c_CurApplication.c_ProjectPath = "";
             }
 
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("ide-call") == "ide-call"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("ide-call") == true))
             {
                c_CurApplication.c_IDECall = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
@@ -1105,11 +1105,11 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
             }
 
             if ((s32_Retval == C_NO_ERR) &&
-                (orc_XMLParser.SelectNodeChild("code-generator-path") == "code-generator-path"))
+                (orc_XMLParser.TrySelectNodeChild("code-generator-path") == true))
             {
                c_CurApplication.c_CodeGeneratorPath = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
@@ -1117,11 +1117,11 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
                c_CurApplication.c_CodeGeneratorPath = "";
             }
 
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("generate-path") == "generate-path"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("generate-path") == true))
             {
                c_CurApplication.c_GeneratePath = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
@@ -1129,11 +1129,11 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
                c_CurApplication.c_GeneratePath = "";
             }
 
-            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.SelectNodeChild("result-path") == "result-path"))
+            if ((s32_Retval == C_NO_ERR) && (orc_XMLParser.TrySelectNodeChild("result-path") == true))
             {
                c_CurApplication.c_ResultPath = orc_XMLParser.GetNodeContent();
                //Return
-               tgl_assert(orc_XMLParser.SelectNodeParent() == "application");
+               tgl_assert(orc_XMLParser.TrySelectNodeParent("application"));
             }
             else
             {
@@ -1142,11 +1142,11 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
             }
 
             orc_NodeApplications.push_back(c_CurApplication);
-            c_CurNode = orc_XMLParser.SelectNodeNext("application");
+            q_CurNodeFound = orc_XMLParser.TrySelectNodeNext("application");
          }
-         while ((c_CurNode == "application") && (s32_Retval == C_NO_ERR));
+         while ((q_CurNodeFound == true) && (s32_Retval == C_NO_ERR));
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "applications");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("applications"));
       }
       //Compare length
       if ((s32_Retval == C_NO_ERR) && (q_ExpectedSizeHere == true))
@@ -1160,7 +1160,7 @@ sint32 C_OSCNodeFiler::mh_LoadApplications(std::vector<C_OSCNodeApplication> & o
          }
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
    }
    else
    {
@@ -1203,10 +1203,10 @@ void C_OSCNodeFiler::mh_SaveApplications(const std::vector<C_OSCNodeApplication>
       orc_XMLParser.CreateNodeChild("generate-path", rc_CurApplication.c_GeneratePath);
       orc_XMLParser.CreateNodeChild("result-path", rc_CurApplication.c_ResultPath);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "applications");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("applications"));
    }
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1232,9 +1232,9 @@ sint32 C_OSCNodeFiler::mh_LoadDataPools(C_OSCNode & orc_Node, C_OSCXMLParserBase
 
    //Clear
    orc_Node.c_DataPools.clear();
-   if (orc_XMLParser.SelectNodeChild("data-pools") == "data-pools")
+   if (orc_XMLParser.TrySelectNodeChild("data-pools") == true)
    {
-      C_SCLString c_CurNode;
+      bool q_CurNodeFound;
       uint32 u32_ExpectedSize = 0UL;
       const bool q_ExpectedSizeHere = orc_XMLParser.AttributeExists("length");
 
@@ -1245,8 +1245,8 @@ sint32 C_OSCNodeFiler::mh_LoadDataPools(C_OSCNode & orc_Node, C_OSCXMLParserBase
          orc_Node.c_DataPools.reserve(u32_ExpectedSize);
       }
 
-      c_CurNode = orc_XMLParser.SelectNodeChild("data-pool");
-      if (c_CurNode == "data-pool")
+      q_CurNodeFound = orc_XMLParser.TrySelectNodeChild("data-pool");
+      if (q_CurNodeFound == true)
       {
          do
          {
@@ -1268,14 +1268,14 @@ sint32 C_OSCNodeFiler::mh_LoadDataPools(C_OSCNode & orc_Node, C_OSCXMLParserBase
                break;
             }
             orc_Node.c_DataPools.push_back(c_CurDataPool);
-            c_CurNode = orc_XMLParser.SelectNodeNext("data-pool");
+            q_CurNodeFound = orc_XMLParser.TrySelectNodeNext("data-pool");
          }
-         while (c_CurNode == "data-pool");
+         while (q_CurNodeFound == true);
 
          if (s32_Retval == C_NO_ERR)
          {
             //Return
-            tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pools");
+            tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pools"));
          }
       }
       if (s32_Retval == C_NO_ERR)
@@ -1291,7 +1291,7 @@ sint32 C_OSCNodeFiler::mh_LoadDataPools(C_OSCNode & orc_Node, C_OSCXMLParserBase
             }
          }
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
       }
    }
    else
@@ -1353,10 +1353,10 @@ sint32 C_OSCNodeFiler::mh_SaveDataPools(const std::vector<C_OSCNodeDataPool> & o
          }
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "data-pools");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("data-pools"));
    }
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
    return s32_Retval;
 }
 
@@ -1379,7 +1379,7 @@ sint32 C_OSCNodeFiler::mh_LoadHALC(C_OSCHalcConfig & orc_Config, C_OSCXMLParserB
 
    //Clear
    orc_Config.Clear();
-   if (orc_XMLParser.SelectNodeChild("halc-file") == "halc-file")
+   if (orc_XMLParser.TrySelectNodeChild("halc-file") == true)
    {
       if (orc_BasePath.IsEmpty())
       {
@@ -1395,7 +1395,7 @@ sint32 C_OSCNodeFiler::mh_LoadHALC(C_OSCHalcConfig & orc_Config, C_OSCXMLParserB
                                                                                   GetNodeContent()), orc_BasePath);
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
    }
    else
    {
@@ -1448,7 +1448,7 @@ sint32 C_OSCNodeFiler::mh_SaveHALC(const C_OSCHalcConfig & orc_Config, C_OSCXMLP
          }
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
    }
    return s32_Retval;
 }
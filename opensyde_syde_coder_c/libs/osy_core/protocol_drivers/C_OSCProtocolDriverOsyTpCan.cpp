@@ -51,7 +51,11 @@ C_OSCProtocolDriverOsyTpCan::C_ServiceState::C_ServiceState(void) :
    u8_SequenceNumber(0U),
    e_Status(eIDLE),
    u32_StartTimeMs(0U),
-   u32_SendCfTimeout(0U)
+   u32_SendCfTimeout(0U),
+   u8_BlockSize(0U),
+   u8_FramesLeftInBlock(0U),
+   u32_SeparationTimeUs(0U),
+   u64_NextFrameTimeUs(0U)
 {
 }
 
@@ -267,30 +271,55 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFirstFrame(const T_STWCAN_Ms
    Advance the Tx state machine accordingly
    If the dispatcher reports a problem leave the state machine as it is.
 
+   The frames are composed directly from the service data.
+   The block size and separation time reported by the last flow control are respected:
+   * after the last CF of a block the state machine is set to eWAITING_FOR_FLOW_CONTROL
+   * separation times below 1ms are waited for actively; the function blocks for at most
+     mhu32_MAX_CF_BURST_TIME_US
+   * if a separation time of 1ms or more is pending the function returns and the next CF will be sent by a
+     later call
+
    Only to be called when the state machine is in state eMORE_CONSECUTIVE_FRAMES_TO_SEND
 
    \return
    C_NO_ERR     no problems: all pending CFs sent; Tx state machine set to eIDLE again
+   C_BUSY       some CFs left, but we need to wait for the separation time or the next flow control
    C_COM        could not send out consecutive frame (one/some might have been sent, however)
                 Tx state machine still at eMORE_CONSECUTIVE_FRAMES_TO_SEND
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
 {
-   uint8 u8_NumBytesToSend;
    sint32 s32_Return = C_NO_ERR;
+   const uint16 u16_ServiceSize = static_cast<uint16>(mc_TxService.c_ServiceData.c_Data.size());
+   const uint64 u64_BurstEndTimeUs = TGL_GetTickCountUS() + mhu32_MAX_CF_BURST_TIME_US;
+   T_STWCAN_Msg_TX t_TxMsg;
+
+   t_TxMsg.u32_ID = m_GetTxIdentifier();
+   t_TxMsg.u8_XTD = 1U;
+   t_TxMsg.u8_RTR = 0U;
 
    //continue where we left:
-   for (; mc_TxService.u16_TransmissionIndex < mc_TxService.c_ServiceData.c_Data.size();
-        mc_TxService.u16_TransmissionIndex += 7)
+   while (mc_TxService.u16_TransmissionIndex < u16_ServiceSize)
    {
-      T_STWCAN_Msg_TX t_TxMsg;
-      u8_NumBytesToSend = static_cast<uint8>
-                          (((mc_TxService.c_ServiceData.c_Data.size() - mc_TxService.u16_TransmissionIndex) > 7U) ? 7U :
-                           (mc_TxService.c_ServiceData.c_Data.size() - mc_TxService.u16_TransmissionIndex));
-      t_TxMsg.u32_ID = m_GetTxIdentifier();
-      t_TxMsg.u8_XTD = 1U;
-      t_TxMsg.u8_RTR = 0U;
+      const uint16 u16_BytesLeft = static_cast<uint16>(u16_ServiceSize - mc_TxService.u16_TransmissionIndex);
+      const uint8 u8_NumBytesToSend = static_cast<uint8>((u16_BytesLeft > 7U) ? 7U : u16_BytesLeft);
+
+      if (mc_TxService.u32_SeparationTimeUs > 0U)
+      {
+         const uint64 u64_Now = TGL_GetTickCountUS();
+         if (u64_Now < mc_TxService.u64_NextFrameTimeUs)
+         {
+            if ((mc_TxService.u32_SeparationTimeUs >= 1000U) || (u64_Now >= u64_BurstEndTimeUs))
+            {
+               //let the caller continue with other things; we'll send the next frame with the next call
+               s32_Return = C_BUSY;
+               break;
+            }
+            TGL_DelayUs(static_cast<uint32>(mc_TxService.u64_NextFrameTimeUs - u64_Now));
+         }
+      }
+
       t_TxMsg.u8_DLC = 1U + u8_NumBytesToSend;
       t_TxMsg.au8_Data[0] = mhu8_ISO15765_N_PCI_CF + mc_TxService.u8_SequenceNumber;
       //lint -e{670} //std::vector reference returned by [] is guaranteed to have linear data in memory
@@ -309,12 +338,31 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
          break;
       }
 
+      mc_TxService.u16_TransmissionIndex += u8_NumBytesToSend;
+      if (mc_TxService.u32_SeparationTimeUs > 0U)
+      {
+         mc_TxService.u64_NextFrameTimeUs = TGL_GetTickCountUS() + mc_TxService.u32_SeparationTimeUs;
+      }
+
       //set sequence number for next block:
       mc_TxService.u8_SequenceNumber++;
       if (mc_TxService.u8_SequenceNumber == 16U)
       {
          mc_TxService.u8_SequenceNumber = 0U;
       }
+
+      //end of block ?
+      if ((mc_TxService.u8_BlockSize != 0U) && (mc_TxService.u16_TransmissionIndex < u16_ServiceSize))
+      {
+         mc_TxService.u8_FramesLeftInBlock--;
+         if (mc_TxService.u8_FramesLeftInBlock == 0U)
+         {
+            mc_TxService.e_Status = C_ServiceState::eWAITING_FOR_FLOW_CONTROL;
+            mc_TxService.u32_StartTimeMs = TGL_GetTickCount();
+            s32_Return = C_BUSY;
+            break;
+         }
+      }
    }
    //finished with this transfer ?
    if (s32_Return == C_NO_ERR)
@@ -324,10 +372,42 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decode separation time parameter of flow control
+
+   Values reserved by ISO 15765-2 are interpreted as the longest valid separation time (127ms).
+
+   \param[in]  ou8_SeparationTime   STmin parameter of flow control
+
+   \return
+   separation time in micro seconds
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCProtocolDriverOsyTpCan::mh_DecodeSeparationTime(const uint8 ou8_SeparationTime)
+{
+   uint32 u32_SeparationTimeUs;
+
+   if (ou8_SeparationTime <= 0x7FU)
+   {
+      u32_SeparationTimeUs = static_cast<uint32>(ou8_SeparationTime) * 1000U;
+   }
+   else if ((ou8_SeparationTime >= 0xF1U) && (ou8_SeparationTime <= 0xF9U))
+   {
+      u32_SeparationTimeUs = static_cast<uint32>(ou8_SeparationTime - 0xF0U) * 100U;
+   }
+   else
+   {
+      u32_SeparationTimeUs = 127000U;
+   }
+   return u32_SeparationTimeUs;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle incoming flow control
 
    Continue sending ongoing Tx transfer consecutive frames when waiting for flow control.
+   Block size (BS) and separation time (STmin) reported by the server are respected.
+   A flow status "wait" restarts the N_Bs timeout, a flow status "overflow" aborts the transfer.
    Invalid and unexpected frames will be ignored.
 
    We already know
@@ -339,9 +419,10 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_SendNextConsecutiveFrames(void)
 
    \return
    C_NO_ERR     no problems
+   C_BUSY       CFs of block sent or separation time pending; transfer not finished yet
    C_NOACT      unexpected flow control
    C_CONFIG     frame invalid (DLC is not 3)
-   C_OVERFLOW   invalid STmin or BS (only 0 supported for each)
+   C_OVERFLOW   server reported overflow or invalid flow status; transfer aborted resp. flow control ignored
    C_COM        could not send out following consecutive frames
 */
 //----------------------------------------------------------------------------------------------------------------------
@@ -352,18 +433,32 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFlowControl(const T_STWCAN_M
    //are we in a segmented Tx transfer ?
    if (mc_TxService.e_Status == C_ServiceState::eWAITING_FOR_FLOW_CONTROL)
    {
-      //only accept STmin=0 and BS=0
       if (orc_CanMessage.u8_DLC == 3U)
       {
-         if ((orc_CanMessage.au8_Data[1] == 0U) && (orc_CanMessage.au8_Data[2] == 0U))
+         const uint8 u8_FlowStatus = orc_CanMessage.au8_Data[0] & 0x0FU;
+         if (u8_FlowStatus == mhu8_ISO15765_FS_CTS)
          {
-            //set total timeout value for sending all CFs (kicks in if the Tx buffer of the CAN dispatcher is full)
+            uint32 u32_NumFrames;
+            mc_TxService.u8_BlockSize = orc_CanMessage.au8_Data[1];
+            mc_TxService.u8_FramesLeftInBlock = mc_TxService.u8_BlockSize;
+            mc_TxService.u32_SeparationTimeUs = mh_DecodeSeparationTime(orc_CanMessage.au8_Data[2]);
+            mc_TxService.u64_NextFrameTimeUs = 0U;
+
+            //set total timeout value for sending all CFs of the block (kicks in if the Tx buffer of the CAN dispatcher
+            // is full)
             //N_As is ISO 15765-2 is per CAN frame (and quite high at 1000ms ...)
             //For the total transfer we use the total number of CAN frames, assume the lowest supported bitrate
             // in openSYDE (100 kbit/s) and an alien busload of 50%
-            //So we'll have around 2 ms/message
+            //So we'll have around 2 ms/message plus the separation time requested by the server
             //But we'll add a lower limit of 100ms to compensate for client side timing constraints
-            mc_TxService.u32_SendCfTimeout = static_cast<uint32>((mc_TxService.c_ServiceData.c_Data.size() / 7U) * 2U);
+            u32_NumFrames = static_cast<uint32>(((mc_TxService.c_ServiceData.c_Data.size() -
+                                                  mc_TxService.u16_TransmissionIndex) + 6U) / 7U);
+            if ((mc_TxService.u8_BlockSize != 0U) && (u32_NumFrames > mc_TxService.u8_BlockSize))
+            {
+               u32_NumFrames = mc_TxService.u8_BlockSize;
+            }
+            mc_TxService.u32_SendCfTimeout = (u32_NumFrames * 2U) +
+                                             ((u32_NumFrames * mc_TxService.u32_SeparationTimeUs) / 1000U);
             if (mc_TxService.u32_SendCfTimeout < 100U)
             {
                mc_TxService.u32_SendCfTimeout = 100U;
@@ -374,9 +469,21 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingFlowControl(const T_STWCAN_M
 
             s32_Return = m_SendNextConsecutiveFrames();
          }
+         else if (u8_FlowStatus == mhu8_ISO15765_FS_WAIT)
+         {
+            //server needs more time; restart N_Bs timeout
+            mc_TxService.u32_StartTimeMs = TGL_GetTickCount();
+         }
+         else if (u8_FlowStatus == mhu8_ISO15765_FS_OVFLW)
+         {
+            m_LogWarningWithHeader("Flow control with status overflow received. Aborting ongoing Tx transfer.",
+                                   TGL_UTIL_FUNC_ID);
+            mc_TxService.e_Status = C_ServiceState::eIDLE;
+            s32_Return = C_OVERFLOW;
+         }
          else
          {
-            m_LogWarningWithHeader("Flow control with unsupported STmin or BS received. Ignoring.", TGL_UTIL_FUNC_ID);
+            m_LogWarningWithHeader("Flow control with invalid flow status received. Ignoring.", TGL_UTIL_FUNC_ID);
             s32_Return = C_OVERFLOW;
          }
       }
@@ -437,7 +544,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingConsecutiveFrame(const T_STW
                               &orc_CanMessage.au8_Data[1],
                               mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex);
             //add to Rx queue:
-            s32_Return = m_AddToRxQueue(mc_RxService.c_ServiceData);
+            s32_Return = m_MoveToRxQueue(mc_RxService.c_ServiceData);
             if (s32_Return != C_NO_ERR)
             {
                m_LogWarningWithHeader("Rx Queue overflow. Incoming consecutive frame dumped.", TGL_UTIL_FUNC_ID);
@@ -553,7 +660,7 @@ sint32 C_OSCProtocolDriverOsyTpCan::m_HandleIncomingOsySpecificMultiFrame(const
                          &orc_CanMessage.au8_Data[1],
                          mc_RxService.c_ServiceData.c_Data.size() - mc_RxService.u16_TransmissionIndex);
             //add to Rx queue:
-            s32_Return = m_AddToRxQueue(mc_RxService.c_ServiceData);
+            s32_Return = m_MoveToRxQueue(mc_RxService.c_ServiceData);
             if (s32_Return != C_NO_ERR)
             {
                m_LogWarningWithHeader("OMF: Rx Queue overflow. Incoming consecutive frame dumped.", TGL_UTIL_FUNC_ID);
@@ -699,6 +806,40 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
    }
    else
    {
+      if (mc_TxService.e_Status == C_ServiceState::eWAITING_FOR_FLOW_CONTROL)
+      {
+         //check for Tx timeout:
+         if ((TGL_GetTickCount() - mhu16_NBsTimeoutMs) > mc_TxService.u32_StartTimeMs)
+         {
+            //transfer timed out ...
+            m_LogWarningWithHeader("N_Bs timeout reached before receiving flow control. Aborting ongoing Tx transfer.",
+                                   TGL_UTIL_FUNC_ID);
+            mc_TxService.e_Status = C_ServiceState::eIDLE;
+         }
+      }
+      else if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
+      {
+         //try to send more frames:
+         //result checked indirectly via state machine status
+         (void)m_SendNextConsecutiveFrames();
+         //still not finished ?
+         if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
+         {
+            if (TGL_GetTickCount() > mc_TxService.u32_SendCfTimeout)
+            {
+               //transfer timed out ...
+               m_LogWarningWithHeader("Could not send all CFs within timeout. Aborting ongoing Tx transfer.",
+                                      TGL_UTIL_FUNC_ID);
+               mc_TxService.e_Status = C_ServiceState::eIDLE;
+            }
+         }
+      }
+      else
+      {
+         //no state we care about ...
+      }
+
+      //ongoing transfer finished or aborted above: continue with the next service right away
       if (mc_TxService.e_Status == C_ServiceState::eIDLE)
       {
          //do we have more to send ?
@@ -821,38 +962,6 @@ sint32 C_OSCProtocolDriverOsyTpCan::Cycle(void)
             }
          }
       }
-      else if (mc_TxService.e_Status == C_ServiceState::eWAITING_FOR_FLOW_CONTROL)
-      {
-         //check for Tx timeout:
-         if ((TGL_GetTickCount() - mhu16_NBsTimeoutMs) > mc_TxService.u32_StartTimeMs)
-         {
-            //transfer timed out ...
-            m_LogWarningWithHeader("N_Bs timeout reached before receiving flow control. Aborting ongoing Tx transfer.",
-                                   TGL_UTIL_FUNC_ID);
-            mc_TxService.e_Status = C_ServiceState::eIDLE;
-         }
-      }
-      else if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
-      {
-         //try to send more frames:
-         //result checked indirectly via state machine status
-         (void)m_SendNextConsecutiveFrames();
-         //still not finished ?
-         if (mc_TxService.e_Status == C_ServiceState::eMORE_CONSECUTIVE_FRAMES_TO_SEND)
-         {
-            if (TGL_GetTickCount() > mc_TxService.u32_SendCfTimeout)
-            {
-               //transfer timed out ...
-               m_LogWarningWithHeader("Could not send all CFs within timeout. Aborting ongoing Tx transfer.",
-                                      TGL_UTIL_FUNC_ID);
-               mc_TxService.e_Status = C_ServiceState::eIDLE;
-            }
-         }
-      }
-      else
-      {
-         //no state we care about ...
-      }
 
       //now check Rx messages:
       T_STWCAN_Msg_RX t_Msg;
@@ -56,6 +56,7 @@ private:
 
       stw_types::sint32 DecodeHeader(const std::vector<stw_types::uint8> & orc_Header);
       void ComposeHeader(std::vector<stw_types::uint8> & orc_Header) const;
+      void ComposeHeader(stw_types::uint8 (&orau8_Header)[hu8_DOIP_HEADER_SIZE]) const;
    };
 
    ///information about ongoing TCP Rx transmission
@@ -80,8 +81,11 @@ private:
    C_OSCIpDispatcher * mpc_Dispatcher;      ///< driver to use for accessing local IP stack
    stw_types::uint32 mu32_DispatcherHandle; ///< handler to use for dispatcher TDP functions
 
-   void m_ComposeRequest(const C_OSCProtocolDriverOsyService & orc_Service,
-                         std::vector<stw_types::uint8> & orc_Request) const;
+   ///size of request header: DoIp header + source address + target address
+   static const stw_types::uint8 mhu8_REQUEST_HEADER_SIZE = C_DoIpHeader::hu8_DOIP_HEADER_SIZE + 4U;
+
+   void m_ComposeRequestHeader(const C_OSCProtocolDriverOsyService & orc_Service,
+                               stw_types::uint8 (&orau8_Header)[mhu8_REQUEST_HEADER_SIZE]) const;
 
 protected:
    void m_LogWarningWithHeader(const stw_scl::C_SCLString & orc_Information,
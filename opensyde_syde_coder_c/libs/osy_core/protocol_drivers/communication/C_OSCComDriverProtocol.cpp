@@ -46,6 +46,8 @@ using namespace stw_opensyde_core;
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
+std::list<C_OSCComDriverProtocol::C_RouteCacheEntry> C_OSCComDriverProtocol::mhc_RouteCache;
+C_TGLCriticalSection C_OSCComDriverProtocol::mhc_RouteCacheCriticalSection;
 
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
@@ -1700,9 +1702,16 @@ sint32 C_OSCComDriverProtocol::m_StartRoutingIp2Ip(const uint32 ou32_ActiveNode,
    Node 2 -> Node 4 (For real purpose and communication)
    Node 3 -> Node 4 (For real purpose and communication)
 
+   When starting the routing of several nodes one after another, routers on the way to more than one node can be
+   configured only once: pass the same opc_ConfiguredRouters container to all calls. It collects the routing
+   configurations set up on each router and for configurations already contained no services are sent to the router.
+   The container is only valid as long as the routers are not reset or switched to another session in between.
+
    \param[in]     ou32_ActiveNode             active node index of vector mc_ActiveNodes
    \param[out]    opu32_ErrorActiveNodeIndex  optional pointer for active node index which caused the error on starting
                                               routing if an error occurred
+   \param[in,out] opc_ConfiguredRouters       optional container of configured routing entries per active router
+                                              node index (NULL: always configure all routers)
 
    \return
    C_NO_ERR   request sent, positive response received or no routing necessary
@@ -1715,7 +1724,9 @@ sint32 C_OSCComDriverProtocol::m_StartRoutingIp2Ip(const uint32 ou32_ActiveNode,
    C_COM      communication driver reported error
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCComDriverProtocol::m_StartRouting(const uint32 ou32_ActiveNode, uint32 * const opu32_ErrorActiveNodeIndex)
+sint32 C_OSCComDriverProtocol::m_StartRouting(const uint32 ou32_ActiveNode, uint32 * const opu32_ErrorActiveNodeIndex,
+                                              std::map<uint32,
+                                                       std::set<std::vector<uint8> > > * const opc_ConfiguredRouters)
 {
    sint32 s32_Return = C_NO_ERR;
 
@@ -1796,8 +1807,58 @@ sint32 C_OSCComDriverProtocol::m_StartRouting(const uint32 ou32_ActiveNode, uint
                      //lint -e{929}  false positive in PC-Lint: allowed by MISRA 5-2-2
                      C_OSCProtocolDriverOsy * const pc_ProtocolOsyTarget =
                         dynamic_cast<C_OSCProtocolDriverOsy * const>(this->mc_OsyProtocols[u32_ActiveOsyTargetNode]);
+                     std::vector<std::vector<uint8> > c_RouterEntries;
+                     std::set<std::vector<uint8> > * pc_ConfiguredEntries = NULL;
+                     bool q_ConfigurationNecessary = false;
+                     uint32 u32_CounterTargetPoint;
+
+                     // Get the routing configuration for each layer behind the router
+                     for (u32_CounterTargetPoint = u32_CounterRoutePoints;
+                          u32_CounterTargetPoint < c_ActRoute.c_VecRoutePoints.size();
+                          ++u32_CounterTargetPoint)
+                     {
+                        const C_OSCRoutingRoutePoint & rc_PointTarget =
+                           c_ActRoute.c_VecRoutePoints[u32_CounterTargetPoint];
+
+                        // Get the Bus IDs
+                        if ((u32_SourceBusIndex < this->mpc_SysDef->c_Buses.size()) &&
+                            (rc_PointTarget.u32_OutBusIndex < this->mpc_SysDef->c_Buses.size()))
+                        {
+                           std::vector<uint8> c_Entry(6U);
+                           c_Entry[0] = static_cast<uint8>(rc_Point.e_InInterfaceType);
+                           c_Entry[1] = rc_Point.u8_InInterfaceNumber;
+                           c_Entry[2] = static_cast<uint8>(rc_Point.e_OutInterfaceType);
+                           c_Entry[3] = rc_Point.u8_OutInterfaceNumber;
+                           c_Entry[4] = this->mpc_SysDef->c_Buses[u32_SourceBusIndex].u8_BusID;
+                           c_Entry[5] = this->mpc_SysDef->c_Buses[rc_PointTarget.u32_OutBusIndex].u8_BusID;
+                           c_RouterEntries.push_back(c_Entry);
+                        }
+                        else
+                        {
+                           s32_Return = C_CONFIG;
+                           break;
+                        }
+                     }
+
+                     // Routers shared by several targets need to be configured only once in one sequence
+                     if (opc_ConfiguredRouters != NULL)
+                     {
+                        pc_ConfiguredEntries = &(*opc_ConfiguredRouters)[u32_ActiveRouterNode];
+                     }
+                     for (uint32 u32_ItEntry = 0U; u32_ItEntry < c_RouterEntries.size(); ++u32_ItEntry)
+                     {
+                        if ((pc_ConfiguredEntries == NULL) ||
+                            (pc_ConfiguredEntries->find(c_RouterEntries[u32_ItEntry]) == pc_ConfiguredEntries->end()))
+                        {
+                           q_ConfigurationNecessary = true;
+                        }
+                     }
 
-                     if (pc_ProtocolOsyTarget != NULL)
+                     if (pc_ProtocolOsyTarget == NULL)
+                     {
+                        s32_Return = C_CONFIG;
+                     }
+                     else if (s32_Return == C_NO_ERR)
                      {
                         // Clear all queues. In case of CAN tp the change causes that more than one queue receives
                         // service responses
@@ -1814,63 +1875,44 @@ sint32 C_OSCComDriverProtocol::m_StartRouting(const uint32 ou32_ActiveNode, uint
                            s32_Return = pc_ProtocolOsyTarget->ReConnect();
                         }
 
-                        if (s32_Return == C_NO_ERR)
+                        if ((s32_Return == C_NO_ERR) && (q_ConfigurationNecessary == true))
                         {
                            // We need a new session
                            s32_Return = this->m_SetNodeSessionIdWithExpectation(u32_ActiveOsyTargetNode,
                                                                                 this->m_GetRoutingSessionId());
                         }
 
-                        if (s32_Return == C_NO_ERR)
+                        if ((s32_Return == C_NO_ERR) && (q_ConfigurationNecessary == true))
                         {
                            // We need an other security level
                            s32_Return = this->m_SetNodeSecurityAccess(u32_ActiveOsyTargetNode, 5, NULL);
                         }
 
-                        if (s32_Return == C_NO_ERR)
+                        if ((s32_Return == C_NO_ERR) && (q_ConfigurationNecessary == true))
                         {
-                           uint32 u32_CounterTargetPoint;
-                           for (u32_CounterTargetPoint = u32_CounterRoutePoints;
-                                u32_CounterTargetPoint < c_ActRoute.c_VecRoutePoints.size();
-                                ++u32_CounterTargetPoint)
+                           for (uint32 u32_ItEntry = 0U; u32_ItEntry < c_RouterEntries.size(); ++u32_ItEntry)
                            {
-                              const C_OSCRoutingRoutePoint & rc_PointTarget =
-                                 c_ActRoute.c_VecRoutePoints[u32_CounterTargetPoint];
+                              const std::vector<uint8> & rc_Entry = c_RouterEntries[u32_ItEntry];
 
-                              // Get the Bus IDs
-                              if ((u32_SourceBusIndex < this->mpc_SysDef->c_Buses.size()) &&
-                                  (rc_PointTarget.u32_OutBusIndex < this->mpc_SysDef->c_Buses.size()))
+                              if ((pc_ConfiguredEntries == NULL) ||
+                                  (pc_ConfiguredEntries->find(rc_Entry) == pc_ConfiguredEntries->end()))
                               {
-                                 const uint8 u8_SourceBusId = this->mpc_SysDef->c_Buses[u32_SourceBusIndex].u8_BusID;
-                                 const uint8 u8_TargetBusId =
-                                    this->mpc_SysDef->c_Buses[rc_PointTarget.u32_OutBusIndex].u8_BusID;
-
                                  // Configure the real node for each layer
                                  s32_Return = pc_ProtocolOsyTarget->OsySetRouteDiagnosisCommunication(
-                                    static_cast<uint8>(rc_Point.e_InInterfaceType),
-                                    rc_Point.u8_InInterfaceNumber,
-                                    static_cast<uint8>(rc_Point.e_OutInterfaceType),
-                                    rc_Point.u8_OutInterfaceNumber,
-                                    u8_SourceBusId,
-                                    u8_TargetBusId);
-                              }
-                              else
-                              {
-                                 s32_Return = C_CONFIG;
-                              }
-
-                              if (s32_Return != C_NO_ERR)
-                              {
-                                 break;
+                                    rc_Entry[0], rc_Entry[1], rc_Entry[2], rc_Entry[3], rc_Entry[4], rc_Entry[5]);
+
+                                 if (s32_Return != C_NO_ERR)
+                                 {
+                                    break;
+                                 }
+                                 if (pc_ConfiguredEntries != NULL)
+                                 {
+                                    pc_ConfiguredEntries->insert(rc_Entry);
+                                 }
                               }
                            }
                         }
 
-                        if ((s32_Return != C_NO_ERR) && (opu32_ErrorActiveNodeIndex != NULL))
-                        {
-                           *opu32_ErrorActiveNodeIndex = u32_ActiveRouterNode;
-                        }
-
                         // Clear all queues. In case of CAN tp the change causes that more than one queue receives
                         // service responses
                         this->ClearDispatcherQueue();
@@ -1880,7 +1922,12 @@ sint32 C_OSCComDriverProtocol::m_StartRouting(const uint32 ou32_ActiveNode, uint
                      }
                      else
                      {
-                        s32_Return = C_CONFIG;
+                        // Invalid configuration, nothing sent
+                     }
+
+                     if ((s32_Return != C_NO_ERR) && (opu32_ErrorActiveNodeIndex != NULL))
+                     {
+                        *opu32_ErrorActiveNodeIndex = u32_ActiveRouterNode;
                      }
                   }
                   else
@@ -2358,13 +2405,37 @@ sint32 C_OSCComDriverProtocol::m_InitRoutesAndActiveNodes(void)
       //Count active nodes
       C_OSCRoutingCalculation::E_Mode e_Mode;
       const bool q_RoutingUsed = this->m_GetRoutingMode(e_Mode);
+      std::vector<uint32> c_CacheKey;
+      bool q_Cached = false;
 
       this->mu32_ActiveNodeCount = 0;
       this->mc_ActiveNodesIndexes.clear();
       this->mc_Routes.clear();
 
+      // The routes only depend on the connections and interface flags of the nodes. So the result of an earlier
+      // initialization with the same configuration can be used without searching all routes again.
+      this->m_GetRouteCacheKey(e_Mode, q_RoutingUsed, c_CacheKey);
+      mhc_RouteCacheCriticalSection.Acquire();
+      for (std::list<C_RouteCacheEntry>::iterator c_ItEntry = mhc_RouteCache.begin();
+           c_ItEntry != mhc_RouteCache.end(); ++c_ItEntry)
+      {
+         if (c_ItEntry->c_Key == c_CacheKey)
+         {
+            s32_Retval = c_ItEntry->s32_Result;
+            this->mc_ActiveNodesIndexes = c_ItEntry->c_ActiveNodesIndexes;
+            this->mc_Routes = c_ItEntry->c_Routes;
+            this->mu32_ActiveNodeCount = static_cast<uint32>(this->mc_Routes.size());
+            // Keep most recently used entry in front
+            mhc_RouteCache.splice(mhc_RouteCache.begin(), mhc_RouteCache, c_ItEntry);
+            q_Cached = true;
+            break;
+         }
+      }
+      mhc_RouteCacheCriticalSection.Release();
+
       //Init routes
-      for (uint32 u32_ItActiveFlag = 0; u32_ItActiveFlag < this->mc_ActiveNodesSystem.size(); ++u32_ItActiveFlag)
+      for (uint32 u32_ItActiveFlag = 0;
+           (q_Cached == false) && (u32_ItActiveFlag < this->mc_ActiveNodesSystem.size()); ++u32_ItActiveFlag)
       {
          if (this->mc_ActiveNodesSystem[u32_ItActiveFlag] == 1U)
          {
@@ -2405,6 +2476,22 @@ sint32 C_OSCComDriverProtocol::m_InitRoutesAndActiveNodes(void)
             }
          }
       }
+
+      if (q_Cached == false)
+      {
+         C_RouteCacheEntry c_Entry;
+         c_Entry.s32_Result = s32_Retval;
+         mhc_RouteCacheCriticalSection.Acquire();
+         mhc_RouteCache.push_front(c_Entry);
+         mhc_RouteCache.front().c_Key.swap(c_CacheKey);
+         mhc_RouteCache.front().c_ActiveNodesIndexes = this->mc_ActiveNodesIndexes;
+         mhc_RouteCache.front().c_Routes = this->mc_Routes;
+         if (mhc_RouteCache.size() > mhu32_ROUTE_CACHE_SIZE)
+         {
+            mhc_RouteCache.pop_back();
+         }
+         mhc_RouteCacheCriticalSection.Release();
+      }
    }
    else
    {
@@ -2414,6 +2501,68 @@ sint32 C_OSCComDriverProtocol::m_InitRoutesAndActiveNodes(void)
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get key of the route cache for the current configuration
+
+   Contains everything the route calculation depends on: the active nodes, the bus of the client, the routing mode
+   and of each node the bus connection, the node ID and the enabled functions of all interfaces.
+   The key is compared as a whole, so different configurations can never share a cache entry.
+
+   \param[in]   oe_Mode           Routing mode
+   \param[in]   oq_RoutingUsed    Flag if routing is used at all
+   \param[out]  orc_Key           Key of current configuration
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComDriverProtocol::m_GetRouteCacheKey(const C_OSCRoutingCalculation::E_Mode oe_Mode,
+                                                const bool oq_RoutingUsed, std::vector<uint32> & orc_Key) const
+{
+   orc_Key.clear();
+   orc_Key.push_back(static_cast<uint32>(oe_Mode));
+   orc_Key.push_back((oq_RoutingUsed == true) ? 1U : 0U);
+   orc_Key.push_back(this->mu32_ActiveBusIndex);
+   orc_Key.push_back(static_cast<uint32>(this->mc_ActiveNodesSystem.size()));
+   for (uint32 u32_ItNode = 0U; u32_ItNode < this->mc_ActiveNodesSystem.size(); ++u32_ItNode)
+   {
+      orc_Key.push_back(this->mc_ActiveNodesSystem[u32_ItNode]);
+   }
+
+   orc_Key.push_back(static_cast<uint32>(this->mpc_SysDef->c_Nodes.size()));
+   for (uint32 u32_ItNode = 0U; u32_ItNode < this->mpc_SysDef->c_Nodes.size(); ++u32_ItNode)
+   {
+      const std::vector<C_OSCNodeComInterfaceSettings> & rc_Interfaces =
+         this->mpc_SysDef->c_Nodes[u32_ItNode].c_Properties.c_ComInterfaces;
+
+      orc_Key.push_back(static_cast<uint32>(rc_Interfaces.size()));
+      for (uint32 u32_ItInterface = 0U; u32_ItInterface < rc_Interfaces.size(); ++u32_ItInterface)
+      {
+         const C_OSCNodeComInterfaceSettings & rc_Interface = rc_Interfaces[u32_ItInterface];
+         uint32 u32_Flags = 0U;
+
+         if (rc_Interface.q_IsBusConnected == true)
+         {
+            u32_Flags |= 0x01U;
+         }
+         if (rc_Interface.q_IsDiagnosisEnabled == true)
+         {
+            u32_Flags |= 0x02U;
+         }
+         if (rc_Interface.q_IsUpdateEnabled == true)
+         {
+            u32_Flags |= 0x04U;
+         }
+         if (rc_Interface.q_IsRoutingEnabled == true)
+         {
+            u32_Flags |= 0x08U;
+         }
+         orc_Key.push_back(u32_Flags);
+         orc_Key.push_back(rc_Interface.u32_BusIndex);
+         orc_Key.push_back(static_cast<uint32>(rc_Interface.e_InterfaceType));
+         orc_Key.push_back(rc_Interface.u8_InterfaceNumber);
+         orc_Key.push_back(rc_Interface.u8_NodeID);
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Initialize Server ID for each node
 
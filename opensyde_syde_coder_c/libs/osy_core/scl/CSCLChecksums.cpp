@@ -102,16 +102,76 @@ static const uint32 mau32_CRC_TABLE[] =
    0xb3667a2eU, 0xc4614ab8U, 0x5d681b02U, 0x2a6f2b94U, 0xb40bbe37U, 0xc30c8ea1U, 0x5a05df1bU, 0x2d02ef8dU
 };
 
+//number of bytes processed per iteration by the "slicing" implementations
+static const uint32 mu32_SLICE_SIZE = 8U;
+
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
+///Creates the "slicing-by-8" lookup tables on module initialization
+class C_SCLChecksumsSliceTables
+{
+public:
+   C_SCLChecksumsSliceTables(void);
+};
+
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
+//"slicing-by-8" lookup tables derived from the byte-wise tables above
+//Entry [N] contains the effect of one byte after N further byte steps.
+static uint16 mau16_CrcSliceTable[mu32_SLICE_SIZE][256];
+static uint16 mau16_CrcStwSliceTable[mu32_SLICE_SIZE][256];
+static uint32 mau32_CrcSliceTable[mu32_SLICE_SIZE][256];
+
+//Set after the slice tables were filled.
+//Zero-initialized before any dynamic initialization; so functions called from other modules' static initializers
+// will safely use the byte-wise implementation.
+static bool mq_SliceTablesValid = false;
+
+static const C_SCLChecksumsSliceTables mc_SliceTables;
+
 /* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
 
 /* -- Implementation ------------------------------------------------------------------------------------------------ */
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Fill slice tables
+
+   Derives the "slicing-by-8" lookup tables from the byte-wise lookup tables.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLChecksumsSliceTables::C_SCLChecksumsSliceTables(void)
+{
+   uint32 u32_Value;
+
+   for (u32_Value = 0U; u32_Value < 256U; u32_Value++)
+   {
+      uint32 u32_Slice;
+      //CRC16: table N = byte value followed by N zero bytes
+      mau16_CrcSliceTable[0][u32_Value] = mau16_CRC_TABLE[u32_Value];
+      //CRC16 STW: table N = byte value in high byte after N + 1 steps
+      mau16_CrcStwSliceTable[0][u32_Value] = mau16_CRC_TABLE[u32_Value];
+      //CRC32: table N = byte value followed by N zero bytes
+      mau32_CrcSliceTable[0][u32_Value] = mau32_CRC_TABLE[u32_Value];
+
+      for (u32_Slice = 1U; u32_Slice < mu32_SLICE_SIZE; u32_Slice++)
+      {
+         const uint16 u16_Crc = mau16_CrcSliceTable[u32_Slice - 1U][u32_Value];
+         const uint16 u16_CrcStw = mau16_CrcStwSliceTable[u32_Slice - 1U][u32_Value];
+         const uint32 u32_Crc = mau32_CrcSliceTable[u32_Slice - 1U][u32_Value];
+
+         mau16_CrcSliceTable[u32_Slice][u32_Value] =
+            static_cast<uint16>((static_cast<uint16>(u16_Crc << 8)) ^ mau16_CRC_TABLE[u16_Crc >> 8]);
+         mau16_CrcStwSliceTable[u32_Slice][u32_Value] =
+            static_cast<uint16>(mau16_CRC_TABLE[u16_CrcStw >> 8] ^ (static_cast<uint16>(u16_CrcStw << 8)));
+         mau32_CrcSliceTable[u32_Slice][u32_Value] = (u32_Crc >> 8) ^ mau32_CRC_TABLE[u32_Crc & 0xFFU];
+      }
+   }
+
+   mq_SliceTablesValid = true;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Calculate 16 bit CRC STW style
 
@@ -128,10 +188,28 @@ static const uint32 mau32_CRC_TABLE[] =
 //----------------------------------------------------------------------------------------------------------------------
 void C_SCLChecksums::CalcCRC16STW(const void * const opv_Start, const uint32 ou32_NumBytes, uint16 & oru16_CRC)
 {
-   uint32 u32_Index;
+   uint32 u32_Index = 0U;
    const uint8 * const pu8_Data = reinterpret_cast<const uint8 *>(opv_Start); //lint !e925 we need to parse byte-by-byte
 
-   for (u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   if (mq_SliceTablesValid == true)
+   {
+      //process 8 bytes per step; each byte is shifted through the register by the remaining number of steps
+      for (; (u32_Index + mu32_SLICE_SIZE) <= ou32_NumBytes; u32_Index += mu32_SLICE_SIZE)
+      {
+         const uint8 * const pu8_Slice = &pu8_Data[u32_Index];
+         oru16_CRC = static_cast<uint16>(mau16_CrcStwSliceTable[7][oru16_CRC >> 8] ^
+                                         mau16_CrcStwSliceTable[6][oru16_CRC & 0xFFU] ^
+                                         mau16_CrcStwSliceTable[5][pu8_Slice[0]] ^
+                                         mau16_CrcStwSliceTable[4][pu8_Slice[1]] ^
+                                         mau16_CrcStwSliceTable[3][pu8_Slice[2]] ^
+                                         mau16_CrcStwSliceTable[2][pu8_Slice[3]] ^
+                                         mau16_CrcStwSliceTable[1][pu8_Slice[4]] ^
+                                         mau16_CrcStwSliceTable[0][pu8_Slice[5]] ^
+                                         (static_cast<uint16>(pu8_Slice[6]) << 8) ^ pu8_Slice[7]);
+      }
+   }
+
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
    {
       oru16_CRC = static_cast<uint16>(mau16_CRC_TABLE[oru16_CRC >> 8] ^ (static_cast<uint16>(oru16_CRC << 8)) ^
                                       pu8_Data[u32_Index]);
@@ -153,11 +231,28 @@ void C_SCLChecksums::CalcCRC16STW(const void * const opv_Start, const uint32 ou3
 //----------------------------------------------------------------------------------------------------------------------
 void C_SCLChecksums::CalcCRC16(const void * const opv_Start, const uint32 ou32_NumBytes, uint16 & oru16_CRC)
 {
-   uint32 u32_Index;
+   uint32 u32_Index = 0U;
    uint8 u8_Index;
    const uint8 * const pu8_Data = reinterpret_cast<const uint8 *>(opv_Start); //lint !e925 we need to parse byte-by-byte
 
-   for (u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   if (mq_SliceTablesValid == true)
+   {
+      //process 8 bytes per step
+      for (; (u32_Index + mu32_SLICE_SIZE) <= ou32_NumBytes; u32_Index += mu32_SLICE_SIZE)
+      {
+         const uint8 * const pu8_Slice = &pu8_Data[u32_Index];
+         oru16_CRC = static_cast<uint16>(mau16_CrcSliceTable[7][static_cast<uint8>(oru16_CRC >> 8) ^ pu8_Slice[0]] ^
+                                         mau16_CrcSliceTable[6][static_cast<uint8>(oru16_CRC) ^ pu8_Slice[1]] ^
+                                         mau16_CrcSliceTable[5][pu8_Slice[2]] ^
+                                         mau16_CrcSliceTable[4][pu8_Slice[3]] ^
+                                         mau16_CrcSliceTable[3][pu8_Slice[4]] ^
+                                         mau16_CrcSliceTable[2][pu8_Slice[5]] ^
+                                         mau16_CrcSliceTable[1][pu8_Slice[6]] ^
+                                         mau16_CrcSliceTable[0][pu8_Slice[7]]);
+      }
+   }
+
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
    {
       u8_Index = static_cast<uint8>(oru16_CRC >> 8) ^ pu8_Data[u32_Index];
       oru16_CRC = static_cast<uint16>((static_cast<uint16>(oru16_CRC << 8)) ^ mau16_CRC_TABLE[u8_Index]);
@@ -178,9 +273,30 @@ void C_SCLChecksums::CalcCRC16(const void * const opv_Start, const uint32 ou32_N
 void C_SCLChecksums::CalcCRC32(const void * const opv_Start, const uint32 ou32_NumBytes, uint32 & oru32_CRC)
 {
    const uint8 * const pu8_Data = reinterpret_cast<const uint8 *>(opv_Start); //lint !e925 we need to parse byte-by-byte
-   uint32 u32_Index;
+   uint32 u32_Index = 0U;
 
-   for (u32_Index = 0U; u32_Index < ou32_NumBytes; u32_Index++)
+   if (mq_SliceTablesValid == true)
+   {
+      //process 8 bytes per step; assemble the first 4 bytes explicitly so we do not depend on alignment or endianness
+      for (; (u32_Index + mu32_SLICE_SIZE) <= ou32_NumBytes; u32_Index += mu32_SLICE_SIZE)
+      {
+         const uint8 * const pu8_Slice = &pu8_Data[u32_Index];
+         const uint32 u32_Low = oru32_CRC ^ (static_cast<uint32>(pu8_Slice[0]) |
+                                             (static_cast<uint32>(pu8_Slice[1]) << 8) |
+                                             (static_cast<uint32>(pu8_Slice[2]) << 16) |
+                                             (static_cast<uint32>(pu8_Slice[3]) << 24));
+         oru32_CRC = mau32_CrcSliceTable[7][u32_Low & 0xFFU] ^
+                     mau32_CrcSliceTable[6][(u32_Low >> 8) & 0xFFU] ^
+                     mau32_CrcSliceTable[5][(u32_Low >> 16) & 0xFFU] ^
+                     mau32_CrcSliceTable[4][(u32_Low >> 24) & 0xFFU] ^
+                     mau32_CrcSliceTable[3][pu8_Slice[4]] ^
+                     mau32_CrcSliceTable[2][pu8_Slice[5]] ^
+                     mau32_CrcSliceTable[1][pu8_Slice[6]] ^
+                     mau32_CrcSliceTable[0][pu8_Slice[7]];
+      }
+   }
+
+   for (; u32_Index < ou32_NumBytes; u32_Index++)
    {
       oru32_CRC = (mau32_CRC_TABLE[((oru32_CRC) ^ (pu8_Data[u32_Index])) & 0xffU] ^ ((oru32_CRC) >> 8));
    }
@@ -220,7 +336,6 @@ sint32 C_SCLChecksums::CalcCRC32TriCore(const void * const opv_Start, const uint
    {
       uint32 u32_Tmp1;
       uint32 u32_Tmp2;
-      uint32 u32_IndexBit;
       uint32 u32_IndexWord;
       uint32 u32_Value;
       const uint8 * const pu8_Data = reinterpret_cast<const uint8 *>(opv_Start); //lint !e925 we need to parse
@@ -229,13 +344,12 @@ sint32 C_SCLChecksums::CalcCRC32TriCore(const void * const opv_Start, const uint
 
       for (u32_IndexWord = 0U; u32_IndexWord < (ou32_NumBytes / 4U); u32_IndexWord++)
       {
-         u32_Tmp1 = 0U;
+         //parity of the feedback bits; fold the word down to 4 bits and look up the parity in a 16 bit constant
          u32_Tmp2 = oru32_CRC & u32_Poly;
-
-         for (u32_IndexBit = 0U; u32_IndexBit <= 31U; u32_IndexBit++)
-         {
-            u32_Tmp1 ^= ((u32_Tmp2 >> u32_IndexBit) & 1U);
-         }
+         u32_Tmp2 ^= (u32_Tmp2 >> 16);
+         u32_Tmp2 ^= (u32_Tmp2 >> 8);
+         u32_Tmp2 ^= (u32_Tmp2 >> 4);
+         u32_Tmp1 = (0x6996U >> (u32_Tmp2 & 0x0FU)) & 1U;
 
          u32_Value = static_cast<uint32>(pu8_Data[u32_IndexWord * 4]) +
                      ((static_cast<uint32>(pu8_Data[(u32_IndexWord * 4) + 1])) << 8) +
@@ -20,6 +20,7 @@
 #include <cstdio>
 #include <climits>
 #include <cstring>
+#include <cctype>
 
 #include "CSCLIniFile.h"
 #include "CSCLString.h"
@@ -59,8 +60,6 @@ static const charn mcn_EqualIndicator = '=';
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLIniFile::C_SCLIniFile(const C_SCLString & orc_FileName) :
    mq_Dirty(false),
-   ms32_PreviousSectionIndex(0),
-   ms32_PreviousKeyIndex(0),
    FileName(orc_FileName)
 {
    if (orc_FileName == "")
@@ -126,6 +125,7 @@ bool C_SCLIniFile::m_Load(const C_SCLString & orc_FileName)
    {
       //ignore: not a problem, file does probably not exist (yet) !
       mc_Sections.SetLength(0);
+      mc_SectionIndex.clear();
       return false;
    }
 
@@ -224,6 +224,13 @@ bool C_SCLIniFile::m_Load(const C_SCLString & orc_FileName)
          //probably an empty line
       }
    }
+
+   //set up indices for fast lookup:
+   this->m_RebuildSectionIndex();
+   for (s32_Index = 0; s32_Index < mc_Sections.GetLength(); s32_Index++)
+   {
+      mh_RebuildKeyIndex(mc_Sections[s32_Index]);
+   }
    return true;
 }
 
@@ -315,6 +322,9 @@ bool C_SCLIniFile::m_SetValue(const C_SCLString & orc_Section, const C_SCLString
       pc_Section->c_Keys[pc_Section->c_Keys.GetHigh()].c_Key     = orc_Key;
       pc_Section->c_Keys[pc_Section->c_Keys.GetHigh()].c_Value   = orc_Value;
       pc_Section->c_Keys[pc_Section->c_Keys.GetHigh()].c_Comment = "";
+      //does not replace an existing entry (relevant for oq_ForceAppend); so the first occurrence keeps being used
+      (void)pc_Section->c_KeyIndex.insert(std::pair<const std::string, sint32>(mh_GetIndexName(orc_Key),
+                                                                               pc_Section->c_Keys.GetHigh()));
    }
    else
    {
@@ -689,21 +699,17 @@ float64 C_SCLIniFile::ReadFloat(const C_SCLString & orc_Section, const C_SCLStri
 //----------------------------------------------------------------------------------------------------------------------
 void C_SCLIniFile::EraseSection(const C_SCLString & orc_Section)
 {
-   sint32 s32_Index;
+   const std::map<std::string, sint32>::const_iterator c_It = mc_SectionIndex.find(mh_GetIndexName(orc_Section));
 
-   for (s32_Index = 0; s32_Index < mc_Sections.GetLength(); s32_Index++)
+   if (c_It == mc_SectionIndex.end())
    {
-      if (mc_Sections[s32_Index].c_Name.AnsiCompareIC(orc_Section) == 0)
-      {
-         mc_Sections.Delete(s32_Index);
-         mq_Dirty = true;
-         ms32_PreviousSectionIndex = 0;
-         ms32_PreviousKeyIndex = 0;
-         return;
-      }
+      throw "C_SCLIniFile::EraseSection failed !";
    }
 
-   throw "C_SCLIniFile::EraseSection failed !";
+   mc_Sections.Delete(c_It->second);
+   mq_Dirty = true;
+   //indices of all following sections changed:
+   this->m_RebuildSectionIndex();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -718,20 +724,18 @@ void C_SCLIniFile::EraseSection(const C_SCLString & orc_Section)
 //----------------------------------------------------------------------------------------------------------------------
 void C_SCLIniFile::DeleteKey(const C_SCLString & orc_Section, const C_SCLString & orc_Key)
 {
-   sint32 s32_Index;
    C_SCLIniSection * const pc_Section = m_GetSection(orc_Section);
-   if (pc_Section == NULL)
-   {
-      return;
-   }
 
-   for (s32_Index = 0; s32_Index < pc_Section->c_Keys.GetLength(); s32_Index++)
+   if (pc_Section != NULL)
    {
-      if (pc_Section->c_Keys[s32_Index].c_Key.AnsiCompareIC(orc_Key) == 0)
+      const std::map<std::string, sint32>::const_iterator c_It =
+         pc_Section->c_KeyIndex.find(mh_GetIndexName(orc_Key));
+      if (c_It != pc_Section->c_KeyIndex.end())
       {
-         pc_Section->c_Keys.Delete(s32_Index);
+         pc_Section->c_Keys.Delete(c_It->second);
          mq_Dirty = true;
-         return;
+         //indices of all following keys changed:
+         mh_RebuildKeyIndex(*pc_Section);
       }
    }
 }
@@ -746,8 +750,8 @@ C_SCLIniSection * C_SCLIniFile::m_CreateSection(const C_SCLString & orc_Section)
    mc_Sections[mc_Sections.GetHigh()].c_Name    = orc_Section;
    mc_Sections[mc_Sections.GetHigh()].c_Comment = "";
    mq_Dirty = true;
-   ms32_PreviousSectionIndex = 0;
-   ms32_PreviousKeyIndex = 0;
+   (void)mc_SectionIndex.insert(std::pair<const std::string, sint32>(mh_GetIndexName(orc_Section),
+                                                                     mc_Sections.GetHigh()));
 
    return &mc_Sections[mc_Sections.GetHigh()];
 }
@@ -806,48 +810,36 @@ C_SCLIniKey * C_SCLIniFile::m_GetKey(const C_SCLString & orc_Key, const C_SCLStr
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find key in section
 
-C_SCLIniKey * C_SCLIniFile::m_GetKey(const C_SCLString & orc_Key, C_SCLIniSection * const opc_Section)
-{
-   sint32 s32_Index;
-   sint32 s32_LastIndex;
+   Looks up the key in the section's key index.
+   If a key is present more than once the first occurrence is returned.
 
-   s32_LastIndex = ms32_PreviousKeyIndex;
+   \param[in]     orc_Key        key to find
+   \param[in]     opc_Section    section to search in
 
-   //Search from last successful point to the end
-   for (s32_Index = s32_LastIndex; s32_Index < opc_Section->c_Keys.GetLength(); s32_Index++)
-   {
-      if (opc_Section->c_Keys[s32_Index].c_Key.AnsiCompareIC(orc_Key) == 0)
-      {
-         ms32_PreviousKeyIndex = s32_Index;
-         return &opc_Section->c_Keys[s32_Index];
-      }
-   }
+   \return
+   NULL                key not found
+   else                address of found key
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLIniKey * C_SCLIniFile::m_GetKey(const C_SCLString & orc_Key, C_SCLIniSection * const opc_Section)
+{
+   C_SCLIniKey * pc_Key = NULL;
+   const std::map<std::string, sint32>::const_iterator c_It = opc_Section->c_KeyIndex.find(mh_GetIndexName(orc_Key));
 
-   //Not found yet -> Search from beginning to last successful point
-   for (s32_Index = 0; s32_Index < s32_LastIndex; s32_Index++)
+   if (c_It != opc_Section->c_KeyIndex.end())
    {
-      if (opc_Section->c_Keys[s32_Index].c_Key.AnsiCompareIC(orc_Key) == 0)
-      {
-         ms32_PreviousKeyIndex = s32_Index;
-         return &opc_Section->c_Keys[s32_Index];
-      }
+      pc_Key = &opc_Section->c_Keys[c_It->second];
    }
-
-   return NULL;
+   return pc_Key;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Find section
 
-   Given a section name, locates that section in the list and returns a pointer to it.
-
-   We do not simply scan from the first index each time.
-   Instead we try to improve performance for subsequent calls by assuming the following:
-   In many cases the caller will parse the file in a ways that
-   - usually the same section is used for many keys
-   - sections parsed after the first typically reside after the previously parsed section
-   So this approach can help to massively speed up access.
+   Given a section name, locates that section in the section index and returns a pointer to it.
+   If a section is present more than once the first occurrence is returned.
 
    \param[in]     orc_Section    ini section to find
 
@@ -858,37 +850,73 @@ C_SCLIniKey * C_SCLIniFile::m_GetKey(const C_SCLString & orc_Key, C_SCLIniSectio
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLIniSection * C_SCLIniFile::m_GetSection(const C_SCLString & orc_Section)
 {
-   sint32 s32_Index;
-   sint32 s32_LastIndex;
+   C_SCLIniSection * pc_Section = NULL;
+   const std::map<std::string, sint32>::const_iterator c_It = mc_SectionIndex.find(mh_GetIndexName(orc_Section));
 
-   s32_LastIndex = ms32_PreviousSectionIndex;
+   if (c_It != mc_SectionIndex.end())
+   {
+      pc_Section = &mc_Sections[c_It->second];
+   }
+   return pc_Section;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get name as used in indices
+
+   Section and key names are compared ignoring case (like AnsiCompareIC).
+   So the indices are based on the upper case variant of the name.
+
+   \param[in]     orc_Name    section or key name
+
+   \return
+   upper case name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+std::string C_SCLIniFile::mh_GetIndexName(const C_SCLString & orc_Name)
+{
+   std::string c_Name = orc_Name.c_str();
 
-   //Search from last successful point to the end
-   for (s32_Index = s32_LastIndex; s32_Index < mc_Sections.GetLength(); s32_Index++)
+   for (std::string::iterator c_It = c_Name.begin(); c_It != c_Name.end(); ++c_It)
    {
-      if (mc_Sections[s32_Index].c_Name.AnsiCompareIC(orc_Section) == 0)
-      {
-         ms32_PreviousSectionIndex = s32_Index;
-         if (s32_Index != s32_LastIndex) //section changed: restart from 1st key
-         {
-            ms32_PreviousKeyIndex = 0;
-         }
-         return &mc_Sections[s32_Index];
-      }
+      *c_It = static_cast<charn>(std::toupper(*c_It));
    }
+   return c_Name;
+}
 
-   //Not found yet -> Search from beginning to last successful point
-   for (s32_Index = 0; s32_Index < s32_LastIndex; s32_Index++)
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up key index of one section
+
+   Required after loading and after keys were removed (changes indices of following keys).
+
+   \param[in,out]  orc_Section    section to rebuild key index for
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SCLIniFile::mh_RebuildKeyIndex(C_SCLIniSection & orc_Section)
+{
+   orc_Section.c_KeyIndex.clear();
+   for (sint32 s32_Index = 0; s32_Index < orc_Section.c_Keys.GetLength(); s32_Index++)
    {
-      if (mc_Sections[s32_Index].c_Name.AnsiCompareIC(orc_Section) == 0)
-      {
-         ms32_PreviousSectionIndex = s32_Index;
-         ms32_PreviousKeyIndex = 0; //section changed: restart from 1st key
-         return &mc_Sections[s32_Index];
-      }
+      //insert does not replace existing entries; so the first occurrence is kept
+      (void)orc_Section.c_KeyIndex.insert(
+         std::pair<const std::string, sint32>(mh_GetIndexName(orc_Section.c_Keys[s32_Index].c_Key), s32_Index));
    }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set up section index
 
-   return NULL;
+   Required after loading and after sections were removed (changes indices of following sections).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SCLIniFile::m_RebuildSectionIndex(void)
+{
+   mc_SectionIndex.clear();
+   for (sint32 s32_Index = 0; s32_Index < mc_Sections.GetLength(); s32_Index++)
+   {
+      //insert does not replace existing entries; so the first occurrence is kept
+      (void)mc_SectionIndex.insert(
+         std::pair<const std::string, sint32>(mh_GetIndexName(mc_Sections[s32_Index].c_Name), s32_Index));
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,102 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Read XML file piece by piece (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCXMLSTREAMREADER_H
+#define C_OSCXMLSTREAMREADER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "stwtypes.h"
+#include "CSCLString.h"
+#include "C_OSCXMLParser.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCXMLStreamReader :
+   public C_OSCXMLParserBase
+{
+public:
+   C_OSCXMLStreamReader(void);
+   virtual ~C_OSCXMLStreamReader(void);
+
+   stw_types::sint32 Open(const stw_scl::C_SCLString & orc_FileName);
+   void Close(void);
+
+   stw_scl::C_SCLString GetNextNodeName(void) const;
+   stw_types::sint32 ReadNextNode(void);
+   stw_types::sint32 EnterNextNode(void);
+   stw_types::sint32 LeaveNode(void);
+   void DiscardReadNodes(void);
+   stw_types::sint32 ReadToEnd(stw_types::uint16 & oru16_CRC);
+
+private:
+   C_OSCXMLStreamReader(const C_OSCXMLStreamReader & orc_Source);               ///< not implemented: prevent copying
+   C_OSCXMLStreamReader & operator = (const C_OSCXMLStreamReader & orc_Source); ///< not implemented: prevent assignment
+
+   enum E_ItemType
+   {
+      eTEXT,        ///< character data
+      eSTART_TAG,   ///< start tag: "<name ...>"
+      eEMPTY_TAG,   ///< empty element tag: "<name .../>"
+      eEND_TAG,     ///< end tag: "</name>"
+      eMISC,        ///< comment, CDATA section, declaration or other "<!...>" markup
+      eEND_OF_FILE  ///< no more data
+   };
+
+   ///one element that was entered but not yet left
+   class C_Level
+   {
+   public:
+      std::string c_Name;     ///< element name
+      std::string c_Header;   ///< start tag plus content in front of the first child element
+      std::string c_Children; ///< complete child elements read with ReadNextNode
+   };
+
+   std::FILE * mpc_File;
+   std::vector<stw_types::charn> mc_ReadBuffer;
+   stw_types::uintn mun_ReadPos;
+   stw_types::uintn mun_ReadSize;
+
+   std::vector<C_Level> mc_Levels;
+   std::string mc_NextTag;    ///< next start or end tag on the current level (already read from file)
+   E_ItemType me_NextTagType; ///< type of mc_NextTag
+   std::string mc_Item;       ///< buffer for reading one item
+   std::string mc_Text;       ///< buffer for assembling text to parse
+
+   tinyxml2::XMLDocument mc_SkipDocument; ///< document for elements that are only passed through the CRC
+   stw_types::uint16 mu16_CRC;
+   stw_types::uint16 mu16_CRCDepth;
+   bool mq_Failed; ///< true: no file open or a previous read failed; all further reads fail
+
+   static const stw_types::uintn mhun_READ_BUFFER_SIZE;
+
+   bool m_PeekChar(stw_types::charn & orcn_Char);
+   stw_types::sint32 m_ReadItem(std::string & orc_Item, E_ItemType & ore_Type);
+   stw_types::sint32 m_ReadNextTag(std::string * const opc_Content);
+   stw_types::sint32 m_SkipElement(void);
+   stw_types::sint32 m_ParseLevels(void);
+   tinyxml2::XMLElement * m_GetCurrentLevelElement(void);
+
+   static bool mh_IsMarkupComplete(const std::string & orc_Markup);
+   static void mh_GetTagName(const std::string & orc_Tag, std::string & orc_Name);
+   static void mh_MakeStartTag(std::string & orc_Tag);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Write XML file piece by piece (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCXMLSTREAMWRITER_H
+#define C_OSCXMLSTREAMWRITER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <cstdio>
+#include <vector>
+#include "stwtypes.h"
+#include "CSCLString.h"
+#include "C_OSCXMLParser.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCXMLStreamWriter :
+   public C_OSCXMLParserBase
+{
+public:
+   C_OSCXMLStreamWriter(void);
+   virtual ~C_OSCXMLStreamWriter(void);
+
+   stw_types::sint32 Open(const stw_scl::C_SCLString & orc_FileName, const bool oq_AddCRC = false);
+   stw_types::sint32 Flush(void);
+   stw_types::sint32 Close(void);
+   stw_types::uint16 GetCRC(void) const;
+
+private:
+   C_OSCXMLStreamWriter(const C_OSCXMLStreamWriter & orc_Source);               ///< not implemented: prevent copying
+   C_OSCXMLStreamWriter & operator = (const C_OSCXMLStreamWriter & orc_Source); ///< not implemented: prevent assignment
+
+   ///element with start tag already written to file
+   class C_OpenElement
+   {
+   public:
+      tinyxml2::XMLElement * pc_Element; ///< element in document
+      bool q_ContentStarted;             ///< true: content written or CRC over element start calculated
+   };
+
+   std::FILE * mpc_File;
+   tinyxml2::XMLPrinter * mpc_Printer;
+   std::vector<C_OpenElement> mc_OpenElements;
+   bool mq_AddCRC;
+   stw_types::uint16 mu16_CRC;
+   stw_types::uint16 mu16_CRCDepth;
+   stw_types::sint32 ms32_CRCPosition;  ///< file position of CRC attribute value (-1: not written yet)
+   stw_types::uint32 mu32_FilePosition; ///< number of bytes written to file
+
+   void m_WriteBuffer(void);
+   void m_OpenElement(tinyxml2::XMLElement & orc_Element);
+   void m_PushCRCPlaceholder(void);
+   void m_StartContent(const stw_types::uint32 ou32_Level);
+   void m_WriteChildren(const stw_types::uint32 ou32_Level, const tinyxml2::XMLNode * const opc_StopAt);
+   void m_CloseElement(void);
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
@@ -27,6 +27,9 @@
 #include "C_OsyCodeExportBase.h"
 #include "C_OSCUtils.h"
 #include "C_OSCBinaryHash.h"
+#include "C_OSCNodeFiler.h"
+#include "C_OSCXMLParser.h"
+#include "CMD5Checksum.h"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 
@@ -35,8 +38,13 @@ using namespace stw_errors;
 using namespace stw_opensyde_core;
 using namespace stw_scl;
 using namespace stw_tgl;
+using namespace stw_md5;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
+//file in the application output folder remembering the inputs and results of the last code generation
+static const charn * const mpcn_FINGERPRINT_FILE_NAME = "osy_code_fingerprint.txt";
+//number of characters of a MD5 checksum in hex format
+static const uint32 mu32_MD5_STRING_LENGTH = 32U;
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
@@ -73,6 +81,12 @@ void C_OsyCodeExportBase::m_PrintCommandLineParameters(void) const
       "                                   (only if --node is also specified)           applications>\n";
    std::cout <<
       "-e      --erasefolder          Erase target directory and all subdirectories <don't>           -e\n";
+   std::cout <<
+      "                                   (also forces generation of up to date code)\n";
+   std::cout <<
+      "-j      --jobs                 Number of applications to generate in parallel <1>              -j 4\n";
+   std::cout <<
+      "                                   (0: one per processor core)\n";
    std::cout <<
       "-h      --help                 Print command line parameters\n";
    std::cout << "Parameters that have a \"Default\" are optional. All others are mandatory.\n" << &std::endl;
@@ -149,6 +163,12 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::Init(void)
    tgl_assert(sn_Return != 0);
 
    mq_EraseTargetFolder = false;
+   mu32_NumberOfJobs = 1U;
+   mu32_NextJobToRun = 0U;
+   mu32_FirstFailedJob = 0U;
+   mu32_NextJobToReport = 0U;
+   mu32_GeneratedApplications = 0U;
+   mu32_SkippedApplications = 0U;
 
    mc_ExeName = acn_ApplicationName;
    mc_ExeVersion = h_GetApplicationVersion(mc_ExeName);
@@ -226,6 +246,9 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::ParseCommandLine(const si
       {
          "erasefolder",               no_argument,       NULL, 'e'
       },
+      {
+         "jobs",                      required_argument, NULL, 'j'
+      },
       {
          "help",                      no_argument,       NULL, 'h'
       },
@@ -241,7 +264,7 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::ParseCommandLine(const si
    {
       sintn sn_Index;
 
-      sn_Result = getopt_long(osn_Argc, oapcn_Argv, "s:d:o:n:a:he", &ac_Options[0], &sn_Index);
+      sn_Result = getopt_long(osn_Argc, oapcn_Argv, "s:d:o:n:a:j:he", &ac_Options[0], &sn_Index);
       if (sn_Result != -1)
       {
          switch (sn_Result)
@@ -267,6 +290,26 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::ParseCommandLine(const si
          case 'e':
             mq_EraseTargetFolder = true;
             break;
+         case 'j':
+            {
+               const sintn sn_Jobs = C_SCLString(optarg).ToIntDef(-1);
+               if (sn_Jobs < 0)
+               {
+                  q_ParseError = true;
+               }
+               else if (sn_Jobs == 0)
+               {
+                  SYSTEM_INFO t_SystemInfo;
+                  GetSystemInfo(&t_SystemInfo);
+                  mu32_NumberOfJobs = (t_SystemInfo.dwNumberOfProcessors > 0U) ?
+                                      static_cast<uint32>(t_SystemInfo.dwNumberOfProcessors) : 1U;
+               }
+               else
+               {
+                  mu32_NumberOfJobs = static_cast<uint32>(sn_Jobs);
+               }
+            }
+            break;
          case 'h':
             q_PrintCommandLineParameters = true;
             break;
@@ -391,8 +434,8 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateNodeCode(const C_
             }
             else
             {
-               e_Return = m_CreateApplicationCode(orc_Node, static_cast<uint16>(u32_Application), orc_OutputPath,
-                                                  c_CreatedFiles);
+               e_Return = m_GetApplicationCode(orc_Node, static_cast<uint16>(u32_Application), orc_OutputPath,
+                                               c_CreatedFiles);
 
                this->m_PrintCodeCreationInformation(orc_Node.c_Properties.c_Name, rc_Application,
                                                     e_Return == eRESULT_OK, c_CreatedFiles);
@@ -428,7 +471,7 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateNodeCode(const C_
                   TGL_FileIncludeTrailingDelimiter(orc_OutputPath) +
                   C_OSCUtils::h_NiceifyStringForFileName(rc_Application.c_Name);
                e_Return =
-                  m_CreateApplicationCode(orc_Node, static_cast<uint16>(u32_Application), c_Path, c_CreatedFiles);
+                  m_GetApplicationCode(orc_Node, static_cast<uint16>(u32_Application), c_Path, c_CreatedFiles);
                if (e_Return == eRESULT_OK)
                {
                   this->m_PrintCodeCreationInformation(orc_Node.c_Properties.c_Name, rc_Application, true,
@@ -603,6 +646,46 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::GenerateSourceCode(void)
       }
    }
 
+   mu32_GeneratedApplications = 0U;
+   mu32_SkippedApplications = 0U;
+
+   if ((e_Return == eRESULT_OK) && (mu32_NumberOfJobs > 1U))
+   {
+      //generate the code of all applications in parallel first
+      //results are picked up by the sequence below, so the console and log output stays the same
+      mc_ApplicationJobs.clear();
+      for (uint32 u32_Node = 0U; u32_Node < mc_SystemDefinition.c_Nodes.size(); u32_Node++)
+      {
+         const C_OSCNode & rc_Node = mc_SystemDefinition.c_Nodes[u32_Node];
+         if (q_OneNodeOnly == true)
+         {
+            if (rc_Node.c_Properties.c_Name.UpperCase() == mc_DeviceName.UpperCase())
+            {
+               if (rc_Node.c_Properties.e_DiagnosticServer == C_OSCNodeProperties::eDS_OPEN_SYDE)
+               {
+                  (void)this->m_CollectApplicationJobs(rc_Node, mc_OutputPath);
+               }
+               break;
+            }
+         }
+         else if (rc_Node.c_Properties.e_DiagnosticServer == C_OSCNodeProperties::eDS_OPEN_SYDE)
+         {
+            const C_SCLString c_Path = TGL_FileIncludeTrailingDelimiter(mc_OutputPath) +
+                                       C_OSCUtils::h_NiceifyStringForFileName(rc_Node.c_Properties.c_Name);
+            //the sequential generation stops at the first node with an error; do not generate any code behind it
+            if (this->m_CollectApplicationJobs(rc_Node, c_Path) == false)
+            {
+               break;
+            }
+         }
+         else
+         {
+            //not an openSYDE node: no code generated
+         }
+      }
+      this->m_RunApplicationJobs();
+   }
+
    if (e_Return == eRESULT_OK)
    {
       //does the requested device exist ?
@@ -659,9 +742,416 @@ C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::GenerateSourceCode(void)
       }
    }
 
+   if (e_Return == eRESULT_OK)
+   {
+      const C_SCLString c_Info = "Generated code for " + C_SCLString::IntToStr(mu32_GeneratedApplications) +
+                                 " application(s); code of " + C_SCLString::IntToStr(mu32_SkippedApplications) +
+                                 " application(s) was up to date.";
+      std::cout << c_Info.c_str() << &std::endl;
+      osc_write_log_info("Code Generation", c_Info);
+   }
+
+   return e_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add jobs for all applications of one node
+
+   Adds the applications m_CreateNodeCode would generate code for in the same order.
+   Applications behind one with an unknown code format version are not added as the generation stops there.
+
+   \param[in]  orc_Node         node to generate code for
+   \param[in]  orc_OutputPath   code generation output path of node
+
+   \return
+   true    all applications m_CreateNodeCode would generate code for were added
+   false   m_CreateNodeCode will report an error for this node (unknown code format version; requested application
+           not found or not programmable); the generation stops at this node so no further jobs must be added
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OsyCodeExportBase::m_CollectApplicationJobs(const C_OSCNode & orc_Node, const C_SCLString & orc_OutputPath)
+{
+   bool q_Return = false;
+   C_ApplicationJob c_Job;
+
+   c_Job.pc_Node = &orc_Node;
+   c_Job.e_Result = eRESULT_OK;
+   c_Job.q_Done = false;
+   c_Job.q_Skipped = false;
+
+   if (mc_ApplicationName != "")
+   {
+      for (uint32 u32_Application = 0U; u32_Application < orc_Node.c_Applications.size(); u32_Application++)
+      {
+         const C_OSCNodeApplication & rc_Application = orc_Node.c_Applications[u32_Application];
+         if (rc_Application.c_Name.UpperCase() == mc_ApplicationName.UpperCase())
+         {
+            if ((rc_Application.e_Type == C_OSCNodeApplication::ePROGRAMMABLE_APPLICATION) &&
+                (rc_Application.u16_GenCodeVersion <= C_OSCNodeApplication::hu16_HIGHEST_KNOWN_CODE_VERSION))
+            {
+               c_Job.u16_ApplicationIndex = static_cast<uint16>(u32_Application);
+               c_Job.c_OutputPath = orc_OutputPath;
+               mc_ApplicationJobs.push_back(c_Job);
+               q_Return = true;
+            }
+            break;
+         }
+      }
+   }
+   else
+   {
+      bool q_FolderCreated = false;
+      q_Return = true;
+      for (uint32 u32_Application = 0U; u32_Application < orc_Node.c_Applications.size(); u32_Application++)
+      {
+         const C_OSCNodeApplication & rc_Application = orc_Node.c_Applications[u32_Application];
+         if (rc_Application.e_Type == C_OSCNodeApplication::ePROGRAMMABLE_APPLICATION)
+         {
+            if (rc_Application.u16_GenCodeVersion > C_OSCNodeApplication::hu16_HIGHEST_KNOWN_CODE_VERSION)
+            {
+               q_Return = false;
+               break;
+            }
+            //the application folders share the node folder; create it before the workers race for it
+            if (q_FolderCreated == false)
+            {
+               (void)C_OSCUtils::h_CreateFolderRecursively(orc_OutputPath);
+               q_FolderCreated = true;
+            }
+            c_Job.u16_ApplicationIndex = static_cast<uint16>(u32_Application);
+            c_Job.c_OutputPath = TGL_FileIncludeTrailingDelimiter(orc_OutputPath) +
+                                 C_OSCUtils::h_NiceifyStringForFileName(rc_Application.c_Name);
+            mc_ApplicationJobs.push_back(c_Job);
+         }
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Generate code for all collected applications in parallel
+
+   Runs mu32_NumberOfJobs workers (including the calling thread) and returns after all jobs were processed.
+   If one job fails, no job behind it is started any more as the sequential generation would not reach them.
+   Jobs in front of the failed one are still started, so the reported result is the same as with the sequential
+    generation. Jobs behind it that were already running when it failed are completed, so their folders can
+    contain new code although the generation reported an error.
+
+   The workers only read shared state that was prepared before they are started (system definition, jobs,
+    executable information incl. mc_BinaryHash set by ::Init).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::m_RunApplicationJobs(void)
+{
+   const uint32 u32_NumberOfThreads = (mu32_NumberOfJobs < mc_ApplicationJobs.size()) ?
+                                      (mu32_NumberOfJobs - 1U) :
+                                      (static_cast<uint32>(mc_ApplicationJobs.size()) - 1U);
+
+   mu32_NextJobToRun = 0U;
+   mu32_NextJobToReport = 0U;
+   mu32_FirstFailedJob = static_cast<uint32>(mc_ApplicationJobs.size());
+
+   if (mc_ApplicationJobs.empty() == false)
+   {
+      C_TGLThread * const pc_Threads = (u32_NumberOfThreads > 0U) ? new C_TGLThread[u32_NumberOfThreads] : NULL;
+
+      for (uint32 u32_Thread = 0U; u32_Thread < u32_NumberOfThreads; u32_Thread++)
+      {
+         //if a thread can not be started the others will do its work
+         (void)pc_Threads[u32_Thread].Start(&C_OsyCodeExportBase::mh_ApplicationJobThread, this);
+      }
+      this->m_ProcessApplicationJobs();
+      for (uint32 u32_Thread = 0U; u32_Thread < u32_NumberOfThreads; u32_Thread++)
+      {
+         (void)pc_Threads[u32_Thread].WaitFor();
+      }
+      delete[] pc_Threads;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Thread function of application code generation workers
+
+   \param[in,out]  opv_Instance   instance of C_OsyCodeExportBase
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::mh_ApplicationJobThread(void * const opv_Instance)
+{
+   C_OsyCodeExportBase * const pc_This = static_cast<C_OsyCodeExportBase *>(opv_Instance);
+
+   pc_This->m_ProcessApplicationJobs();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Process application jobs until there are no more jobs to do
+
+   Can be called by multiple threads at the same time.
+   A job is only started if no job in front of it failed yet (see m_RunApplicationJobs).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OsyCodeExportBase::m_ProcessApplicationJobs(void)
+{
+   bool q_Continue = true;
+
+   while (q_Continue == true)
+   {
+      uint32 u32_Job;
+
+      mc_JobCriticalSection.Acquire();
+      u32_Job = mu32_NextJobToRun;
+      if ((u32_Job < mc_ApplicationJobs.size()) && (u32_Job < mu32_FirstFailedJob))
+      {
+         mu32_NextJobToRun++;
+      }
+      else
+      {
+         q_Continue = false;
+      }
+      mc_JobCriticalSection.Release();
+
+      if (q_Continue == true)
+      {
+         C_ApplicationJob & rc_Job = mc_ApplicationJobs[u32_Job];
+         rc_Job.e_Result = m_CreateApplicationCodeIfChanged(*rc_Job.pc_Node, rc_Job.u16_ApplicationIndex,
+                                                            rc_Job.c_OutputPath, rc_Job.c_CreatedFiles,
+                                                            rc_Job.q_Skipped);
+         rc_Job.q_Done = true;
+         if (rc_Job.e_Result != eRESULT_OK)
+         {
+            mc_JobCriticalSection.Acquire();
+            if (u32_Job < mu32_FirstFailedJob)
+            {
+               mu32_FirstFailedJob = u32_Job;
+            }
+            mc_JobCriticalSection.Release();
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get generated source code for one application of one node
+
+   Returns the result of the parallel generation if it already generated the code for this application.
+   Otherwise the code is generated right now.
+
+   \param[in]     orc_Node               node to generate code for
+   \param[in]     ou16_ApplicationIndex  application to generate code for
+   \param[in]     orc_OutputPath         code generation output path
+   \param[out]    orc_CreatedFiles       list of created files (with paths)
+
+   \return
+   eRESULT_OK                        code created for all programmable application
+   eRESULT_CODE_GENERATION_ERROR     problems creating code
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_GetApplicationCode(const C_OSCNode & orc_Node,
+                                                                            const uint16 ou16_ApplicationIndex,
+                                                                            const C_SCLString & orc_OutputPath,
+                                                                            std::vector<C_SCLString> & orc_CreatedFiles)
+{
+   E_ResultCode e_Return;
+   bool q_Skipped;
+
+   //jobs are reported in the order they were collected in
+   if ((mu32_NumberOfJobs > 1U) && (mu32_NextJobToReport < mc_ApplicationJobs.size()) &&
+       (mc_ApplicationJobs[mu32_NextJobToReport].pc_Node == &orc_Node) &&
+       (mc_ApplicationJobs[mu32_NextJobToReport].u16_ApplicationIndex == ou16_ApplicationIndex) &&
+       (mc_ApplicationJobs[mu32_NextJobToReport].q_Done == true))
+   {
+      const C_ApplicationJob & rc_Job = mc_ApplicationJobs[mu32_NextJobToReport];
+      orc_CreatedFiles = rc_Job.c_CreatedFiles;
+      e_Return = rc_Job.e_Result;
+      q_Skipped = rc_Job.q_Skipped;
+      mu32_NextJobToReport++;
+   }
+   else
+   {
+      e_Return = m_CreateApplicationCodeIfChanged(orc_Node, ou16_ApplicationIndex, orc_OutputPath, orc_CreatedFiles,
+                                                  q_Skipped);
+   }
+
+   if (e_Return == eRESULT_OK)
+   {
+      if (q_Skipped == true)
+      {
+         mu32_SkippedApplications++;
+      }
+      else
+      {
+         mu32_GeneratedApplications++;
+      }
+   }
    return e_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Generate source code for one application of one node if its inputs changed
+
+   The fingerprint of the inputs of the last successful generation is stored in the output folder together with the
+    list of created files and the MD5 checksum of each of them. If the fingerprint still matches and all files still
+    have the stored checksum the code is not generated again, so the files keep their time stamps and builds of the
+    target do not need to compile them again. Deleted or manually modified files are generated again.
+
+   Can be called by multiple threads at the same time.
+
+   \param[in]     orc_Node               node to generate code for
+   \param[in]     ou16_ApplicationIndex  application to generate code for
+   \param[in]     orc_OutputPath         code generation output path
+   \param[out]    orc_CreatedFiles       list of created files (with paths)
+   \param[out]    orq_Skipped            true: code was up to date and not generated again
+
+   \return
+   eRESULT_OK                        code created for all programmable application
+   eRESULT_CODE_GENERATION_ERROR     problems creating code
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OsyCodeExportBase::E_ResultCode C_OsyCodeExportBase::m_CreateApplicationCodeIfChanged(
+   const C_OSCNode & orc_Node, const uint16 ou16_ApplicationIndex, const C_SCLString & orc_OutputPath,
+   std::vector<C_SCLString> & orc_CreatedFiles, bool & orq_Skipped)
+{
+   E_ResultCode e_Return = eRESULT_OK;
+   const C_SCLString c_FingerprintFile = TGL_FileIncludeTrailingDelimiter(orc_OutputPath) + mpcn_FINGERPRINT_FILE_NAME;
+   const C_SCLString c_Fingerprint = this->m_GetApplicationFingerprint(orc_Node, ou16_ApplicationIndex,
+                                                                       orc_OutputPath);
+   C_SCLStringList c_Manifest;
+
+   orq_Skipped = false;
+
+   //first line: fingerprint; following lines: "<MD5 checksum> <path>" of each created file
+   if (TGL_FileExists(c_FingerprintFile) == true)
+   {
+      try
+      {
+         c_Manifest.LoadFromFile(c_FingerprintFile);
+      }
+      catch (...)
+      {
+         c_Manifest.Clear();
+      }
+   }
+   orc_CreatedFiles.clear();
+   if ((c_Fingerprint != "") && (c_Manifest.Strings.GetLength() > 1) && (c_Manifest.Strings[0] == c_Fingerprint))
+   {
+      orq_Skipped = true;
+      for (sint32 s32_File = 1; (s32_File < c_Manifest.Strings.GetLength()) && (orq_Skipped == true); s32_File++)
+      {
+         const C_SCLString & rc_Entry = c_Manifest.Strings[s32_File];
+         if (rc_Entry.Length() > (mu32_MD5_STRING_LENGTH + 1U))
+         {
+            const C_SCLString c_Path = rc_Entry.SubString(mu32_MD5_STRING_LENGTH + 2U, rc_Entry.Length());
+            //checksum is empty if the file does not exist any more
+            if (CMD5Checksum::GetMD5(c_Path) == rc_Entry.SubString(1U, mu32_MD5_STRING_LENGTH))
+            {
+               orc_CreatedFiles.push_back(c_Path);
+            }
+            else
+            {
+               orq_Skipped = false;
+            }
+         }
+         else
+         {
+            orq_Skipped = false;
+         }
+      }
+   }
+
+   if (orq_Skipped == false)
+   {
+      orc_CreatedFiles.clear();
+      //a failed generation must not leave an outdated fingerprint behind
+      if (TGL_FileExists(c_FingerprintFile) == true)
+      {
+         (void)std::remove(c_FingerprintFile.c_str());
+      }
+
+      e_Return = m_CreateApplicationCode(orc_Node, ou16_ApplicationIndex, orc_OutputPath, orc_CreatedFiles);
+
+      if ((e_Return == eRESULT_OK) && (orc_CreatedFiles.empty() == false) && (c_Fingerprint != ""))
+      {
+         bool q_ChecksumsValid = true;
+         c_Manifest.Clear();
+         c_Manifest.Add(c_Fingerprint);
+         for (uint32 u32_File = 0U; (u32_File < orc_CreatedFiles.size()) && (q_ChecksumsValid == true); u32_File++)
+         {
+            const C_SCLString c_Checksum = CMD5Checksum::GetMD5(orc_CreatedFiles[u32_File]);
+            if (c_Checksum.Length() == mu32_MD5_STRING_LENGTH)
+            {
+               c_Manifest.Add(c_Checksum + " " + orc_CreatedFiles[u32_File]);
+            }
+            else
+            {
+               q_ChecksumsValid = false;
+            }
+         }
+         if (q_ChecksumsValid == true)
+         {
+            try
+            {
+               c_Manifest.SaveToFile(c_FingerprintFile);
+            }
+            catch (...)
+            {
+               //not critical: code will be generated again next time
+               osc_write_log_warning("Code Generation", "Could not write file \"" + c_FingerprintFile + "\".");
+            }
+         }
+         else
+         {
+            //not critical: code will be generated again next time
+            osc_write_log_warning("Code Generation", "Could not calculate checksums of the files created in \"" +
+                                  orc_OutputPath + "\".");
+         }
+      }
+   }
+
+   return e_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get fingerprint of all inputs of the code generation for one application
+
+   Covers the complete node (including Datapools, protocols and HALC configuration), the application,
+    the output path and the version and checksum of this tool.
+   The node is serialized the same way it is stored in the project (with all referenced files inline) and the MD5
+    checksum of that is used, so different inputs can not end up with the same fingerprint by chance.
+
+   \param[in]     orc_Node               node to generate code for
+   \param[in]     ou16_ApplicationIndex  application to generate code for
+   \param[in]     orc_OutputPath         code generation output path
+
+   \return
+   fingerprint as text (empty if the node could not be serialized)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OsyCodeExportBase::m_GetApplicationFingerprint(const C_OSCNode & orc_Node,
+                                                             const uint16 ou16_ApplicationIndex,
+                                                             const C_SCLString & orc_OutputPath) const
+{
+   C_OSCXMLParserString c_XMLParser;
+   C_SCLString c_Fingerprint;
+
+   c_XMLParser.CreateNodeChild("node");
+   tgl_assert(c_XMLParser.SelectRoot() == "node");
+   //without base path everything is stored inline
+   if (C_OSCNodeFiler::h_SaveNode(orc_Node, c_XMLParser, "", NULL) == C_NO_ERR)
+   {
+      C_SCLString c_Inputs;
+      uint32 u32_Hash = 0xFFFFFFFFUL;
+
+      c_XMLParser.SaveToString(c_Inputs);
+      //also covers information not stored in the project (e.g. device definition)
+      orc_Node.CalcHash(u32_Hash);
+      c_Inputs += "\n" + C_SCLString::IntToHex(u32_Hash, 8U) + "\n" + C_SCLString::IntToStr(ou16_ApplicationIndex) +
+                  "\n" + orc_OutputPath;
+
+      c_Fingerprint = CMD5Checksum::GetMD5(reinterpret_cast<const uint8 *>(c_Inputs.c_str()), c_Inputs.Length()) +
+                      " " + mc_ExeVersion + " " + mc_BinaryHash;
+   }
+   return c_Fingerprint;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Shut down generic code export engine
 
@@ -16,6 +16,7 @@
 
 #include "stwtypes.h"
 #include "CSCLString.h"
+#include "TGLTasks.h"
 #include "C_OSCSystemDefinition.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -59,7 +60,45 @@ public:
    E_ResultCode Exit(const E_ResultCode oe_ResultCode);
 
 private:
+   ///Code generation for one application; run by the worker threads if parallel generation is active
+   class C_ApplicationJob
+   {
+   public:
+      const stw_opensyde_core::C_OSCNode * pc_Node;
+      stw_types::uint16 u16_ApplicationIndex;
+      stw_scl::C_SCLString c_OutputPath;
+      E_ResultCode e_Result;
+      std::vector<stw_scl::C_SCLString> c_CreatedFiles;
+      bool q_Done;    ///< true: e_Result, c_CreatedFiles and q_Skipped are valid
+      bool q_Skipped; ///< true: code was up to date and not generated again
+   };
+
+   std::vector<C_ApplicationJob> mc_ApplicationJobs; ///< jobs in the order of sequential generation
+   stw_types::uint32 mu32_NextJobToRun;              ///< index of the next job to be picked up by a worker
+   stw_types::uint32 mu32_FirstFailedJob;            ///< jobs behind this one are not needed anymore
+   stw_types::uint32 mu32_NextJobToReport;           ///< index of the next job to be reported
+   stw_tgl::C_TGLCriticalSection mc_JobCriticalSection;
+   stw_types::uint32 mu32_GeneratedApplications; ///< number of applications code was generated for
+   stw_types::uint32 mu32_SkippedApplications;   ///< number of applications with up to date code
+
    void m_PrintCommandLineParameters(void) const;
+   bool m_CollectApplicationJobs(const stw_opensyde_core::C_OSCNode & orc_Node,
+                                 const stw_scl::C_SCLString & orc_OutputPath);
+   void m_RunApplicationJobs(void);
+   static void mh_ApplicationJobThread(void * const opv_Instance);
+   void m_ProcessApplicationJobs(void);
+   E_ResultCode m_GetApplicationCode(const stw_opensyde_core::C_OSCNode & orc_Node,
+                                     const stw_types::uint16 ou16_ApplicationIndex,
+                                     const stw_scl::C_SCLString & orc_OutputPath,
+                                     std::vector<stw_scl::C_SCLString> & orc_CreatedFiles);
+   E_ResultCode m_CreateApplicationCodeIfChanged(const stw_opensyde_core::C_OSCNode & orc_Node,
+                                                 const stw_types::uint16 ou16_ApplicationIndex,
+                                                 const stw_scl::C_SCLString & orc_OutputPath,
+                                                 std::vector<stw_scl::C_SCLString> & orc_CreatedFiles,
+                                                 bool & orq_Skipped);
+   stw_scl::C_SCLString m_GetApplicationFingerprint(const stw_opensyde_core::C_OSCNode & orc_Node,
+                                                    const stw_types::uint16 ou16_ApplicationIndex,
+                                                    const stw_scl::C_SCLString & orc_OutputPath) const;
    E_ResultCode m_CreateNodeCode(const stw_opensyde_core::C_OSCNode & orc_Node,
                                  const stw_scl::C_SCLString & orc_OutputPath);
    void m_PrintCodeCreationInformation(const stw_scl::C_SCLString & orc_NodeName,
@@ -76,6 +115,7 @@ protected:
    stw_scl::C_SCLString mc_DeviceName;      //name of device for which to create code ("" -> all)
    stw_scl::C_SCLString mc_ApplicationName; //name of application for which to create code ("" -> all)
    bool mq_EraseTargetFolder;
+   stw_types::uint32 mu32_NumberOfJobs; //number of applications to generate code for in parallel (1 -> sequential)
 
    //parsed system definition
    stw_opensyde_core::C_OSCSystemDefinition mc_SystemDefinition;
@@ -96,6 +136,8 @@ protected:
 
       The caller guarantees ou16_ApplicationIndex to be within valid range and the application to be a
        "programmable application".
+      With parallel generation ("--jobs") this is called by multiple threads at the same time,
+       so implementations must not modify any members.
 
       \param[in]     orc_Node               node to generate code for
       \param[in]     ou16_ApplicationIndex  application to generate code for
@@ -67,9 +67,12 @@ private:
    static void mh_CreateInterpretedList(const C_OSCNodeDataPoolList & orc_List,
                                         C_OSCParamSetInterpretedList & orc_InterpretedList);
    stw_types::sint32 m_CheckParameterFileContent(const C_OSCParamSetRawNode & orc_Node);
+   stw_types::sint32 m_ReadParameterLists(const std::vector<C_OSCNodeDataPoolListId> & orc_ListIds,
+                                          std::vector<std::vector<stw_types::uint8> > & orc_Values,
+                                          stw_types::uint8 * const opu8_NrCode);
    stw_types::sint32 m_CreateRawEntryAndPrepareInterpretedData(C_OSCNodeDataPoolList & orc_List,
-                                                               C_OSCParamSetRawEntry & orc_Entry,
-                                                               stw_types::uint8 * const opu8_NrCode);
+                                                               std::vector<stw_types::uint8> & orc_Values,
+                                                               C_OSCParamSetRawEntry & orc_Entry) const;
 
    enum E_CreateParameterSetFileState
    {
@@ -15,6 +15,8 @@
 #include "stwtypes.h"
 #include "CSCLString.h"
 #include "C_OSCXMLParser.h"
+#include "C_OSCXMLStreamReader.h"
+#include "C_OSCXMLStreamWriter.h"
 #include "C_OSCParamSetDataPoolInfo.h"
 #include "C_OSCParamSetInterpretedFileInfoData.h"
 
@@ -53,6 +55,10 @@ protected:
 
 private:
    static stw_types::uint16 mhu16_FileVersion;
+
+   static stw_types::sint32 mh_ReplaceFile(const stw_scl::C_SCLString & orc_NewPath,
+                                           const stw_scl::C_SCLString & orc_Path);
+   static stw_types::sint32 mh_CopyNodes(C_OSCXMLStreamReader & orc_Reader, C_OSCXMLStreamWriter & orc_Writer);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -15,7 +15,8 @@
 #include "TGLUtils.h"
 #include "TGLFile.h"
 #include "stwerrors.h"
-#include "C_OSCChecksummedXML.h"
+#include "C_OSCXMLStreamReader.h"
+#include "C_OSCXMLStreamWriter.h"
 #include "C_OSCParamSetHandler.h"
 #include "C_OSCParamSetRawNodeFiler.h"
 #include "C_OSCParamSetInterpretedNodeFiler.h"
@@ -51,6 +52,8 @@ C_OSCParamSetHandler::C_OSCParamSetHandler(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Create clean file from internally stored content without adding a CRC
 
+   The file is written node by node, so only the XML of one node is held in memory at a time.
+
    \param[in] orc_FilePath Parameter file path
    \param[in] oq_InterpretedDataOnly   Flag to load only the interpreted data and not the raw data
 
@@ -71,25 +74,34 @@ sint32 C_OSCParamSetHandler::CreateCleanFileWithoutCRC(const C_SCLString & orc_F
       if ((oq_InterpretedDataOnly == true) ||
           (this->mc_RawNodes.size() == this->mc_Data.c_InterpretedNodes.size()))
       {
-         C_OSCXMLParser c_XMLParser;
-         tgl_assert(c_XMLParser.CreateAndSelectNodeChild("opensyde-parameter-sets") == "opensyde-parameter-sets");
-         C_OSCParamSetFilerBase::h_SaveFileVersion(c_XMLParser);
-         C_OSCParamSetFilerBase::h_SaveFileInfo(c_XMLParser, this->mc_Data.c_FileInfo);
-         tgl_assert(c_XMLParser.CreateAndSelectNodeChild("nodes") == "nodes");
-         for (uint32 u32_ItNode = 0; u32_ItNode < this->mc_Data.c_InterpretedNodes.size(); ++u32_ItNode)
+         C_OSCXMLStreamWriter c_XMLParser;
+         s32_Return = c_XMLParser.Open(orc_FilePath);
+         if (s32_Return == C_NO_ERR)
          {
-            tgl_assert(c_XMLParser.CreateAndSelectNodeChild("node") == "node");
-            if (oq_InterpretedDataOnly == false)
+            tgl_assert(c_XMLParser.CreateAndSelectNodeChild("opensyde-parameter-sets") == "opensyde-parameter-sets");
+            C_OSCParamSetFilerBase::h_SaveFileVersion(c_XMLParser);
+            C_OSCParamSetFilerBase::h_SaveFileInfo(c_XMLParser, this->mc_Data.c_FileInfo);
+            tgl_assert(c_XMLParser.CreateAndSelectNodeChild("nodes") == "nodes");
+            for (uint32 u32_ItNode = 0; (u32_ItNode < this->mc_Data.c_InterpretedNodes.size()) &&
+                 (s32_Return == C_NO_ERR); ++u32_ItNode)
+            {
+               tgl_assert(c_XMLParser.CreateAndSelectNodeChild("node") == "node");
+               if (oq_InterpretedDataOnly == false)
+               {
+                  C_OSCParamSetRawNodeFiler::h_SaveRawNode(this->mc_RawNodes[u32_ItNode], c_XMLParser);
+               }
+               C_OSCParamSetInterpretedNodeFiler::h_SaveInterpretedNode(
+                  this->mc_Data.c_InterpretedNodes[u32_ItNode], c_XMLParser);
+               //Return
+               tgl_assert(c_XMLParser.SelectNodeParent() == "nodes");
+               //node is complete: write it
+               s32_Return = c_XMLParser.Flush();
+            }
+            if (c_XMLParser.Close() != C_NO_ERR)
             {
-               C_OSCParamSetRawNodeFiler::h_SaveRawNode(this->mc_RawNodes[u32_ItNode], c_XMLParser);
+               s32_Return = C_NOACT;
             }
-            C_OSCParamSetInterpretedNodeFiler::h_SaveInterpretedNode(this->mc_Data.c_InterpretedNodes[u32_ItNode],
-                                                                     c_XMLParser);
-            //Return
-            tgl_assert(c_XMLParser.SelectNodeParent() == "nodes");
          }
-
-         s32_Return = c_XMLParser.SaveToFile(orc_FilePath);
          if (s32_Return != C_NO_ERR)
          {
             s32_Return = C_RD_WR;
@@ -110,6 +122,10 @@ sint32 C_OSCParamSetHandler::CreateCleanFileWithoutCRC(const C_SCLString & orc_F
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Read file and update internally stored content (cleared at start)
 
+   The file is read node by node, so there is no DOM of the complete file.
+   Memory limit: the read content itself is stored completely (raw and interpreted nodes),
+   so the memory needed still grows with the size of the file.
+
    \param[in]     orc_FilePath               Parameter file path
    \param[in]     oq_IgnoreCrc               Flag to ignore CRC if set to true
    \param[in]     oq_InterpretedDataOnly     Flag to load only the interpreted data and not the raw data
@@ -135,52 +151,64 @@ sint32 C_OSCParamSetHandler::ReadFile(const C_SCLString & orc_FilePath, const bo
    this->ClearContent();
    if (TGL_FileExists(orc_FilePath) == true)
    {
-      C_OSCXMLParser * pc_Parser;
-      if (oq_IgnoreCrc == true)
-      {
-         pc_Parser = new C_OSCXMLParser();
-      }
-      else
-      {
-         pc_Parser = new C_OSCChecksummedXML();
-      }
+      //the file is read node by node; the CRC is calculated on the way
+      C_OSCXMLStreamReader c_Parser;
 
-      s32_Retval = pc_Parser->LoadFromFile(orc_FilePath);
+      s32_Retval = c_Parser.Open(orc_FilePath);
       if (s32_Retval == C_NO_ERR)
       {
-         if (pc_Parser->SelectRoot() == "opensyde-parameter-sets")
+         const bool q_CrcFound = c_Parser.AttributeExists("file_crc");
+         const uint16 u16_FileCrc = static_cast<uint16>(c_Parser.GetAttributeUint32("file_crc"));
+         const bool q_RootFound = (c_Parser.SelectRoot() == "opensyde-parameter-sets");
+         bool q_MissingOptionalContent = false;
+         sint32 s32_LoadResult = C_NO_ERR;
+         uint16 u16_CrcCalc;
+
+         if (q_RootFound == true)
          {
-            s32_Retval = C_OSCParamSetRawNodeFiler::h_CheckFileVersion(*pc_Parser);
-            if (s32_Retval == C_NO_ERR)
-            {
-               bool q_MissingOptionalContent = false;
-               C_OSCParamSetRawNodeFiler::h_LoadFileInfo(*pc_Parser, this->mc_Data.c_FileInfo,
-                                                         q_MissingOptionalContent);
-               s32_Retval = this->m_LoadNodes(*pc_Parser, oq_InterpretedDataOnly, q_MissingOptionalContent);
-               if ((opu16_FileCrc != NULL) && (s32_Retval == C_NO_ERR))
-               {
-                  *opu16_FileCrc = static_cast<uint16>(pc_Parser->GetAttributeUint32("file_crc"));
-               }
-               if (opq_MissingOptionalContent != NULL)
-               {
-                  *opq_MissingOptionalContent = q_MissingOptionalContent;
-               }
-            }
+            s32_LoadResult = this->m_LoadNodes(c_Parser, oq_InterpretedDataOnly, q_MissingOptionalContent);
          }
-         else
+
+         //the CRC covers the whole file; so it is checked before looking at the result of loading the content
+         if (c_Parser.ReadToEnd(u16_CrcCalc) != C_NO_ERR)
+         {
+            s32_Retval = C_RD_WR;
+         }
+         else if ((oq_IgnoreCrc == false) && (q_CrcFound == false))
+         {
+            s32_Retval = C_RD_WR;
+         }
+         else if ((oq_IgnoreCrc == false) && (u16_CrcCalc != u16_FileCrc))
+         {
+            s32_Retval = C_CHECKSUM;
+         }
+         else if (q_RootFound == false)
          {
             osc_write_log_error("Loading Dataset data", "Could not find root element \"opensyde-parameter-sets\".");
             s32_Retval = C_RD_WR;
          }
+         else
+         {
+            s32_Retval = s32_LoadResult;
+            if ((opu16_FileCrc != NULL) && (s32_Retval == C_NO_ERR))
+            {
+               *opu16_FileCrc = u16_FileCrc;
+            }
+            if (opq_MissingOptionalContent != NULL)
+            {
+               *opq_MissingOptionalContent = q_MissingOptionalContent;
+            }
+         }
       }
       else
       {
-         if (s32_Retval != C_CHECKSUM)
-         {
-            s32_Retval = C_RD_WR;
-         }
+         s32_Retval = C_RD_WR;
+      }
+      if ((s32_Retval == C_RD_WR) || (s32_Retval == C_CHECKSUM))
+      {
+         //content was loaded before the file was checked completely: do not leave it behind
+         this->ClearContent();
       }
-      delete pc_Parser;
    }
    else
    {
@@ -372,9 +400,12 @@ const C_OSCParamSetRawNode * C_OSCParamSetHandler::GetRawDataForNode(const uint3
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Load node data
 
-   Load node data from XML file
-   pre-condition: the passed XML parser has the active node set to "opensyde-parameter-sets"
-   post-condition: the passed XML parser has the active node set to the same "opensyde-parameter-sets"
+   Load file version, file information and node data from XML file.
+   The nodes are read and processed one by one. Everything in front of the "nodes" element is read completely.
+   So "file-version" and "file-info" are expected in front of "nodes".
+
+   pre-condition: the passed XML parser has the active node set to "opensyde-parameter-sets"; no child read yet
+   post-condition: the passed XML parser is positioned somewhere within "opensyde-parameter-sets"
 
    \param[in,out] orc_XMLParser              XML with specified node active
    \param[in]     oq_InterpretedDataOnly     Flag to load only the interpreted data and not the raw data
@@ -384,68 +415,84 @@ const C_OSCParamSetRawNode * C_OSCParamSetHandler::GetRawDataForNode(const uint3
    \return
    C_NO_ERR   data read
    C_CONFIG   content of file is invalid or incomplete
+   C_RD_WR    invalid XML
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_OSCParamSetHandler::m_LoadNodes(C_OSCXMLParser & orc_XMLParser, const bool oq_InterpretedDataOnly,
+sint32 C_OSCParamSetHandler::m_LoadNodes(C_OSCXMLStreamReader & orc_XMLParser, const bool oq_InterpretedDataOnly,
                                          bool & orq_MissingOptionalContent)
 {
    sint32 s32_Retval = C_NO_ERR;
+   C_SCLString c_NextNode = orc_XMLParser.GetNextNodeName();
 
-   if (orc_XMLParser.SelectNodeChild("nodes") == "nodes")
+   //header
+   while ((s32_Retval == C_NO_ERR) && (c_NextNode != "") && (c_NextNode != "nodes"))
    {
-      C_SCLString c_SelectedNode = orc_XMLParser.SelectNodeChild("node");
-
-      if (c_SelectedNode == "node")
+      s32_Retval = orc_XMLParser.ReadNextNode();
+      c_NextNode = orc_XMLParser.GetNextNodeName();
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      tgl_assert(orc_XMLParser.SelectRoot() == "opensyde-parameter-sets");
+      s32_Retval = C_OSCParamSetFilerBase::h_CheckFileVersion(orc_XMLParser);
+   }
+   if (s32_Retval == C_NO_ERR)
+   {
+      C_OSCParamSetFilerBase::h_LoadFileInfo(orc_XMLParser, this->mc_Data.c_FileInfo, orq_MissingOptionalContent);
+      if (c_NextNode == "nodes")
       {
-         do
+         bool q_NodeFound = false;
+         s32_Retval = orc_XMLParser.EnterNextNode();
+         c_NextNode = orc_XMLParser.GetNextNodeName();
+         while ((s32_Retval == C_NO_ERR) && (c_NextNode != ""))
          {
-            C_OSCParamSetInterpretedNode c_InterpretedItem;
-            C_OSCParamSetRawNode c_RawItem;
-            //Content
-            if (oq_InterpretedDataOnly == false)
+            //only keep the current node in memory
+            orc_XMLParser.DiscardReadNodes();
+            s32_Retval = orc_XMLParser.ReadNextNode();
+            if ((s32_Retval == C_NO_ERR) && (c_NextNode == "node"))
             {
-               s32_Retval = C_OSCParamSetRawNodeFiler::h_LoadRawNode(c_RawItem, orc_XMLParser,
-                                                                     orq_MissingOptionalContent);
-               if (s32_Retval == C_NO_ERR)
+               C_OSCParamSetInterpretedNode c_InterpretedItem;
+               C_OSCParamSetRawNode c_RawItem;
+               q_NodeFound = true;
+               //Content
+               if (oq_InterpretedDataOnly == false)
                {
-                  this->mc_RawNodes.push_back(c_RawItem);
+                  s32_Retval = C_OSCParamSetRawNodeFiler::h_LoadRawNode(c_RawItem, orc_XMLParser,
+                                                                        orq_MissingOptionalContent);
+                  if (s32_Retval == C_NO_ERR)
+                  {
+                     this->mc_RawNodes.push_back(c_RawItem);
+                  }
                }
-            }
-            else
-            {
-               // Do not load the raw data
-               s32_Retval = C_NO_ERR;
-            }
 
-            if (s32_Retval == C_NO_ERR)
-            {
-               s32_Retval = C_OSCParamSetInterpretedNodeFiler::h_LoadInterpretedNode(c_InterpretedItem, orc_XMLParser,
-                                                                                     orq_MissingOptionalContent);
                if (s32_Retval == C_NO_ERR)
                {
-                  this->mc_Data.c_InterpretedNodes.push_back(c_InterpretedItem);
+                  s32_Retval = C_OSCParamSetInterpretedNodeFiler::h_LoadInterpretedNode(c_InterpretedItem,
+                                                                                        orc_XMLParser,
+                                                                                        orq_MissingOptionalContent);
+                  if (s32_Retval == C_NO_ERR)
+                  {
+                     this->mc_Data.c_InterpretedNodes.push_back(c_InterpretedItem);
+                  }
                }
             }
-
             //Next
-            c_SelectedNode = orc_XMLParser.SelectNodeNext("node");
+            c_NextNode = orc_XMLParser.GetNextNodeName();
+         }
+         if ((s32_Retval == C_NO_ERR) && (q_NodeFound == false))
+         {
+            osc_write_log_error("Loading Dataset data", "Could not find \"nodes\".\"node\" node.");
+            s32_Retval = C_CONFIG;
          }
-         while ((c_SelectedNode == "node") && (s32_Retval == C_NO_ERR));
-         //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "nodes");
       }
       else
       {
-         osc_write_log_error("Loading Dataset data", "Could not find \"nodes\".\"node\" node.");
+         osc_write_log_error("Loading Dataset data", "Could not find \"nodes\".");
          s32_Retval = C_CONFIG;
       }
-      //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "opensyde-parameter-sets");
    }
-   else
+   if (s32_Retval == C_NOACT)
    {
-      osc_write_log_error("Loading Dataset data", "Could not find \"nodes\".");
-      s32_Retval = C_CONFIG;
+      s32_Retval = C_RD_WR;
    }
    return s32_Retval;
 }
@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Buffered writer for generated source files (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_OSCEXPORTCODEWRITER_H
+#define C_OSCEXPORTCODEWRITER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <string>
+#include "stwtypes.h"
+#include "CSCLString.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_core
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_OSCExportCodeWriter
+{
+public:
+   C_OSCExportCodeWriter(void);
+
+   void Append(const stw_scl::C_SCLString & orc_Line);
+   void Append(const stw_types::charn * const opcn_Line);
+   void Clear(void);
+
+   void WriteText(const stw_scl::C_SCLString & orc_Text);
+   void WriteText(const stw_types::charn * const opcn_Text);
+   void WriteUnsigned(const stw_types::uint64 ou64_Value);
+   void WriteSigned(const stw_types::sint64 os64_Value);
+   void WriteHex(const stw_types::uint64 ou64_Value, const stw_types::uint32 ou32_Digits);
+   void WriteFloat(const stw_types::float64 of64_Value);
+   void EndLine(void);
+
+   void IncIndent(void);
+   void DecIndent(void);
+
+   stw_types::sint32 SaveToFile(const stw_scl::C_SCLString & orc_PathAndFilename) const;
+
+private:
+   std::string mc_Buffer;          ///< content of complete file including line ends
+   stw_types::uint32 mu32_Indent;  ///< current indentation level
+   bool mq_LineStarted;            ///< true: text was already written to the current line
+
+   static const stw_types::uint32 mhu32_INDENT_WIDTH;
+   static const stw_types::uint32 mhu32_INITIAL_CAPACITY;
+
+   void m_WriteRaw(const stw_types::charn * const opcn_Text, const stw_types::uintn oun_Length);
+   bool m_IsFileContentEqual(const stw_scl::C_SCLString & orc_PathAndFilename) const;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
@@ -18,7 +18,6 @@
 #include "TGLFile.h"
 #include "TGLUtils.h"
 #include "CSCLString.h"
-#include "CSCLStringList.h"
 #include "C_OSCExportOsyInit.h"
 #include "C_OSCExportDataPool.h"
 #include "C_OSCExportCommunicationStack.h"
@@ -98,7 +97,7 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
                                               const bool oq_RunsDpd, const uint16 ou16_ApplicationIndex,
                                               const C_SCLString & orc_ExportToolInfo)
 {
-   C_SCLStringList c_Lines;
+   C_OSCExportCodeWriter c_Lines;
    sint32 s32_Return;
    uint8 u8_DataPoolsKnownInThisApplication = 0U;
    uint8 u8_CommDefinitionsKnownInThisApplication = 0U;
@@ -107,35 +106,35 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
    uint32 u32_BufferSize;
 
    //header file: quite simple (constant only as long as we always create DPD and DPH structures):
-   c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-   c_Lines.Add("/*!");
-   c_Lines.Add("   \\file");
-   c_Lines.Add("   \\brief       Application specific openSYDE initialization (Header file with interface)");
-   c_Lines.Add("");
-   c_Lines.Add(C_OSCExportUti::h_GetCreationToolInfo(orc_ExportToolInfo));
-   c_Lines.Add("*/");
-   c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-   c_Lines.Add("#ifndef " + h_GetFileName().UpperCase() + "H");
-   c_Lines.Add("#define " + h_GetFileName().UpperCase() + "H");
-   c_Lines.Add("");
-   c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Includes"));
-   c_Lines.Add("#include \"stwtypes.h\"");
+   c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+   c_Lines.Append("/*!");
+   c_Lines.Append("   \\file");
+   c_Lines.Append("   \\brief       Application specific openSYDE initialization (Header file with interface)");
+   c_Lines.Append("");
+   c_Lines.Append(C_OSCExportUti::h_GetCreationToolInfo(orc_ExportToolInfo));
+   c_Lines.Append("*/");
+   c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+   c_Lines.Append("#ifndef " + h_GetFileName().UpperCase() + "H");
+   c_Lines.Append("#define " + h_GetFileName().UpperCase() + "H");
+   c_Lines.Append("");
+   c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Includes"));
+   c_Lines.Append("#include \"stwtypes.h\"");
    if (oq_RunsDpd == true)
    {
-      c_Lines.Add("#include \"osy_dpd_driver.h\"");
+      c_Lines.Append("#include \"osy_dpd_driver.h\"");
    }
-   c_Lines.Add("#include \"osy_dpa_data_pool.h\"");
+   c_Lines.Append("#include \"osy_dpa_data_pool.h\"");
    //includes for the Datapool definitions
    //adding them to this central header allows the application to just include one central file and access all data
    // pools
-   c_Lines.Add("//Header files exporting application specific Datapools:");
+   c_Lines.Append("//Header files exporting application specific Datapools:");
    for (uint8 u8_DataPool = 0U; u8_DataPool < orc_Node.c_DataPools.size(); u8_DataPool++)
    {
       if (mh_IsDpKnownToApp(u8_DataPool, ou16_ApplicationIndex, orc_Node, oq_RunsDpd) == true)
       {
          C_SCLString c_HeaderName;
          c_HeaderName = C_OSCExportDataPool::h_GetFileName(orc_Node.c_DataPools[u8_DataPool]);
-         c_Lines.Add("#include \"" + c_HeaderName + ".h\"");
+         c_Lines.Append("#include \"" + c_HeaderName + ".h\"");
          u8_DataPoolsKnownInThisApplication++;
       }
    }
@@ -143,7 +142,7 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
    //these are not needed by this module at all; they are only provided for application convenience
    if (orc_Node.c_ComProtocols.size() > 0)
    {
-      c_Lines.Add("//Header files exporting comm stack configuration and status:");
+      c_Lines.Append("//Header files exporting comm stack configuration and status:");
       for (uint32 u32_ItProtocol = 0U; u32_ItProtocol < orc_Node.c_ComProtocols.size(); u32_ItProtocol++)
       {
          const C_OSCCanProtocol & rc_Protocol = orc_Node.c_ComProtocols[u32_ItProtocol];
@@ -160,7 +159,7 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
                   const C_SCLString c_HeaderName =
                      C_OSCExportCommunicationStack::h_GetFileName(static_cast<uint8>(u32_ItInterface),
                                                                   rc_Protocol.e_Type);
-                  c_Lines.Add("#include \"" + c_HeaderName + ".h\"");
+                  c_Lines.Append("#include \"" + c_HeaderName + ".h\"");
                   u8_CommDefinitionsKnownInThisApplication++;
                }
             }
@@ -168,9 +167,9 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
       }
    }
 
-   c_Lines.Add("");
+   c_Lines.Append("");
    C_OSCExportUti::h_AddExternCStart(c_Lines);
-   c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Defines"));
+   c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Defines"));
 
    if (oq_RunsDpd == true)
    {
@@ -185,15 +184,15 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
             switch (rc_ComIf.e_InterfaceType)
             {
             case C_OSCSystemBus::eCAN:
-               c_Lines.Add("#define OSY_INIT_DPD_BUS_NUMBER_CAN_CHANNEL_" +
-                           C_SCLString::IntToStr(u8_NumCanChannels) + "       " +
-                           C_SCLString::IntToStr(rc_ComIf.u8_InterfaceNumber) + "U");
+               c_Lines.Append("#define OSY_INIT_DPD_BUS_NUMBER_CAN_CHANNEL_" +
+                              C_SCLString::IntToStr(u8_NumCanChannels) + "       " +
+                              C_SCLString::IntToStr(rc_ComIf.u8_InterfaceNumber) + "U");
                u8_NumCanChannels++;
                break;
             case C_OSCSystemBus::eETHERNET:
-               c_Lines.Add("#define OSY_INIT_DPD_BUS_NUMBER_ETHERNET_CHANNEL_" +
-                           C_SCLString::IntToStr(u8_NumEthChannels) + "  " +
-                           C_SCLString::IntToStr(rc_ComIf.u8_InterfaceNumber) + "U");
+               c_Lines.Append("#define OSY_INIT_DPD_BUS_NUMBER_ETHERNET_CHANNEL_" +
+                              C_SCLString::IntToStr(u8_NumEthChannels) + "  " +
+                              C_SCLString::IntToStr(rc_ComIf.u8_InterfaceNumber) + "U");
                u8_NumEthChannels++;
                break;
             default:
@@ -203,18 +202,19 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
          }
       }
 
-      c_Lines.Add("#define OSY_INIT_DPD_NUMBER_OF_CAN_CHANNELS         " + C_SCLString::IntToStr(u8_NumCanChannels) +
-                  "U");
-      c_Lines.Add("#define OSY_INIT_DPD_NUMBER_OF_ETHERNET_CHANNELS    " + C_SCLString::IntToStr(u8_NumEthChannels) +
-                  "U");
-      c_Lines.Add("");
-      c_Lines.Add("#define OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS " +
-                  C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u8_MaxClients) + "U");
-      c_Lines.Add("#define OSY_INIT_DPD_CAN_FIFO_SIZE_TX               " +
-                  C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u16_MaxMessageBufferTx) + "U");
-      c_Lines.Add("#define OSY_INIT_DPD_CAN_ROUTING_FIFO_SIZE_RX       " +
-                  C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u16_MaxRoutingMessageBufferRx) +
-                  "U");
+      c_Lines.Append("#define OSY_INIT_DPD_NUMBER_OF_CAN_CHANNELS         " + C_SCLString::IntToStr(u8_NumCanChannels) +
+                     "U");
+      c_Lines.Append("#define OSY_INIT_DPD_NUMBER_OF_ETHERNET_CHANNELS    " + C_SCLString::IntToStr(u8_NumEthChannels) +
+                     "U");
+      c_Lines.Append("");
+      c_Lines.Append("#define OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS " +
+                     C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u8_MaxClients) + "U");
+      c_Lines.Append("#define OSY_INIT_DPD_CAN_FIFO_SIZE_TX               " +
+                     C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u16_MaxMessageBufferTx) +
+                     "U");
+      c_Lines.Append("#define OSY_INIT_DPD_CAN_ROUTING_FIFO_SIZE_RX       " +
+                     C_SCLString::IntToStr(
+                        orc_Node.c_Properties.c_OpenSYDEServerSettings.u16_MaxRoutingMessageBufferRx) + "U");
       //get size of greatest element so we know how to set up the buffers
       //add protocol overhead for DPD and NVM access services (greatest overhead: write_memory_by_address)
       u32_BufferSize = mh_GetSizeOfLargestDataPoolElement(orc_Node.c_DataPools) + 11U;
@@ -229,47 +229,48 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
          u32_BufferSize = C_OSCProtocolDriverOsyTpBase::hu16_OSY_MAXIMUM_SERVICE_SIZE;
       }
 
-      c_Lines.Add("#define OSY_INIT_DPD_BUF_SIZE_INSTANCE              " + C_SCLString::IntToStr(u32_BufferSize) + "U");
-      c_Lines.Add("#define OSY_INIT_DPD_MAX_NUM_CYCLIC_TRANSMISSIONS   " +
-                  C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u8_MaxParallelTransmissions) +
-                  "U");
-      c_Lines.Add("");
+      c_Lines.Append("#define OSY_INIT_DPD_BUF_SIZE_INSTANCE              " + C_SCLString::IntToStr(u32_BufferSize) +
+                     "U");
+      c_Lines.Append("#define OSY_INIT_DPD_MAX_NUM_CYCLIC_TRANSMISSIONS   " +
+                     C_SCLString::IntToStr(orc_Node.c_Properties.c_OpenSYDEServerSettings.u8_MaxParallelTransmissions) +
+                     "U");
+      c_Lines.Append("");
    }
 
-   c_Lines.Add("#define OSY_INIT_DPH_NUM_DATA_POOLS                 " +
-               C_SCLString::IntToStr(u8_DataPoolsKnownInThisApplication) + "U");
-   c_Lines.Add("");
+   c_Lines.Append("#define OSY_INIT_DPH_NUM_DATA_POOLS                 " +
+                  C_SCLString::IntToStr(u8_DataPoolsKnownInThisApplication) + "U");
+   c_Lines.Append("");
    //add the next constant even if there are no COMM protocols; just placing the define does not create an external
    // dependency
-   c_Lines.Add("#define OSY_INIT_COM_NUM_PROTOCOL_CONFIGURATIONS    " +
-               C_SCLString::IntToStr(u8_CommDefinitionsKnownInThisApplication) + "U");
-   c_Lines.Add("");
-   c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Types"));
-   c_Lines.Add("");
-   c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Global Variables"));
-   c_Lines.Add("");
-   c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Function Prototypes"));
+   c_Lines.Append("#define OSY_INIT_COM_NUM_PROTOCOL_CONFIGURATIONS    " +
+                  C_SCLString::IntToStr(u8_CommDefinitionsKnownInThisApplication) + "U");
+   c_Lines.Append("");
+   c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Types"));
+   c_Lines.Append("");
+   c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Global Variables"));
+   c_Lines.Append("");
+   c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Function Prototypes"));
    if (oq_RunsDpd == true)
    {
-      c_Lines.Add("extern const T_osy_dpd_data * osy_dpd_get_init_config(void);");
+      c_Lines.Append("extern const T_osy_dpd_data * osy_dpd_get_init_config(void);");
    }
-   c_Lines.Add("extern const T_osy_dpa_data_pool * const * osy_dph_get_init_config(void);");
-   c_Lines.Add("extern uint8 osy_dph_get_num_data_pools(void);");
-   c_Lines.Add("");
+   c_Lines.Append("extern const T_osy_dpa_data_pool * const * osy_dph_get_init_config(void);");
+   c_Lines.Append("extern uint8 osy_dph_get_num_data_pools(void);");
+   c_Lines.Append("");
 
    //prototypes for COMM utility functions; only place if there are COMM protocols to prevent external dependencies
    // (on type definitions)
    if (u8_CommDefinitionsKnownInThisApplication > 0U)
    {
-      c_Lines.Add("extern const T_osy_com_protocol_configuration * const * osy_com_get_protocol_configs(void);");
-      c_Lines.Add("extern uint8 osy_com_get_num_protocol_configs(void);");
-      c_Lines.Add("");
+      c_Lines.Append("extern const T_osy_com_protocol_configuration * const * osy_com_get_protocol_configs(void);");
+      c_Lines.Append("extern uint8 osy_com_get_num_protocol_configs(void);");
+      c_Lines.Append("");
    }
 
-   c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Implementation"));
-   c_Lines.Add("");
+   c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Implementation"));
+   c_Lines.Append("");
    C_OSCExportUti::h_AddExternCEnd(c_Lines);
-   c_Lines.Add("#endif");
+   c_Lines.Append("#endif");
 
    // finally save all stuff into the file
    s32_Return = C_OSCExportUti::h_SaveToFile(c_Lines, orc_FilePath, h_GetFileName(), true);
@@ -280,52 +281,52 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
       c_Lines.Clear();
 
       //constant header part:
-      c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-      c_Lines.Add("/*!");
-      c_Lines.Add("   \\file");
-      c_Lines.Add("   \\brief       Application specific openSYDE initialization (Source file with implementation)");
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetCreationToolInfo(orc_ExportToolInfo));
-      c_Lines.Add("*/");
-      c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Includes"));
-      c_Lines.Add("#include <stddef.h> //for NULL");
-      c_Lines.Add("#include \"stwtypes.h\"");
-      c_Lines.Add("#include \"" + h_GetFileName() + ".h\"");
-      c_Lines.Add("#include \"osy_dpa_data_pool.h\"");
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Defines"));
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Types"));
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Global Variables"));
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Module Global Variables"));
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Module Global Function Prototypes"));
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetSectionSeparator("Implementation"));
+      c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+      c_Lines.Append("/*!");
+      c_Lines.Append("   \\file");
+      c_Lines.Append("   \\brief       Application specific openSYDE initialization (Source file with implementation)");
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetCreationToolInfo(orc_ExportToolInfo));
+      c_Lines.Append("*/");
+      c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Includes"));
+      c_Lines.Append("#include <stddef.h> //for NULL");
+      c_Lines.Append("#include \"stwtypes.h\"");
+      c_Lines.Append("#include \"" + h_GetFileName() + ".h\"");
+      c_Lines.Append("#include \"osy_dpa_data_pool.h\"");
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Defines"));
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Types"));
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Global Variables"));
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Module Global Variables"));
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Module Global Function Prototypes"));
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetSectionSeparator("Implementation"));
 
       if (oq_RunsDpd == true)
       {
-         c_Lines.Add("");
-         c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-         c_Lines.Add("/*! \\brief   Set up and provide openSYDE protocol driver configuration");
-         c_Lines.Add("");
-         c_Lines.Add("   Sets up:");
-         c_Lines.Add("   * CAN channel configuration");
-         c_Lines.Add("   * Ethernet channel configuration");
-         c_Lines.Add("   * Connection buffer definition");
-         c_Lines.Add("   * Main initialization structure");
-         c_Lines.Add("");
-         c_Lines.Add("   \\return");
-         c_Lines.Add(
+         c_Lines.Append("");
+         c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+         c_Lines.Append("/*! \\brief   Set up and provide openSYDE protocol driver configuration");
+         c_Lines.Append("");
+         c_Lines.Append("   Sets up:");
+         c_Lines.Append("   * CAN channel configuration");
+         c_Lines.Append("   * Ethernet channel configuration");
+         c_Lines.Append("   * Connection buffer definition");
+         c_Lines.Append("   * Main initialization structure");
+         c_Lines.Append("");
+         c_Lines.Append("   \\return");
+         c_Lines.Append(
             "   pointer to configuration structure (statically available; can be used for the DPD initialization function)");
-         c_Lines.Add("*/");
-         c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-         c_Lines.Add("const T_osy_dpd_data * osy_dpd_get_init_config(void)");
-         c_Lines.Add("{");
+         c_Lines.Append("*/");
+         c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+         c_Lines.Append("const T_osy_dpd_data * osy_dpd_get_init_config(void)");
+         c_Lines.Append("{");
 
          //channel instances
          u8_NumCanChannels = 0U;
@@ -343,37 +344,38 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
             {
                if (rc_ComIf.e_InterfaceType == C_OSCSystemBus::eCAN)
                {
-                  c_Lines.Add("   OSY_DPD_CAN_CHANNEL(ht_CanInitConfiguration" +
-                              C_SCLString::IntToStr(u8_NumCanChannels) +
-                              ", OSY_INIT_DPD_BUS_NUMBER_CAN_CHANNEL_" + C_SCLString::IntToStr(u8_NumCanChannels) +
-                              ",");
-                  c_Lines.Add(
+                  c_Lines.Append("   OSY_DPD_CAN_CHANNEL(ht_CanInitConfiguration" +
+                                 C_SCLString::IntToStr(u8_NumCanChannels) +
+                                 ", OSY_INIT_DPD_BUS_NUMBER_CAN_CHANNEL_" + C_SCLString::IntToStr(u8_NumCanChannels) +
+                                 ",");
+                  c_Lines.Append(
                      "                       OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS, OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS,");
-                  c_Lines.Add("                       OSY_INIT_DPD_BUF_SIZE_INSTANCE,");
-                  c_Lines.Add(
+                  c_Lines.Append("                       OSY_INIT_DPD_BUF_SIZE_INSTANCE,");
+                  c_Lines.Append(
                      "                       OSY_INIT_DPD_CAN_FIFO_SIZE_TX, OSY_INIT_DPD_CAN_ROUTING_FIFO_SIZE_RX)");
                   u8_NumCanChannels++;
                }
                else
                {
-                  c_Lines.Add("   OSY_DPD_ETH_CHANNEL(ht_EthernetInitConfiguration" +
-                              C_SCLString::IntToStr(u8_NumEthChannels) + ", OSY_INIT_DPD_BUS_NUMBER_ETHERNET_CHANNEL_" +
-                              C_SCLString::IntToStr(u8_NumEthChannels) + ",");
-                  c_Lines.Add(
+                  c_Lines.Append("   OSY_DPD_ETH_CHANNEL(ht_EthernetInitConfiguration" +
+                                 C_SCLString::IntToStr(u8_NumEthChannels) +
+                                 ", OSY_INIT_DPD_BUS_NUMBER_ETHERNET_CHANNEL_" +
+                                 C_SCLString::IntToStr(u8_NumEthChannels) + ",");
+                  c_Lines.Append(
                      "                       OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS, OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS,");
-                  c_Lines.Add("                       OSY_INIT_DPD_BUF_SIZE_INSTANCE)");
+                  c_Lines.Append("                       OSY_INIT_DPD_BUF_SIZE_INSTANCE)");
                   u8_NumEthChannels++;
                }
             }
          }
 
          //channel lists
-         c_Lines.Add("");
+         c_Lines.Append("");
          if (u8_NumCanChannels > 0)
          {
-            c_Lines.Add("   static const T_osy_udc_global_cantp_init_configuration * const");
-            c_Lines.Add("      hapt_CanInitConfigurations[OSY_INIT_DPD_NUMBER_OF_CAN_CHANNELS] =");
-            c_Lines.Add("   {");
+            c_Lines.Append("   static const T_osy_udc_global_cantp_init_configuration * const");
+            c_Lines.Append("      hapt_CanInitConfigurations[OSY_INIT_DPD_NUMBER_OF_CAN_CHANNELS] =");
+            c_Lines.Append("   {");
             for (uint8 u8_Channel = 0U; u8_Channel < u8_NumCanChannels; u8_Channel++)
             {
                C_SCLString c_Text = "      &ht_CanInitConfiguration" + C_SCLString::IntToStr(u8_Channel);
@@ -381,16 +383,16 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
                {
                   c_Text += ",";
                }
-               c_Lines.Add(c_Text);
+               c_Lines.Append(c_Text);
             }
-            c_Lines.Add("   };");
+            c_Lines.Append("   };");
          }
-         c_Lines.Add("");
+         c_Lines.Append("");
          if (u8_NumEthChannels > 0)
          {
-            c_Lines.Add("   static const T_osy_udc_global_ethertp_init_configuration * const");
-            c_Lines.Add("      hapt_EthernetInitConfigurations[OSY_INIT_DPD_NUMBER_OF_ETHERNET_CHANNELS] =");
-            c_Lines.Add("   {");
+            c_Lines.Append("   static const T_osy_udc_global_ethertp_init_configuration * const");
+            c_Lines.Append("      hapt_EthernetInitConfigurations[OSY_INIT_DPD_NUMBER_OF_ETHERNET_CHANNELS] =");
+            c_Lines.Append("   {");
             for (uint8 u8_Channel = 0U; u8_Channel < u8_NumEthChannels; u8_Channel++)
             {
                C_SCLString c_Text = "      &ht_EthernetInitConfiguration" + C_SCLString::IntToStr(u8_Channel);
@@ -398,23 +400,23 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
                {
                   c_Text += ",";
                }
-               c_Lines.Add(c_Text);
+               c_Lines.Append(c_Text);
             }
-            c_Lines.Add("   };");
+            c_Lines.Append("   };");
          }
-         c_Lines.Add("");
+         c_Lines.Append("");
          //connection instances
          for (uint8 u8_Instance = 0U; u8_Instance < orc_Node.c_Properties.c_OpenSYDEServerSettings.u8_MaxClients;
               u8_Instance++)
          {
-            c_Lines.Add("   OSY_DPD_CONNECTION_INSTANCE_INIT(ht_DpdConnectionInstance" +
-                        C_SCLString::IntToStr(u8_Instance) + ", " + C_SCLString::IntToStr(u8_Instance) + "U, " +
-                        "OSY_INIT_DPD_MAX_NUM_CYCLIC_TRANSMISSIONS)");
+            c_Lines.Append("   OSY_DPD_CONNECTION_INSTANCE_INIT(ht_DpdConnectionInstance" +
+                           C_SCLString::IntToStr(u8_Instance) + ", " + C_SCLString::IntToStr(u8_Instance) + "U, " +
+                           "OSY_INIT_DPD_MAX_NUM_CYCLIC_TRANSMISSIONS)");
          }
-         c_Lines.Add("");
-         c_Lines.Add(
+         c_Lines.Append("");
+         c_Lines.Append(
             "   static T_osy_dpd_connection_instance * const hapt_DpdConnections[OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS] =");
-         c_Lines.Add("   {");
+         c_Lines.Append("   {");
          for (uint8 u8_Instance = 0U; u8_Instance < orc_Node.c_Properties.c_OpenSYDEServerSettings.u8_MaxClients;
               u8_Instance++)
          {
@@ -423,109 +425,115 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
             {
                c_Text += ",";
             }
-            c_Lines.Add(c_Text);
+            c_Lines.Append(c_Text);
          }
-         c_Lines.Add("   };");
-         c_Lines.Add("");
-
-         c_Lines.Add("   OSY_DPD_GLOBAL_DATA_INIT(ht_DpdDataInstance,");
-         c_Lines.Add("                            OSY_INIT_DPD_NUMBER_OF_CAN_CHANNELS,");
-         c_Lines.Add("                            OSY_INIT_DPD_NUMBER_OF_ETHERNET_CHANNELS,");
-         c_Lines.Add("                            OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS,");
-         c_Lines.Add("                            &hapt_DpdConnections[0],");
+         c_Lines.Append("   };");
+         c_Lines.Append("");
+
+         c_Lines.Append("   OSY_DPD_GLOBAL_DATA_INIT(ht_DpdDataInstance,");
+         c_Lines.Append("                            OSY_INIT_DPD_NUMBER_OF_CAN_CHANNELS,");
+         c_Lines.Append("                            OSY_INIT_DPD_NUMBER_OF_ETHERNET_CHANNELS,");
+         c_Lines.Append("                            OSY_INIT_DPD_NUMBER_OF_PARALLEL_CONNECTIONS,");
+         c_Lines.Append("                            &hapt_DpdConnections[0],");
          if (u8_NumCanChannels > 0)
          {
-            c_Lines.Add("                            &hapt_CanInitConfigurations[0],");
+            c_Lines.Append("                            &hapt_CanInitConfigurations[0],");
          }
          else
          {
-            c_Lines.Add("                            NULL,");
+            c_Lines.Append("                            NULL,");
          }
          if (u8_NumEthChannels > 0)
          {
-            c_Lines.Add("                            &hapt_EthernetInitConfigurations[0])");
+            c_Lines.Append("                            &hapt_EthernetInitConfigurations[0])");
          }
          else
          {
-            c_Lines.Add("                            NULL)");
+            c_Lines.Append("                            NULL)");
          }
-         c_Lines.Add("");
-         c_Lines.Add("   return &ht_DpdDataInstance;");
-         c_Lines.Add("}");
+         c_Lines.Append("");
+         c_Lines.Append("   return &ht_DpdDataInstance;");
+         c_Lines.Append("}");
       }
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-      c_Lines.Add("/*! \\brief   Set up and provide openSYDE Datapool handler configuration");
-      c_Lines.Add("");
-      c_Lines.Add("   Sets up:");
-      c_Lines.Add("   * initialization structure listing all Datapools in correct sequence");
-      c_Lines.Add("");
-      c_Lines.Add("   \\return");
-      c_Lines.Add(
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+      c_Lines.Append("/*! \\brief   Set up and provide openSYDE Datapool handler configuration");
+      c_Lines.Append("");
+      c_Lines.Append("   Sets up:");
+      c_Lines.Append("   * initialization structure listing all Datapools in correct sequence");
+      c_Lines.Append("");
+      c_Lines.Append("   \\return");
+      c_Lines.Append(
          "   pointer to initialization structure (statically available; can be used for the DPH initialization function)");
-      c_Lines.Add("   NULL: no Datapools defined");
-      c_Lines.Add("*/");
-      c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-      c_Lines.Add("const T_osy_dpa_data_pool * const * osy_dph_get_init_config(void)");
-      c_Lines.Add("{");
+      c_Lines.Append("   NULL: no Datapools defined");
+      c_Lines.Append("*/");
+      c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+      c_Lines.Append("const T_osy_dpa_data_pool * const * osy_dph_get_init_config(void)");
+      c_Lines.Append("{");
 
       //add table of Datapools
       if (u8_DataPoolsKnownInThisApplication == 0U)
       {
-         c_Lines.Add("   return NULL;");
+         c_Lines.Append("   return NULL;");
       }
       else
       {
-         c_Lines.Add("   static const T_osy_dpa_data_pool * const hapt_Datapools[OSY_INIT_DPH_NUM_DATA_POOLS] =");
-         c_Lines.Add("   {");
+         c_Lines.Append("   static const T_osy_dpa_data_pool * const hapt_Datapools[OSY_INIT_DPH_NUM_DATA_POOLS] =");
+         bool q_FirstEntry = true;
+         c_Lines.Append("   {");
          for (uint8 u8_DataPool = 0U; u8_DataPool < orc_Node.c_DataPools.size(); u8_DataPool++)
          {
             if (mh_IsDpKnownToApp(u8_DataPool, ou16_ApplicationIndex, orc_Node, oq_RunsDpd) == true)
             {
-               const C_SCLString c_Text = "      &gt_" + orc_Node.c_DataPools[u8_DataPool].c_Name + "_DataPool,";
-               c_Lines.Add(c_Text);
+               //separate from previous entry; no "," after the final entry
+               if (q_FirstEntry == false)
+               {
+                  c_Lines.WriteText(",");
+                  c_Lines.EndLine();
+               }
+               c_Lines.WriteText("      &gt_" + orc_Node.c_DataPools[u8_DataPool].c_Name + "_DataPool");
+               q_FirstEntry = false;
             }
          }
-         //remove final ",":
-         c_Lines.Strings[static_cast<sint32>(c_Lines.GetCount()) - 1].Delete(
-            c_Lines.Strings[static_cast<sint32>(c_Lines.GetCount()) - 1].Length(), 1U);
+         c_Lines.EndLine();
 
-         c_Lines.Add("   };");
-         c_Lines.Add("");
-         c_Lines.Add("   return &hapt_Datapools[0];");
+         c_Lines.Append("   };");
+         c_Lines.Append("");
+         c_Lines.Append("   return &hapt_Datapools[0];");
       }
-      c_Lines.Add("}");
-      c_Lines.Add("");
-      c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-      c_Lines.Add("/*! \\brief   Get number of defined openSYDE Datapools");
-      c_Lines.Add("");
-      c_Lines.Add("   \\return");
-      c_Lines.Add("   number of openSYDE Datapools");
-      c_Lines.Add("*/");
-      c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-      c_Lines.Add("uint8 osy_dph_get_num_data_pools(void)");
-      c_Lines.Add("{");
-      c_Lines.Add("   return OSY_INIT_DPH_NUM_DATA_POOLS;");
-      c_Lines.Add("}");
+      c_Lines.Append("}");
+      c_Lines.Append("");
+      c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+      c_Lines.Append("/*! \\brief   Get number of defined openSYDE Datapools");
+      c_Lines.Append("");
+      c_Lines.Append("   \\return");
+      c_Lines.Append("   number of openSYDE Datapools");
+      c_Lines.Append("*/");
+      c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+      c_Lines.Append("uint8 osy_dph_get_num_data_pools(void)");
+      c_Lines.Append("{");
+      c_Lines.Append("   return OSY_INIT_DPH_NUM_DATA_POOLS;");
+      c_Lines.Append("}");
 
       if (u8_CommDefinitionsKnownInThisApplication > 0)
       {
-         c_Lines.Add("");
-         c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-         c_Lines.Add("/*! \\brief   Set up and provide a list of openSYDE COMM protocol configurations");
-         c_Lines.Add("");
-         c_Lines.Add("   Sets up a table with pointers to all defined COMM protocol configurations");
-         c_Lines.Add("");
-         c_Lines.Add("   \\return");
-         c_Lines.Add("   pointer to table of configurations (statically available)");
-         c_Lines.Add("*/");
-         c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-         c_Lines.Add("const T_osy_com_protocol_configuration * const * osy_com_get_protocol_configs(void)");
-         c_Lines.Add("{");
-         c_Lines.Add("   static const T_osy_com_protocol_configuration * const");
-         c_Lines.Add("      hapt_CommConfigurations[OSY_INIT_COM_NUM_PROTOCOL_CONFIGURATIONS] =");
-         c_Lines.Add("   {");
-
+         c_Lines.Append("");
+         c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+         c_Lines.Append("/*! \\brief   Set up and provide a list of openSYDE COMM protocol configurations");
+         c_Lines.Append("");
+         c_Lines.Append("   Sets up a table with pointers to all defined COMM protocol configurations");
+         c_Lines.Append("");
+         c_Lines.Append("   \\return");
+         c_Lines.Append("   pointer to table of configurations (statically available)");
+         c_Lines.Append("*/");
+         c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+         c_Lines.Append("const T_osy_com_protocol_configuration * const * osy_com_get_protocol_configs(void)");
+         c_Lines.Append("{");
+         c_Lines.Append("   static const T_osy_com_protocol_configuration * const");
+         c_Lines.Append("      hapt_CommConfigurations[OSY_INIT_COM_NUM_PROTOCOL_CONFIGURATIONS] =");
+         c_Lines.Append("   {");
+
+         bool q_FirstEntry = true;
          for (uint32 u32_Protocol = 0U; u32_Protocol < orc_Node.c_ComProtocols.size(); u32_Protocol++)
          {
             const C_OSCCanProtocol & rc_Protocol = orc_Node.c_ComProtocols[u32_Protocol];
@@ -539,36 +547,39 @@ sint32 C_OSCExportOsyInit::h_CreateSourceCode(const C_SCLString & orc_FilePath,
                   if (rc_Protocol.c_ComMessages[u8_Interface].ContainsAtLeastOneMessage() == true)
                   {
                      //finally we have a winner ...
-                     const C_SCLString c_Text = "      &" + C_OSCExportCommunicationStack::h_GetConfigurationName(
-                        u8_Interface, rc_Protocol.e_Type) + ",";
-
-                     c_Lines.Add(c_Text);
+                     //separate from previous entry; no "," after the final entry
+                     if (q_FirstEntry == false)
+                     {
+                        c_Lines.WriteText(",");
+                        c_Lines.EndLine();
+                     }
+                     c_Lines.WriteText("      &" + C_OSCExportCommunicationStack::h_GetConfigurationName(
+                                          u8_Interface, rc_Protocol.e_Type));
+                     q_FirstEntry = false;
                   }
                }
             }
          }
-         //remove final ",":
-         c_Lines.Strings[static_cast<sint32>(c_Lines.GetCount()) - 1].Delete(
-            c_Lines.Strings[static_cast<sint32>(c_Lines.GetCount()) - 1].Length(), 1U);
-         c_Lines.Add("   };");
-         c_Lines.Add("");
-         c_Lines.Add("   return &hapt_CommConfigurations[0];");
-         c_Lines.Add("}");
-         c_Lines.Add("");
-         c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-         c_Lines.Add("/*! \\brief   Get number of defined openSYDE COMM protocol configurations");
-         c_Lines.Add("");
-         c_Lines.Add(
+         c_Lines.EndLine();
+         c_Lines.Append("   };");
+         c_Lines.Append("");
+         c_Lines.Append("   return &hapt_CommConfigurations[0];");
+         c_Lines.Append("}");
+         c_Lines.Append("");
+         c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+         c_Lines.Append("/*! \\brief   Get number of defined openSYDE COMM protocol configurations");
+         c_Lines.Append("");
+         c_Lines.Append(
             "   The returned value matches the number of elements in the table returned by osy_com_get_protocol_configs.");
-         c_Lines.Add("");
-         c_Lines.Add("   \\return");
-         c_Lines.Add("   number of openSYDE Datapools");
-         c_Lines.Add("*/");
-         c_Lines.Add(C_OSCExportUti::h_GetHeaderSeparator());
-         c_Lines.Add("uint8 osy_com_get_num_protocol_configs(void)");
-         c_Lines.Add("{");
-         c_Lines.Add("   return OSY_INIT_COM_NUM_PROTOCOL_CONFIGURATIONS;");
-         c_Lines.Add("}");
+         c_Lines.Append("");
+         c_Lines.Append("   \\return");
+         c_Lines.Append("   number of openSYDE Datapools");
+         c_Lines.Append("*/");
+         c_Lines.Append(C_OSCExportUti::h_GetHeaderSeparator());
+         c_Lines.Append("uint8 osy_com_get_num_protocol_configs(void)");
+         c_Lines.Append("{");
+         c_Lines.Append("   return OSY_INIT_COM_NUM_PROTOCOL_CONFIGURATIONS;");
+         c_Lines.Append("}");
       }
 
       // finally save all stuff into the file
@@ -9,8 +9,8 @@
 #define C_OSCEXPORTUTI_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
-#include "CSCLStringList.h"
 #include "C_OSCNodeDataPool.h"
+#include "C_OSCExportCodeWriter.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_core
@@ -27,13 +27,14 @@ public:
    static stw_scl::C_SCLString h_GetSectionSeparator(const stw_scl::C_SCLString & orc_SectionName);
    static stw_scl::C_SCLString h_GetHeaderSeparator(void);
    static stw_scl::C_SCLString h_GetCreationToolInfo(const stw_scl::C_SCLString & orc_ExportToolInfo);
-   static void h_AddExternCStart(stw_scl::C_SCLStringList & orc_Data);
-   static void h_AddExternCEnd(stw_scl::C_SCLStringList & orc_Data);
-   static void h_AddProjectIdDef(stw_scl::C_SCLStringList & orc_Data, const stw_scl::C_SCLString & orc_MagicName,
+   static void h_AddExternCStart(C_OSCExportCodeWriter & orc_Data);
+   static void h_AddExternCEnd(C_OSCExportCodeWriter & orc_Data);
+   static void h_AddProjectIdDef(C_OSCExportCodeWriter & orc_Data, const stw_scl::C_SCLString & orc_MagicName,
                                  const bool oq_HeaderFile);
-   static void h_AddProjIdFunctionPrototype(stw_scl::C_SCLStringList & orc_Data,
+   static void h_AddProjIdFunctionPrototype(C_OSCExportCodeWriter & orc_Data,
                                             const stw_scl::C_SCLString & orc_MagicName);
-   static stw_types::sint32 h_SaveToFile(stw_scl::C_SCLStringList & orc_Data, const stw_scl::C_SCLString & orc_Path,
+   static stw_types::sint32 h_SaveToFile(const C_OSCExportCodeWriter & orc_Data,
+                                         const stw_scl::C_SCLString & orc_Path,
                                          const stw_scl::C_SCLString & orc_FileName, const bool oq_HeaderFile);
    static void h_CollectFilePaths(std::vector<stw_scl::C_SCLString> & orc_FilePaths,
                                   const stw_scl::C_SCLString & orc_Path, const stw_scl::C_SCLString & orc_FileName);
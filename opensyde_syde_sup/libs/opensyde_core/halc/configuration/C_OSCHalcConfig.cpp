@@ -38,7 +38,8 @@ using namespace stw_opensyde_core;
 /*! \brief  Default constructor
 */
 //----------------------------------------------------------------------------------------------------------------------
-C_OSCHalcConfig::C_OSCHalcConfig(void)
+C_OSCHalcConfig::C_OSCHalcConfig(void) :
+   mq_DatapoolStructureChanged(true)
 {
 }
 
@@ -104,6 +105,7 @@ void C_OSCHalcConfig::Clear()
 {
    C_OSCHalcDefBase::Clear();
    this->mc_Domains.clear();
+   this->SetDatapoolStructureChanged();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -134,6 +136,7 @@ bool C_OSCHalcConfig::IsClear(void) const
 void C_OSCHalcConfig::AddDomain(const C_OSCHalcDefDomain & orc_Domain)
 {
    this->mc_Domains.push_back(orc_Domain);
+   this->mq_DatapoolStructureChanged = true;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -154,6 +157,7 @@ sint32 C_OSCHalcConfig::SetDomainConfig(const uint32 ou32_Index, const C_OSCHalc
    if (ou32_Index < this->mc_Domains.size())
    {
       this->mc_Domains[ou32_Index] = orc_Domain;
+      this->mq_DatapoolStructureChanged = true;
    }
    else
    {
@@ -193,6 +197,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelConfig(const uint32 ou32_DomainIndex, co
          if (ou32_ChannelIndex < rc_Domain.c_ChannelConfigs.size())
          {
             C_OSCHalcConfigChannel & rc_Channel = rc_Domain.c_ChannelConfigs[ou32_ChannelIndex];
+            if (rc_Channel.q_SafetyRelevant != oq_SafetyRelevant)
+            {
+               this->mq_DatapoolStructureChanged = true;
+            }
             rc_Channel.c_Name = orc_Name;
             rc_Channel.c_Comment = orc_Comment;
             rc_Channel.q_SafetyRelevant = oq_SafetyRelevant;
@@ -206,6 +214,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelConfig(const uint32 ou32_DomainIndex, co
       else
       {
          C_OSCHalcConfigChannel & rc_Channel = rc_Domain.c_DomainConfig;
+         if (rc_Channel.q_SafetyRelevant != oq_SafetyRelevant)
+         {
+            this->mq_DatapoolStructureChanged = true;
+         }
          rc_Channel.c_Name = orc_Name;
          rc_Channel.c_Comment = orc_Comment;
          rc_Channel.q_SafetyRelevant = oq_SafetyRelevant;
@@ -216,6 +228,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelConfig(const uint32 ou32_DomainIndex, co
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -252,6 +268,11 @@ sint32 C_OSCHalcConfig::ResetDomainChannelConfig(const uint32 ou32_DomainIndex,
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      //Reset might change safety relevance
+      this->mq_DatapoolStructureChanged = true;
+   }
    return s32_Retval;
 }
 
@@ -285,6 +306,10 @@ sint32 C_OSCHalcConfig::ResetDomainChannelUseCase(const uint32 ou32_DomainIndex,
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -407,6 +432,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelConfigSafety(const uint32 ou32_DomainInd
          if (ou32_ChannelIndex < rc_Domain.c_ChannelConfigs.size())
          {
             C_OSCHalcConfigChannel & rc_Channel = rc_Domain.c_ChannelConfigs[ou32_ChannelIndex];
+            if (rc_Channel.q_SafetyRelevant != oq_SafetyRelevant)
+            {
+               this->mq_DatapoolStructureChanged = true;
+            }
             rc_Channel.q_SafetyRelevant = oq_SafetyRelevant;
          }
          else
@@ -417,6 +446,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelConfigSafety(const uint32 ou32_DomainInd
       else
       {
          C_OSCHalcConfigChannel & rc_Channel = rc_Domain.c_DomainConfig;
+         if (rc_Channel.q_SafetyRelevant != oq_SafetyRelevant)
+         {
+            this->mq_DatapoolStructureChanged = true;
+         }
          rc_Channel.q_SafetyRelevant = oq_SafetyRelevant;
       }
    }
@@ -470,6 +503,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelConfigUseCase(const uint32 ou32_DomainIn
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -532,6 +569,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelParameterConfig(const uint32 ou32_Domain
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -614,6 +655,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelParameterConfigElement(const uint32 ou32
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -712,6 +757,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelParameterConfigElementPlain(const uint32
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -811,6 +860,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelParameterConfigElementEnum(const uint32
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -912,6 +965,10 @@ sint32 C_OSCHalcConfig::SetDomainChannelParameterConfigElementBitmask(const uint
    {
       s32_Retval = C_RANGE;
    }
+   if (s32_Retval == C_NO_ERR)
+   {
+      this->m_MarkValuesChanged(ou32_DomainIndex, ou32_ChannelIndex, oq_UseChannelIndex);
+   }
    return s32_Retval;
 }
 
@@ -1080,3 +1137,95 @@ void C_OSCHalcConfig::CalcHash(uint32 & oru32_HashValue) const
       this->mc_Domains[u32_It].CalcHash(oru32_HashValue);
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if HALC Datapools need to be regenerated completely
+
+   Structure changes are all changes which affect the layout of the HALC Datapools
+   (e.g. new definition, changed safety relevance of a channel).
+   Only tracked since the last call of ResetDatapoolChanges.
+
+   \retval   true    Structure changed: HALC Datapools have to be regenerated completely
+   \retval   false   Structure unchanged: changes can be applied via GetChangedChannels
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCHalcConfig::IsDatapoolStructureChanged(void) const
+{
+   return this->mq_DatapoolStructureChanged;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get channels with changed values since the last call of ResetDatapoolChanges
+
+   Only meaningful if IsDatapoolStructureChanged returns false.
+
+   \param[in]   ou32_DomainIndex          Domain index
+   \param[out]  orc_ChannelIndices        Indices of channels with changed configuration (ascending)
+   \param[out]  orq_DomainValuesChanged   Flag if domain configuration changed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCHalcConfig::GetChangedChannels(const uint32 ou32_DomainIndex, std::vector<uint32> & orc_ChannelIndices,
+                                         bool & orq_DomainValuesChanged) const
+{
+   const std::map<uint32, std::set<uint32> >::const_iterator c_ItDomain =
+      this->mc_ChangedChannels.find(ou32_DomainIndex);
+
+   orc_ChannelIndices.clear();
+   if (c_ItDomain != this->mc_ChangedChannels.end())
+   {
+      orc_ChannelIndices.assign(c_ItDomain->second.begin(), c_ItDomain->second.end());
+   }
+   orq_DomainValuesChanged = (this->mc_ChangedDomainValues.count(ou32_DomainIndex) > 0UL);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Request complete regeneration of HALC Datapools
+
+   Use if the configuration was replaced as a whole,
+   so the tracked changes do not describe the difference to the existing HALC Datapools.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCHalcConfig::SetDatapoolStructureChanged(void)
+{
+   this->mq_DatapoolStructureChanged = true;
+   this->mc_ChangedDomainValues.clear();
+   this->mc_ChangedChannels.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Reset tracked changes
+
+   Call after HALC Datapools were generated from the current configuration.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCHalcConfig::ResetDatapoolChanges(void)
+{
+   this->mq_DatapoolStructureChanged = false;
+   this->mc_ChangedDomainValues.clear();
+   this->mc_ChangedChannels.clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remember changed values of channel or domain for HALC Datapool generation
+
+   \param[in]  ou32_DomainIndex     Domain index
+   \param[in]  ou32_ChannelIndex    Channel index
+   \param[in]  oq_UseChannelIndex   Use channel index
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCHalcConfig::m_MarkValuesChanged(const uint32 ou32_DomainIndex, const uint32 ou32_ChannelIndex,
+                                          const bool oq_UseChannelIndex)
+{
+   //no need to track details if everything is regenerated anyway
+   if (this->mq_DatapoolStructureChanged == false)
+   {
+      if (oq_UseChannelIndex)
+      {
+         this->mc_ChangedChannels[ou32_DomainIndex].insert(ou32_ChannelIndex);
+      }
+      else
+      {
+         this->mc_ChangedDomainValues.insert(ou32_DomainIndex);
+      }
+   }
+}
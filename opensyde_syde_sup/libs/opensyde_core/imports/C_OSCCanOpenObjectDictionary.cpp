@@ -126,6 +126,7 @@ bool C_OSCCanOpenObject::operator <(const C_OSCCanOpenObject & orc_Object) const
 
    Load CANopen EDS file and store contents in c_Objects.
    Objects in c_Objects will be sorted by index and sub-index.
+   The lookup index used by GetCanOpenObject() is rebuilt from the sorted objects.
 
    \param[in]     orc_File        File path
 
@@ -141,7 +142,8 @@ sint32 C_OSCCanOpenObjectDictionary::LoadFromFile(const C_SCLString & orc_File)
    sint32 s32_Return;
 
    mc_LastError = "";
-   c_Objects.SetLength(0);
+   c_Objects.clear();
+   mc_ObjectIndex.clear();
 
    if (TGL_FileExists(orc_File) == false)
    {
@@ -150,6 +152,10 @@ sint32 C_OSCCanOpenObjectDictionary::LoadFromFile(const C_SCLString & orc_File)
    else
    {
       C_SCLIniFile c_IniFile(orc_File);
+      //reserve at least the main objects; sub-indexes are only known while parsing
+      c_Objects.reserve(static_cast<uintn>(c_IniFile.ReadUint16("MandatoryObjects", "SupportedObjects", 0)) +
+                        static_cast<uintn>(c_IniFile.ReadUint16("OptionalObjects", "SupportedObjects", 0)) +
+                        static_cast<uintn>(c_IniFile.ReadUint16("ManufacturerObjects", "SupportedObjects", 0)));
       s32_Return = m_AppendEDSBlock("MandatoryObjects", c_IniFile);
       if (s32_Return == C_NO_ERR)
       {
@@ -168,14 +174,12 @@ sint32 C_OSCCanOpenObjectDictionary::LoadFromFile(const C_SCLString & orc_File)
    if (s32_Return == C_NO_ERR)
    {
       //sort object dictionary:
-      if (c_Objects.GetLength() > 0)
-      {
-         std::sort(&c_Objects[0], &c_Objects[c_Objects.GetLength()]);
-      }
+      std::sort(c_Objects.begin(), c_Objects.end());
+      m_RebuildObjectIndex();
    }
    else
    {
-      c_Objects.SetLength(0);
+      c_Objects.clear();
    }
 
    return s32_Return;
@@ -200,12 +204,12 @@ sint32 C_OSCCanOpenObjectDictionary::LoadFromFile(const C_SCLString & orc_File)
 sint32 C_OSCCanOpenObjectDictionary::m_AppendEDSBlock(const C_SCLString & orc_Blockname, C_SCLIniFile & orc_IniFile)
 {
    uint16 u16_NumEntries;
-   sint32 s32_IndexInList;
+   uint32 u32_IndexInList;
    sint32 s32_Return = C_NO_ERR;
 
-   s32_IndexInList = this->c_Objects.GetLength();
+   u32_IndexInList = static_cast<uint32>(this->c_Objects.size());
    u16_NumEntries = orc_IniFile.ReadUint16(orc_Blockname, "SupportedObjects", 0);
-   this->c_Objects.IncLength(u16_NumEntries);
+   this->c_Objects.resize(this->c_Objects.size() + u16_NumEntries);
    for (sint32 s32_Loop = 0; s32_Loop < u16_NumEntries; s32_Loop++)
    {
       C_SCLString c_Section;
@@ -225,7 +229,7 @@ sint32 C_OSCCanOpenObjectDictionary::m_AppendEDSBlock(const C_SCLString & orc_Bl
          try
          {
             u16_Index = static_cast<uint16>(c_Index.ToInt());
-            this->c_Objects[s32_IndexInList].u16_Index = u16_Index;
+            this->c_Objects[u32_IndexInList].u16_Index = u16_Index;
          }
          catch (...)
          {
@@ -241,13 +245,13 @@ sint32 C_OSCCanOpenObjectDictionary::m_AppendEDSBlock(const C_SCLString & orc_Bl
          //strap the "0x"
          c_Section = c_Index.SubString(3, c_Index.Length());
          orc_IniFile.ReadSectionValues(c_Section, &c_List, false);
-         s32_Return = m_GetObjectDescription(u16_Index, 0, false, c_List, this->c_Objects[s32_IndexInList]);
+         s32_Return = m_GetObjectDescription(u16_Index, 0, false, c_List, this->c_Objects[u32_IndexInList]);
       }
 
       if (s32_Return == C_NO_ERR)
       {
-         uint8 u8_NumSubs = this->c_Objects[s32_IndexInList].u8_NumSubs;
-         s32_IndexInList++;
+         uint8 u8_NumSubs = this->c_Objects[u32_IndexInList].u8_NumSubs;
+         u32_IndexInList++;
          //are there sub-indexes ?
          if (u8_NumSubs > 0)
          {
@@ -270,14 +274,14 @@ sint32 C_OSCCanOpenObjectDictionary::m_AppendEDSBlock(const C_SCLString & orc_Bl
                   C_SCLStringList c_List;
                   orc_IniFile.ReadSectionValues(c_SubSection, &c_List, false);
 
-                  this->c_Objects.IncLength();
+                  this->c_Objects.resize(this->c_Objects.size() + 1U);
                   s32_Return = m_GetObjectDescription(u16_Index, static_cast<uint8>(u16_Sub), true, c_List,
-                                                      this->c_Objects[s32_IndexInList]);
+                                                      this->c_Objects[u32_IndexInList]);
                   if (s32_Return != C_NO_ERR)
                   {
                      break;
                   }
-                  s32_IndexInList++;
+                  u32_IndexInList++;
                }
                else
                {
@@ -532,3 +536,51 @@ C_SCLString C_OSCCanOpenObjectDictionary::GetLastErrorText(void) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get object by index and sub-index
+
+   Uses the lookup index built by LoadFromFile().
+   Main objects are reported with sub-index 0 and take precedence over a "sub0" object of the same index.
+
+   \param[in]     ou16_Index      object index
+   \param[in]     ou8_SubIndex    object sub-index
+
+   \return
+   NULL     object not found
+   else     pointer to object in c_Objects
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_OSCCanOpenObject * C_OSCCanOpenObjectDictionary::GetCanOpenObject(const uint16 ou16_Index,
+                                                                          const uint8 ou8_SubIndex) const
+{
+   const C_OSCCanOpenObject * pc_Retval = NULL;
+   const uint32 u32_Key = (static_cast<uint32>(ou16_Index) << 8U) | static_cast<uint32>(ou8_SubIndex);
+
+   const std::map<uint32, uint32>::const_iterator c_It = mc_ObjectIndex.find(u32_Key);
+
+   if ((c_It != mc_ObjectIndex.end()) && (c_It->second < c_Objects.size()))
+   {
+      pc_Retval = &c_Objects[c_It->second];
+   }
+   return pc_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Rebuild lookup index from sorted c_Objects
+
+   If an index / sub-index combination is present more than once the first object in c_Objects wins.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCCanOpenObjectDictionary::m_RebuildObjectIndex(void)
+{
+   mc_ObjectIndex.clear();
+   for (uint32 u32_Object = 0U; u32_Object < c_Objects.size(); u32_Object++)
+   {
+      const C_OSCCanOpenObject & rc_Object = c_Objects[u32_Object];
+      const uint32 u32_Key = (static_cast<uint32>(rc_Object.u16_Index) << 8U) |
+                             static_cast<uint32>(rc_Object.u8_SubIndex);
+      //insert does not overwrite existing entries:
+      (void)mc_ObjectIndex.insert(std::pair<uint32, uint32>(u32_Key, u32_Object));
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
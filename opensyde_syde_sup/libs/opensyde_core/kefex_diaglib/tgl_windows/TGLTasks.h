@@ -94,6 +94,33 @@ public:
    stw_types::uint32 GetInterval(void) const;
 };
 
+//----------------------------------------------------------------------------------------------------------------------
+
+typedef void (* PR_TGLThreadFunction)(void * const opv_Instance);
+
+///Executes a function in a separate thread of execution
+class TGL_PACKAGE C_TGLThread
+{
+private:
+   HANDLE mpv_Handle;
+   PR_TGLThreadFunction mpr_Function;
+   void * mpv_Instance;
+
+   static DWORD __stdcall mh_ThreadFunction(void * opv_Thread);
+
+   //this class can not be copied:
+   C_TGLThread(const C_TGLThread & orc_Source);
+   C_TGLThread & operator = (const C_TGLThread & orc_Source);
+
+public:
+   C_TGLThread(void);
+   virtual ~C_TGLThread(void);
+
+   stw_types::sint32 Start(const PR_TGLThreadFunction opr_Function, void * const opv_Instance);
+   stw_types::sint32 WaitFor(void);
+   bool IsRunning(void) const;
+};
+
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
 }
 
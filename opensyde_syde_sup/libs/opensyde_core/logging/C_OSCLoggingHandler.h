@@ -18,6 +18,7 @@
 #include "TGLTasks.h"
 #include <fstream>
 #include <map>
+#include <vector>
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_core
@@ -50,6 +51,7 @@ public:
    static void h_SetWriteToConsoleActive(const bool oq_Active);
    static void h_SetMeasurePerformanceActive(const bool oq_Active);
    static void h_SetCompleteLogFileLocation(const stw_scl::C_SCLString & orc_CompleteLogFileLocation);
+   static void h_SetAsyncWriteActive(const bool oq_Active);
    static const stw_scl::C_SCLString & h_GetCompleteLogFileLocation(void);
 
    //Logging call
@@ -74,6 +76,23 @@ public:
    static std::string h_UtilConvertDateTimeToString(const stw_tgl::C_TGLDateTime & orc_DateTime);
 
 private:
+   ///Log entry waiting to be written by the asynchronous writer
+   class C_LogRecord
+   {
+   public:
+      stw_tgl::C_TGLDateTime c_DateTime;
+      std::string c_Type;
+      std::string c_Activity;
+      std::string c_Message;
+      std::string c_Class;
+      std::string c_Function;
+
+      void Swap(C_LogRecord & orc_Other);
+   };
+
+   static const stw_types::uint32 mhu32_RECORD_BUFFER_SIZE;
+   static const stw_types::uint32 mhu32_ASYNC_WRITE_INTERVAL;
+
    static bool mhq_WriteToFile;
    static bool mhq_WriteToConsole;
    static bool mhq_MeasureTime;
@@ -83,9 +102,35 @@ private:
    static stw_tgl::C_TGLCriticalSection mhc_FileCriticalSection;
    static std::ofstream mhc_File;
 
+   static bool mhq_AsyncWrite;
+   static bool mhq_AsyncWriterStop;
+   static std::vector<C_LogRecord> mhc_Records;    ///< ring buffer of entries not yet written
+   static std::vector<C_LogRecord> mhc_WriteBatch; ///< entries currently being written
+   static stw_types::uint32 mhu32_RecordReadIndex;
+   static stw_types::uint32 mhu32_RecordCount;
+   static stw_types::uint32 mhu32_RecordsDropped; ///< entries lost since last write because buffer was full
+   static stw_tgl::C_TGLCriticalSection mhc_RecordCriticalSection;
+   static stw_tgl::C_TGLCriticalSection mhc_WriteBatchCriticalSection;
+   static stw_tgl::C_TGLThread mhc_AsyncWriter;
+
    static void mh_WriteLog(const stw_scl::C_SCLString & orc_Type, const stw_scl::C_SCLString & orc_Activity,
                            const stw_scl::C_SCLString & orc_Message, const stw_types::charn * const opcn_Class = NULL,
                            const stw_types::charn * const opcn_Function = NULL);
+   static bool mh_QueueLog(const stw_tgl::C_TGLDateTime & orc_DateTime, const stw_scl::C_SCLString & orc_Type,
+                           const stw_scl::C_SCLString & orc_Activity, const stw_scl::C_SCLString & orc_Message,
+                           const stw_types::charn * const opcn_Class, const stw_types::charn * const opcn_Function);
+   static void mh_WriteQueuedLogs(void);
+   static void mh_OutputQueuedLogs(void);
+   static void mh_AsyncWriterThread(void * const opv_Instance);
+   static void mh_FormatLogEntry(const stw_tgl::C_TGLDateTime & orc_DateTime, const stw_types::charn * const opcn_Type,
+                                 const stw_types::charn * const opcn_Activity,
+                                 const stw_types::charn * const opcn_Message,
+                                 const stw_types::charn * const opcn_Class,
+                                 const stw_types::charn * const opcn_Function, std::string & orc_LogEntries);
+   static void mh_AppendDecimal(std::string & orc_Text, const stw_types::uint32 ou32_Value,
+                                const stw_types::uint32 ou32_Digits);
+   static void mh_PadToColumn(std::string & orc_Text, const stw_types::uintn oun_Column);
+   static void mh_OutputLogEntries(const std::string & orc_LogEntries);
    static void mh_OpenFile(void);
    //Avoid calling
    C_OSCLoggingHandler(void);
@@ -127,6 +127,20 @@ public:
    stw_types::sint32 SetValueFromLittleEndianBlob(const std::vector<stw_types::uint8> & orc_Data);
    void GetValueAsBigEndianBlob(std::vector<stw_types::uint8> & orc_Data) const;
    void GetValueAsLittleEndianBlob(std::vector<stw_types::uint8> & orc_Data) const;
+   stw_types::sint32 SetValueFromBigEndianBlob(const stw_types::uint8 * const opu8_Data,
+                                               const stw_types::uint32 ou32_Size);
+   stw_types::sint32 SetValueFromLittleEndianBlob(const stw_types::uint8 * const opu8_Data,
+                                                  const stw_types::uint32 ou32_Size);
+   stw_types::sint32 GetValueAsBigEndianBlob(stw_types::uint8 * const opu8_Data,
+                                             const stw_types::uint32 ou32_Size) const;
+   stw_types::sint32 GetValueAsLittleEndianBlob(stw_types::uint8 * const opu8_Data,
+                                                const stw_types::uint32 ou32_Size) const;
+   stw_types::sint32 SetValueElementsFromBigEndianBlob(const stw_types::uint32 ou32_FirstIndex,
+                                                       const stw_types::uint8 * const opu8_Data,
+                                                       const stw_types::uint32 ou32_Size);
+   stw_types::sint32 SetValueElementsFromLittleEndianBlob(const stw_types::uint32 ou32_FirstIndex,
+                                                          const stw_types::uint8 * const opu8_Data,
+                                                          const stw_types::uint32 ou32_Size);
 
    void SetArraySize(const stw_types::uint32 & oru32_Size);
    stw_types::uint32 GetArraySize(void) const;
@@ -156,11 +170,29 @@ public:
    void GetAnyValueAsFloat64(stw_types::float64 & orf64_Output, const stw_types::uint32 ou32_Index) const;
 
 private:
-   E_Type me_Type;                                   ///< Currently active type
-   bool mq_Array;                                    ///< Flag for array (true) or single element type (false)
-   std::vector<stw_types::uint8> mc_Data;            ///< Contained value
-   static const stw_types::sint32 mhs32_TypeError;   ///< Exception value for type mismatch
-   static const stw_types::sint32 mhs32_AccessError; ///< Exception value for out of bounds array access
+   static const stw_types::uint32 mhu32_LOCAL_DATA_SIZE = 8U; ///< Size of local storage for values in bytes
+
+   //lint -e{9018}  //union so the heap pointer does not need memory in addition to the local storage
+   union U_Storage ///< Storage of contained value; member in use depends on mu32_DataSize
+   {
+      stw_types::uint8 au8_Local[mhu32_LOCAL_DATA_SIZE]; ///< Value if it fits in (no heap allocation)
+      stw_types::uint8 * pu8_Heap;                       ///< Value on heap if it does not fit into au8_Local
+   };
+
+   E_Type me_Type;                                           ///< Currently active type
+   bool mq_Array;                                            ///< Flag for array (true) or single element type (false)
+   stw_types::uint32 mu32_DataSize;                          ///< Size of contained value in bytes
+   U_Storage mu_Storage;                                     ///< Contained value
+   static const stw_types::sint32 mhs32_TypeError;           ///< Exception value for type mismatch
+   static const stw_types::sint32 mhs32_AccessError;         ///< Exception value for out of bounds array access
+
+   stw_types::uint8 * m_GetData(void);
+   const stw_types::uint8 * m_GetData(void) const;
+   void m_ResizeData(const stw_types::uint32 ou32_Size);
+   void m_SetValueFromBlob(const stw_types::uint32 ou32_Offset, const stw_types::uint8 * const opu8_Data,
+                           const stw_types::uint32 ou32_Size, const bool oq_BigEndian);
+   void m_GetValueAsBlob(stw_types::uint8 * const opu8_Data, const bool oq_BigEndian) const;
+   stw_types::uint32 m_GetElementSize(void) const;
 
    template <typename T> void m_SetValue(const T & orc_Value, const E_Type oe_Type);
    template <typename T> void m_GetValue(const E_Type oe_Type, T & orc_Value) const;
@@ -232,6 +232,57 @@ sint32 C_OSCProtocolDriverOsyTpBase::m_AddToRxQueue(const C_OSCProtocolDriverOsy
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   move new service to Rx queue
+
+   Add specified service to Rx queue for incoming responses.
+   In contrast to m_AddToRxQueue the service data is not copied but handed over to the queue.
+   So this is the preferred way for placing large reassembled services.
+   During the operation the queue will be locked by a critical section.
+
+   \param[in,out] orc_Service   service to add to queue; the service data is empty afterwards if it was added
+
+   \return
+   C_NO_ERR    service added
+   C_RANGE     service size out of range
+   C_OVERFLOW  Rx queue is already full
+   C_NOACT     could not add to queue (out of memory; should not happen in real life)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCProtocolDriverOsyTpBase::m_MoveToRxQueue(C_OSCProtocolDriverOsyService & orc_Service)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (orc_Service.c_Data.size() > hu16_OSY_MAXIMUM_SERVICE_SIZE)
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      mc_CsRxQueue.Acquire();
+      if (mc_RxQueue.size() >= mu16_MaxServiceQueueSize)
+      {
+         s32_Return = C_OVERFLOW;
+      }
+      else
+      {
+         try
+         {
+            //add empty element and swap the data in; saves copying the whole payload
+            mc_RxQueue.push_back(C_OSCProtocolDriverOsyService());
+            mc_RxQueue.back().c_Data.swap(orc_Service.c_Data);
+            mc_RxQueue.back().q_CanTransferWithoutFlowControl = orc_Service.q_CanTransferWithoutFlowControl;
+         }
+         catch (...)
+         {
+            s32_Return = C_NOACT; //probably out of memory
+         }
+      }
+      mc_CsRxQueue.Release();
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   get "oldest" entry from Tx queue
 
@@ -256,8 +307,10 @@ sint32 C_OSCProtocolDriverOsyTpBase::m_GetFromTxQueue(C_OSCProtocolDriverOsyServ
    }
    else
    {
-      orc_Service = mc_TxQueue.front(); //get element from queue
-      mc_TxQueue.pop_front();           //delete element from queue
+      //get element from queue; swap the data instead of copying the whole payload:
+      orc_Service.c_Data.swap(mc_TxQueue.front().c_Data);
+      orc_Service.q_CanTransferWithoutFlowControl = mc_TxQueue.front().q_CanTransferWithoutFlowControl;
+      mc_TxQueue.pop_front(); //delete element from queue
    }
    mc_CsTxQueue.Release();
    return s32_Return;
@@ -287,8 +340,10 @@ sint32 C_OSCProtocolDriverOsyTpBase::m_GetFromRxQueue(C_OSCProtocolDriverOsyServ
    }
    else
    {
-      orc_Service = mc_RxQueue.front(); //get element from queue
-      mc_RxQueue.pop_front();           //delete element from queue
+      //get element from queue; swap the data instead of copying the whole payload:
+      orc_Service.c_Data.swap(mc_RxQueue.front().c_Data);
+      orc_Service.q_CanTransferWithoutFlowControl = mc_RxQueue.front().q_CanTransferWithoutFlowControl;
+      mc_RxQueue.pop_front(); //delete element from queue
    }
    mc_CsRxQueue.Release();
    return s32_Return;
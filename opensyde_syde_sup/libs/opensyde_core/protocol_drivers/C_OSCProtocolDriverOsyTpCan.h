@@ -53,6 +53,10 @@ private:
                                                // timeout
       stw_types::uint32 u32_SendCfTimeout;     ///< Tx:time at which sending all CFs should have been finished; set upon
       ///< reception of FC
+      stw_types::uint8 u8_BlockSize;           ///< Tx: block size reported by last FC (0: no limit)
+      stw_types::uint8 u8_FramesLeftInBlock;   ///< Tx: number of CFs left to send before waiting for next FC
+      stw_types::uint32 u32_SeparationTimeUs;  ///< Tx: minimum gap between CFs reported by last FC
+      stw_types::uint64 u64_NextFrameTimeUs;   ///< Tx: earliest time the next CF may be sent
    };
 
    ///CAN-TP PCI types:
@@ -65,6 +69,11 @@ private:
    static const stw_types::uint8 mhu8_ISO15765_N_PCI_OMF = 0xE0U; // openSYDE multi frame
                                                                   // (no flow control, SN 0, SN 15->1)
 
+   ///flow status of flow control (lower nibble of PCI)
+   static const stw_types::uint8 mhu8_ISO15765_FS_CTS   = 0x00U; // continue to send
+   static const stw_types::uint8 mhu8_ISO15765_FS_WAIT  = 0x01U; // wait for next flow control
+   static const stw_types::uint8 mhu8_ISO15765_FS_OVFLW = 0x02U; // overflow; abort transfer
+
    ///openSYDE single frame message types (lower nibble)
    static const stw_types::uint8 mhu8_OSY_OSF_TYPE_EVENT_DRIVEN_DP_SINGLE_FRAME = 0x01U; // openSYDE single frame
                                                                                          // without response SID=0xFA
@@ -83,6 +92,8 @@ private:
 
    ///timeout when waiting for flow control; lower but more realistic than the 1s specified in 15765
    static const stw_types::uint16 mhu16_NBsTimeoutMs = 100U;
+   ///maximum time to block in one call when sending CFs with sub-millisecond separation times
+   static const stw_types::uint32 mhu32_MAX_CF_BURST_TIME_US = 10000U;
 
    stw_can::C_CAN_Dispatcher * mpc_CanDispatcher; ///< CAN dispatcher to use for communication
    stw_types::uint16 mu16_DispatcherClientHandle; ///< our handle for dispatcher interaction
@@ -103,6 +114,7 @@ private:
    stw_types::sint32 m_BroadcastSendDiagnosticSessionControl(const stw_types::uint8 ou8_Session) const;
 
    stw_types::sint32 m_SendNextConsecutiveFrames(void);
+   static stw_types::uint32 mh_DecodeSeparationTime(const stw_types::uint8 ou8_SeparationTime);
 
    void m_ComposeSingleFrame(const C_OSCProtocolDriverOsyService & orc_Service, const stw_types::uint32 ou32_Identifier,
                              stw_can::T_STWCAN_Msg_TX & orc_CanMessage) const;
@@ -117,6 +117,8 @@ protected:
                                           const stw_opensyde_core::C_OSCNodeDataPoolContent & orc_OscValue,
                                           const stw_types::float64 of64_Factor, const stw_types::float64 of64_Offset);
 
+   static stw_types::uint32 mh_GetMessageIndexKey(const stw_types::uint32 ou32_CanId, const bool oq_IsExtended);
+
    virtual stw_scl::C_SCLString m_GetProtocolStringHexHook(void) const;
    virtual stw_scl::C_SCLString m_GetProtocolStringDecHook(void) const;
 
@@ -133,6 +135,15 @@ protected:
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerFileBase * const> mc_LoggingFiles;
 
 private:
+   ///Location of the first matching CAN message in all active system definitions
+   class C_OsySysDefMessageLocation
+   {
+   public:
+      const C_OSCCanMessage * pc_Message;
+      const C_OSCNodeDataPoolList * pc_DataPoolList;
+      bool q_DataPoolFound; ///< false: Datapool index of protocol invalid, message can not be interpreted
+   };
+
    //Avoid call
    C_OSCComMessageLogger(const C_OSCComMessageLogger &);
    C_OSCComMessageLogger & operator =(const C_OSCComMessageLogger &);
@@ -141,6 +152,7 @@ private:
    void m_InterpretSysDefCanSignal(C_OSCComMessageLoggerData & orc_MessageData,
                                    const C_OSCCanSignal & orc_OscSignal) const;
    void m_ResetCounter(void);
+   void m_UpdateOsySysDefMessageIndex(void);
    static void mh_PostProcessSysDef(stw_opensyde_core::C_OSCSystemDefinition & orc_SystemDefinition);
    static void mh_AddSpecialECeSSignals(C_OSCNode & orc_Node, const C_OSCCanMessageIdentificationIndices & orc_Id,
                                         const stw_types::uint32 ou32_SignalIndex);
@@ -157,6 +169,8 @@ private:
 
    // Database interpretation
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerOsySysDefConfig> mc_OsySysDefs;
+   ///Messages of all active system definitions by CAN ID (see mh_GetMessageIndexKey)
+   std::map<stw_types::uint32, C_OsySysDefMessageLocation> mc_OsySysDefMessageIndex;
 
    // Filtering
    std::vector<C_OSCComMessageLoggerFilter> mc_CanFilterConfig;
@@ -39,6 +39,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 
 #include <string>
+#include <map>
 #include "stwtypes.h"
 #include "CSCLString.h"
 #include "CSCLStringList.h"
@@ -91,6 +92,8 @@ public:
    C_SCLString c_Name;                  ///< name (text within "[""]")
    C_SCLString c_Comment;               ///< comment preceeding the section
    SCLDynamicArray<C_SCLIniKey> c_Keys; ///< key/value pairs contains in this section
+
+   std::map<std::string, stw_types::sint32> c_KeyIndex; ///< upper case key -> index in c_Keys (first occurrence)
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -101,6 +104,11 @@ private:
    // Utility Methods
    static void mh_GetNextPair(const C_SCLString & orc_CommandLine, C_SCLString & orc_Key, C_SCLString & orc_Value);
 
+   // Index handling; names are compared ignoring case, so the indices use upper case names
+   static std::string mh_GetIndexName(const C_SCLString & orc_Name);
+   static void mh_RebuildKeyIndex(C_SCLIniSection & orc_Section);
+   void m_RebuildSectionIndex(void);
+
    // Returns the requested key (if found) from the requested Section. Returns NULL otherwise.
    C_SCLIniKey * m_GetKey(const C_SCLString & orc_Key, const C_SCLString & orc_Section);
 
@@ -133,10 +141,9 @@ private:
    // exist. Section is created with no keys.
    C_SCLIniSection * m_CreateSection(const C_SCLString & orc_Section);
 
-   SCLDynamicArray<C_SCLIniSection> mc_Sections; ///< Our list of sections
-   bool mq_Dirty;                                ///< Tracks whether or not data has changed.
-   stw_types::sint32 ms32_PreviousSectionIndex;  ///< for speeding up searching for a section
-   stw_types::sint32 ms32_PreviousKeyIndex;      ///< for speeding up searching for a key
+   SCLDynamicArray<C_SCLIniSection> mc_Sections;               ///< Our list of sections (in file order)
+   std::map<std::string, stw_types::sint32> mc_SectionIndex; ///< upper case name -> index in mc_Sections
+   bool mq_Dirty;                                              ///< Tracks whether or not data has changed.
 
    // Methods
 
@@ -110,9 +110,7 @@ C_SCLString::C_SCLString(void) :
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLString::C_SCLString(const stw_types::uint8 ou8_InitValue)
 {
-   std::stringstream c_Stream;
-   c_Stream << static_cast<uint32>(ou8_InitValue);
-   c_String = c_Stream.str();
+   (void)this->AppendUInt(ou8_InitValue);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -129,9 +127,111 @@ C_SCLString::C_SCLString(const stw_types::uint8 ou8_InitValue)
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLString::C_SCLString(const stw_types::sint8 os8_InitValue)
 {
-   std::stringstream c_Stream;
-   c_Stream << static_cast<sint32>(os8_InitValue);
-   c_String = c_Stream.str();
+   (void)this->AppendInt(os8_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to os16_InitValue (interpreted as a number)
+
+   \param[in]  os16_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::sint16 os16_InitValue)
+{
+   (void)this->AppendInt(os16_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to ou16_InitValue (interpreted as a number)
+
+   \param[in]  ou16_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::uint16 ou16_InitValue)
+{
+   (void)this->AppendUInt(ou16_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to osn_InitValue (interpreted as a number)
+
+   \param[in]  osn_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::sintn osn_InitValue)
+{
+   (void)this->AppendInt(osn_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to oun_InitValue (interpreted as a number)
+
+   \param[in]  oun_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::uintn oun_InitValue)
+{
+   (void)this->AppendUInt(oun_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to os32_InitValue (interpreted as a number)
+
+   \param[in]  os32_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::sint32 os32_InitValue)
+{
+   (void)this->AppendInt(os32_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to ou32_InitValue (interpreted as a number)
+
+   \param[in]  ou32_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::uint32 ou32_InitValue)
+{
+   (void)this->AppendUInt(ou32_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to os64_InitValue (interpreted as a number)
+
+   \param[in]  os64_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::sint64 os64_InitValue)
+{
+   (void)this->AppendInt(os64_InitValue);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor
+
+   Initialize string data to ou64_InitValue (interpreted as a number)
+
+   \param[in]  ou64_InitValue   initial value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const stw_types::uint64 ou64_InitValue)
+{
+   (void)this->AppendUInt(ou64_InitValue);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -205,6 +305,40 @@ C_SCLString::C_SCLString(const charn * const opcn_InitValue, const uintn oun_Len
    (void)c_String.assign(opcn_InitValue, oun_Length);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor.
+
+   Initialize string data from zero-terminated string.
+   A NULL pointer results in an empty string.
+
+   \param[in]  opcn_InitValue   pointer to zero-terminated initial string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(const charn * const opcn_InitValue)
+{
+   if (opcn_InitValue != NULL)
+   {
+      (void)c_String.assign(opcn_InitValue);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Constructor.
+
+   Initialize string data from "charn *"
+   See documentation of const-variation for details.
+
+   \param[in]  opcn_InitValue   pointer to zero-terminated initial string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString::C_SCLString(charn * const opcn_InitValue)
+{
+   if (opcn_InitValue != NULL)
+   {
+      (void)c_String.assign(opcn_InitValue);
+   }
+} //lint !e818
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Constructor.
 
@@ -474,25 +608,55 @@ C_SCLString C_SCLString::StringOfChar(const charn ocn_Char, const uint32 ou32_Co
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief    Utility: get number of required characters for "printf"
+/*! \brief    Utility: "printf" into stack buffer
 
-   Return number of required characters for "printfing".
-   Used for calculating the required size of a dynamic buffer for performing the
-    actual printing with m_SNPrintf or m_CatSNPrintf.
+   Print into a local buffer of mhun_PRINTF_STACK_BUFFER_SIZE characters.
+   If the result fits it is assigned to resp. appended to the string data; so the typical short texts are done
+    with one call to vsnprintf and without a heap allocation for the formatting itself.
+   As before the result is taken up to the first zero character (e.g. from "%c" with '\0').
+   Otherwise the string data is not touched and the caller has to print again into a dynamic buffer of the
+    returned size using m_SNPrintf or m_CatSNPrintf.
    The reason this is split up is that the call to "vsnprintf" can modify the opv_Args parameter.
    So we need another copy for the 2nd call. This copy could be created using the "va_copy" macro.
    Unfortunately it is not portable (available from C99 resp. C++11).
 
    \param[in]  opcn_Format   format string
    \param[in]  opv_Args      values to print into string
+   \param[in]  oq_Append     true: append result to string data; false: replace string data with result
 
    \return
    number of characters required (without terminating zero)
+   negative value: formatting error (string data is cleared resp. not appended to)
 */
 //----------------------------------------------------------------------------------------------------------------------
-sintn C_SCLString::mh_GetRequiredPrintfSize(const charn * const opcn_Format, va_list opv_Args)
+sintn C_SCLString::m_PrintToStackBuffer(const charn * const opcn_Format, va_list opv_Args, const bool oq_Append)
 {
-   return std::vsnprintf(NULL, 0U, opcn_Format, opv_Args);
+   charn acn_Buffer[mhun_PRINTF_STACK_BUFFER_SIZE];
+   const sintn sn_Length = std::vsnprintf(&acn_Buffer[0], sizeof(acn_Buffer), opcn_Format, opv_Args);
+
+   if (sn_Length < 0)
+   {
+      if (oq_Append == false)
+      {
+         c_String.clear();
+      }
+   }
+   else if (static_cast<uintn>(sn_Length) < sizeof(acn_Buffer))
+   {
+      if (oq_Append == true)
+      {
+         (void)c_String.append(&acn_Buffer[0]);
+      }
+      else
+      {
+         (void)c_String.assign(&acn_Buffer[0]);
+      }
+   }
+   else
+   {
+      //did not fit; caller needs to print again
+   }
+   return sn_Length;
 } //lint !e952 //va_list can be const on some targets but not all
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -515,7 +679,7 @@ void C_SCLString::m_CatSNPrintf(const stw_types::sintn osn_Size, const stw_types
    charn * const pcn_Buffer = new charn[static_cast<uintn>(osn_Size) + 1U];
 
    (void)std::vsnprintf(pcn_Buffer, static_cast<uintn>(osn_Size) + 1U, opcn_Format, opv_Args);
-   c_String.operator +=(pcn_Buffer);
+   (void)c_String.append(pcn_Buffer);
    delete[] pcn_Buffer;
 } //lint !e952 //va_list can be const on some targets but not all
 
@@ -538,12 +702,16 @@ sintn C_SCLString::printf(const charn * const opcn_Format, ...) //lint !e1960 !e
    va_list pv_Args;
 
    va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   sn_Length = mh_GetRequiredPrintfSize(opcn_Format, pv_Args);
+   sn_Length = m_PrintToStackBuffer(opcn_Format, pv_Args, false);
    va_end(pv_Args);
 
-   va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   m_SNPrintf(sn_Length, opcn_Format, pv_Args);
-   va_end(pv_Args);
+   if (sn_Length >= static_cast<sintn>(mhun_PRINTF_STACK_BUFFER_SIZE))
+   {
+      //too long for the stack buffer: print again into buffer of the now known size
+      va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //using "..."
+      m_SNPrintf(sn_Length, opcn_Format, pv_Args);
+      va_end(pv_Args);
+   }
 
    return sn_Length;
 }
@@ -567,12 +735,16 @@ C_SCLString & C_SCLString::sprintf(const charn * const opcn_Format, ...) //lint
    sintn sn_Length;
 
    va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   sn_Length = mh_GetRequiredPrintfSize(opcn_Format, pv_Args);
+   sn_Length = m_PrintToStackBuffer(opcn_Format, pv_Args, false);
    va_end(pv_Args);
 
-   va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   m_SNPrintf(sn_Length, opcn_Format, pv_Args);
-   va_end(pv_Args);
+   if (sn_Length >= static_cast<sintn>(mhun_PRINTF_STACK_BUFFER_SIZE))
+   {
+      //too long for the stack buffer: print again into buffer of the now known size
+      va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //using "..."
+      m_SNPrintf(sn_Length, opcn_Format, pv_Args);
+      va_end(pv_Args);
+   }
 
    return (*this);
 }
@@ -596,12 +768,16 @@ sintn C_SCLString::PrintFormatted(const charn * const opcn_Format, ...) //lint !
    va_list pv_Args;
 
    va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   sn_Length = mh_GetRequiredPrintfSize(opcn_Format, pv_Args);
+   sn_Length = m_PrintToStackBuffer(opcn_Format, pv_Args, false);
    va_end(pv_Args);
 
-   va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   m_SNPrintf(sn_Length, opcn_Format, pv_Args);
-   va_end(pv_Args);
+   if (sn_Length >= static_cast<sintn>(mhun_PRINTF_STACK_BUFFER_SIZE))
+   {
+      //too long for the stack buffer: print again into buffer of the now known size
+      va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //using "..."
+      m_SNPrintf(sn_Length, opcn_Format, pv_Args);
+      va_end(pv_Args);
+   }
 
    return sn_Length;
 }
@@ -625,12 +801,16 @@ C_SCLString & C_SCLString::StringPrintFormatted(const charn * const opcn_Format,
    sintn sn_Length;
 
    va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   sn_Length = mh_GetRequiredPrintfSize(opcn_Format, pv_Args);
+   sn_Length = m_PrintToStackBuffer(opcn_Format, pv_Args, false);
    va_end(pv_Args);
 
-   va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   m_SNPrintf(sn_Length, opcn_Format, pv_Args);
-   va_end(pv_Args);
+   if (sn_Length >= static_cast<sintn>(mhun_PRINTF_STACK_BUFFER_SIZE))
+   {
+      //too long for the stack buffer: print again into buffer of the now known size
+      va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //using "..."
+      m_SNPrintf(sn_Length, opcn_Format, pv_Args);
+      va_end(pv_Args);
+   }
 
    return (*this);
 }
@@ -656,12 +836,16 @@ sintn C_SCLString::cat_printf(const charn * const opcn_Format, ...) //lint !e196
    va_list pv_Args;
 
    va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   sn_Length = mh_GetRequiredPrintfSize(opcn_Format, pv_Args);
+   sn_Length = m_PrintToStackBuffer(opcn_Format, pv_Args, true);
    va_end(pv_Args);
 
-   va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   m_CatSNPrintf(sn_Length, opcn_Format, pv_Args);
-   va_end(pv_Args);
+   if (sn_Length >= static_cast<sintn>(mhun_PRINTF_STACK_BUFFER_SIZE))
+   {
+      //too long for the stack buffer: print again into buffer of the now known size
+      va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //using "..."
+      m_CatSNPrintf(sn_Length, opcn_Format, pv_Args);
+      va_end(pv_Args);
+   }
 
    return sn_Length;
 }
@@ -686,12 +870,16 @@ C_SCLString & C_SCLString::cat_sprintf(const charn * const opcn_Format, ...) //l
    sintn sn_Length;
 
    va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   sn_Length = mh_GetRequiredPrintfSize(opcn_Format, pv_Args);
+   sn_Length = m_PrintToStackBuffer(opcn_Format, pv_Args, true);
    va_end(pv_Args);
 
-   va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //effects of using "..."
-   m_CatSNPrintf(sn_Length, opcn_Format, pv_Args);
-   va_end(pv_Args);
+   if (sn_Length >= static_cast<sintn>(mhun_PRINTF_STACK_BUFFER_SIZE))
+   {
+      //too long for the stack buffer: print again into buffer of the now known size
+      va_start(pv_Args, opcn_Format); //lint !e970 !e1924 !e1773 !e925 !e928 !e1963 !e1960 !e826 //using "..."
+      m_CatSNPrintf(sn_Length, opcn_Format, pv_Args);
+      va_end(pv_Args);
+   }
 
    return (*this);
 }
@@ -767,6 +955,100 @@ C_SCLString & C_SCLString::SetLength(const uint32 ou32_NewLength)
    return (*this);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Append signed number to string
+
+   Append decimal representation of the number to the existing string.
+   Same result as "(*this) += IntToStr(os64_Value)" but without creating temporary strings.
+
+   \param[in]  os64_Value   value to append
+
+   \return
+   Resulting string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString & C_SCLString::AppendInt(const sint64 os64_Value)
+{
+   if (os64_Value < 0)
+   {
+      c_String.operator +=('-');
+      //calculate absolute value in unsigned arithmetic to cover the lowest possible value
+      (void)this->AppendUInt(0U - static_cast<uint64>(os64_Value));
+   }
+   else
+   {
+      (void)this->AppendUInt(static_cast<uint64>(os64_Value));
+   }
+   return (*this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Append unsigned number to string
+
+   Append decimal representation of the number to the existing string.
+   Same result as "(*this) += IntToStr(ou64_Value)" but without creating temporary strings.
+
+   \param[in]  ou64_Value   value to append
+
+   \return
+   Resulting string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString & C_SCLString::AppendUInt(const uint64 ou64_Value)
+{
+   charn acn_Digits[20]; //highest uint64 value has 20 digits
+   uintn un_Start = sizeof(acn_Digits);
+   uint64 u64_Value = ou64_Value;
+
+   do
+   {
+      un_Start--;
+      acn_Digits[un_Start] = static_cast<charn>('0' + static_cast<sintn>(u64_Value % 10U));
+      u64_Value /= 10U;
+   }
+   while (u64_Value != 0U);
+
+   (void)c_String.append(&acn_Digits[un_Start], sizeof(acn_Digits) - un_Start);
+   return (*this);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief    Append unsigned number as hexadecimal text to string
+
+   Append hexadecimal representation of the number to the existing string.
+   Same result as "(*this) += IntToHex(ou64_Value, ou32_Digits)" but without creating temporary strings.
+   Lower case characters are used; no "0x" prefix is added.
+
+   \param[in]  ou64_Value    value to append
+   \param[in]  ou32_Digits   minimum number of digits (zeroes will be filled in from the left)
+
+   \return
+   Resulting string
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString & C_SCLString::AppendHex(const uint64 ou64_Value, const uint32 ou32_Digits)
+{
+   static const charn hacn_HEX_DIGITS[] = "0123456789abcdef";
+   charn acn_Digits[16]; //highest uint64 value has 16 hex digits
+   uintn un_Start = sizeof(acn_Digits);
+   uint64 u64_Value = ou64_Value;
+
+   do
+   {
+      un_Start--;
+      acn_Digits[un_Start] = hacn_HEX_DIGITS[static_cast<uintn>(u64_Value & 0x0FU)];
+      u64_Value >>= 4U;
+   }
+   while (u64_Value != 0U);
+
+   if (ou32_Digits > (sizeof(acn_Digits) - un_Start))
+   {
+      (void)c_String.append(static_cast<uintn>(ou32_Digits - (sizeof(acn_Digits) - un_Start)), '0');
+   }
+   (void)c_String.append(&acn_Digits[un_Start], sizeof(acn_Digits) - un_Start);
+   return (*this);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Get first position of specified string in existing string
 
@@ -1392,10 +1674,7 @@ C_SCLString C_SCLString::IntToStr(const charn ocn_Value)
 {
    C_SCLString c_Text;
 
-   std::stringstream c_Stream;
-   //a "sint32" should be enough for a charn on all platforms
-   c_Stream << static_cast<sint32>(ocn_Value);
-   c_Text.c_String = c_Stream.str();
+   (void)c_Text.AppendInt(ocn_Value);
 
    return c_Text;
 }
@@ -1422,9 +1701,7 @@ C_SCLString C_SCLString::IntToHex(const uint8 ou8_Value, const uint32 ou32_Digit
 {
    C_SCLString c_Text;
 
-   std::stringstream c_Stream;
-   c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << static_cast<uint32>(ou8_Value);
-   c_Text.c_String = c_Stream.str();
+   (void)c_Text.AppendHex(ou8_Value, ou32_Digits);
 
    return c_Text;
 }
@@ -1451,9 +1728,8 @@ C_SCLString C_SCLString::IntToHex(const sint8 os8_Value, const uint32 ou32_Digit
 {
    C_SCLString c_Text;
 
-   std::stringstream c_Stream;
-   c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << static_cast<sint32>(os8_Value);
-   c_Text.c_String = c_Stream.str();
+   //negative values result in the two's complement of a sint32
+   (void)c_Text.AppendHex(static_cast<uint32>(static_cast<sint32>(os8_Value)), ou32_Digits);
 
    return c_Text;
 }
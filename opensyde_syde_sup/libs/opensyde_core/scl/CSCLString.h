@@ -85,7 +85,10 @@ private:
 
    std::string c_String; ///< actual string data wrapped by C_SCLString
 
-   static stw_types::sintn mh_GetRequiredPrintfSize(const stw_types::charn * const opcn_Format, va_list opv_Args);
+   static const stw_types::uintn mhun_PRINTF_STACK_BUFFER_SIZE = 256U;
+
+   stw_types::sintn m_PrintToStackBuffer(const stw_types::charn * const opcn_Format, va_list opv_Args,
+                                         const bool oq_Append);
    void m_SNPrintf(const stw_types::sintn osn_Size, const stw_types::charn * const opcn_Format, va_list opv_Args);
    void m_CatSNPrintf(const stw_types::sintn osn_Size, const stw_types::charn * const opcn_Format, va_list opv_Args);
 
@@ -114,8 +117,18 @@ public:
    C_SCLString(void);
    C_SCLString(const C_SCLString & orc_InitValue);
    C_SCLString(const stw_types::charn * const opcn_InitValue, const stw_types::uintn oun_Length);
+   C_SCLString(const stw_types::charn * const opcn_InitValue);
+   C_SCLString(stw_types::charn * const opcn_InitValue);
    C_SCLString(const stw_types::sint8 os8_InitValue);
    C_SCLString(const stw_types::uint8 ou8_InitValue);
+   C_SCLString(const stw_types::sint16 os16_InitValue);
+   C_SCLString(const stw_types::uint16 ou16_InitValue);
+   C_SCLString(const stw_types::sintn osn_InitValue);
+   C_SCLString(const stw_types::uintn oun_InitValue);
+   C_SCLString(const stw_types::sint32 os32_InitValue);
+   C_SCLString(const stw_types::uint32 ou32_InitValue);
+   C_SCLString(const stw_types::sint64 os64_InitValue);
+   C_SCLString(const stw_types::uint64 ou64_InitValue);
    C_SCLString(const stw_types::float64 of64_InitValue);
    C_SCLString(const wchar_t * const opwcn_InitValue);
    C_SCLString(wchar_t * const opwcn_InitValue);
@@ -150,6 +163,11 @@ public:
    C_SCLString & Delete(const stw_types::uint32 ou32_Index, const stw_types::uint32 ou32_Count);
    C_SCLString & SetLength(const stw_types::uint32 ou32_NewLength);
 
+   // Append numbers in place (no temporary string)
+   C_SCLString & AppendInt(const stw_types::sint64 os64_Value);
+   C_SCLString & AppendUInt(const stw_types::uint64 ou64_Value);
+   C_SCLString & AppendHex(const stw_types::uint64 ou64_Value, const stw_types::uint32 ou32_Digits);
+
    stw_types::uint32 Pos(const C_SCLString & orc_SubString) const;
    stw_types::uint32 LastPos(const C_SCLString & orc_SubString) const; //last position of string
    stw_types::uint32 LastDelimiter(const C_SCLString & orc_Delimiters) const;
@@ -187,7 +205,7 @@ public:
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief    Constructor
 
-   Covers all integer types.
+   Covers all types not handled by one of the dedicated constructors (e.g. charn, bool, float32).
 
    \param[in]  orc_Value    value to convert
 */
@@ -236,10 +254,10 @@ template <typename T> C_SCLString C_SCLString::IntToStr(const T orc_Value)
 template <typename T> C_SCLString C_SCLString::IntToHex(const T orc_Value, const stw_types::uint32 ou32_Digits)
 {
    C_SCLString c_Text;
+   //negative values are shown as two's complement in the size of T (same as std::hex does)
+   const stw_types::uint64 u64_Mask = (~static_cast<stw_types::uint64>(0U)) >> (64U - (sizeof(T) * 8U));
 
-   std::stringstream c_Stream;
-   c_Stream << &std::hex << std::setw(ou32_Digits) << std::setfill('0') << orc_Value;
-   c_Text.c_String = c_Stream.str();
+   (void)c_Text.AppendHex(static_cast<stw_types::uint64>(orc_Value) & u64_Mask, ou32_Digits);
 
    return c_Text;
 }
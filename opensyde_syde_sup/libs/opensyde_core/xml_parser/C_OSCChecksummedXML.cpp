@@ -11,6 +11,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h" //pre-compiled headers
+#include <cstring>
 #include "stwtypes.h"
 #include "stwerrors.h"
 #include "C_OSCChecksummedXML.h"
@@ -25,11 +26,12 @@ using namespace stw_scl;
 using namespace stw_opensyde_core;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
-static const C_SCLString mc_NAME_CRC_ATTRIBUTE = "file_crc";
 
 /* -- Types --------------------------------------------------------------------------------------------------------- */
 
 /* -- Global Variables ---------------------------------------------------------------------------------------------- */
+const uint16 C_OSCChecksummedXML::hu16_CRC_START_VALUE = 0x1D0FU; //CCITT25 start value
+const charn * const C_OSCChecksummedXML::hpcn_CRC_ATTRIBUTE_NAME = "file_crc";
 
 /* -- Module Global Variables --------------------------------------------------------------------------------------- */
 
@@ -44,8 +46,7 @@ static const C_SCLString mc_NAME_CRC_ATTRIBUTE = "file_crc";
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCChecksummedXML::C_OSCChecksummedXML(void) :
-   C_OSCXMLParser(),
-   mu16_CRCDepth(0U)
+   C_OSCXMLParser()
 {
 }
 
@@ -56,7 +57,7 @@ C_OSCChecksummedXML::C_OSCChecksummedXML(void) :
    If the file could not be opened the function will return an error and prepare an empty XML structure.
    After the data was opened the function will check the CRC
 
-   The checksum value is expected in the attribute "c_NAME_CRC_ATTRIBUTE" of the root name.
+   The checksum value is expected in the attribute "hpcn_CRC_ATTRIBUTE_NAME" of the root name.
 
    \param[in]   orc_FileName   path to XML file to open
 
@@ -84,13 +85,13 @@ sint32 C_OSCChecksummedXML::LoadFromFile(const C_SCLString & orc_FileName)
       }
       else
       {
-         if (this->AttributeExists(mc_NAME_CRC_ATTRIBUTE) == false)
+         if (this->AttributeExists(hpcn_CRC_ATTRIBUTE_NAME) == false)
          {
             s32_Return = C_RD_WR;
          }
          else
          {
-            u16_CRCFromFile = static_cast<uint16>(this->GetAttributeUint32(mc_NAME_CRC_ATTRIBUTE));
+            u16_CRCFromFile = static_cast<uint16>(this->GetAttributeUint32(hpcn_CRC_ATTRIBUTE_NAME));
             u16_CRCCalc = this->m_CalcXMLCRC();
 
             this->SelectRoot(); //be defensive: set defined start state
@@ -106,7 +107,7 @@ sint32 C_OSCChecksummedXML::LoadFromFile(const C_SCLString & orc_FileName)
 /*! \brief  Write XML data to file
 
    Update CRC and write data to file.
-   After calculation the checksum value is written to the attribute "c_NAME_CRC_ATTRIBUTE" of the root name.
+   After calculation the checksum value is written to the attribute "hpcn_CRC_ATTRIBUTE_NAME" of the root name.
    A pre-existing file will be replaced.
 
    Will set the active node to "root".
@@ -129,7 +130,7 @@ sint32 C_OSCChecksummedXML::SaveToFile(const C_SCLString & orc_FileName)
    }
    else
    {
-      this->SetAttributeString(mc_NAME_CRC_ATTRIBUTE, "0x" + C_SCLString::IntToHex(u16_CRCCalc, 4));
+      this->SetAttributeString(hpcn_CRC_ATTRIBUTE_NAME, "0x" + C_SCLString::IntToHex(u16_CRCCalc, 4));
 
       s32_Return = C_OSCXMLParser::SaveToFile(orc_FileName);
    }
@@ -137,73 +138,110 @@ sint32 C_OSCChecksummedXML::SaveToFile(const C_SCLString & orc_FileName)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add CRC over text
 
-void C_OSCChecksummedXML::m_CalcXMLCRCNode(uint16 & oru16_CRC)
-{
-   std::vector<C_OSCXMLAttribute> c_Attributes;
-   C_SCLString c_NodeLv1;
-   C_SCLString c_Text;
-   c_NodeLv1 = this->SelectNodeChild();
+   Feeds the text directly from the document's buffer (no temporary string copies).
 
-   mu16_CRCDepth++;
-   C_SCLChecksums::CalcCRC16(&mu16_CRCDepth, 2U, oru16_CRC);
-   while (c_NodeLv1 != "")
+   \param[in]      opcn_Text   zero-terminated text (NULL is treated as empty text)
+   \param[in,out]  oru16_CRC   CRC to update
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCChecksummedXML::mh_CalcCRCText(const charn * const opcn_Text, uint16 & oru16_CRC)
+{
+   if (opcn_Text != NULL)
    {
-      C_SCLChecksums::CalcCRC16(c_NodeLv1.c_str(), c_NodeLv1.Length(), oru16_CRC);
-      c_Attributes = this->GetAttributes();
-      for (uint32 u32_Index = 0U; u32_Index < c_Attributes.size(); u32_Index++)
-      {
-         C_SCLChecksums::CalcCRC16(c_Attributes[u32_Index].c_Name.c_str(),
-                                   c_Attributes[u32_Index].c_Name.Length(), oru16_CRC);
-         C_SCLChecksums::CalcCRC16(c_Attributes[u32_Index].c_Value.c_str(),
-                                   c_Attributes[u32_Index].c_Value.Length(), oru16_CRC);
-      }
-      c_Text = this->GetNodeContent();
-      C_SCLChecksums::CalcCRC16(c_Text.c_str(), c_Text.Length(), oru16_CRC);
+      C_SCLChecksums::CalcCRC16(opcn_Text, static_cast<uint32>(std::strlen(opcn_Text)), oru16_CRC);
+   }
+}
 
-      //sub-nodes ?
-      m_CalcXMLCRCNode(oru16_CRC);
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add CRC over the element itself (without its child elements)
+
+   Covers the name, the attributes and the text of the element and then advances the absolute node index.
+   For the root element the CRC attribute is skipped and the node index is (re)started.
+
+   As only the element and its first child (for the text) are evaluated this can also be used by stream based
+   parsers which only hold part of the document.
 
-      c_NodeLv1 = this->SelectNodeNext();
-      if (c_NodeLv1 == "")
+   \param[in]      orc_Element   element to process
+   \param[in]      oq_IsRoot     true: element is the document's root element
+   \param[in,out]  oru16_Depth   absolute node index (the same variable must be used for all elements of a document)
+   \param[in,out]  oru16_CRC     CRC to update
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCChecksummedXML::h_CalcCRCElementStart(const tinyxml2::XMLElement & orc_Element, const bool oq_IsRoot,
+                                                uint16 & oru16_Depth, uint16 & oru16_CRC)
+{
+   const tinyxml2::XMLAttribute * pc_Attribute = orc_Element.FirstAttribute();
+
+   mh_CalcCRCText(orc_Element.Name(), oru16_CRC);
+   while (pc_Attribute != NULL)
+   {
+      //skip CRC value
+      if ((oq_IsRoot == false) || (std::strcmp(pc_Attribute->Name(), hpcn_CRC_ATTRIBUTE_NAME) != 0))
       {
-         //go back to parent, we are finished here ...
-         this->SelectNodeParent();
+         mh_CalcCRCText(pc_Attribute->Name(), oru16_CRC);
+         mh_CalcCRCText(pc_Attribute->Value(), oru16_CRC);
       }
+      pc_Attribute = pc_Attribute->Next();
    }
+   mh_CalcCRCText(orc_Element.GetText(), oru16_CRC);
+
+   if (oq_IsRoot == true)
+   {
+      oru16_Depth = 1U;
+      C_SCLChecksums::CalcCRC16(&oru16_Depth, 2U, oru16_CRC);
+   }
+
+   //sub-nodes:
+   oru16_Depth++;
+   C_SCLChecksums::CalcCRC16(&oru16_Depth, 2U, oru16_CRC);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add CRC over a (non-root) element including all its child elements
 
-uint16 C_OSCChecksummedXML::m_CalcXMLCRC(void)
+   Walks the tinyxml2 tree directly.
+   The sequence of CRC updates is the same as it was when navigating with SelectNodeChild/SelectNodeNext.
+
+   \param[in]      orc_Element   element to process
+   \param[in,out]  oru16_Depth   absolute node index (the same variable must be used for all elements of a document)
+   \param[in,out]  oru16_CRC     CRC to update
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCChecksummedXML::h_CalcCRCElement(const tinyxml2::XMLElement & orc_Element, uint16 & oru16_Depth,
+                                           uint16 & oru16_CRC)
 {
-   std::vector<C_OSCXMLAttribute> c_Attributes;
-   C_SCLString c_Text;
-   uint16 u16_CRC = 0x1D0FU; //set CCITT25 start value
+   const tinyxml2::XMLElement * pc_Node = orc_Element.FirstChildElement();
 
-   c_Text = this->SelectRoot();
+   h_CalcCRCElementStart(orc_Element, false, oru16_Depth, oru16_CRC);
+   while (pc_Node != NULL)
+   {
+      h_CalcCRCElement(*pc_Node, oru16_Depth, oru16_CRC);
+      pc_Node = pc_Node->NextSiblingElement();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+uint16 C_OSCChecksummedXML::m_CalcXMLCRC(void) const
+{
+   uint16 u16_CRC = hu16_CRC_START_VALUE;
+   const tinyxml2::XMLElement * const pc_Root = this->mc_Document.RootElement();
 
-   C_SCLChecksums::CalcCRC16(c_Text.c_str(), c_Text.Length(), u16_CRC);
-   c_Attributes = this->GetAttributes();
-   for (uint32 u32_Index = 0U; u32_Index < c_Attributes.size(); u32_Index++)
+   if (pc_Root != NULL)
    {
-      if (c_Attributes[u32_Index].c_Name != mc_NAME_CRC_ATTRIBUTE) //skip CRC value
+      uint16 u16_Depth = 0U;
+      const tinyxml2::XMLElement * pc_Node = pc_Root->FirstChildElement();
+
+      h_CalcCRCElementStart(*pc_Root, true, u16_Depth, u16_CRC);
+      while (pc_Node != NULL)
       {
-         C_SCLChecksums::CalcCRC16(c_Attributes[u32_Index].c_Name.c_str(),
-                                   c_Attributes[u32_Index].c_Name.Length(), u16_CRC);
-         C_SCLChecksums::CalcCRC16(c_Attributes[u32_Index].c_Value.c_str(),
-                                   c_Attributes[u32_Index].c_Value.Length(), u16_CRC);
+         h_CalcCRCElement(*pc_Node, u16_Depth, u16_CRC);
+         pc_Node = pc_Node->NextSiblingElement();
       }
    }
 
-   mu16_CRCDepth = 1U;
-   c_Text = this->GetNodeContent();
-   C_SCLChecksums::CalcCRC16(c_Text.c_str(), c_Text.Length(), u16_CRC);
-   C_SCLChecksums::CalcCRC16(&mu16_CRCDepth, 2U, u16_CRC);
-
-   //subnodes:
-   m_CalcXMLCRCNode(u16_CRC);
-
    return u16_CRC;
 }
 
@@ -12,6 +12,7 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h" //pre-compiled headers
 
+#include <cstring>
 #include <fstream>
 #include "stwtypes.h"
 #include "stwerrors.h"
@@ -287,6 +288,102 @@ C_SCLString C_OSCXMLParserBase::SelectNodeParent(void)
    return c_Name;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select next node with name as active element
+
+   Select the next node with the specified name on the same level as the current node as active element.
+   Other than SelectNodeNext no strings are created, so this is the preferred function for parsing loops.
+
+   \param[in]  opcn_Name   name of node to select
+
+   \return
+   true    node found and selected
+   false   no such node; selection not changed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::TrySelectNodeNext(const charn * const opcn_Name)
+{
+   bool q_Return = false;
+
+   if (mpc_CurrentNode != NULL)
+   {
+      tinyxml2::XMLElement * const pc_Element = mpc_CurrentNode->NextSiblingElement(opcn_Name);
+      if (pc_Element != NULL)
+      {
+         mpc_CurrentNode = pc_Element;
+         q_Return = true;
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select child node with name as active element
+
+   Select the first child node with the specified name of the current node as active element.
+   Other than SelectNodeChild no strings are created.
+
+   \param[in]  opcn_Name   name of node to select
+
+   \return
+   true    node found and selected
+   false   no such node; selection not changed
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::TrySelectNodeChild(const charn * const opcn_Name)
+{
+   bool q_Return = false;
+   tinyxml2::XMLElement * pc_Element;
+
+   if (mpc_CurrentNode != NULL)
+   {
+      pc_Element = mpc_CurrentNode;
+   }
+   else
+   {
+      pc_Element = mc_Document.RootElement();
+   }
+
+   if (pc_Element != NULL)
+   {
+      pc_Element = pc_Element->FirstChildElement(opcn_Name);
+      if (pc_Element != NULL)
+      {
+         mpc_CurrentNode = pc_Element;
+         q_Return = true;
+      }
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Select parent of active node as active element and check its name
+
+   Select the parent node of the current node as active element.
+   Other than SelectNodeParent no strings are created.
+
+   \param[in]  opcn_ExpectedName   expected name of parent node
+
+   \return
+   true    parent node selected and has the expected name
+   false   no parent node or parent node with other name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::TrySelectNodeParent(const charn * const opcn_ExpectedName)
+{
+   bool q_Return = false;
+
+   if (mpc_CurrentNode != NULL)
+   {
+      mpc_CurrentNode = mpc_CurrentNode->Parent()->ToElement();
+   }
+   if ((mpc_CurrentNode != NULL) && (opcn_ExpectedName != NULL))
+   {
+      q_Return = (std::strcmp(mpc_CurrentNode->Name(), opcn_ExpectedName) == 0);
+   }
+   return q_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get content of selected node
 
@@ -328,12 +425,29 @@ C_SCLString C_OSCXMLParserBase::GetNodeContent(void) const
 */
 //----------------------------------------------------------------------------------------------------------------------
 bool C_OSCXMLParserBase::AttributeExists(const C_SCLString & orc_Name) const
+{
+   return this->AttributeExists(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check whether specified attribute exists
+
+   Check whether the specified attribute exists in the current element.
+
+   \param[in]   opcn_Name   name of attribute to check for
+
+   \return
+   true   attribute exists
+   false  attribute does not exists (or: no element selected)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::AttributeExists(const charn * const opcn_Name) const
 {
    bool q_Return = false;
 
    if (mpc_CurrentNode != NULL)
    {
-      const charn * const pcn_Text = mpc_CurrentNode->Attribute(orc_Name.c_str());
+      const charn * const pcn_Text = mpc_CurrentNode->Attribute(opcn_Name);
       if (pcn_Text != NULL)
       {
          q_Return = true;
@@ -354,12 +468,28 @@ bool C_OSCXMLParserBase::AttributeExists(const C_SCLString & orc_Name) const
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_SCLString C_OSCXMLParserBase::GetAttributeString(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeString(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as string.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   Content of selected attribute ("" on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCXMLParserBase::GetAttributeString(const charn * const opcn_Name) const
 {
    C_SCLString c_Value;
 
    if (mpc_CurrentNode != NULL)
    {
-      const charn * const pcn_Text = mpc_CurrentNode->Attribute(orc_Name.c_str());
+      const charn * const pcn_Text = mpc_CurrentNode->Attribute(opcn_Name);
       if (pcn_Text != NULL)
       {
          c_Value = pcn_Text;
@@ -382,22 +512,35 @@ C_SCLString C_OSCXMLParserBase::GetAttributeString(const C_SCLString & orc_Name)
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCXMLParserBase::GetAttributeSint32(const C_SCLString & orc_Name) const
 {
-   sintn sn_Value = 0;
-   C_SCLString c_Text;
+   return this->GetAttributeSint32(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as sint32 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLParserBase::GetAttributeSint32(const charn * const opcn_Name) const
+{
+   sint32 s32_Value = 0;
 
    //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
+   if (mpc_CurrentNode != NULL)
    {
-      try
-      {
-         sn_Value = static_cast<sintn>(c_Text.ToInt());
-      }
-      catch (...)
+      uint64 u64_Value;
+      if (mh_ParseInteger(mpc_CurrentNode->Attribute(opcn_Name), u64_Value) == true)
       {
+         s32_Value = static_cast<sint32>(static_cast<uint32>(u64_Value));
       }
    }
-   return sn_Value;
+   return s32_Value;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -414,22 +557,35 @@ sint32 C_OSCXMLParserBase::GetAttributeSint32(const C_SCLString & orc_Name) cons
 //----------------------------------------------------------------------------------------------------------------------
 uint32 C_OSCXMLParserBase::GetAttributeUint32(const C_SCLString & orc_Name) const
 {
-   uintn un_Value = 0;
-   C_SCLString c_Text;
+   return this->GetAttributeUint32(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as uint32 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCXMLParserBase::GetAttributeUint32(const charn * const opcn_Name) const
+{
+   uint32 u32_Value = 0U;
 
    //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
+   if (mpc_CurrentNode != NULL)
    {
-      try
-      {
-         un_Value = static_cast<uintn>(c_Text.ToInt());
-      }
-      catch (...)
+      uint64 u64_Value;
+      if (mh_ParseInteger(mpc_CurrentNode->Attribute(opcn_Name), u64_Value) == true)
       {
+         u32_Value = static_cast<uint32>(u64_Value);
       }
    }
-   return un_Value;
+   return u32_Value;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -445,20 +601,33 @@ uint32 C_OSCXMLParserBase::GetAttributeUint32(const C_SCLString & orc_Name) cons
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint64 C_OSCXMLParserBase::GetAttributeSint64(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeSint64(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as sint64 value.
+   Can handle "0x" notation to interpret hex values.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (zero on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint64 C_OSCXMLParserBase::GetAttributeSint64(const charn * const opcn_Name) const
 {
    sint64 s64_Value = 0;
-   C_SCLString c_Text;
 
    //do not use XMLElement::Query function: it can not handle hexadecimal values with "0x"
-   c_Text = this->GetAttributeString(orc_Name);
-   if (c_Text != "")
+   if (mpc_CurrentNode != NULL)
    {
-      try
-      {
-         s64_Value = c_Text.ToInt64();
-      }
-      catch (...)
+      uint64 u64_Value;
+      if (mh_ParseInteger(mpc_CurrentNode->Attribute(opcn_Name), u64_Value) == true)
       {
+         s64_Value = static_cast<sint64>(u64_Value);
       }
    }
    return s64_Value;
@@ -477,12 +646,29 @@ sint64 C_OSCXMLParserBase::GetAttributeSint64(const C_SCLString & orc_Name) cons
 */
 //----------------------------------------------------------------------------------------------------------------------
 bool C_OSCXMLParserBase::GetAttributeBool(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeBool(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as bool value.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   true   attribute value is "1"
+   false  attribute value is "0" (also returned on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::GetAttributeBool(const charn * const opcn_Name) const
 {
    bool q_Value = false;
 
    if (mpc_CurrentNode != NULL)
    {
-      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryBoolAttribute(orc_Name.c_str(), &q_Value);
+      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryBoolAttribute(opcn_Name, &q_Value);
       if (e_Error != tinyxml2::XML_SUCCESS)
       {
          q_Value = false;
@@ -503,12 +689,28 @@ bool C_OSCXMLParserBase::GetAttributeBool(const C_SCLString & orc_Name) const
 */
 //----------------------------------------------------------------------------------------------------------------------
 float32 C_OSCXMLParserBase::GetAttributeFloat32(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeFloat32(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as float32 value.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (0.0F on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float32 C_OSCXMLParserBase::GetAttributeFloat32(const charn * const opcn_Name) const
 {
    float32 f32_Value = 0.0F;
 
    if (mpc_CurrentNode != NULL)
    {
-      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryFloatAttribute(orc_Name.c_str(), &f32_Value);
+      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryFloatAttribute(opcn_Name, &f32_Value);
       if (e_Error != tinyxml2::XML_SUCCESS)
       {
          f32_Value = 0.0F;
@@ -529,12 +731,28 @@ float32 C_OSCXMLParserBase::GetAttributeFloat32(const C_SCLString & orc_Name) co
 */
 //----------------------------------------------------------------------------------------------------------------------
 float64 C_OSCXMLParserBase::GetAttributeFloat64(const C_SCLString & orc_Name) const
+{
+   return this->GetAttributeFloat64(orc_Name.c_str());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get attribute value of selected node
+
+   Return one attribute value of selected node as float64 value.
+
+   \param[in]  opcn_Name   name of attribute
+
+   \return
+   value (0.0 on error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+float64 C_OSCXMLParserBase::GetAttributeFloat64(const charn * const opcn_Name) const
 {
    float64 f64_Value = 0.0;
 
    if (mpc_CurrentNode != NULL)
    {
-      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryDoubleAttribute(orc_Name.c_str(), &f64_Value);
+      const tinyxml2::XMLError e_Error = mpc_CurrentNode->QueryDoubleAttribute(opcn_Name, &f64_Value);
       if (e_Error != tinyxml2::XML_SUCCESS)
       {
          f64_Value = 0.0;
@@ -635,6 +853,37 @@ C_SCLString C_OSCXMLParserBase::CreateAndSelectNodeChild(const C_SCLString & orc
    return c_Name;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Create a copy of a node of another document under the currently selected node.
+
+   Add a deep copy of the node currently selected in orc_Source (including attributes, text and all child nodes)
+   under the currently selected node.
+   The current selection will not be changed.
+   If no node is currently selected the new node will be added at the end of the document.
+   If no node is selected in orc_Source nothing is added.
+
+   \param[in]  orc_Source   document to copy the selected node from
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLParserBase::CreateNodeChildCopy(const C_OSCXMLParserBase & orc_Source)
+{
+   if (orc_Source.mpc_CurrentNode != NULL)
+   {
+      tinyxml2::XMLNode * const pc_Node = mh_CloneNode(*orc_Source.mpc_CurrentNode, mc_Document);
+      if (pc_Node != NULL)
+      {
+         if (mpc_CurrentNode != NULL)
+         {
+            mpc_CurrentNode->InsertEndChild(pc_Node);
+         }
+         else
+         {
+            mc_Document.InsertEndChild(pc_Node);
+         }
+      }
+   }
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Delete the current node.
 
@@ -854,3 +1103,121 @@ void C_OSCXMLParserString::SaveToString(C_SCLString & orc_String) const
    this->mc_Document.Print(&c_Printer);
    orc_String = static_cast<C_SCLString>(c_Printer.CStr());
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Create deep copy of node
+
+   tinyxml2 only provides shallow copies.
+   So copy the node and then recursively all of its children.
+
+   \param[in]      orc_Node       node to copy (can be part of another document)
+   \param[in,out]  orc_Document   document to create the copy in
+
+   \return
+   created copy (not yet linked into orc_Document); NULL if the node cannot be copied (e.g. it is a document)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+tinyxml2::XMLNode * C_OSCXMLParserBase::mh_CloneNode(const tinyxml2::XMLNode & orc_Node,
+                                                     tinyxml2::XMLDocument & orc_Document)
+{
+   tinyxml2::XMLNode * const pc_Copy = orc_Node.ShallowClone(&orc_Document);
+
+   if (pc_Copy != NULL)
+   {
+      const tinyxml2::XMLNode * pc_Child = orc_Node.FirstChild();
+      while (pc_Child != NULL)
+      {
+         tinyxml2::XMLNode * const pc_ChildCopy = mh_CloneNode(*pc_Child, orc_Document);
+         if (pc_ChildCopy != NULL)
+         {
+            pc_Copy->InsertEndChild(pc_ChildCopy);
+         }
+         pc_Child = pc_Child->NextSibling();
+      }
+   }
+   return pc_Copy;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Parse integer value from text
+
+   Accepted formats (same as C_SCLString::ToInt):
+   - decimal positive value
+   - decimal negative value
+   - hexadecimal value ("0x..."); the "x" and a..f can be upper or lower case
+   - hexadecimal negative value ("-0x..."); the "x" and a..f can be upper or lower case
+
+   Works directly on the text, so no temporary string is needed.
+   Values out of range are truncated in the same way as by C_SCLString::ToInt.
+
+   \param[in]   opcn_Text      text to parse (NULL is handled as error)
+   \param[out]  oru64_Value    parsed value (two's complement for negative values)
+
+   \return
+   true    text is a valid integer
+   false   text is empty or not an integer
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLParserBase::mh_ParseInteger(const charn * const opcn_Text, uint64 & oru64_Value)
+{
+   bool q_Return = false;
+
+   oru64_Value = 0U;
+   if (opcn_Text != NULL)
+   {
+      const charn * pcn_Act = opcn_Text;
+      bool q_Negative = false;
+      bool q_Hex = false;
+
+      if (*pcn_Act == '-')
+      {
+         q_Negative = true;
+         pcn_Act++;
+      }
+      if ((pcn_Act[0] == '0') && ((pcn_Act[1] == 'x') || (pcn_Act[1] == 'X')) && (pcn_Act[2] != '\0'))
+      {
+         q_Hex = true;
+         pcn_Act += 2;
+      }
+
+      q_Return = (*pcn_Act != '\0');
+      while ((*pcn_Act != '\0') && (q_Return == true))
+      {
+         const charn cn_Char = *pcn_Act;
+         uint64 u64_Digit = 0U;
+
+         if ((cn_Char >= '0') && (cn_Char <= '9'))
+         {
+            u64_Digit = static_cast<uint64>(cn_Char - '0');
+         }
+         else if ((q_Hex == true) && (cn_Char >= 'a') && (cn_Char <= 'f'))
+         {
+            u64_Digit = static_cast<uint64>(cn_Char - 'a') + 10U;
+         }
+         else if ((q_Hex == true) && (cn_Char >= 'A') && (cn_Char <= 'F'))
+         {
+            u64_Digit = static_cast<uint64>(cn_Char - 'A') + 10U;
+         }
+         else
+         {
+            q_Return = false;
+         }
+         oru64_Value = (oru64_Value * ((q_Hex == true) ? 16U : 10U)) + u64_Digit;
+         pcn_Act++;
+      }
+
+      if (q_Return == false)
+      {
+         oru64_Value = 0U;
+      }
+      else if (q_Negative == true)
+      {
+         oru64_Value = 0U - oru64_Value;
+      }
+      else
+      {
+         //nothing to do
+      }
+   }
+   return q_Return;
+}
@@ -46,12 +46,14 @@ private:
    C_OSCXMLParserBase(const C_OSCXMLParserBase & orc_Souce);               ///< not implemented: prevent copying
    C_OSCXMLParserBase & operator = (const C_OSCXMLParserBase & orc_Souce); ///< not implemented: prevent assignment
 
-   tinyxml2::XMLElement * mpc_CurrentNode;
+   static bool mh_ParseInteger(const stw_types::charn * const opcn_Text, stw_types::uint64 & oru64_Value);
 
 protected:
    tinyxml2::XMLDocument mc_Document;
+   tinyxml2::XMLElement * mpc_CurrentNode;
 
    void m_Init(void);
+   static tinyxml2::XMLNode * mh_CloneNode(const tinyxml2::XMLNode & orc_Node, tinyxml2::XMLDocument & orc_Document);
 
 public:
    // set up class
@@ -69,11 +71,18 @@ public:
    // select parent node of current node                         (go up)
    stw_scl::C_SCLString SelectNodeParent(void);
 
+   // node navigation without string copies - returns true if a node with the name is selected
+   bool TrySelectNodeNext(const stw_types::charn * const opcn_Name);
+   bool TrySelectNodeChild(const stw_types::charn * const opcn_Name);
+   bool TrySelectNodeParent(const stw_types::charn * const opcn_ExpectedName);
+
    //append new child node under the current node with content
    // if the document is still empty this will create the root node
    void CreateNodeChild(const stw_scl::C_SCLString & orc_Name, const stw_scl::C_SCLString & orc_Content = "");
    //append new child node under the current node and select it; returns new child node name
    stw_scl::C_SCLString CreateAndSelectNodeChild(const stw_scl::C_SCLString & orc_Name);
+   //append copy of the current node of another document (including all children) under the current node
+   void CreateNodeChildCopy(const C_OSCXMLParserBase & orc_Source);
    // delete current node
    stw_scl::C_SCLString DeleteNode(void);
 
@@ -83,6 +92,7 @@ public:
 
    // node attribute operations
    bool AttributeExists(const stw_scl::C_SCLString & orc_Name) const;
+   bool AttributeExists(const stw_types::charn * const opcn_Name) const;
 
    stw_scl::C_SCLString GetCurrentNodeName(void) const
    {
@@ -107,6 +117,15 @@ public:
    stw_types::float32 GetAttributeFloat32(const stw_scl::C_SCLString & orc_Name) const;
    stw_types::float64 GetAttributeFloat64(const stw_scl::C_SCLString & orc_Name) const;
 
+   // get attribute values without temporary strings for the name (e.g. for string literals)
+   stw_scl::C_SCLString GetAttributeString(const stw_types::charn * const opcn_Name) const;
+   stw_types::sint32 GetAttributeSint32(const stw_types::charn * const opcn_Name) const;
+   stw_types::uint32 GetAttributeUint32(const stw_types::charn * const opcn_Name) const;
+   stw_types::sint64 GetAttributeSint64(const stw_types::charn * const opcn_Name) const;
+   bool GetAttributeBool(const stw_types::charn * const opcn_Name) const;
+   stw_types::float32 GetAttributeFloat32(const stw_types::charn * const opcn_Name) const;
+   stw_types::float64 GetAttributeFloat64(const stw_types::charn * const opcn_Name) const;
+
    // get all attributes
    std::vector<C_OSCXMLAttribute> GetAttributes(void) const;
 };
@@ -0,0 +1,818 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Read XML file piece by piece
+
+   Reads an XML file without building the DOM of the complete file.
+   Only the elements on the path from the root to the current level (start tags and text) plus the child nodes read
+   with ReadNextNode are held in the document. So the memory needed is defined by the size of the largest element
+   read at once, not by the size of the file.
+   Memory limit: the read nodes are held as text and are parsed again (with the entered levels) on each read, so
+   while reading about three times the size of the held nodes is needed (text, copy for parsing, DOM).
+   Call DiscardReadNodes as soon as possible to keep this small.
+
+   The navigation and attribute functions of C_OSCXMLParserBase can be used on the held document.
+   Changes to that document are lost with the next Read/Enter/Leave call.
+   After a read error all further read calls fail.
+
+   While reading the CRC as defined by C_OSCChecksummedXML is calculated on the fly (also for skipped parts).
+   So the result is the same as loading the file into a C_OSCChecksummedXML.
+
+   Limitation compared to loading the complete file: content after the end of the root element is not checked.
+
+   Typical use:
+   * Open: selects the root node
+   * GetNextNodeName: check what comes next on the current level
+   * ReadNextNode: read complete next node (and select it); use DiscardReadNodes to free nodes that are no longer
+     needed
+   * EnterNextNode / LeaveNode: go down/up one level without reading the complete node
+   * ReadToEnd: skip the rest of the file and get the calculated CRC
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstring>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "C_OSCXMLStreamReader.h"
+#include "C_OSCChecksummedXML.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const charn mcn_COMMENT_START[] = "<!--";
+static const charn mcn_CDATA_START[] = "<![CDATA[";
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+const uintn C_OSCXMLStreamReader::mhun_READ_BUFFER_SIZE = 65536U;
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStreamReader::C_OSCXMLStreamReader(void) :
+   C_OSCXMLParserBase(),
+   mpc_File(NULL),
+   mun_ReadPos(0U),
+   mun_ReadSize(0U),
+   me_NextTagType(eEND_OF_FILE),
+   mu16_CRC(C_OSCChecksummedXML::hu16_CRC_START_VALUE),
+   mu16_CRCDepth(0U),
+   mq_Failed(true)
+{
+   this->mc_Document.Clear();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+
+   Closes the file.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStreamReader::~C_OSCXMLStreamReader(void)
+{
+   this->Close();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Open file and read root start tag
+
+   On success the root node is selected. Its attributes and text can be accessed.
+   A previously opened file is closed first.
+
+   \param[in]   orc_FileName   path to XML file to open
+
+   \return
+   C_NO_ERR   file opened; root node selected
+   C_NOACT    could not open file or no valid root element found
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::Open(const C_SCLString & orc_FileName)
+{
+   sint32 s32_Return = C_NOACT;
+
+   this->Close();
+   this->mpc_File = std::fopen(orc_FileName.c_str(), "rb");
+   if (this->mpc_File != NULL)
+   {
+      this->mc_ReadBuffer.resize(mhun_READ_BUFFER_SIZE);
+      this->mu16_CRC = C_OSCChecksummedXML::hu16_CRC_START_VALUE;
+      this->mu16_CRCDepth = 0U;
+      this->mq_Failed = false;
+
+      //skip declaration and comments in front of the root element
+      s32_Return = this->m_ReadNextTag(NULL);
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = this->EnterNextNode();
+      }
+      if (s32_Return != C_NO_ERR)
+      {
+         s32_Return = C_NOACT;
+         this->Close();
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Close file
+
+   Also clears the document.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamReader::Close(void)
+{
+   if (this->mpc_File != NULL)
+   {
+      (void)std::fclose(this->mpc_File);
+      this->mpc_File = NULL;
+   }
+   this->mun_ReadPos = 0U;
+   this->mun_ReadSize = 0U;
+   this->mc_Levels.clear();
+   this->mc_NextTag.clear();
+   this->me_NextTagType = eEND_OF_FILE;
+   this->mc_Document.Clear();
+   this->mpc_CurrentNode = NULL;
+   this->mq_Failed = true;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get name of next child node of the current level
+
+   \return
+   name of next node ("" if there are no more child nodes on the current level)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SCLString C_OSCXMLStreamReader::GetNextNodeName(void) const
+{
+   C_SCLString c_Name;
+
+   if ((this->me_NextTagType == eSTART_TAG) || (this->me_NextTagType == eEMPTY_TAG))
+   {
+      std::string c_TagName;
+      mh_GetTagName(this->mc_NextTag, c_TagName);
+      c_Name = c_TagName.c_str();
+   }
+   return c_Name;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read next child node of the current level completely
+
+   The node is added under the current level's node (after nodes read before) and selected.
+
+   \return
+   C_NO_ERR   node read and selected
+   C_RANGE    no more child nodes on the current level
+   C_NOACT    could not read node (invalid XML or read error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::ReadNextNode(void)
+{
+   sint32 s32_Return = C_RANGE;
+
+   if (this->mq_Failed == true)
+   {
+      s32_Return = C_NOACT;
+   }
+   else if ((this->mc_Levels.size() > 0) &&
+            ((this->me_NextTagType == eSTART_TAG) || (this->me_NextTagType == eEMPTY_TAG)))
+   {
+      C_Level & rc_Level = this->mc_Levels.back();
+      uint32 u32_Depth = (this->me_NextTagType == eSTART_TAG) ? 1U : 0U;
+
+      s32_Return = C_NO_ERR;
+      rc_Level.c_Children += this->mc_NextTag;
+      while ((u32_Depth > 0U) && (s32_Return == C_NO_ERR))
+      {
+         E_ItemType e_Type;
+         s32_Return = this->m_ReadItem(this->mc_Item, e_Type);
+         if (s32_Return == C_NO_ERR)
+         {
+            switch (e_Type)
+            {
+            case eSTART_TAG:
+               u32_Depth++;
+               break;
+            case eEND_TAG:
+               u32_Depth--;
+               break;
+            case eEND_OF_FILE:
+               s32_Return = C_NOACT;
+               break;
+            default:
+               break;
+            }
+            rc_Level.c_Children += this->mc_Item;
+         }
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         s32_Return = this->m_ParseLevels();
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         tinyxml2::XMLElement * const pc_Level = this->m_GetCurrentLevelElement();
+         tinyxml2::XMLElement * const pc_Node = (pc_Level != NULL) ? pc_Level->LastChildElement() : NULL;
+         if (pc_Node != NULL)
+         {
+            C_OSCChecksummedXML::h_CalcCRCElement(*pc_Node, this->mu16_CRCDepth, this->mu16_CRC);
+            this->mpc_CurrentNode = pc_Node;
+            s32_Return = this->m_ReadNextTag(NULL);
+         }
+         else
+         {
+            s32_Return = C_NOACT;
+         }
+      }
+   }
+   else
+   {
+      //no more nodes on this level
+   }
+   this->mq_Failed = (s32_Return == C_NOACT);
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Enter next child node of the current level
+
+   Only the start tag and the text of the node are read.
+   The node becomes the new current level and is selected.
+
+   \return
+   C_NO_ERR   node entered and selected
+   C_RANGE    no more child nodes on the current level
+   C_NOACT    could not read node (invalid XML or read error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::EnterNextNode(void)
+{
+   sint32 s32_Return = C_RANGE;
+
+   if (this->mq_Failed == true)
+   {
+      s32_Return = C_NOACT;
+   }
+   else if ((this->me_NextTagType == eSTART_TAG) || (this->me_NextTagType == eEMPTY_TAG))
+   {
+      C_Level c_Level;
+
+      s32_Return = C_NO_ERR;
+      mh_GetTagName(this->mc_NextTag, c_Level.c_Name);
+      c_Level.c_Header = this->mc_NextTag;
+      if (this->me_NextTagType == eEMPTY_TAG)
+      {
+         //no content; continue as if there was an end tag
+         mh_MakeStartTag(c_Level.c_Header);
+         this->mc_NextTag = "</" + c_Level.c_Name + ">";
+         this->me_NextTagType = eEND_TAG;
+      }
+      else
+      {
+         s32_Return = this->m_ReadNextTag(&c_Level.c_Header);
+      }
+
+      if (s32_Return == C_NO_ERR)
+      {
+         this->mc_Levels.push_back(c_Level);
+         s32_Return = this->m_ParseLevels();
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         tinyxml2::XMLElement * const pc_Node = this->m_GetCurrentLevelElement();
+         if (pc_Node != NULL)
+         {
+            C_OSCChecksummedXML::h_CalcCRCElementStart(*pc_Node, (this->mc_Levels.size() == 1U),
+                                                       this->mu16_CRCDepth, this->mu16_CRC);
+            this->mpc_CurrentNode = pc_Node;
+         }
+         else
+         {
+            s32_Return = C_NOACT;
+         }
+      }
+   }
+   else
+   {
+      //no more nodes on this level
+   }
+   this->mq_Failed = (s32_Return == C_NOACT);
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Leave current level
+
+   Remaining child nodes of the current level are skipped (but still added to the CRC).
+   The node of the left level is removed from the document. Its parent is selected.
+
+   \return
+   C_NO_ERR   level left
+   C_RANGE    no level entered
+   C_NOACT    invalid XML or read error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::LeaveNode(void)
+{
+   sint32 s32_Return = C_RANGE;
+
+   if (this->mq_Failed == true)
+   {
+      s32_Return = C_NOACT;
+   }
+   else if (this->mc_Levels.size() > 0)
+   {
+      s32_Return = C_NO_ERR;
+      while ((s32_Return == C_NO_ERR) &&
+             ((this->me_NextTagType == eSTART_TAG) || (this->me_NextTagType == eEMPTY_TAG)))
+      {
+         s32_Return = this->m_SkipElement();
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         std::string c_EndTagName;
+         mh_GetTagName(this->mc_NextTag, c_EndTagName);
+         if ((this->me_NextTagType != eEND_TAG) || (c_EndTagName != this->mc_Levels.back().c_Name))
+         {
+            s32_Return = C_NOACT;
+         }
+      }
+      if (s32_Return == C_NO_ERR)
+      {
+         tinyxml2::XMLElement * const pc_Node = this->m_GetCurrentLevelElement();
+         this->mc_Levels.pop_back();
+         if ((this->mc_Levels.size() == 0) || (pc_Node == NULL) || (pc_Node->Parent() == NULL))
+         {
+            //left the root: done
+            this->mc_Document.Clear();
+            this->mpc_CurrentNode = NULL;
+            this->mc_NextTag.clear();
+            this->me_NextTagType = eEND_OF_FILE;
+         }
+         else
+         {
+            this->mpc_CurrentNode = pc_Node->Parent()->ToElement();
+            this->mc_Document.DeleteNode(pc_Node);
+            s32_Return = this->m_ReadNextTag(NULL);
+         }
+      }
+   }
+   else
+   {
+      //no level entered
+   }
+   this->mq_Failed = (s32_Return == C_NOACT);
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Remove the nodes read with ReadNextNode on the current level from the document
+
+   Call this when the nodes were processed to keep memory and runtime independent of the number of nodes.
+   The current level's node is selected.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamReader::DiscardReadNodes(void)
+{
+   if (this->mc_Levels.size() > 0)
+   {
+      tinyxml2::XMLElement * const pc_Level = this->m_GetCurrentLevelElement();
+
+      this->mc_Levels.back().c_Children.clear();
+      if (pc_Level != NULL)
+      {
+         tinyxml2::XMLElement * pc_Child = pc_Level->FirstChildElement();
+         while (pc_Child != NULL)
+         {
+            pc_Level->DeleteChild(pc_Child);
+            pc_Child = pc_Level->FirstChildElement();
+         }
+      }
+      this->mpc_CurrentNode = pc_Level;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Skip rest of file and get CRC
+
+   All levels are left. The remaining content is read and added to the CRC.
+   The file stays open until Close is called (or the instance is destroyed).
+
+   \param[out]  oru16_CRC   CRC over the complete file (as calculated by C_OSCChecksummedXML)
+
+   \return
+   C_NO_ERR   end of file reached; CRC is valid
+   C_NOACT    invalid XML or read error (also if any previous read failed)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::ReadToEnd(uint16 & oru16_CRC)
+{
+   sint32 s32_Return = (this->mq_Failed == true) ? C_NOACT : C_NO_ERR;
+   E_ItemType e_Type = eTEXT;
+
+   while ((s32_Return == C_NO_ERR) && (this->mc_Levels.size() > 0))
+   {
+      s32_Return = this->LeaveNode();
+   }
+   while ((s32_Return == C_NO_ERR) && (e_Type != eEND_OF_FILE))
+   {
+      s32_Return = this->m_ReadItem(this->mc_Item, e_Type);
+   }
+   this->mq_Failed = (s32_Return == C_NOACT);
+   oru16_CRC = this->mu16_CRC;
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get next character from file without consuming it
+
+   Reads the file in blocks. Use ++mun_ReadPos to consume the character.
+
+   \param[out]  orcn_Char   next character
+
+   \return
+   true    character available
+   false   end of file (or read error)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLStreamReader::m_PeekChar(charn & orcn_Char)
+{
+   bool q_Return = true;
+
+   if (this->mun_ReadPos >= this->mun_ReadSize)
+   {
+      this->mun_ReadPos = 0U;
+      this->mun_ReadSize = 0U;
+      if (this->mpc_File != NULL)
+      {
+         this->mun_ReadSize = static_cast<uintn>(std::fread(&this->mc_ReadBuffer[0], 1U,
+                                                            this->mc_ReadBuffer.size(), this->mpc_File));
+      }
+      q_Return = (this->mun_ReadSize > 0U);
+   }
+   if (q_Return == true)
+   {
+      orcn_Char = this->mc_ReadBuffer[this->mun_ReadPos];
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read next item from file
+
+   An item is either a run of character data up to the next "<" or one complete markup (tag, comment, ...).
+   Quotes in tags are respected, so a ">" in an attribute value does not end the tag.
+
+   \param[out]  orc_Item   raw text of item as contained in the file
+   \param[out]  ore_Type   type of item
+
+   \return
+   C_NO_ERR   item read (or end of file reached)
+   C_NOACT    file ends within a markup
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::m_ReadItem(std::string & orc_Item, E_ItemType & ore_Type)
+{
+   sint32 s32_Return = C_NO_ERR;
+   charn cn_Char;
+
+   orc_Item.clear();
+   if (this->m_PeekChar(cn_Char) == false)
+   {
+      ore_Type = eEND_OF_FILE;
+   }
+   else if (cn_Char != '<')
+   {
+      ore_Type = eTEXT;
+      do
+      {
+         orc_Item.push_back(cn_Char);
+         ++this->mun_ReadPos;
+      }
+      while ((this->m_PeekChar(cn_Char) == true) && (cn_Char != '<'));
+   }
+   else
+   {
+      charn cn_Quote = '\0';
+      bool q_Complete = false;
+
+      ore_Type = eSTART_TAG;
+      orc_Item.push_back(cn_Char);
+      ++this->mun_ReadPos;
+      while ((q_Complete == false) && (this->m_PeekChar(cn_Char) == true))
+      {
+         orc_Item.push_back(cn_Char);
+         ++this->mun_ReadPos;
+         if (orc_Item.size() == 2U)
+         {
+            if ((cn_Char == '?') || (cn_Char == '!'))
+            {
+               ore_Type = eMISC;
+            }
+            else if (cn_Char == '/')
+            {
+               ore_Type = eEND_TAG;
+            }
+            else
+            {
+               //start tag
+            }
+         }
+
+         if (ore_Type == eMISC)
+         {
+            q_Complete = mh_IsMarkupComplete(orc_Item);
+         }
+         else if (cn_Quote != '\0')
+         {
+            if (cn_Char == cn_Quote)
+            {
+               cn_Quote = '\0';
+            }
+         }
+         else if ((cn_Char == '"') || (cn_Char == '\''))
+         {
+            cn_Quote = cn_Char;
+         }
+         else
+         {
+            q_Complete = (cn_Char == '>');
+         }
+      }
+
+      if (q_Complete == false)
+      {
+         s32_Return = C_NOACT;
+      }
+      else if ((ore_Type == eSTART_TAG) && (orc_Item[orc_Item.size() - 2U] == '/'))
+      {
+         ore_Type = eEMPTY_TAG;
+      }
+      else
+      {
+         //nothing more to do
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Read up to the next start or end tag
+
+   The tag is stored in mc_NextTag.
+
+   \param[out]  opc_Content   optional: character data and other markup in front of the tag is appended here
+                              (NULL: skip it)
+
+   \return
+   C_NO_ERR   next tag read
+   C_NOACT    end of file reached or invalid markup
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::m_ReadNextTag(std::string * const opc_Content)
+{
+   sint32 s32_Return = C_NO_ERR;
+   bool q_Found = false;
+
+   while ((q_Found == false) && (s32_Return == C_NO_ERR))
+   {
+      E_ItemType e_Type;
+      s32_Return = this->m_ReadItem(this->mc_Item, e_Type);
+      if (s32_Return == C_NO_ERR)
+      {
+         if ((e_Type == eTEXT) || (e_Type == eMISC))
+         {
+            if (opc_Content != NULL)
+            {
+               *opc_Content += this->mc_Item;
+            }
+         }
+         else if (e_Type == eEND_OF_FILE)
+         {
+            this->mc_NextTag.clear();
+            this->me_NextTagType = eEND_OF_FILE;
+            s32_Return = C_NOACT;
+         }
+         else
+         {
+            this->mc_NextTag.swap(this->mc_Item);
+            this->me_NextTagType = e_Type;
+            q_Found = true;
+         }
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Skip the element starting with mc_NextTag
+
+   The element is only added to the CRC. Child elements are handled one by one, so the size of the element does not
+   matter.
+
+   \return
+   C_NO_ERR   element skipped; mc_NextTag contains the tag after the element
+   C_NOACT    invalid XML or read error
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::m_SkipElement(void)
+{
+   sint32 s32_Return = C_NO_ERR;
+   const bool q_Empty = (this->me_NextTagType == eEMPTY_TAG);
+   std::string c_Name;
+   std::string c_Element = this->mc_NextTag;
+
+   mh_GetTagName(c_Element, c_Name);
+   if (q_Empty == false)
+   {
+      s32_Return = this->m_ReadNextTag(&c_Element);
+      c_Element += "</" + c_Name + ">";
+   }
+   if (s32_Return == C_NO_ERR)
+   {
+      if ((this->mc_SkipDocument.Parse(c_Element.c_str(), c_Element.size()) != tinyxml2::XML_SUCCESS) ||
+          (this->mc_SkipDocument.RootElement() == NULL))
+      {
+         s32_Return = C_NOACT;
+      }
+      else
+      {
+         C_OSCChecksummedXML::h_CalcCRCElementStart(*this->mc_SkipDocument.RootElement(), false,
+                                                    this->mu16_CRCDepth, this->mu16_CRC);
+      }
+   }
+   if ((s32_Return == C_NO_ERR) && (q_Empty == false))
+   {
+      std::string c_EndTagName;
+      while ((s32_Return == C_NO_ERR) &&
+             ((this->me_NextTagType == eSTART_TAG) || (this->me_NextTagType == eEMPTY_TAG)))
+      {
+         s32_Return = this->m_SkipElement();
+      }
+      mh_GetTagName(this->mc_NextTag, c_EndTagName);
+      if ((s32_Return == C_NO_ERR) && ((this->me_NextTagType != eEND_TAG) || (c_EndTagName != c_Name)))
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+   if (s32_Return == C_NO_ERR)
+   {
+      s32_Return = this->m_ReadNextTag(NULL);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Rebuild the document from the entered levels and the nodes read on them
+
+   \return
+   C_NO_ERR   document parsed
+   C_NOACT    invalid XML
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamReader::m_ParseLevels(void)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   this->mpc_CurrentNode = NULL;
+   this->mc_Text.clear();
+   for (uint32 u32_Level = 0U; u32_Level < this->mc_Levels.size(); ++u32_Level)
+   {
+      this->mc_Text += this->mc_Levels[u32_Level].c_Header;
+      this->mc_Text += this->mc_Levels[u32_Level].c_Children;
+   }
+   for (uint32 u32_Level = static_cast<uint32>(this->mc_Levels.size()); u32_Level > 0U; --u32_Level)
+   {
+      this->mc_Text += "</";
+      this->mc_Text += this->mc_Levels[u32_Level - 1U].c_Name;
+      this->mc_Text += ">";
+   }
+
+   if (this->mc_Text.empty() == true)
+   {
+      this->mc_Document.Clear();
+   }
+   else if (this->mc_Document.Parse(this->mc_Text.c_str(), this->mc_Text.size()) != tinyxml2::XML_SUCCESS)
+   {
+      s32_Return = C_NOACT;
+   }
+   else
+   {
+      //parsed
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get node of the current level in the document
+
+   \return
+   node of current level (NULL: no level entered)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+tinyxml2::XMLElement * C_OSCXMLStreamReader::m_GetCurrentLevelElement(void)
+{
+   tinyxml2::XMLElement * pc_Node = this->mc_Document.RootElement();
+
+   //the nodes of the deeper levels are always the last children of their parents
+   for (uint32 u32_Level = 1U; (u32_Level < this->mc_Levels.size()) && (pc_Node != NULL); ++u32_Level)
+   {
+      pc_Node = pc_Node->LastChildElement();
+   }
+   return pc_Node;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check whether "<?" or "<!" markup is complete
+
+   \param[in]  orc_Markup   markup read so far
+
+   \return
+   true    markup is complete
+   false   more characters required
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCXMLStreamReader::mh_IsMarkupComplete(const std::string & orc_Markup)
+{
+   bool q_Return;
+   const uintn un_Length = orc_Markup.size();
+
+   if (orc_Markup[1] == '?')
+   {
+      q_Return = ((un_Length >= 4U) && (orc_Markup.compare(un_Length - 2U, 2U, "?>") == 0));
+   }
+   else if ((un_Length >= 4U) && (orc_Markup.compare(0U, 4U, mcn_COMMENT_START) == 0))
+   {
+      q_Return = ((un_Length >= 7U) && (orc_Markup.compare(un_Length - 3U, 3U, "-->") == 0));
+   }
+   else if ((un_Length >= 9U) && (orc_Markup.compare(0U, 9U, mcn_CDATA_START) == 0))
+   {
+      q_Return = ((un_Length >= 12U) && (orc_Markup.compare(un_Length - 3U, 3U, "]]>") == 0));
+   }
+   else if ((std::strncmp(orc_Markup.c_str(), mcn_COMMENT_START, un_Length) == 0) ||
+            (std::strncmp(orc_Markup.c_str(), mcn_CDATA_START, un_Length) == 0))
+   {
+      //still could become a comment or CDATA section
+      q_Return = false;
+   }
+   else
+   {
+      //other "<!...>" markup
+      q_Return = (orc_Markup[un_Length - 1U] == '>');
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Extract element name from start or end tag
+
+   \param[in]   orc_Tag    complete tag
+   \param[out]  orc_Name   element name
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamReader::mh_GetTagName(const std::string & orc_Tag, std::string & orc_Name)
+{
+   const uintn un_Start = ((orc_Tag.size() > 1U) && (orc_Tag[1] == '/')) ? 2U : 1U;
+   uintn un_End = un_Start;
+
+   while ((un_End < orc_Tag.size()) && (std::strchr(" \t\r\n/>", orc_Tag[un_End]) == NULL))
+   {
+      un_End++;
+   }
+   orc_Name.assign(orc_Tag, un_Start, un_End - un_Start);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Convert empty element tag ("<name .../>") to start tag ("<name ...>")
+
+   \param[in,out]  orc_Tag   tag to convert
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamReader::mh_MakeStartTag(std::string & orc_Tag)
+{
+   if (orc_Tag.size() >= 2U)
+   {
+      orc_Tag.erase(orc_Tag.size() - 2U, 1U);
+   }
+}
@@ -0,0 +1,414 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Write XML file piece by piece
+
+   Writes an XML file without holding the DOM of the complete file.
+   The document is set up with the functions of C_OSCXMLParserBase as usual.
+   Each call of Flush writes all completed parts of the document to the file and removes them from the document.
+   A part is completed if it is not on the path from the root to the currently selected node.
+   So the memory needed is defined by the amount of data added between two calls of Flush.
+
+   Example:
+   * CreateAndSelectNodeChild("root"), CreateAndSelectNodeChild("list")
+   * for each entry: CreateAndSelectNodeChild("entry"), add content, SelectNodeParent(), Flush()
+   * Close()
+
+   Restrictions:
+   * nodes can only be appended; written nodes must not be changed or selected anymore
+   * the attributes of the nodes on the selected path are written with the first Flush and must not be changed later
+   * the document must have exactly one root node
+
+   The file is written in binary mode with the line end of the platform ("\r\n" on Windows, "\n" elsewhere),
+   so the CRC position is known exactly.
+   The resulting file is identical to the one written by C_OSCXMLParser::SaveToFile for the same document on the
+   same platform.
+   With CRC the file is identical to the one written by C_OSCChecksummedXML::SaveToFile.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstring>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "C_OSCXMLStreamWriter.h"
+#include "C_OSCChecksummedXML.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const charn mcn_CRC_PLACEHOLDER[] = "0x0000";
+//same line end as written by tinyxml2 (text mode file)
+#ifdef _WIN32
+static const charn mcn_LINE_END[] = "\r\n";
+#else
+static const charn mcn_LINE_END[] = "\n";
+#endif
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStreamWriter::C_OSCXMLStreamWriter(void) :
+   C_OSCXMLParserBase(),
+   mpc_File(NULL),
+   mpc_Printer(NULL),
+   mq_AddCRC(false),
+   mu16_CRC(C_OSCChecksummedXML::hu16_CRC_START_VALUE),
+   mu16_CRCDepth(0U),
+   ms32_CRCPosition(-1),
+   mu32_FilePosition(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Default destructor
+
+   Closes the file (writing the remaining document).
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCXMLStreamWriter::~C_OSCXMLStreamWriter(void)
+{
+   (void)this->Close();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Create file and write XML declaration
+
+   A pre-existing file will be replaced.
+   The document is cleared.
+
+   \param[in]  orc_FileName   path to XML file to write to
+   \param[in]  oq_AddCRC      true: add CRC attribute to root node (as done by C_OSCChecksummedXML)
+
+   \return
+   C_NO_ERR   file created
+   C_NOACT    could not create file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamWriter::Open(const C_SCLString & orc_FileName, const bool oq_AddCRC)
+{
+   sint32 s32_Return = C_NOACT;
+
+   (void)this->Close();
+   //binary mode: line ends are written explicitly (see m_WriteBuffer)
+   this->mpc_File = std::fopen(orc_FileName.c_str(), "wb");
+   if (this->mpc_File != NULL)
+   {
+      //the printer prints to memory; the content is passed to the file by m_WriteBuffer
+      this->mpc_Printer = new tinyxml2::XMLPrinter(NULL);
+      this->mq_AddCRC = oq_AddCRC;
+      this->mu16_CRC = C_OSCChecksummedXML::hu16_CRC_START_VALUE;
+      this->mu16_CRCDepth = 0U;
+      this->ms32_CRCPosition = -1;
+      this->mu32_FilePosition = 0U;
+      this->mpc_Printer->PushDeclaration("xml version=\"1.0\" encoding=\"utf-8\"");
+      s32_Return = C_NO_ERR;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write completed parts of the document to file
+
+   Writes everything that is not on the path from the root to the currently selected node.
+   Start tags of the nodes on the path are written; their end tags follow when they are left.
+   Written nodes are removed from the document.
+
+   \return
+   C_NO_ERR   data written
+   C_NOACT    file not open or could not write data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamWriter::Flush(void)
+{
+   sint32 s32_Return = C_NOACT;
+
+   if (this->mpc_File != NULL)
+   {
+      std::vector<tinyxml2::XMLElement *> c_Path;
+      uint32 u32_Common = 0U;
+      tinyxml2::XMLElement * pc_Node = this->mpc_CurrentNode;
+
+      while (pc_Node != NULL)
+      {
+         c_Path.insert(c_Path.begin(), pc_Node);
+         pc_Node = (pc_Node->Parent() != NULL) ? pc_Node->Parent()->ToElement() : NULL;
+      }
+
+      //finish elements that were left
+      while ((u32_Common < this->mc_OpenElements.size()) && (u32_Common < c_Path.size()) &&
+             (this->mc_OpenElements[u32_Common].pc_Element == c_Path[u32_Common]))
+      {
+         u32_Common++;
+      }
+      while (this->mc_OpenElements.size() > u32_Common)
+      {
+         this->m_CloseElement();
+      }
+
+      //write everything in front of the selected path
+      for (uint32 u32_Level = 0U; u32_Level < c_Path.size(); ++u32_Level)
+      {
+         const tinyxml2::XMLNode * const pc_StopAt = ((u32_Level + 1U) < c_Path.size()) ? c_Path[u32_Level + 1U] :
+                                                     NULL;
+         if (u32_Level >= this->mc_OpenElements.size())
+         {
+            this->m_OpenElement(*c_Path[u32_Level]);
+         }
+         this->m_WriteChildren(u32_Level, pc_StopAt);
+         if (pc_StopAt != NULL)
+         {
+            //the next element on the path is content of this one; so it has to be started before opening that
+            this->m_StartContent(u32_Level);
+         }
+      }
+      this->m_WriteBuffer();
+
+      s32_Return = (std::ferror(this->mpc_File) == 0) ? C_NO_ERR : C_NOACT;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write the remaining document and close file
+
+   If requested the CRC is written to the root node.
+   The document is cleared.
+
+   \return
+   C_NO_ERR   file written and closed (also returned if no file was open)
+   C_NOACT    could not write data
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCXMLStreamWriter::Close(void)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (this->mpc_File != NULL)
+   {
+      tinyxml2::XMLElement * pc_Root;
+
+      //everything is completed now
+      this->mpc_CurrentNode = NULL;
+      (void)this->Flush();
+      //root not written at all yet ?
+      pc_Root = this->mc_Document.RootElement();
+      if (pc_Root != NULL)
+      {
+         this->m_OpenElement(*pc_Root);
+         this->m_CloseElement();
+      }
+      this->m_WriteBuffer();
+
+      if ((this->mq_AddCRC == true) && (this->ms32_CRCPosition >= 0))
+      {
+         const C_SCLString c_CRC = "0x" + C_SCLString::IntToHex(this->mu16_CRC, 4U);
+         if ((std::fseek(this->mpc_File, this->ms32_CRCPosition, SEEK_SET) != 0) ||
+             (std::fputs(c_CRC.c_str(), this->mpc_File) < 0))
+         {
+            s32_Return = C_NOACT;
+         }
+      }
+      if (std::ferror(this->mpc_File) != 0)
+      {
+         s32_Return = C_NOACT;
+      }
+      if (std::fclose(this->mpc_File) != 0)
+      {
+         s32_Return = C_NOACT;
+      }
+      this->mpc_File = NULL;
+      delete this->mpc_Printer;
+      this->mpc_Printer = NULL;
+   }
+   this->mc_OpenElements.clear();
+   this->mc_Document.Clear();
+   this->mpc_CurrentNode = NULL;
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get CRC of written document
+
+   The CRC is calculated over the document structure while writing (as C_OSCChecksummedXML does).
+   It is final after Close was called.
+   Can be compared with the CRC calculated by C_OSCXMLStreamReader::ReadToEnd for a copied file
+   without reading the file again.
+
+   \return
+   CRC over the document written so far
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint16 C_OSCXMLStreamWriter::GetCRC(void) const
+{
+   return this->mu16_CRC;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Pass content printed so far to file
+
+   tinyxml2 only uses "\n" as line end; each one is written as the line end of the platform.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamWriter::m_WriteBuffer(void)
+{
+   const charn * pcn_Start = this->mpc_Printer->CStr();
+   const charn * pcn_LineEnd = std::strchr(pcn_Start, '\n');
+
+   while (pcn_LineEnd != NULL)
+   {
+      this->mu32_FilePosition += static_cast<uint32>(std::fwrite(pcn_Start, 1U,
+                                                                 static_cast<size_t>(pcn_LineEnd - pcn_Start),
+                                                                 this->mpc_File));
+      this->mu32_FilePosition += static_cast<uint32>(std::fwrite(&mcn_LINE_END[0], 1U, std::strlen(mcn_LINE_END),
+                                                                 this->mpc_File));
+      pcn_Start = pcn_LineEnd + 1;
+      pcn_LineEnd = std::strchr(pcn_Start, '\n');
+   }
+   this->mu32_FilePosition += static_cast<uint32>(std::fwrite(pcn_Start, 1U, std::strlen(pcn_Start),
+                                                              this->mpc_File));
+   this->mpc_Printer->ClearBuffer();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write start tag with attributes
+
+   For the root node the CRC attribute is written as placeholder (if requested).
+   Its position is the same as C_OSCChecksummedXML::SaveToFile would use.
+
+   \param[in]  orc_Element   element to write
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamWriter::m_OpenElement(tinyxml2::XMLElement & orc_Element)
+{
+   const bool q_AddCRC = ((this->mq_AddCRC == true) && (this->mc_OpenElements.size() == 0));
+   const tinyxml2::XMLAttribute * pc_Attribute = orc_Element.FirstAttribute();
+   C_OpenElement c_OpenElement;
+
+   this->mpc_Printer->OpenElement(orc_Element.Name(), false);
+   while (pc_Attribute != NULL)
+   {
+      if ((q_AddCRC == true) &&
+          (std::strcmp(pc_Attribute->Name(), C_OSCChecksummedXML::hpcn_CRC_ATTRIBUTE_NAME) == 0))
+      {
+         this->m_PushCRCPlaceholder();
+      }
+      else
+      {
+         this->mpc_Printer->PushAttribute(pc_Attribute->Name(), pc_Attribute->Value());
+      }
+      pc_Attribute = pc_Attribute->Next();
+   }
+   if ((q_AddCRC == true) && (this->ms32_CRCPosition < 0))
+   {
+      this->m_PushCRCPlaceholder();
+   }
+
+   c_OpenElement.pc_Element = &orc_Element;
+   c_OpenElement.q_ContentStarted = false;
+   this->mc_OpenElements.push_back(c_OpenElement);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write CRC attribute with placeholder value
+
+   The file position of the value is stored so the real CRC can be filled in when closing the file.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamWriter::m_PushCRCPlaceholder(void)
+{
+   this->mpc_Printer->PushAttribute(C_OSCChecksummedXML::hpcn_CRC_ATTRIBUTE_NAME, mcn_CRC_PLACEHOLDER);
+   this->m_WriteBuffer();
+   //value is followed by the closing quote
+   this->ms32_CRCPosition = static_cast<sint32>(this->mu32_FilePosition) -
+                            static_cast<sint32>(std::strlen(mcn_CRC_PLACEHOLDER) + 1U);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Add start of open element to CRC
+
+   Done when the first child is written (or the element is closed) as the text of the element is part of the CRC.
+
+   \param[in]  ou32_Level   index of open element
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamWriter::m_StartContent(const uint32 ou32_Level)
+{
+   C_OpenElement & rc_OpenElement = this->mc_OpenElements[ou32_Level];
+
+   if (rc_OpenElement.q_ContentStarted == false)
+   {
+      if (this->mq_AddCRC == true)
+      {
+         C_OSCChecksummedXML::h_CalcCRCElementStart(*rc_OpenElement.pc_Element, (ou32_Level == 0U),
+                                                    this->mu16_CRCDepth, this->mu16_CRC);
+      }
+      rc_OpenElement.q_ContentStarted = true;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write child nodes of open element and remove them from the document
+
+   \param[in]  ou32_Level    index of open element
+   \param[in]  opc_StopAt    child to stop at (NULL: write all children)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamWriter::m_WriteChildren(const uint32 ou32_Level, const tinyxml2::XMLNode * const opc_StopAt)
+{
+   tinyxml2::XMLElement * const pc_Parent = this->mc_OpenElements[ou32_Level].pc_Element;
+   tinyxml2::XMLNode * pc_Child = pc_Parent->FirstChild();
+
+   while ((pc_Child != NULL) && (pc_Child != opc_StopAt))
+   {
+      tinyxml2::XMLNode * const pc_Next = pc_Child->NextSibling();
+      const tinyxml2::XMLElement * const pc_ChildElement = pc_Child->ToElement();
+
+      this->m_StartContent(ou32_Level);
+      (void)pc_Child->Accept(this->mpc_Printer);
+      if ((this->mq_AddCRC == true) && (pc_ChildElement != NULL))
+      {
+         C_OSCChecksummedXML::h_CalcCRCElement(*pc_ChildElement, this->mu16_CRCDepth, this->mu16_CRC);
+      }
+      pc_Parent->DeleteChild(pc_Child);
+      pc_Child = pc_Next;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Write remaining children and end tag of innermost open element
+
+   The element is removed from the document.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCXMLStreamWriter::m_CloseElement(void)
+{
+   const uint32 u32_Level = static_cast<uint32>(this->mc_OpenElements.size() - 1U);
+   tinyxml2::XMLElement * const pc_Element = this->mc_OpenElements[u32_Level].pc_Element;
+
+   this->m_WriteChildren(u32_Level, NULL);
+   this->m_StartContent(u32_Level);
+   this->mpc_Printer->CloseElement(false);
+   this->mc_OpenElements.pop_back();
+   this->mc_Document.DeleteNode(pc_Element);
+}
@@ -713,6 +713,7 @@ C_SYDEsup::E_Result C_SYDEsup::m_InitOptionalParameters()
    std::cout << "The following output also is logged to the file: " << mc_LogFile.c_str() << "\n" << &std::endl;
    C_OSCLoggingHandler::h_SetWriteToConsoleActive(false);
    C_OSCLoggingHandler::h_SetWriteToFileActive(true);
+   C_OSCLoggingHandler::h_SetAsyncWriteActive(true);
 
    return e_Return;
 }
@@ -26,7 +26,8 @@ namespace DBC {
 
 File::File() :
     progressCallback(nullptr),
-    statusCallback(nullptr)
+    statusCallback(nullptr),
+    parser(Parser::Tokenizer)
 {
     /* nothing to do here */
 }
@@ -41,5 +42,10 @@ void File::setStatusCallback(StatusCallback function)
     statusCallback = function;
 }
 
+void File::setParser(Parser parser)
+{
+    this->parser = parser;
+}
+
 }
 }
@@ -112,6 +112,27 @@ public:
      */
     void setStatusCallback(StatusCallback function);
 
+    // 2026-10-18 STW: added hand-written tokenizer as default load parser
+    /**
+     * Parser used to load database files
+     */
+    enum class Parser {
+        /** Hand-written tokenizer (default) */
+        Tokenizer,
+
+        /** Regular expressions (reference implementation) */
+        Regex
+    };
+
+    /**
+     * @brief Set parser used on load
+     * @param[in] parser Parser
+     *
+     * The tokenizer produces the same network as the regular expressions,
+     * which are kept to validate it against.
+     */
+    void setParser(Parser parser);
+
 private:
     /** Progress Callback function */
     ProgressCallback progressCallback;
@@ -119,6 +140,9 @@ private:
     /** Status Callback function */
     StatusCallback statusCallback;
 
+    /** Parser used on load */
+    Parser parser;
+
     /** Remove windows/unix/mac line endings */
     void chomp(std::string & line);
 
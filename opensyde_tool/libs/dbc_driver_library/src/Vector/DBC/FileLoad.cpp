@@ -24,6 +24,7 @@
 
 #include <Vector/DBC/File.h>
 
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <stack>
@@ -35,13 +36,11 @@
 #define smatch        std::smatch
 #define regex         std::regex
 #define regex_search  std::regex_search
-#define regex_replace std::regex_replace
 #else
 #include <boost/regex.hpp>
 #define smatch        boost::smatch
 #define regex         boost::regex
 #define regex_search  boost::regex_search
-#define regex_replace boost::regex_replace
 #endif
 
 /* force Linux to use Windows line endings */
@@ -91,6 +90,800 @@ static const char endl[] = "\r\n";
 namespace Vector {
 namespace DBC {
 
+// 2026-10-18 STW: Compiling and running a std::regex for every line dominates the load time of large files.
+//                 Each line pattern now has a matcher that either runs the original regular expression
+//                 (File::Parser::Regex, kept as reference) or a hand-written tokenizer (File::Parser::Tokenizer).
+//                 The tokenizer mirrors the REGEX_* building blocks one by one and fills the same groups,
+//                 so the following processing of the sub-matches is shared by both parsers.
+namespace {
+
+/** Sub-matches of one line, numbered like the groups of the regular expressions */
+class Match
+{
+public:
+    std::string & operator[](std::size_t index)
+    {
+        return groups[index];
+    }
+
+private:
+    /** group 0 is unused, the signal line has the most groups (13) */
+    std::string groups[14];
+};
+
+/** Line matching with regular expressions */
+bool regexMatch(const std::string & line, Match & match, const char * expression)
+{
+    smatch m;
+    regex re(expression);
+    if (!regex_search(line, m, re)) {
+        return false;
+    }
+    for (std::size_t i = 1; i < m.size(); ++i) {
+        match[i] = m[i];
+    }
+    return true;
+}
+
+/** [[:space:]] */
+bool isSpace(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+}
+
+/** [[:digit:]] */
+bool isDigit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+/** [[:xdigit:]] */
+bool isHexDigit(char c)
+{
+    return isDigit(c) || ((c >= 'a') && (c <= 'f')) || ((c >= 'A') && (c <= 'F'));
+}
+
+#ifdef OPTION_USE_STRICT_NAMES
+/** [[:alpha:]_] */
+bool isNameStart(char c)
+{
+    return ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || (c == '_');
+}
+
+/** [[:alnum:]_] */
+bool isNameChar(char c)
+{
+    return isNameStart(c) || isDigit(c);
+}
+#else
+/** [^[:space:]\:] */
+bool isLooseNameChar(char c)
+{
+    return !isSpace(c) && (c != ':');
+}
+
+/** [^\"[:space:]] */
+bool isLooseAttributeNameChar(char c)
+{
+    return !isSpace(c) && (c != '"');
+}
+#endif
+
+/** [[:digit:]\.\+\-eE] */
+bool isDoubleChar(char c)
+{
+    return isDigit(c) || (c == '.') || (c == '+') || (c == '-') || (c == 'e') || (c == 'E');
+}
+
+/** Object types of BA_DEF */
+const char * const objectTypes[] = { "BU_", "BO_", "SG_", "EV_", nullptr };
+
+/** Value types of BA_DEF */
+const char * const valueTypes[] = { "INT", "HEX", "FLOAT", "STRING", "ENUM", nullptr };
+
+/**
+ * Hand-written tokenizer for one line.
+ *
+ * Each method consumes the same characters as the REGEX_* building block it is named after.
+ * None of the line patterns needs backtracking: every token ends at a character that can't be part of it.
+ */
+class Scanner
+{
+public:
+    explicit Scanner(const std::string & line) :
+        line(line),
+        pos(0)
+    {
+    }
+
+    /** REGEX_SOL */
+    bool startOfLine()
+    {
+        skipSpaces();
+        return true;
+    }
+
+    /** Literal text */
+    bool keyword(const char * text)
+    {
+        std::size_t length = std::strlen(text);
+        if (line.compare(pos, length, text) != 0) {
+            return false;
+        }
+        pos += length;
+        return true;
+    }
+
+    /** Literal character */
+    bool character(char c)
+    {
+        if ((pos >= line.size()) || (line[pos] != c)) {
+            return false;
+        }
+        ++pos;
+        return true;
+    }
+
+    /** (a|b|...)? */
+    bool optionalKeyword(const char * const * texts, std::string & value)
+    {
+        if (!oneOfKeywords(texts, value)) {
+            value.clear();
+        }
+        return true;
+    }
+
+    /** (a|b|...) */
+    bool oneOfKeywords(const char * const * texts, std::string & value)
+    {
+        for (; *texts != nullptr; ++texts) {
+            if (keyword(*texts)) {
+                value = *texts;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** ([abc]) */
+    bool oneOf(const char * chars, std::string & value)
+    {
+        if ((pos >= line.size()) || (line[pos] == '\0') || (std::strchr(chars, line[pos]) == nullptr)) {
+            return false;
+        }
+        value.assign(1, line[pos]);
+        ++pos;
+        return true;
+    }
+
+    /** REGEX_SPACE */
+    bool space()
+    {
+        std::size_t start = pos;
+        skipSpaces();
+        return pos > start;
+    }
+
+    /** [[:space:]]* */
+    bool optionalSpace()
+    {
+        skipSpaces();
+        return true;
+    }
+
+    /** REGEX_DELIM(x) */
+    bool delimiter(char c)
+    {
+        skipSpaces();
+        if (!character(c)) {
+            return false;
+        }
+        skipSpaces();
+        return true;
+    }
+
+    /** REGEX_UINT */
+    bool unsignedInteger(std::string & value)
+    {
+        return span(isDigit, value) && !value.empty();
+    }
+
+    /** REGEX_DOUBLE */
+    bool doubleValue(std::string & value)
+    {
+        return span(isDoubleChar, value) && !value.empty();
+    }
+
+    /** ([[:xdigit:]]+) */
+    bool hexDigits(std::string & value)
+    {
+        return span(isHexDigit, value) && !value.empty();
+    }
+
+    /** REGEX_NAME */
+    bool name(std::string & value)
+    {
+#ifdef OPTION_USE_STRICT_NAMES
+        if ((pos >= line.size()) || !isNameStart(line[pos])) {
+            return false;
+        }
+        return span(isNameChar, value);
+#else
+        return span(isLooseNameChar, value);
+#endif
+    }
+
+    /** REGEX_ATTRIB_NAME */
+    bool attributeName(std::string & value)
+    {
+        std::size_t start = pos;
+        if (!character('"')) {
+            return false;
+        }
+#ifdef OPTION_USE_STRICT_NAMES
+        if (!name(value)) {
+            pos = start;
+            return false;
+        }
+#else
+        (void) span(isLooseAttributeNameChar, value);
+#endif
+        if (!character('"')) {
+            pos = start;
+            return false;
+        }
+        return true;
+    }
+
+    /** REGEX_STRING */
+    bool quotedString(std::string & value)
+    {
+        if (!character('"')) {
+            return false;
+        }
+        std::size_t end = line.find('"', pos);
+        if (end == std::string::npos) {
+            return false;
+        }
+        value.assign(line, pos, end - pos);
+        pos = end + 1;
+        return true;
+    }
+
+    /** ((m[[:digit:]]+)|M)? */
+    bool multiplexor(std::string & value, std::string & multiplexedValue)
+    {
+        std::size_t start = pos;
+        if ((pos + 1 < line.size()) && (line[pos] == 'm') && isDigit(line[pos + 1])) {
+            pos += 2;
+            while ((pos < line.size()) && isDigit(line[pos])) {
+                ++pos;
+            }
+            multiplexedValue.assign(line, start, pos - start);
+        } else
+        if ((pos < line.size()) && (line[pos] == 'M')) {
+            ++pos;
+        }
+        value.assign(line, start, pos - start);
+        return true;
+    }
+
+    /** REGEX_EOL */
+    bool endOfLine()
+    {
+        skipSpaces();
+        return pos == line.size();
+    }
+
+    /** REGEX_EOL_DELIM */
+    bool endOfLineDelimiter()
+    {
+        skipSpaces();
+        if (!character(';')) {
+            return false;
+        }
+        return endOfLine();
+    }
+
+    /** REGEX_TO_END REGEX_EOL */
+    bool toEnd(std::string & value)
+    {
+        std::size_t end = line.size();
+        while ((end > pos) && isSpace(line[end - 1])) {
+            --end;
+        }
+        return capture(end, value);
+    }
+
+    /** REGEX_TO_END REGEX_EOL_DELIM */
+    bool toEndDelimiter(std::string & value)
+    {
+        std::size_t end = line.size();
+        while ((end > pos) && isSpace(line[end - 1])) {
+            --end;
+        }
+        if ((end == pos) || (line[end - 1] != ';')) {
+            return false;
+        }
+        --end;
+        while ((end > pos) && isSpace(line[end - 1])) {
+            --end;
+        }
+        return capture(end, value);
+    }
+
+private:
+    /** line to scan */
+    const std::string & line;
+
+    /** current position */
+    std::size_t pos;
+
+    /** [[:space:]]* */
+    void skipSpaces()
+    {
+        while ((pos < line.size()) && isSpace(line[pos])) {
+            ++pos;
+        }
+    }
+
+    /** ([...]*) */
+    bool span(bool (*accept)(char), std::string & value)
+    {
+        std::size_t start = pos;
+        while ((pos < line.size()) && accept(line[pos])) {
+            ++pos;
+        }
+        value.assign(line, start, pos - start);
+        return true;
+    }
+
+    /** (.*?) up to end, '.' doesn't match line terminators */
+    bool capture(std::size_t end, std::string & value)
+    {
+        for (std::size_t i = pos; i < end; ++i) {
+            if ((line[i] == '\n') || (line[i] == '\r')) {
+                return false;
+            }
+        }
+        value.assign(line, pos, end - pos);
+        pos = line.size();
+        return true;
+    }
+};
+
+/* Version (VERSION) */
+bool matchVersion(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "VERSION" REGEX_SPACE REGEX_STRING REGEX_EOL);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("VERSION") && s.space() && s.quotedString(m[1]) && s.endOfLine();
+}
+
+/* New Symbol (NS) */
+bool matchNewSymbol(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL REGEX_NAME REGEX_EOL);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.name(m[1]) && s.endOfLine();
+}
+
+/* Bit Timing (BS) */
+bool matchBitTiming(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BS_:" REGEX_SPACE REGEX_UINT ":" REGEX_UINT ":" REGEX_UINT REGEX_EOL);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BS_:") && s.space() && s.unsignedInteger(m[1]) && s.character(':') &&
+        s.unsignedInteger(m[2]) && s.character(':') && s.unsignedInteger(m[3]) && s.endOfLine();
+}
+
+/* Value Table (VAL_TABLE) */
+bool matchValueTable(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "VAL_TABLE_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("VAL_TABLE_") && s.space() && s.name(m[1]) && s.space() && s.toEndDelimiter(m[2]);
+}
+
+/* Signal (SG) */
+bool matchSignal(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "SG_" REGEX_SPACE REGEX_NAME "[[:space:]]*((m[[:digit:]]+)|M)?[[:space:]]*:[[:space:]]*" REGEX_UINT "\\|" REGEX_UINT "@([01])([+-])" REGEX_SPACE "\\(" REGEX_DOUBLE "," REGEX_DOUBLE "\\)" REGEX_SPACE "\\[" REGEX_DOUBLE "\\|" REGEX_DOUBLE "\\]" REGEX_SPACE REGEX_STRING REGEX_SPACE REGEX_TO_END REGEX_EOL);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("SG_") && s.space() && s.name(m[1]) && s.optionalSpace() && s.multiplexor(m[2], m[3]) &&
+        s.delimiter(':') && s.unsignedInteger(m[4]) && s.character('|') && s.unsignedInteger(m[5]) &&
+        s.character('@') && s.oneOf("01", m[6]) && s.oneOf("+-", m[7]) && s.space() &&
+        s.character('(') && s.doubleValue(m[8]) && s.character(',') && s.doubleValue(m[9]) && s.character(')') && s.space() &&
+        s.character('[') && s.doubleValue(m[10]) && s.character('|') && s.doubleValue(m[11]) && s.character(']') && s.space() &&
+        s.quotedString(m[12]) && s.space() && s.toEnd(m[13]);
+}
+
+/* Message (BO) */
+bool matchMessage(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BO_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_EOL);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BO_") && s.space() && s.unsignedInteger(m[1]) && s.space() && s.name(m[2]) &&
+        s.delimiter(':') && s.unsignedInteger(m[3]) && s.space() && s.name(m[4]) && s.endOfLine();
+}
+
+/* Message Transmitter (BO_TX_BU) */
+bool matchMessageTransmitter(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BO_TX_BU_" REGEX_SPACE REGEX_UINT REGEX_DELIM(":") REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BO_TX_BU_") && s.space() && s.unsignedInteger(m[1]) && s.delimiter(':') && s.toEndDelimiter(m[2]);
+}
+
+/* Environment Variable (EV) */
+bool matchEnvironmentVariable(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "EV_" REGEX_SPACE REGEX_NAME REGEX_DELIM(":") "([01])" REGEX_SPACE "\\[" REGEX_DOUBLE "\\|" REGEX_DOUBLE "\\]" REGEX_SPACE REGEX_STRING REGEX_SPACE REGEX_DOUBLE REGEX_SPACE REGEX_UINT REGEX_SPACE "DUMMY_NODE_VECTOR([[:xdigit:]]+)" REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("EV_") && s.space() && s.name(m[1]) && s.delimiter(':') && s.oneOf("01", m[2]) && s.space() &&
+        s.character('[') && s.doubleValue(m[3]) && s.character('|') && s.doubleValue(m[4]) && s.character(']') && s.space() &&
+        s.quotedString(m[5]) && s.space() && s.doubleValue(m[6]) && s.space() && s.unsignedInteger(m[7]) && s.space() &&
+        s.keyword("DUMMY_NODE_VECTOR") && s.hexDigits(m[8]) && s.space() && s.toEndDelimiter(m[9]);
+}
+
+/* Environment Variable Data (ENVVAR_DATA) */
+bool matchEnvironmentVariableData(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "ENVVAR_DATA_" REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_UINT REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("ENVVAR_DATA_") && s.space() && s.name(m[1]) && s.delimiter(':') && s.unsignedInteger(m[2]) &&
+        s.endOfLineDelimiter();
+}
+
+/* Signal Type (SGTYPE, obsolete) */
+bool matchSignalType(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "SGTYPE_" REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_UINT "@([01])([+-])" REGEX_SPACE "\\(" REGEX_DOUBLE "," REGEX_DOUBLE "\\)" REGEX_SPACE "\\[" REGEX_DOUBLE "\\|" REGEX_DOUBLE "\\]" REGEX_SPACE REGEX_STRING REGEX_SPACE REGEX_DOUBLE REGEX_DELIM(",") REGEX_NAME REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("SGTYPE_") && s.space() && s.name(m[1]) && s.delimiter(':') && s.unsignedInteger(m[2]) &&
+        s.character('@') && s.oneOf("01", m[3]) && s.oneOf("+-", m[4]) && s.space() &&
+        s.character('(') && s.doubleValue(m[5]) && s.character(',') && s.doubleValue(m[6]) && s.character(')') && s.space() &&
+        s.character('[') && s.doubleValue(m[7]) && s.character('|') && s.doubleValue(m[8]) && s.character(']') && s.space() &&
+        s.quotedString(m[9]) && s.space() && s.doubleValue(m[10]) && s.delimiter(',') && s.name(m[11]) && s.endOfLineDelimiter();
+}
+
+/* Signal Type Ref (SGTYPE, obsolete) */
+bool matchSignalTypeRef(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "SGTYPE_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_NAME REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("SGTYPE_") && s.space() && s.unsignedInteger(m[1]) && s.space() && s.name(m[2]) &&
+        s.delimiter(':') && s.name(m[3]) && s.endOfLineDelimiter();
+}
+
+/* Comment (CM) for Network */
+bool matchCommentNetwork(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "CM_" REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("CM_") && s.space() && s.quotedString(m[1]) && s.endOfLineDelimiter();
+}
+
+/* Comment (CM) for Node (BU) */
+bool matchCommentNode(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "CM_" REGEX_SPACE "BU_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("CM_") && s.space() && s.keyword("BU_") && s.space() && s.name(m[1]) && s.space() &&
+        s.quotedString(m[2]) && s.endOfLineDelimiter();
+}
+
+/* Comment (CM) for Message (BO) */
+bool matchCommentMessage(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "CM_" REGEX_SPACE "BO_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("CM_") && s.space() && s.keyword("BO_") && s.space() && s.unsignedInteger(m[1]) && s.space() &&
+        s.quotedString(m[2]) && s.endOfLineDelimiter();
+}
+
+/* Comment (CM) for Signal (SG) */
+bool matchCommentSignal(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "CM_" REGEX_SPACE "SG_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("CM_") && s.space() && s.keyword("SG_") && s.space() && s.unsignedInteger(m[1]) && s.space() &&
+        s.name(m[2]) && s.space() && s.quotedString(m[3]) && s.endOfLineDelimiter();
+}
+
+/* Comment (CM) for Environment Variable (EV) */
+bool matchCommentEnvironmentVariable(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "CM_" REGEX_SPACE "EV_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("CM_") && s.space() && s.keyword("EV_") && s.space() && s.name(m[1]) && s.space() &&
+        s.quotedString(m[2]) && s.endOfLineDelimiter();
+}
+
+/* Attribute Definition (BA_DEF) */
+bool matchAttributeDefinition(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_DEF_" REGEX_SPACE "(BU_|BO_|SG_|EV_)?[[:space:]]*" REGEX_ATTRIB_NAME REGEX_SPACE "(INT|HEX|FLOAT|STRING|ENUM)[[:space:]]*" REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_DEF_") && s.space() && s.optionalKeyword(objectTypes, m[1]) && s.optionalSpace() &&
+        s.attributeName(m[2]) && s.space() && s.oneOfKeywords(valueTypes, m[3]) && s.optionalSpace() &&
+        s.toEndDelimiter(m[4]);
+}
+
+/* Attribute Definition at Relation (BA_DEF_REL) */
+bool matchAttributeDefinitionRelation(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_DEF_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_DEF_REL_") && s.space() && s.name(m[1]) && s.space() && s.attributeName(m[2]) && s.space() &&
+        s.name(m[3]) && s.space() && s.toEndDelimiter(m[4]);
+}
+
+/* Attribute Default (BA_DEF_DEF) */
+bool matchAttributeDefault(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_DEF_DEF_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_DEF_DEF_") && s.space() && s.attributeName(m[1]) && s.space() && s.toEndDelimiter(m[2]);
+}
+
+/* Attribute Default at Relation (BA_DEF_DEF_REL) */
+bool matchAttributeDefaultRelation(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_DEF_DEF_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_DEF_DEF_REL_") && s.space() && s.attributeName(m[1]) && s.space() && s.toEndDelimiter(m[2]);
+}
+
+/* Attribute Value (BA) for Network */
+bool matchAttributeValueNetwork(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_") && s.space() && s.attributeName(m[1]) && s.space() && s.toEndDelimiter(m[2]);
+}
+
+/* Attribute Value (BA) for Node (BU) */
+bool matchAttributeValueNode(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("BU_") && s.space() &&
+        s.name(m[2]) && s.space() && s.toEndDelimiter(m[3]);
+}
+
+/* Attribute Value (BA) for Message (BO) */
+bool matchAttributeValueMessage(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BO_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("BO_") && s.space() &&
+        s.unsignedInteger(m[2]) && s.space() && s.toEndDelimiter(m[3]);
+}
+
+/* Attribute Value (BA) for Signal (SG) */
+bool matchAttributeValueSignal(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "SG_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("SG_") && s.space() &&
+        s.unsignedInteger(m[2]) && s.space() && s.name(m[3]) && s.space() && s.toEndDelimiter(m[4]);
+}
+
+/* Attribute Value (BA) for Environment Variable (EV) */
+bool matchAttributeValueEnvironmentVariable(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "EV_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("EV_") && s.space() &&
+        s.name(m[2]) && s.space() && s.toEndDelimiter(m[3]);
+}
+
+/* Attribute Value at Relation (BA_REL) for "Control Unit - Env. Variable" (BU_EV_REL) */
+bool matchAttributeRelationValueControlUnitEnvironmentVariable(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_EV_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_REL_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("BU_EV_REL_") && s.space() &&
+        s.name(m[2]) && s.space() && s.name(m[3]) && s.space() && s.toEndDelimiter(m[4]);
+}
+
+/* Attribute Value at Relation (BA_REL) for "Node - Tx Message" (BU_BO_REL) */
+bool matchAttributeRelationValueNodeTxMessage(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_BO_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_REL_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("BU_BO_REL_") && s.space() &&
+        s.name(m[2]) && s.space() && s.unsignedInteger(m[3]) && s.space() && s.toEndDelimiter(m[4]);
+}
+
+/* Attribute Value at Relation (BA_REL) for "Node - Mapped Rx Signal" (BU_SG_REL) */
+bool matchAttributeRelationValueNodeMappedRxSignal(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "BA_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_SG_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE "SG_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("BA_REL_") && s.space() && s.attributeName(m[1]) && s.space() && s.keyword("BU_SG_REL_") && s.space() &&
+        s.name(m[2]) && s.space() && s.keyword("SG_") && s.space() && s.unsignedInteger(m[3]) && s.space() &&
+        s.name(m[4]) && s.space() && s.toEndDelimiter(m[5]);
+}
+
+/* Value Description (VAL) for Environment Variable (EV) */
+bool matchValueDescriptionEnvironmentVariable(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "VAL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("VAL_") && s.space() && s.name(m[1]) && s.space() && s.toEndDelimiter(m[2]);
+}
+
+/* Signal Group (SIG_GROUP) */
+bool matchSignalGroup(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "SIG_GROUP_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_UINT REGEX_DELIM(":") REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("SIG_GROUP_") && s.space() && s.unsignedInteger(m[1]) && s.space() && s.name(m[2]) && s.space() &&
+        s.unsignedInteger(m[3]) && s.delimiter(':') && s.toEndDelimiter(m[4]);
+}
+
+/* Signal Extended Value Type (SIG_VALTYPE, obsolete) */
+bool matchSignalExtendedValueType(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "SIG_VALTYPE_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_DELIM(":") "([012])" REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("SIG_VALTYPE_") && s.space() && s.unsignedInteger(m[1]) && s.space() && s.name(m[2]) &&
+        s.delimiter(':') && s.oneOf("012", m[3]) && s.endOfLineDelimiter();
+}
+
+/* Extended Multiplexor (SG_MUL_VAL) */
+bool matchExtendedMultiplexor(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL "SG_MUL_VAL_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.keyword("SG_MUL_VAL_") && s.space() && s.unsignedInteger(m[1]) && s.space() && s.name(m[2]) && s.space() &&
+        s.name(m[3]) && s.space() && s.toEndDelimiter(m[4]);
+}
+
+/* keyword at start of line */
+bool matchKeyword(File::Parser parser, const std::string & line, Match & m)
+{
+    if (parser == File::Parser::Regex) {
+        return regexMatch(line, m, REGEX_SOL REGEX_NAME);
+    }
+
+    Scanner s(line);
+    return s.startOfLine() &&
+        s.name(m[1]);
+}
+
+}
+
 /* Removes trailing spaces incl. windows/unix/mac line endings. */
 void File::chomp(std::string & line)
 {
@@ -100,7 +893,11 @@ void File::chomp(std::string & line)
     }
 
     /* remove trailing spaces */
-    line = regex_replace(line, regex("[[:space:]]+$"), "");
+    std::size_t end = line.size();
+    while ((end > 0) && isSpace(line[end - 1])) {
+        --end;
+    }
+    line.erase(end);
 }
 
 /* stod without C locale */
@@ -120,9 +917,8 @@ double File::stod(const std::string & str)
 /* Version (VERSION) */
 void File::readVersion(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "VERSION" REGEX_SPACE REGEX_STRING REGEX_EOL);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchVersion(parser, line, m)) {
         network.version = m[1];
         return;
     }
@@ -142,9 +938,8 @@ void File::readNewSymbols(Network & network, std::ifstream & ifs, std::string &
         if (line.empty())
             return;
 
-        smatch m;
-        regex re(REGEX_SOL REGEX_NAME REGEX_EOL);
-        if (regex_search(line, m, re)) {
+        Match m;
+        if (matchNewSymbol(parser, line, m)) {
             network.newSymbols.push_back(m[1]);
         }
     }
@@ -157,9 +952,8 @@ void File::readBitTiming(Network & network, std::string & line)
         // all ok
         return;
     } else {
-        smatch m;
-        regex re(REGEX_SOL "BS_:" REGEX_SPACE REGEX_UINT ":" REGEX_UINT ":" REGEX_UINT REGEX_EOL);
-        if (regex_search(line, m, re)) {
+        Match m;
+        if (matchBitTiming(parser, line, m)) {
             network.bitTiming.baudrate = stoul(m[1]);
             network.bitTiming.btr1 = stoul(m[2]);
             network.bitTiming.btr2 = stoul(m[2]);
@@ -191,9 +985,8 @@ void File::readNodes(Network & network, std::string & line)
 /* Value Tables (VAL_TABLE) */
 void File::readValueTable(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "VAL_TABLE_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchValueTable(parser, line, m)) {
         std::string valueTableName = m[1];
         ValueTable & valueTable = network.valueTables[valueTableName];
 
@@ -235,9 +1028,8 @@ void File::readValueTable(Network & network, std::string & line)
 /* Signals (SG) */
 void File::readSignal(Network & network, Message & message, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "SG_" REGEX_SPACE REGEX_NAME "[[:space:]]*((m[[:digit:]]+)|M)?[[:space:]]*:[[:space:]]*" REGEX_UINT "\\|" REGEX_UINT "@([01])([+-])" REGEX_SPACE "\\(" REGEX_DOUBLE "," REGEX_DOUBLE "\\)" REGEX_SPACE "\\[" REGEX_DOUBLE "\\|" REGEX_DOUBLE "\\]" REGEX_SPACE REGEX_STRING REGEX_SPACE REGEX_TO_END REGEX_EOL);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchSignal(parser, line, m)) {
         std::string signalName = m[1];
         Signal & signal = message.signals[signalName];
 
@@ -321,9 +1113,8 @@ void File::readSignal(Network & network, Message & message, std::string & line)
 /* Messages (BO) */
 Message * File::readMessage(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BO_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_EOL);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchMessage(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         Message & message = network.messages[messageId];
 
@@ -356,9 +1147,8 @@ Message * File::readMessage(Network & network, std::string & line)
 /* Message Transmitters (BO_TX_BU) */
 void File::readMessageTransmitter(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BO_TX_BU_" REGEX_SPACE REGEX_UINT REGEX_DELIM(":") REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchMessageTransmitter(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         Message & message = network.messages[messageId];
 
@@ -384,9 +1174,8 @@ void File::readMessageTransmitter(Network & network, std::string & line)
 /* Environment Variables (EV) */
 void File::readEnvironmentVariable(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "EV_" REGEX_SPACE REGEX_NAME REGEX_DELIM(":") "([01])" REGEX_SPACE "\\[" REGEX_DOUBLE "\\|" REGEX_DOUBLE "\\]" REGEX_SPACE REGEX_STRING REGEX_SPACE REGEX_DOUBLE REGEX_SPACE REGEX_UINT REGEX_SPACE "DUMMY_NODE_VECTOR([[:xdigit:]]+)" REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchEnvironmentVariable(parser, line, m)) {
         std::string envVarName = m[1];
         EnvironmentVariable & environmentVariable = network.environmentVariables[envVarName];
 
@@ -463,9 +1252,8 @@ void File::readEnvironmentVariable(Network & network, std::string & line)
 /* Environment Variable Data (ENVVAR_DATA) */
 void File::readEnvironmentVariableData(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "ENVVAR_DATA_" REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_UINT REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchEnvironmentVariableData(parser, line, m)) {
         std::string envVarName = m[1];
         EnvironmentVariable & environmentVariable = network.environmentVariables[envVarName];
 
@@ -490,9 +1278,8 @@ void File::readEnvironmentVariableData(Network & network, std::string & line)
 void File::readSignalType(Network & network, std::string & line)
 {
     // Signal Type
-    smatch m;
-    regex re(REGEX_SOL "SGTYPE_" REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_UINT "@([01])([+-])" REGEX_SPACE "\\(" REGEX_DOUBLE "," REGEX_DOUBLE "\\)" REGEX_SPACE "\\[" REGEX_DOUBLE "\\|" REGEX_DOUBLE "\\]" REGEX_SPACE REGEX_STRING REGEX_SPACE REGEX_DOUBLE REGEX_DELIM(",") REGEX_NAME REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchSignalType(parser, line, m)) {
         std::string signalTypeName = m[1];
         SignalType & signalType = network.signalTypes[signalTypeName];
 
@@ -544,9 +1331,8 @@ void File::readSignalType(Network & network, std::string & line)
     }
 
     // Signal Type Ref
-    smatch mSTR;
-    regex reSTR(REGEX_SOL "SGTYPE_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_DELIM(":") REGEX_NAME REGEX_EOL_DELIM);
-    if (regex_search(line, mSTR, reSTR)) {
+    Match mSTR;
+    if (matchSignalTypeRef(parser, line, mSTR)) {
         unsigned int messageId = stoul(mSTR[1]);
         std::string signalName = mSTR[2];
         std::string signalTypeName = mSTR[3];
@@ -563,9 +1349,8 @@ void File::readSignalType(Network & network, std::string & line)
 /* Comments (CM) for Networks */
 bool File::readCommentNetwork(Network & network, std::stack<std::size_t> & lineBreaks, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "CM_" REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchCommentNetwork(parser, line, m)) {
         std::string comment2 = m[1];
         while(!lineBreaks.empty()) {
             comment2.insert(lineBreaks.top(), endl);
@@ -590,9 +1375,8 @@ bool File::readCommentNetwork(Network & network, std::stack<std::size_t> & lineB
 /* Comments (CM) for Nodes (BU) */
 bool File::readCommentNode(Network & network, std::stack<std::size_t> & lineBreaks, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "CM_" REGEX_SPACE "BU_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchCommentNode(parser, line, m)) {
         std::string nodeName = m[1];
         std::string comment = m[2];
         while(!lineBreaks.empty()) {
@@ -618,9 +1402,8 @@ bool File::readCommentNode(Network & network, std::stack<std::size_t> & lineBrea
 /* Comments (CM) for Messages (BO) */
 bool File::readCommentMessage(Network & network, std::stack<std::size_t> & lineBreaks, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "CM_" REGEX_SPACE "BO_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchCommentMessage(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         std::string comment = m[2];
         while(!lineBreaks.empty()) {
@@ -646,9 +1429,8 @@ bool File::readCommentMessage(Network & network, std::stack<std::size_t> & lineB
 /* Comments (CM) for Signals (SG) */
 bool File::readCommentSignal(Network & network, std::stack<std::size_t> & lineBreaks, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "CM_" REGEX_SPACE "SG_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchCommentSignal(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         std::string signalName = m[2];
         std::string comment = m[3];
@@ -675,9 +1457,8 @@ bool File::readCommentSignal(Network & network, std::stack<std::size_t> & lineBr
 /* Comments (CM) for Environment Variables (EV) */
 bool File::readCommentEnvironmentVariable(Network & network, std::stack<std::size_t> & lineBreaks, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "CM_" REGEX_SPACE "EV_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_STRING REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchCommentEnvironmentVariable(parser, line, m)) {
         std::string envVarName = m[1];
         std::string comment = m[2];
         while(!lineBreaks.empty()) {
@@ -772,9 +1553,8 @@ void File::readComment(Network & network, std::ifstream & ifs, std::string & lin
 /* Attribute Definitions (BA_DEF) */
 void File::readAttributeDefinition(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_DEF_" REGEX_SPACE "(BU_|BO_|SG_|EV_)?[[:space:]]*" REGEX_ATTRIB_NAME REGEX_SPACE "(INT|HEX|FLOAT|STRING|ENUM)[[:space:]]*" REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeDefinition(parser, line, m)) {
         std::string objectType = m[1];
         std::string attributeName = m[2];
         std::string attributeValueType = m[3];
@@ -870,9 +1650,8 @@ void File::readAttributeDefinition(Network & network, std::string & line)
 /* Attribute Definitions at Relations (BA_DEF_REL) */
 void File::readAttributeDefinitionRelation(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_DEF_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeDefinitionRelation(parser, line, m)) {
         std::string objectType = m[1];
         std::string attributeName = m[2];
         std::string attributeValueType = m[3];
@@ -970,9 +1749,8 @@ void File::readAttributeDefinitionRelation(Network & network, std::string & line
 /* Attribute Defaults (BA_DEF_DEF) */
 void File::readAttributeDefault(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_DEF_DEF_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeDefault(parser, line, m)) {
         std::string attributeName = m[1];
         std::string attributeValue = m[2];
         AttributeDefinition & attributeDefinition = network.attributeDefinitions[attributeName];
@@ -1039,9 +1817,8 @@ void File::readAttributeDefault(Network & network, std::string & line)
 /* Attribute Defaults at Relations (BA_DEF_DEF_REL) */
 void File::readAttributeDefaultRelation(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_DEF_DEF_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeDefaultRelation(parser, line, m)) {
         std::string attributeName = m[1];
         std::string attributeValue = m[2];
         AttributeDefinition & attributeDefinition = network.attributeDefinitions[attributeName];
@@ -1108,9 +1885,8 @@ void File::readAttributeDefaultRelation(Network & network, std::string & line)
 /* Attribute Values (BA) for Network */
 bool File::readAttributeValueNetwork(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeValueNetwork(parser, line, m)) {
         std::string attributeName = m[1];
         std::string attributeValue = m[2];
         AttributeDefinition & attributeDefinition = network.attributeDefinitions[attributeName];
@@ -1198,9 +1974,8 @@ bool File::readAttributeValueNetwork(Network & network, std::string & line)
 /* Attribute Values (BA) for Node (BU) */
 bool File::readAttributeValueNode(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeValueNode(parser, line, m)) {
         std::string attributeName = m[1];
         std::string nodeName = m[2];
         std::string attributeValue = m[3];
@@ -1291,9 +2066,8 @@ bool File::readAttributeValueNode(Network & network, std::string & line)
 /* Attribute Values (BA) for Message (BO) */
 bool File::readAttributeValueMessage(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BO_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeValueMessage(parser, line, m)) {
         std::string attributeName = m[1];
         unsigned int messageId = stoul(m[2]);
         std::string attributeValue = m[3];
@@ -1382,9 +2156,8 @@ bool File::readAttributeValueMessage(Network & network, std::string & line)
 /* Attribute Values (BA) for Signal (SG) */
 bool File::readAttributeValueSignal(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "SG_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeValueSignal(parser, line, m)) {
         std::string attributeName = m[1];
         unsigned int messageId = stoul(m[2]);
         std::string signalName = m[3];
@@ -1474,9 +2247,8 @@ bool File::readAttributeValueSignal(Network & network, std::string & line)
 /* Attribute Values (BA) for Environment Variable (EV) */
 bool File::readAttributeValueEnvironmentVariable(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "BA_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "EV_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchAttributeValueEnvironmentVariable(parser, line, m)) {
         std::string attributeName = m[1];
         std::string envVarName = m[2];
         std::string attributeValue = m[3];
@@ -1604,9 +2376,8 @@ void File::readAttributeRelationValue(Network & network, std::string & line)
     std::string attributeValue;
 
     // for relation "Control Unit - Env. Variable" (BU_EV_REL)
-    smatch mBU_EV_REL;
-    regex reBU_EV_REL(REGEX_SOL "BA_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_EV_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (!found && regex_search(line, mBU_EV_REL, reBU_EV_REL)) {
+    Match mBU_EV_REL;
+    if (!found && matchAttributeRelationValueControlUnitEnvironmentVariable(parser, line, mBU_EV_REL)) {
         attributeRelation.relationType = AttributeRelation::RelationType::ControlUnitEnvironmentVariable;
         attributeRelation.name = mBU_EV_REL[1];
         attributeRelation.nodeName = mBU_EV_REL[2];
@@ -1616,9 +2387,8 @@ void File::readAttributeRelationValue(Network & network, std::string & line)
     }
 
     // for relation "Node - Tx Message" (BU_BO_REL)
-    smatch mBU_BO_REL;
-    regex reBU_BO_REL(REGEX_SOL "BA_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_BO_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (!found && regex_search(line, mBU_BO_REL, reBU_BO_REL)) {
+    Match mBU_BO_REL;
+    if (!found && matchAttributeRelationValueNodeTxMessage(parser, line, mBU_BO_REL)) {
         attributeRelation.relationType = AttributeRelation::RelationType::NodeTxMessage;
         attributeRelation.name = mBU_BO_REL[1];
         attributeRelation.nodeName = mBU_BO_REL[2];
@@ -1628,9 +2398,8 @@ void File::readAttributeRelationValue(Network & network, std::string & line)
     }
 
     // for relation "Node - Mapped Rx Signal" (BU_SG_REL)
-    smatch mBU_SG_REL;
-    regex reBU_SG_REL(REGEX_SOL "BA_REL_" REGEX_SPACE REGEX_ATTRIB_NAME REGEX_SPACE "BU_SG_REL_" REGEX_SPACE REGEX_NAME REGEX_SPACE "SG_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (!found && regex_search(line, mBU_SG_REL, reBU_SG_REL)) {
+    Match mBU_SG_REL;
+    if (!found && matchAttributeRelationValueNodeMappedRxSignal(parser, line, mBU_SG_REL)) {
         attributeRelation.relationType = AttributeRelation::RelationType::NodeMappedRxSignal;
         attributeRelation.name = mBU_SG_REL[1];
         attributeRelation.nodeName = mBU_SG_REL[2];
@@ -1924,9 +2693,8 @@ bool File::readValueDescriptionSignal(Network & network, std::ifstream & ifs, st
 /* Value Descriptions (VAL) for Environment Variables (EV) */
 bool File::readValueDescriptionEnvironmentVariable(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "VAL_" REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchValueDescriptionEnvironmentVariable(parser, line, m)) {
         std::string envVarName = m[1];
         ValueDescriptions & valueDescriptions = network.environmentVariables[envVarName].valueDescriptions;
 
@@ -1992,9 +2760,8 @@ void File::readValueDescription(Network & network, std::ifstream & ifs, std::str
 /* Signal Groups (SIG_GROUP) */
 void File::readSignalGroup(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "SIG_GROUP_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_UINT REGEX_DELIM(":") REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchSignalGroup(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         std::string signalGroupName = m[2];
         SignalGroup & signalGroup = network.messages[messageId].signalGroups[signalGroupName];
@@ -2026,9 +2793,8 @@ void File::readSignalGroup(Network & network, std::string & line)
 /* Signal Extended Value Types (SIG_VALTYPE, obsolete) */
 void File::readSignalExtendedValueType(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "SIG_VALTYPE_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_DELIM(":") "([012])" REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchSignalExtendedValueType(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         std::string signalName = m[2];
 
@@ -2060,9 +2826,8 @@ void File::readSignalExtendedValueType(Network & network, std::string & line)
 /* Extended Multiplexors (SG_MUL_VAL) */
 void File::readExtendedMultiplexor(Network & network, std::string & line)
 {
-    smatch m;
-    regex re(REGEX_SOL "SG_MUL_VAL_" REGEX_SPACE REGEX_UINT REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_NAME REGEX_SPACE REGEX_TO_END REGEX_EOL_DELIM);
-    if (regex_search(line, m, re)) {
+    Match m;
+    if (matchExtendedMultiplexor(parser, line, m)) {
         unsigned int messageId = stoul(m[1]);
         std::string multiplexedSignalName = m[2];
         std::string switchName = m[3];
@@ -2131,9 +2896,8 @@ Status File::load(Network & network, const char * filename)
         chomp(line);
 
         /* parse line */
-        smatch m;
-        regex re(REGEX_SOL REGEX_NAME);
-        if ((!line.empty()) && (regex_search(line, m, re))) {
+        Match m;
+        if ((!line.empty()) && (matchKeyword(parser, line, m))) {
             std::string name = m[1];
             Message * newMessageContext = nullptr;
 
@@ -140,6 +140,73 @@ void performance_test_3(Vector::DBC::ByteOrder byteOrder, Vector::DBC::ValueType
     }
 }
 
+/**
+ * This measures the time to load a database file with both parsers.
+ *
+ * The generated columns are:
+ * - Number of messages in database (random in range 1..200, each with 8 signals)
+ * - Measured load time with regular expressions (nanoseconds)
+ * - Measured load time with tokenizer (nanoseconds)
+ */
+void performance_test_4()
+{
+    /* loading is expensive, so less iterations */
+    const int loadMeasurements = 50;
+    const char * filename = "performance_test_4.dbc";
+
+    /* multiple measurement loops */
+    for (int i = 0; i < loadMeasurements; ++i) {
+        unsigned int messageCount = (rand() % 200) + 1;
+
+        /* setup the database with random number of messages and save it */
+        {
+            Vector::DBC::Network network;
+            for (unsigned int id = 0; id < messageCount; ++id) {
+                Vector::DBC::Message & message = network.messages[id];
+                message.id = id;
+                message.name = "message_" + std::to_string(id);
+                message.size = 8;
+                message.comment = "comment of message " + std::to_string(id);
+                for (unsigned int nr = 0; nr < 8; ++nr) {
+                    std::string signalName = "signal_" + std::to_string(id) + "_" + std::to_string(nr);
+                    Vector::DBC::Signal & signal = message.signals[signalName];
+                    signal.name = signalName;
+                    signal.startBit = 8 * nr;
+                    signal.bitSize = 8;
+                    signal.factor = 0.5;
+                    signal.maximumPhysicalValue = 127.5;
+                    signal.unit = "km/h";
+                    signal.valueDescriptions[0] = "off";
+                    signal.valueDescriptions[1] = "on";
+                }
+            }
+            Vector::DBC::File file;
+            file.save(network, filename);
+        }
+
+        /* and load it with both parsers */
+        Vector::DBC::File regexFile;
+        regexFile.setParser(Vector::DBC::File::Parser::Regex);
+        Vector::DBC::Network regexNetwork;
+        auto t1 = std::chrono::high_resolution_clock::now();
+        regexFile.load(regexNetwork, filename);
+        auto t2 = std::chrono::high_resolution_clock::now();
+
+        Vector::DBC::File tokenizerFile;
+        tokenizerFile.setParser(Vector::DBC::File::Parser::Tokenizer);
+        Vector::DBC::Network tokenizerNetwork;
+        auto t3 = std::chrono::high_resolution_clock::now();
+        tokenizerFile.load(tokenizerNetwork, filename);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        assert(regexNetwork.messages.size() == tokenizerNetwork.messages.size());
+
+        /* print result */
+        std::chrono::nanoseconds regexNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t2-t1);
+        std::chrono::nanoseconds tokenizerNs = std::chrono::duration_cast<std::chrono::nanoseconds>(t4-t3);
+        std::cout << messageCount << "\t" << regexNs.count() << "\t" << tokenizerNs.count() << std::endl;
+    }
+}
+
 int main(int argc, char **argv)
 {
     /* safety check */
@@ -168,6 +235,9 @@ int main(int argc, char **argv)
     else
     if (id == "3bu")
         performance_test_3(Vector::DBC::ByteOrder::BigEndian, Vector::DBC::ValueType::Unsigned);
+    else
+    if (id == "4")
+        performance_test_4();
 
     return 0;
 }
@@ -82,6 +82,18 @@ set output "table_${ID}.pdf"
 plot 'table_${ID}.csv' using 1:2
 END
 
+ID="4"
+echo ${ID}
+./performance_test ${ID} > table_${ID}.csv
+gnuplot << END
+set title "time to load a database file (8 signals per message)"
+set xlabel "number of messages"
+set ylabel "load time (ns)"
+set terminal pdf
+set output "table_${ID}.pdf"
+plot 'table_${ID}.csv' using 1:2 title "regex", 'table_${ID}.csv' using 1:3 title "tokenizer"
+END
+
 echo "Generating report"
 pdftk table_*.pdf cat output - > performance_measurement.pdf
 
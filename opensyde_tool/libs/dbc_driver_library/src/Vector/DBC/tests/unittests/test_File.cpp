@@ -8,6 +8,7 @@
 #include <iostream>
 #include <iterator>
 #include <string>
+#include <vector>
 #include <boost/filesystem.hpp>
 
 #include <Vector/DBC.h>
@@ -72,3 +73,51 @@ BOOST_AUTO_TEST_CASE(File)
     std::istream_iterator<char> b2(ifs2), e2;
     BOOST_CHECK_EQUAL_COLLECTIONS(b1, e1, b2, e2);
 }
+
+/** load database file with the given parser, save it again and return the recorded status codes */
+std::vector<Vector::DBC::Status> loadAndSave(Vector::DBC::File::Parser parser,
+                                             const boost::filesystem::path & infile,
+                                             const boost::filesystem::path & outfile)
+{
+    std::vector<Vector::DBC::Status> statusCodes;
+    Vector::DBC::Network network;
+    Vector::DBC::File file;
+    file.setParser(parser);
+    file.setStatusCallback([&statusCodes](Vector::DBC::Network & /* network */, Vector::DBC::Status status) {
+        statusCodes.push_back(status);
+    });
+
+    std::string infilename = infile.string();
+    BOOST_REQUIRE(file.load(network, infilename) == Vector::DBC::Status::Ok);
+
+    std::string outfilename = outfile.string();
+    BOOST_REQUIRE(file.save(network, outfilename) == Vector::DBC::Status::Ok);
+
+    return statusCodes;
+}
+
+BOOST_AUTO_TEST_CASE(FileParser)
+{
+    /* create output directory */
+    boost::filesystem::path outdir(CMAKE_CURRENT_BINARY_DIR "/data/");
+    if (!exists(outdir)) {
+        BOOST_REQUIRE(create_directory(outdir));
+    }
+
+    /* load database file with both parsers */
+    boost::filesystem::path infile(CMAKE_CURRENT_SOURCE_DIR "/data/Database.dbc");
+    boost::filesystem::path regexfile(CMAKE_CURRENT_BINARY_DIR "/data/Database_Regex.dbc");
+    boost::filesystem::path tokenizerfile(CMAKE_CURRENT_BINARY_DIR "/data/Database_Tokenizer.dbc");
+    std::vector<Vector::DBC::Status> regexStatusCodes =
+        loadAndSave(Vector::DBC::File::Parser::Regex, infile, regexfile);
+    std::vector<Vector::DBC::Status> tokenizerStatusCodes =
+        loadAndSave(Vector::DBC::File::Parser::Tokenizer, infile, tokenizerfile);
+
+    /* both parsers should report the same and result in the same network */
+    BOOST_CHECK(regexStatusCodes == tokenizerStatusCodes);
+    std::ifstream ifs1(regexfile.c_str());
+    std::ifstream ifs2(tokenizerfile.c_str());
+    std::istreambuf_iterator<char> b1(ifs1), e1;
+    std::istreambuf_iterator<char> b2(ifs2), e2;
+    BOOST_CHECK_EQUAL_COLLECTIONS(b1, e1, b2, e2);
+}
@@ -12,10 +12,12 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h"
 
+#include <cstdio>
 #include "stwerrors.h"
 #include "TGLFile.h"
 #include "TGLUtils.h"
-#include "C_OSCChecksummedXML.h"
+#include "C_OSCXMLStreamReader.h"
+#include "C_OSCXMLStreamWriter.h"
 #include "C_OSCParamSetFilerBase.h"
 #include "C_OSCLoggingHandler.h"
 
@@ -42,6 +44,12 @@ stw_types::uint16 C_OSCParamSetFilerBase::mhu16_FileVersion = 1;
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add CRC to specified file
 
+   The file is copied node by node to a temporary file which then replaces the original file.
+   The CRC is calculated while writing, so the file is never loaded completely.
+   Before replacing the original, the CRC calculated while reading the original is compared to the one written.
+   So the copy is verified without reading the temporary file again.
+   The original is kept as backup until the temporary file took its place.
+
    \param[in] orc_Path File path
 
    \return
@@ -57,19 +65,49 @@ sint32 C_OSCParamSetFilerBase::h_AddCRC(const C_SCLString & orc_Path)
 
    if (TGL_FileExists(orc_Path) == true)
    {
-      C_OSCChecksummedXML c_XMLParser;
-      s32_Return = c_XMLParser.LoadFromFile(orc_Path);
-      //ignore missing and incorrect CRC; we want to set it
-      if ((s32_Return == C_NO_ERR) || (s32_Return == C_CHECKSUM) || (s32_Return == C_RD_WR))
+      C_OSCXMLStreamReader c_Reader;
+      s32_Return = c_Reader.Open(orc_Path);
+      if (s32_Return == C_NO_ERR)
       {
          //do we have the correct type of file ?
-         if (c_XMLParser.SelectRoot() != "opensyde-parameter-sets")
+         if (c_Reader.SelectRoot() != "opensyde-parameter-sets")
          {
             s32_Return = C_CONFIG;
          }
          else
          {
-            s32_Return = c_XMLParser.SaveToFile(orc_Path);
+            const C_SCLString c_TempPath = orc_Path + ".tmp";
+            C_OSCXMLStreamWriter c_Writer;
+            s32_Return = c_Writer.Open(c_TempPath, true);
+            if (s32_Return == C_NO_ERR)
+            {
+               uint16 u16_Crc = 0U;
+               s32_Return = mh_CopyNodes(c_Reader, c_Writer);
+               if (s32_Return == C_NO_ERR)
+               {
+                  //make sure the rest of the file is valid XML and get CRC of original content
+                  s32_Return = c_Reader.ReadToEnd(u16_Crc);
+               }
+               if (c_Writer.Close() != C_NO_ERR)
+               {
+                  s32_Return = C_NOACT;
+               }
+               c_Reader.Close();
+               if ((s32_Return == C_NO_ERR) && (u16_Crc != c_Writer.GetCRC()))
+               {
+                  osc_write_log_error("Adding CRC to Dataset file", "Written file \"" + c_TempPath +
+                                      "\" does not match the original.");
+                  s32_Return = C_NOACT;
+               }
+               if (s32_Return == C_NO_ERR)
+               {
+                  s32_Return = mh_ReplaceFile(c_TempPath, orc_Path);
+               }
+               if (s32_Return != C_NO_ERR)
+               {
+                  (void)std::remove(c_TempPath.c_str());
+               }
+            }
          }
       }
       if (s32_Return == C_NOACT)
@@ -85,6 +123,114 @@ sint32 C_OSCParamSetFilerBase::h_AddCRC(const C_SCLString & orc_Path)
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Replace file by new version
+
+   The original file is renamed to a backup first. It is only removed after the new file took its place.
+   If the new file can not be moved the original is restored.
+
+   \param[in] orc_NewPath  path of new version of file
+   \param[in] orc_Path     path of file to replace
+
+   \return
+   C_NO_ERR   file replaced
+   C_NOACT    could not replace file (original is still in place)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCParamSetFilerBase::mh_ReplaceFile(const C_SCLString & orc_NewPath, const C_SCLString & orc_Path)
+{
+   sint32 s32_Return = C_NOACT;
+   const C_SCLString c_BackupPath = orc_Path + ".bak";
+
+   //leftover of an earlier run
+   if (TGL_FileExists(c_BackupPath) == true)
+   {
+      (void)std::remove(c_BackupPath.c_str());
+   }
+   if (std::rename(orc_Path.c_str(), c_BackupPath.c_str()) == 0)
+   {
+      if (std::rename(orc_NewPath.c_str(), orc_Path.c_str()) == 0)
+      {
+         (void)std::remove(c_BackupPath.c_str());
+         s32_Return = C_NO_ERR;
+      }
+      else
+      {
+         (void)std::rename(c_BackupPath.c_str(), orc_Path.c_str());
+      }
+   }
+   if (s32_Return != C_NO_ERR)
+   {
+      osc_write_log_error("Adding CRC to Dataset file", "Could not replace file \"" + orc_Path + "\".");
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Copy parameter set file content node by node
+
+   The root node and the "nodes" element are entered, all other elements are copied as a whole.
+   pre-condition: the reader has the root node active; the writer is empty
+   post-condition: all content of the root node was passed to the writer
+
+   \param[in,out] orc_Reader   source file
+   \param[in,out] orc_Writer   target file
+
+   \return
+   C_NO_ERR   content copied
+   C_NOACT    invalid XML or could not write
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCParamSetFilerBase::mh_CopyNodes(C_OSCXMLStreamReader & orc_Reader, C_OSCXMLStreamWriter & orc_Writer)
+{
+   sint32 s32_Return = C_NO_ERR;
+   C_SCLString c_NextNode = orc_Reader.GetNextNodeName();
+
+   orc_Writer.CreateNodeChildCopy(orc_Reader);
+   tgl_assert(orc_Writer.SelectRoot() == "opensyde-parameter-sets");
+   while ((s32_Return == C_NO_ERR) && (c_NextNode != ""))
+   {
+      if (c_NextNode == "nodes")
+      {
+         s32_Return = orc_Reader.EnterNextNode();
+         if (s32_Return == C_NO_ERR)
+         {
+            orc_Writer.CreateNodeChildCopy(orc_Reader);
+            tgl_assert(orc_Writer.SelectNodeChild("nodes") == "nodes");
+            c_NextNode = orc_Reader.GetNextNodeName();
+            while ((s32_Return == C_NO_ERR) && (c_NextNode != ""))
+            {
+               s32_Return = orc_Reader.ReadNextNode();
+               if (s32_Return == C_NO_ERR)
+               {
+                  orc_Writer.CreateNodeChildCopy(orc_Reader);
+                  orc_Reader.DiscardReadNodes();
+                  s32_Return = orc_Writer.Flush();
+               }
+               c_NextNode = orc_Reader.GetNextNodeName();
+            }
+         }
+         if (s32_Return == C_NO_ERR)
+         {
+            s32_Return = orc_Reader.LeaveNode();
+            tgl_assert(orc_Writer.SelectNodeParent() == "opensyde-parameter-sets");
+         }
+      }
+      else
+      {
+         s32_Return = orc_Reader.ReadNextNode();
+         if (s32_Return == C_NO_ERR)
+         {
+            orc_Writer.CreateNodeChildCopy(orc_Reader);
+            orc_Reader.DiscardReadNodes();
+            s32_Return = orc_Writer.Flush();
+         }
+      }
+      c_NextNode = orc_Reader.GetNextNodeName();
+   }
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Check parameter set file version
 
@@ -15,7 +15,7 @@
 #include <vector>
 #include "stwtypes.h"
 #include "CSCLString.h"
-#include "C_OSCXMLParser.h"
+#include "C_OSCXMLStreamReader.h"
 #include "C_OSCParamSetInterpretedData.h"
 #include "C_OSCParamSetRawNode.h"
 
@@ -55,7 +55,7 @@ private:
    C_OSCParamSetInterpretedData mc_Data;
    std::vector<C_OSCParamSetRawNode> mc_RawNodes;
 
-   stw_types::sint32 m_LoadNodes(C_OSCXMLParser & orc_XMLParser, const bool oq_InterpretedDataOnly,
+   stw_types::sint32 m_LoadNodes(C_OSCXMLStreamReader & orc_XMLParser, const bool oq_InterpretedDataOnly,
                                  bool & orq_MissingOptionalContent);
 };
 
@@ -122,11 +122,11 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntries(std::vector<C_OSCParamSetRawEnt
    sint32 s32_Retval = C_NO_ERR;
 
    orc_Entries.clear();
-   if (orc_XMLParser.SelectNodeChild("raw") == "raw")
+   if (orc_XMLParser.TrySelectNodeChild("raw") == true)
    {
-      C_SCLString c_SelectedNode = orc_XMLParser.SelectNodeChild("raw-entry");
+      bool q_SelectedNodeFound = orc_XMLParser.TrySelectNodeChild("raw-entry");
 
-      if (c_SelectedNode == "raw-entry")
+      if (q_SelectedNodeFound == true)
       {
          do
          {
@@ -138,11 +138,11 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntries(std::vector<C_OSCParamSetRawEnt
             }
 
             //Next
-            c_SelectedNode = orc_XMLParser.SelectNodeNext("raw-entry");
+            q_SelectedNodeFound = orc_XMLParser.TrySelectNodeNext("raw-entry");
          }
-         while ((c_SelectedNode == "raw-entry") && (s32_Retval == C_NO_ERR));
+         while ((q_SelectedNodeFound == true) && (s32_Retval == C_NO_ERR));
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "raw");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("raw"));
       }
       else
       {
@@ -150,7 +150,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntries(std::vector<C_OSCParamSetRawEnt
          s32_Retval = C_CONFIG;
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
    }
    else
    {
@@ -174,7 +174,7 @@ void C_OSCParamSetRawNodeFiler::mh_SaveEntries(const std::vector<C_OSCParamSetRa
                                                C_OSCXMLParserBase & orc_XMLParser)
 {
    //Clean start
-   if (orc_XMLParser.SelectNodeChild("raw") == "raw")
+   if (orc_XMLParser.TrySelectNodeChild("raw") == true)
    {
       tgl_assert(orc_XMLParser.DeleteNode() == "raw");
       tgl_assert(orc_XMLParser.SelectRoot() == "opensyde-parameter-sets");
@@ -185,10 +185,10 @@ void C_OSCParamSetRawNodeFiler::mh_SaveEntries(const std::vector<C_OSCParamSetRa
       tgl_assert(orc_XMLParser.CreateAndSelectNodeChild("raw-entry") == "raw-entry");
       C_OSCParamSetRawNodeFiler::mh_SaveEntry(orc_Entries[u32_Index], orc_XMLParser);
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "raw");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("raw"));
    }
    //Return
-   tgl_assert(orc_XMLParser.SelectNodeParent() == "node");
+   tgl_assert(orc_XMLParser.TrySelectNodeParent("node"));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -210,7 +210,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntry(C_OSCParamSetRawEntry & orc_Entry
 {
    sint32 s32_Retval = C_NO_ERR;
 
-   if (orc_XMLParser.SelectNodeChild("address") == "address")
+   if (orc_XMLParser.TrySelectNodeChild("address") == true)
    {
       try
       {
@@ -223,7 +223,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntry(C_OSCParamSetRawEntry & orc_Entry
          s32_Retval = C_CONFIG;
       }
       //Return
-      tgl_assert(orc_XMLParser.SelectNodeParent() == "raw-entry");
+      tgl_assert(orc_XMLParser.TrySelectNodeParent("raw-entry"));
    }
    else
    {
@@ -232,7 +232,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntry(C_OSCParamSetRawEntry & orc_Entry
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("value") == "value")
+      if (orc_XMLParser.TrySelectNodeChild("value") == true)
       {
          const C_SCLString c_Content = orc_XMLParser.GetNodeContent();
          SCLDynamicArray<C_SCLString> c_Tokens;
@@ -254,7 +254,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntry(C_OSCParamSetRawEntry & orc_Entry
             }
          }
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "raw-entry");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("raw-entry"));
       }
       else
       {
@@ -264,7 +264,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntry(C_OSCParamSetRawEntry & orc_Entry
    }
    if (s32_Retval == C_NO_ERR)
    {
-      if (orc_XMLParser.SelectNodeChild("size") == "size")
+      if (orc_XMLParser.TrySelectNodeChild("size") == true)
       {
          uint32 u32_Size = 0;
          try
@@ -283,7 +283,7 @@ sint32 C_OSCParamSetRawNodeFiler::mh_LoadEntry(C_OSCParamSetRawEntry & orc_Entry
             }
          }
          //Return
-         tgl_assert(orc_XMLParser.SelectNodeParent() == "raw-entry");
+         tgl_assert(orc_XMLParser.TrySelectNodeParent("raw-entry"));
       }
       else
       {
@@ -0,0 +1,384 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Buffered writer for generated source files
+
+   Collects the complete content of one generated file in a single buffer.
+   Compared to a C_SCLStringList there is no string object per line and numbers are formatted directly into
+   the buffer, so large tables (e.g. Datapool init values) can be generated without temporary strings.
+
+   Lines are terminated with "\r\n" (same file format as C_SCLStringList::SaveToFile).
+   The buffer is written to disk in one go and only if the file does not already have the same content.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "stwtypes.h"
+#include "stwerrors.h"
+#include "C_OSCExportCodeWriter.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_errors;
+using namespace stw_scl;
+using namespace stw_opensyde_core;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+static const charn mcn_INDENT[] = "            ";
+static const charn mcn_LINE_END[] = "\r\n";
+static const uintn mun_COMPARE_CHUNK_SIZE = 65536U;
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+const uint32 C_OSCExportCodeWriter::mhu32_INDENT_WIDTH = 3U;
+const uint32 C_OSCExportCodeWriter::mhu32_INITIAL_CAPACITY = 65536U;
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_OSCExportCodeWriter::C_OSCExportCodeWriter(void) :
+   mu32_Indent(0U),
+   mq_LineStarted(false)
+{
+   this->mc_Buffer.reserve(mhu32_INITIAL_CAPACITY);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append one complete line
+
+   Functionally identical to C_SCLStringList::Append.
+   If a line was already started with WriteText etc. the text is added to that line and the line is finished.
+
+   \param[in]  orc_Line   line to append (without line end)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::Append(const C_SCLString & orc_Line)
+{
+   this->WriteText(orc_Line);
+   this->EndLine();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Append one complete line
+
+   Version for string literals; no C_SCLString instance is created.
+
+   \param[in]  opcn_Line   line to append (without line end)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::Append(const charn * const opcn_Line)
+{
+   this->WriteText(opcn_Line);
+   this->EndLine();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all content
+
+   The allocated buffer is kept for the next file.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::Clear(void)
+{
+   this->mc_Buffer.clear();
+   this->mu32_Indent = 0U;
+   this->mq_LineStarted = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add text to current line
+
+   \param[in]  orc_Text   text to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::WriteText(const C_SCLString & orc_Text)
+{
+   this->m_WriteRaw(orc_Text.c_str(), orc_Text.Length());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add text to current line
+
+   \param[in]  opcn_Text   zero terminated text to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::WriteText(const charn * const opcn_Text)
+{
+   this->m_WriteRaw(opcn_Text, std::strlen(opcn_Text));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add unsigned number in decimal notation to current line
+
+   Same result as C_SCLString::IntToStr.
+
+   \param[in]  ou64_Value   value to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::WriteUnsigned(const uint64 ou64_Value)
+{
+   charn acn_Digits[20]; // enough for the highest uint64 value
+   uintn un_Start = sizeof(acn_Digits);
+   uint64 u64_Rest = ou64_Value;
+
+   do
+   {
+      --un_Start;
+      acn_Digits[un_Start] = static_cast<charn>('0' + static_cast<sintn>(u64_Rest % 10U));
+      u64_Rest /= 10U;
+   }
+   while (u64_Rest > 0U);
+
+   this->m_WriteRaw(&acn_Digits[un_Start], sizeof(acn_Digits) - un_Start);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add signed number in decimal notation to current line
+
+   Same result as C_SCLString::IntToStr.
+
+   \param[in]  os64_Value   value to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::WriteSigned(const sint64 os64_Value)
+{
+   if (os64_Value < 0)
+   {
+      this->m_WriteRaw("-", 1U);
+      //calculate magnitude without overflow for the lowest possible value
+      this->WriteUnsigned(static_cast<uint64>(-(os64_Value + 1)) + 1U);
+   }
+   else
+   {
+      this->WriteUnsigned(static_cast<uint64>(os64_Value));
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add number in hexadecimal notation to current line
+
+   Same result as C_SCLString::IntToHex: lower case digits, no "0x" prefix.
+
+   \param[in]  ou64_Value    value to add
+   \param[in]  ou32_Digits   minimum number of digits (zeroes will be filled in from the left)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::WriteHex(const uint64 ou64_Value, const uint32 ou32_Digits)
+{
+   static const charn hacn_HEX_DIGITS[] = "0123456789abcdef";
+   charn acn_Digits[16]; // enough for the highest uint64 value
+   uintn un_Start = sizeof(acn_Digits);
+   uint64 u64_Rest = ou64_Value;
+   uint32 u32_Fill;
+
+   do
+   {
+      --un_Start;
+      acn_Digits[un_Start] = hacn_HEX_DIGITS[static_cast<uintn>(u64_Rest & 0xFU)];
+      u64_Rest >>= 4U;
+   }
+   while (u64_Rest > 0U);
+
+   for (u32_Fill = static_cast<uint32>(sizeof(acn_Digits) - un_Start); u32_Fill < ou32_Digits; u32_Fill++)
+   {
+      this->m_WriteRaw("0", 1U);
+   }
+   this->m_WriteRaw(&acn_Digits[un_Start], sizeof(acn_Digits) - un_Start);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add floating point number to current line
+
+   Same result as C_OSCExportUti::h_FloatToStrCutZeroes with default precision:
+   6 digits after the decimal point with trailing zeroes removed (at least one digit remains).
+
+   \param[in]  of64_Value   value to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::WriteFloat(const float64 of64_Value)
+{
+   // "%f" of the highest float64 value results in 309 digits, sign, decimal point and 6 decimals
+   charn acn_Text[330];
+   const sintn sn_Length = std::sprintf(&acn_Text[0], "%f", of64_Value);
+
+   if (sn_Length > 0)
+   {
+      uintn un_Length = static_cast<uintn>(sn_Length);
+      const charn * const pcn_Point = static_cast<const charn *>(std::memchr(&acn_Text[0], '.', un_Length));
+
+      if (pcn_Point != NULL)
+      {
+         // cut trailing zeroes but keep one digit after the decimal point
+         const uintn un_MinLength = static_cast<uintn>(pcn_Point - &acn_Text[0]) + 2U;
+         while ((un_Length > un_MinLength) && (acn_Text[un_Length - 1U] == '0'))
+         {
+            --un_Length;
+         }
+      }
+      this->m_WriteRaw(&acn_Text[0], un_Length);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Finish current line
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::EndLine(void)
+{
+   this->mc_Buffer.append(&mcn_LINE_END[0], sizeof(mcn_LINE_END) - 1U);
+   this->mq_LineStarted = false;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Increase indentation of following lines by one level (3 spaces)
+
+   Empty lines are not indented.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::IncIndent(void)
+{
+   this->mu32_Indent++;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Decrease indentation of following lines by one level
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::DecIndent(void)
+{
+   if (this->mu32_Indent > 0U)
+   {
+      this->mu32_Indent--;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store content to file
+
+   A file that already has the same content is not touched, so builds of the target do not compile it again.
+
+   \param[in]  orc_PathAndFilename   full path of file to create
+
+   \return
+   C_NO_ERR   content stored (or file already up to date)
+   C_RD_WR    could not write file
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCExportCodeWriter::SaveToFile(const C_SCLString & orc_PathAndFilename) const
+{
+   sint32 s32_Retval = C_NO_ERR;
+
+   if (this->m_IsFileContentEqual(orc_PathAndFilename) == false)
+   {
+      std::FILE * const pt_File = std::fopen(orc_PathAndFilename.c_str(), "wb");
+
+      if (pt_File == NULL)
+      {
+         s32_Retval = C_RD_WR;
+      }
+      else
+      {
+         if (std::fwrite(this->mc_Buffer.data(), 1U, this->mc_Buffer.size(), pt_File) != this->mc_Buffer.size())
+         {
+            s32_Retval = C_RD_WR;
+         }
+         if (std::fclose(pt_File) != 0)
+         {
+            s32_Retval = C_RD_WR;
+         }
+      }
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add raw text to buffer
+
+   Adds the pending indentation if this is the first text in the current line.
+
+   \param[in]  opcn_Text    text to add
+   \param[in]  oun_Length   number of characters to add
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCExportCodeWriter::m_WriteRaw(const charn * const opcn_Text, const uintn oun_Length)
+{
+   if (oun_Length > 0U)
+   {
+      if (this->mq_LineStarted == false)
+      {
+         uint32 u32_Spaces = this->mu32_Indent * mhu32_INDENT_WIDTH;
+         while (u32_Spaces > 0U)
+         {
+            const uint32 u32_Chunk = (u32_Spaces < (sizeof(mcn_INDENT) - 1U)) ?
+                                     u32_Spaces : static_cast<uint32>(sizeof(mcn_INDENT) - 1U);
+            this->mc_Buffer.append(&mcn_INDENT[0], u32_Chunk);
+            u32_Spaces -= u32_Chunk;
+         }
+         this->mq_LineStarted = true;
+      }
+      this->mc_Buffer.append(opcn_Text, oun_Length);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check whether file already has the content that would be saved
+
+   \param[in]  orc_PathAndFilename  Path to file
+
+   \return
+   true   file exists and has the same content
+   false  file does not exist, can not be read or differs
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_OSCExportCodeWriter::m_IsFileContentEqual(const C_SCLString & orc_PathAndFilename) const
+{
+   bool q_Equal = false;
+   std::FILE * const pt_File = std::fopen(orc_PathAndFilename.c_str(), "rb");
+
+   if (pt_File != NULL)
+   {
+      sintn sn_FileSize;
+
+      (void)std::fseek(pt_File, 0, SEEK_END);
+      sn_FileSize = std::ftell(pt_File);
+      (void)std::fseek(pt_File, 0, SEEK_SET);
+
+      if ((sn_FileSize >= 0) && (static_cast<uintn>(sn_FileSize) == this->mc_Buffer.size()))
+      {
+         std::vector<charn> c_Chunk(mun_COMPARE_CHUNK_SIZE);
+         uintn un_Offset = 0U;
+
+         q_Equal = true;
+         while ((un_Offset < this->mc_Buffer.size()) && (q_Equal == true))
+         {
+            const uintn un_Remaining = this->mc_Buffer.size() - un_Offset;
+            const uintn un_Size = (un_Remaining < mun_COMPARE_CHUNK_SIZE) ? un_Remaining : mun_COMPARE_CHUNK_SIZE;
+            if ((std::fread(&c_Chunk[0], 1U, un_Size, pt_File) != un_Size) ||
+                (std::memcmp(&c_Chunk[0], this->mc_Buffer.data() + un_Offset, un_Size) != 0))
+            {
+               q_Equal = false;
+            }
+            un_Offset += un_Size;
+         }
+      }
+      (void)std::fclose(pt_File);
+   }
+   return q_Equal;
+}
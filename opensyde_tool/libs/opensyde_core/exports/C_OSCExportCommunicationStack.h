@@ -17,7 +17,7 @@
 
 #include "stwtypes.h"
 
-#include "CSCLStringList.h"
+#include "C_OSCExportCodeWriter.h"
 #include "C_OSCNode.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -63,40 +63,40 @@ protected:
                                                         const stw_types::uint8 ou8_InterfaceIndex,
                                                         const stw_scl::C_SCLString & orc_ProjectId);
 
-   static void mh_AddHeader(const stw_scl::C_SCLString & orc_ExportToolInfo, stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddHeader(const stw_scl::C_SCLString & orc_ExportToolInfo, C_OSCExportCodeWriter & orc_Data,
                             const stw_types::uint8 ou8_InterfaceIndex, const C_OSCCanProtocol::E_Type & ore_Protocol,
                             const bool oq_FileType);
-   static void mh_AddCIncludes(stw_scl::C_SCLStringList & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
+   static void mh_AddCIncludes(C_OSCExportCodeWriter & orc_Data, const C_OSCNodeDataPool & orc_DataPool,
                                const stw_types::uint8 ou8_InterfaceIndex, const C_OSCCanProtocol::E_Type & ore_Protocol,
                                const bool oq_NullRequired);
-   static void mh_AddDefines(stw_scl::C_SCLStringList & orc_Data, const C_OSCCanMessageContainer & orc_ComMessage,
+   static void mh_AddDefines(C_OSCExportCodeWriter & orc_Data, const C_OSCCanMessageContainer & orc_ComMessage,
                              const stw_types::uint8 ou8_InterfaceIndex, const C_OSCCanProtocol::E_Type & ore_Protocol,
                              const stw_scl::C_SCLString & orc_ProjectId, const stw_types::uint16 ou16_GenCodeVersion,
                              const bool oq_FileType);
-   static void mh_AddCModuleGlobal(stw_scl::C_SCLStringList & orc_Data, const bool oq_SafeData,
+   static void mh_AddCModuleGlobal(C_OSCExportCodeWriter & orc_Data, const bool oq_SafeData,
                                    const C_OSCCanMessageContainer & orc_ComMessage,
                                    const stw_types::uint8 ou8_InterfaceIndex,
                                    const C_OSCCanProtocol::E_Type & ore_Protocol,
                                    const stw_types::uint16 ou16_GenCodeVersion,
                                    const stw_types::uint32 ou32_TxListIndex, const stw_types::uint32 ou32_RxListIndex);
-   static void mh_AddCGlobalVariables(stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddCGlobalVariables(C_OSCExportCodeWriter & orc_Data,
                                       const stw_scl::C_SCLString & orc_DataPoolName,
                                       const stw_types::uint8 ou8_InterfaceIndex,
                                       const C_OSCCanProtocol::E_Type & ore_Protocol, const bool oq_TxMessagesPresent,
                                       const bool oq_RxMessagesPresent);
-   static void mh_AddSignalDefinitions(stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddSignalDefinitions(C_OSCExportCodeWriter & orc_Data,
                                        const stw_types::uint32 ou32_SignalListIndex,
                                        const std::vector<C_OSCCanMessage> & orc_Messages,
                                        const stw_types::uint16 ou16_GenCodeVersion);
-   static void mh_AddMessageMuxDefinitions(stw_scl::C_SCLStringList & orc_Data,
+   static void mh_AddMessageMuxDefinitions(C_OSCExportCodeWriter & orc_Data,
                                            const std::vector<C_OSCCanMessage> & orc_Messages,
                                            const stw_scl::C_SCLString & orc_TxRxString);
-   static void mh_AddMessageDefinitions(stw_scl::C_SCLStringList & orc_Data, const stw_types::uint8 ou8_InterfaceIndex,
+   static void mh_AddMessageDefinitions(C_OSCExportCodeWriter & orc_Data, const stw_types::uint8 ou8_InterfaceIndex,
                                         const C_OSCCanProtocol::E_Type & ore_Protocol,
                                         const std::vector<C_OSCCanMessage> & orc_Messages,
                                         const stw_types::uint16 ou16_GenCodeVersion, const bool oq_Tx);
    static stw_types::uint32 mh_CountMuxMessages(const std::vector<C_OSCCanMessage> & orc_Messages);
-   static void mh_ConvertSignalsToStrings(stw_scl::C_SCLStringList & orc_Data,
+   static void mh_ConvertSignalsToStrings(C_OSCExportCodeWriter & orc_Data,
                                           const std::vector<C_OSCCanSignal> & orc_Signals,
                                           const stw_types::uint32 ou32_SignalListIndex, const bool oq_RemoveLastComma);
    static void mh_GroupSignalsByMuxValue(const C_OSCCanMessage & orc_Message,
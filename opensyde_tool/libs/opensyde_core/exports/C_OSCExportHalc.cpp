@@ -13,7 +13,6 @@
 #include "stwtypes.h"
 #include "stwerrors.h"
 #include "C_OSCExportHalc.h"
-#include "CSCLStringList.h"
 #include "TGLUtils.h"
 #include "C_OSCLoggingHandler.h"
 
@@ -172,7 +171,7 @@ sint32 C_OSCExportHalc::mh_CreateHeaderFile(const stw_scl::C_SCLString & orc_Exp
                                             const uint16 ou16_GenCodeVersion)
 {
    sint32 s32_Retval;
-   C_SCLStringList c_Data;
+   C_OSCExportCodeWriter c_Data;
 
    // add header
    mh_AddHeader(orc_ExportToolInfo, c_Data, mhq_IS_HEADER_FILE, oq_IsSafe);
@@ -227,7 +226,7 @@ sint32 C_OSCExportHalc::mh_CreateImplementationFile(const stw_scl::C_SCLString &
 {
    sint32 s32_Retval;
 
-   C_SCLStringList c_Data;
+   C_OSCExportCodeWriter c_Data;
 
    // add header
    mh_AddHeader(orc_ExportToolInfo, c_Data, mhq_IS_IMPLEMENTATION_FILE, oq_IsSafe);
@@ -266,12 +265,12 @@ sint32 C_OSCExportHalc::mh_CreateImplementationFile(const stw_scl::C_SCLString &
 /*! \brief  Add file header
 
    \param[in]      orc_ExportToolInfo  Information about calling executable (name + version)
-   \param[in,out]  orc_Data            Data converted to string list
+   \param[in,out]  orc_Data            Converted data
    \param[in]      oq_FileType         Flag for .c vs. .h file
    \param[in]      oq_IsSafe           true: generate code for safe HALC
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportHalc::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C_SCLStringList & orc_Data,
+void C_OSCExportHalc::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C_OSCExportCodeWriter & orc_Data,
                                    const bool oq_FileType, const bool oq_IsSafe)
 {
    const C_SCLString c_Tmp = (oq_FileType == mhq_IS_IMPLEMENTATION_FILE) ? "Source file with constant definitions" :
@@ -306,12 +305,12 @@ void C_OSCExportHalc::mh_AddHeader(const C_SCLString & orc_ExportToolInfo, C_SCL
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add includes
 
-   \param[in,out]  orc_Data      Data converted to string list
+   \param[in,out]  orc_Data      Converted data
    \param[in]      oq_FileType   Flag for .c vs. .h file
    \param[in]      oq_IsSafe     true: generate code for safe HALC
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportHalc::mh_AddIncludes(C_SCLStringList & orc_Data, const bool oq_FileType, const bool oq_IsSafe)
+void C_OSCExportHalc::mh_AddIncludes(C_OSCExportCodeWriter & orc_Data, const bool oq_FileType, const bool oq_IsSafe)
 {
    orc_Data.Append(C_OSCExportUti::h_GetSectionSeparator("Includes"));
    if (oq_FileType == mhq_IS_HEADER_FILE)
@@ -334,7 +333,7 @@ void C_OSCExportHalc::mh_AddIncludes(C_SCLStringList & orc_Data, const bool oq_F
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add defines
 
-   \param[in,out]  orc_Data             Data converted to string list
+   \param[in,out]  orc_Data             Converted data
    \param[in]      orc_HalcConfig       HALC configuration
    \param[in]      orc_ProjectId        Project id for consistency check
    \param[in]      oq_FileType          Flag for .c vs. .h file
@@ -342,7 +341,7 @@ void C_OSCExportHalc::mh_AddIncludes(C_SCLStringList & orc_Data, const bool oq_F
    \param[in]      ou16_GenCodeVersion  version of structure (generate code as specified for this version)
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportHalc::mh_AddDefines(C_SCLStringList & orc_Data, const C_OSCHalcConfig & orc_HalcConfig,
+void C_OSCExportHalc::mh_AddDefines(C_OSCExportCodeWriter & orc_Data, const C_OSCHalcConfig & orc_HalcConfig,
                                     const C_SCLString & orc_ProjectId, const bool oq_FileType, const bool oq_IsSafe,
                                     const uint16 ou16_GenCodeVersion)
 {
@@ -420,13 +419,13 @@ void C_OSCExportHalc::mh_AddDefines(C_SCLStringList & orc_Data, const C_OSCHalcC
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Add global variables
 
-   \param[in,out]  orc_Data         Data converted to string list
+   \param[in,out]  orc_Data         Converted data
    \param[in]      orc_HalcConfig   HALC configuration
    \param[in]      oq_FileType      Flag for .c vs. .h file
    \param[in]      oq_IsSafe        true: generate code for safe HALC
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportHalc::mh_AddGlobalVariables(C_SCLStringList & orc_Data, const C_OSCHalcConfig & orc_HalcConfig,
+void C_OSCExportHalc::mh_AddGlobalVariables(C_OSCExportCodeWriter & orc_Data, const C_OSCHalcConfig & orc_HalcConfig,
                                             const bool oq_FileType, const bool oq_IsSafe)
 {
    //compose name of HAL configuration structure based on name of Datapool
@@ -627,7 +626,7 @@ C_SCLString C_OSCExportHalc::mh_GetMagicName(const C_SCLString & orc_ProjectId,
    Distinguish if the definition array has subelements or not (e.g.: parameter without/with parameter elements)
    Made to have one call for configuration, inputs, outputs and statuses.
 
-   \param[in,out]  orc_Data                  Data converted to string list
+   \param[in,out]  orc_Data                  Converted data
    \param[in]      orc_DefinitionArray       Definition array: parameters/configuration, inputs, outputs or statuses
    \param[in]      orc_ConfigArray           Configuration array: contains configured settings for each channel
    \param[in]      ore_Type                  Type: configuration/inputs/outputs/statuses
@@ -636,7 +635,7 @@ C_SCLString C_OSCExportHalc::mh_GetMagicName(const C_SCLString & orc_ProjectId,
    \param[in]      oq_IsSafe                 true: generate code for safe HALC
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCExportHalc::mh_AddDpListElementReferences(stw_scl::C_SCLStringList & orc_Data,
+void C_OSCExportHalc::mh_AddDpListElementReferences(C_OSCExportCodeWriter & orc_Data,
                                                     const std::vector<C_OSCHalcDefStruct> & orc_DefinitionArray,
                                                     const std::vector<C_OSCHalcConfigChannel> & orc_ConfigArray,
                                                     const C_OSCHalcDefDomain::E_VariableSelector & ore_Type,
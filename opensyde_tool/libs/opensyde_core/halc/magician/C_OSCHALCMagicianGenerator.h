@@ -25,6 +25,7 @@ public:
    C_OSCHALCMagicianGenerator(const C_OSCNode * const opc_Node);
 
    stw_types::sint32 GenerateHALCDatapools(std::vector<C_OSCNodeDataPool> & orc_Datapools) const;
+   stw_types::sint32 UpdateHALCDatapools(std::vector<C_OSCNodeDataPool> & orc_Datapools) const;
 
 private:
    const C_OSCNode * const mpc_Node;
@@ -35,6 +36,35 @@ private:
                                                const C_OSCHalcConfigDomain & orc_Domain,
                                                const C_OSCHALCMagicianDatapoolListHandler & orc_Handler,
                                                const stw_types::uint32 ou32_ItDomain, const bool oq_IsSafe) const;
+   stw_types::sint32 m_FillHALCDatapoolsDomainValues(C_OSCNodeDataPoolList & orc_List,
+                                                     const C_OSCHalcConfigDomain & orc_Domain,
+                                                     const C_OSCHALCMagicianDatapoolListHandler & orc_Handler,
+                                                     const stw_types::uint32 ou32_ItDomain) const;
+   stw_types::sint32 m_FillHALCDatapoolsDomainChannel(C_OSCNodeDataPoolList & orc_List,
+                                                      const C_OSCHalcConfigDomain & orc_Domain,
+                                                      const C_OSCHALCMagicianDatapoolListHandler & orc_Handler,
+                                                      const stw_types::uint32 ou32_ItDomain,
+                                                      const stw_types::uint32 ou32_ItChannel,
+                                                      const stw_types::uint32 ou32_ItRelevantChannel) const;
+   stw_types::sint32 m_UpdateHALCDatapoolsDomain(C_OSCNodeDataPoolList & orc_ListNonSafe,
+                                                 C_OSCNodeDataPoolList & orc_ListSafe,
+                                                 const C_OSCHalcConfigDomain & orc_Domain,
+                                                 const C_OSCHALCMagicianDatapoolListHandler & orc_Handler,
+                                                 const stw_types::uint32 ou32_ItDomain,
+                                                 const std::vector<stw_types::uint32> & orc_ChangedChannels,
+                                                 const bool oq_DomainValuesChanged) const;
+   bool m_CheckHALCDatapoolsStructure(const std::vector<C_OSCNodeDataPool> & orc_Datapools) const;
+   bool m_CheckHALCListElements(const C_OSCNodeDataPoolList & orc_List,
+                                const C_OSCHalcDefDomain::E_VariableSelector oe_Selector, const bool oq_IsSafe) const;
+   static bool mh_CheckHALCElementsForVector(const C_OSCNodeDataPoolList & orc_List,
+                                             stw_types::uint32 & oru32_ItElement,
+                                             const std::vector<C_OSCHalcDefStruct> & orc_Definition,
+                                             const stw_scl::C_SCLString & orc_DomainSingularName,
+                                             const stw_types::uint32 ou32_NumChannels);
+   static bool mh_CheckHALCElement(const C_OSCNodeDataPoolList & orc_List, stw_types::uint32 & oru32_ItElement,
+                                   const stw_scl::C_SCLString & orc_Name,
+                                   const C_OSCNodeDataPoolContent::E_Type oe_Type,
+                                   const stw_types::uint32 ou32_NumChannels);
    stw_types::sint32 m_FillHALCDatapoolsChanNum(C_OSCNodeDataPoolList & orc_List,
                                                 const C_OSCHALCMagicianDatapoolListHandler & orc_Handler,
                                                 const stw_types::uint32 ou32_ItDomain, const bool oq_IsSafe,
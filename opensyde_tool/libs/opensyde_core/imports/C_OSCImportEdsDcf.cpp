@@ -110,12 +110,12 @@ sint32 C_OSCImportEdsDcf::h_Import(const C_SCLString & orc_FilePath, const uint8
          {
             std::vector<uint32> c_Dummies;
             mh_LoadDummies(orc_FilePath, c_Dummies);
-            s32_Retval = mh_ParseMessages(0x1400, ou8_NodeId, c_Dictionary.c_Objects, c_Dummies, orc_OSCRxMessageData,
+            s32_Retval = mh_ParseMessages(0x1400, ou8_NodeId, c_Dictionary, c_Dummies, orc_OSCRxMessageData,
                                           orc_OSCRxSignalData,
                                           q_Eds, orc_ImportMessagesPerMessage, false);
             if (s32_Retval == C_NO_ERR)
             {
-               s32_Retval = mh_ParseMessages(0x1800, ou8_NodeId, c_Dictionary.c_Objects, c_Dummies,
+               s32_Retval = mh_ParseMessages(0x1800, ou8_NodeId, c_Dictionary, c_Dummies,
                                              orc_OSCTxMessageData,
                                              orc_OSCTxSignalData,
                                              q_Eds, orc_ImportMessagesPerMessage, true);
@@ -148,28 +148,25 @@ C_OSCImportEdsDcf::C_OSCImportEdsDcf(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get CO object by object ID
 
-   \param[in] orc_Objects All CO objects
-   \param[in] ou32_Id     Object ID
+   \param[in] orc_COObjects All CO objects
+   \param[in] ou32_Id       Object ID
+   \param[in] os32_SubIndex Object sub-index (negative: main object)
 
    \return
    NULL Object not found
    Else Valid object
 */
 //----------------------------------------------------------------------------------------------------------------------
-const C_OSCCanOpenObject * C_OSCImportEdsDcf::mh_GetCOObject(
-   const stw_scl::SCLDynamicArray<C_OSCCanOpenObject> & orc_COObjects, const uint32 ou32_Id, const sint32 os32_SubIndex)
+const C_OSCCanOpenObject * C_OSCImportEdsDcf::mh_GetCOObject(const C_OSCCanOpenObjectDictionary & orc_COObjects,
+                                                             const uint32 ou32_Id, const sint32 os32_SubIndex)
 {
    const C_OSCCanOpenObject * pc_Retval = NULL;
 
-   for (sint32 s32_ItObject = 0; s32_ItObject < orc_COObjects.GetLength(); ++s32_ItObject)
+   if (ou32_Id <= 0xFFFFUL)
    {
-      const C_OSCCanOpenObject & rc_CurObject = orc_COObjects[s32_ItObject];
-      if ((rc_CurObject.u16_Index == ou32_Id) &&
-          ((os32_SubIndex < 0) || (rc_CurObject.u8_SubIndex == static_cast<uint8>(os32_SubIndex))))
-      {
-         pc_Retval = &rc_CurObject;
-         break;
-      }
+      //the main object is sorted first and reported with sub-index 0
+      const uint8 u8_SubIndex = (os32_SubIndex < 0) ? 0U : static_cast<uint8>(os32_SubIndex);
+      pc_Retval = orc_COObjects.GetCanOpenObject(static_cast<uint16>(ou32_Id), u8_SubIndex);
    }
    return pc_Retval;
 }
@@ -192,7 +189,7 @@ const C_OSCCanOpenObject * C_OSCImportEdsDcf::mh_GetCOObject(
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCImportEdsDcf::mh_ParseMessages(const uint32 ou32_StartingId, const uint8 ou8_NodeId,
-                                           const stw_scl::SCLDynamicArray<C_OSCCanOpenObject> & orc_COObjects,
+                                           const C_OSCCanOpenObjectDictionary & orc_COObjects,
                                            const std::vector<uint32> & orc_Dummies,
                                            std::vector<C_OSCCanMessage> & orc_OSCMessageData,
                                            std::vector<C_OSCNodeDataPoolListElement> & orc_OSCSignalData,
@@ -414,7 +411,7 @@ sint32 C_OSCImportEdsDcf::mh_ParseMessages(const uint32 ou32_StartingId, const u
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCImportEdsDcf::mh_ParseSignals(const uint32 ou32_COMessageId, const uint8 ou8_NodeId,
-                                          const stw_scl::SCLDynamicArray<C_OSCCanOpenObject> & orc_COObjects,
+                                          const C_OSCCanOpenObjectDictionary & orc_COObjects,
                                           const std::vector<uint32> & orc_Dummies, C_OSCCanMessage & orc_OSCMessageData,
                                           std::vector<C_OSCNodeDataPoolListElement> & orc_OSCSignalData,
                                           const bool oq_IsEds)
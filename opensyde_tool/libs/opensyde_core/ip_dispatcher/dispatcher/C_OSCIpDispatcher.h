@@ -22,6 +22,7 @@
 #define C_OSCIPDISPATCHERH
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
 #include "stwtypes.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
@@ -194,6 +195,39 @@ public:
    virtual stw_types::sint32 SendTcp(const stw_types::uint32 ou32_Handle,
                                      const std::vector<stw_types::uint8> & orc_Data) = 0;
 
+   //-----------------------------------------------------------------------------
+   /*!
+      \brief   Send package composed of header and payload on TCP socket
+
+      Same as SendTcp() but the package is passed in two parts.
+      So the caller does not need to copy header and payload into one buffer.
+
+      Default implementation: put both parts into one buffer and use SendTcp().
+      Implementations supporting scatter/gather I/O shall overload this and send both parts directly.
+
+      \param[in]  ou32_Handle       handle obtained by InitTcp()
+      \param[in]  opu8_Header       header data to send first
+      \param[in]  ou32_HeaderSize   number of bytes in opu8_Header
+      \param[in]  orc_Payload       payload data to send after header
+
+      \return
+      C_NO_ERR   data sent successfully
+      C_RD_WR    error sending data
+      C_RANGE    invalid handle
+   */
+   //-----------------------------------------------------------------------------
+   virtual stw_types::sint32 SendTcpWithHeader(const stw_types::uint32 ou32_Handle,
+                                               const stw_types::uint8 * const opu8_Header,
+                                               const stw_types::uint32 ou32_HeaderSize,
+                                               const std::vector<stw_types::uint8> & orc_Payload)
+   {
+      std::vector<stw_types::uint8> c_Data;
+      c_Data.reserve(static_cast<size_t>(ou32_HeaderSize) + orc_Payload.size());
+      c_Data.insert(c_Data.end(), opu8_Header, opu8_Header + ou32_HeaderSize);
+      c_Data.insert(c_Data.end(), orc_Payload.begin(), orc_Payload.end());
+      return this->SendTcp(ou32_Handle, c_Data);
+   }
+
    //-----------------------------------------------------------------------------
    /*!
       \brief   Read data from TCP socket
@@ -236,3 +236,105 @@ uint32 C_TGLTimer::GetInterval(void) const
 }
 
 //----------------------------------------------------------------------------------------------------------------------
+
+C_TGLThread::C_TGLThread(void) :
+   mpv_Handle(NULL),
+   mpr_Function(NULL),
+   mpv_Instance(NULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//waits for a running thread to finish
+C_TGLThread::~C_TGLThread(void)
+{
+   (void)WaitFor();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+DWORD __stdcall C_TGLThread::mh_ThreadFunction(void * opv_Thread)
+{
+   C_TGLThread * const pc_Thread = reinterpret_cast<C_TGLThread *>(opv_Thread);
+
+   pc_Thread->mpr_Function(pc_Thread->mpv_Instance);
+   return 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   start executing function in a new thread
+
+   The function is called once. The thread ends when the function returns.
+
+   \param[in]  opr_Function   function to execute
+   \param[in]  opv_Instance   parameter passed to function
+
+   \return
+   C_NO_ERR    thread started
+   C_BUSY      thread is already running
+   C_RANGE     opr_Function is NULL
+   C_NOACT     could not create thread
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_TGLThread::Start(const PR_TGLThreadFunction opr_Function, void * const opv_Instance)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (opr_Function == NULL)
+   {
+      s32_Return = C_RANGE;
+   }
+   else if (IsRunning() == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else
+   {
+      (void)WaitFor(); //clean up handle of finished thread
+      mpr_Function = opr_Function;
+      mpv_Instance = opv_Instance;
+      mpv_Handle = CreateThread(NULL, 0U, &C_TGLThread::mh_ThreadFunction, this, 0U, NULL);
+      if (mpv_Handle == NULL)
+      {
+         s32_Return = C_NOACT;
+      }
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   block until the thread has finished
+
+   \return
+   C_NO_ERR    thread finished
+   C_NOACT     thread was not started
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_TGLThread::WaitFor(void)
+{
+   sint32 s32_Return = C_NOACT;
+
+   if (mpv_Handle != NULL)
+   {
+      (void)WaitForSingleObject(mpv_Handle, INFINITE);
+      (void)CloseHandle(mpv_Handle);
+      mpv_Handle = NULL;
+      s32_Return = C_NO_ERR;
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//check whether the thread has been started and not yet finished
+bool C_TGLThread::IsRunning(void) const
+{
+   bool q_Return = false;
+
+   if (mpv_Handle != NULL)
+   {
+      q_Return = (WaitForSingleObject(mpv_Handle, 0U) == WAIT_TIMEOUT) ? true : false;
+   }
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
@@ -42,6 +42,8 @@ SOURCES += \
     $${PWD}/scl/CSCLStringList.cpp \
     $${PWD}/xml_parser/C_OSCXMLParser.cpp \
     $${PWD}/xml_parser/C_OSCChecksummedXML.cpp \
+    $${PWD}/xml_parser/C_OSCXMLStreamReader.cpp \
+    $${PWD}/xml_parser/C_OSCXMLStreamWriter.cpp \
     $${PWD}/xml_parser/tinyxml2/tinyxml2.cpp
 
 HEADERS += \
@@ -67,6 +69,8 @@ HEADERS += \
     $${PWD}/stwtypes/stwtypes.h \
     $${PWD}/xml_parser/C_OSCXMLParser.h \
     $${PWD}/xml_parser/C_OSCChecksummedXML.h \
+    $${PWD}/xml_parser/C_OSCXMLStreamReader.h \
+    $${PWD}/xml_parser/C_OSCXMLStreamWriter.h \
     $${PWD}/xml_parser/tinyxml2/tinyxml2.h
 
 # optional: zip/unzip
@@ -117,6 +121,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_code_generation) {
                $${PWD}/exports
 
    SOURCES += \
+    $${PWD}/exports/C_OSCExportCodeWriter.cpp \
     $${PWD}/exports/C_OSCExportCommunicationStack.cpp \
     $${PWD}/exports/C_OSCExportDataPool.cpp \
     $${PWD}/exports/C_OSCExportHalc.cpp \
@@ -125,6 +130,7 @@ contains(opensyde_core_skip_modules, opensyde_core_skip_code_generation) {
     $${PWD}/exports/C_OSCExportUti.cpp
 
    HEADERS += \
+    $${PWD}/exports/C_OSCExportCodeWriter.h \
     $${PWD}/exports/C_OSCExportCommunicationStack.h \
     $${PWD}/exports/C_OSCExportDataPool.h \
     $${PWD}/exports/C_OSCExportHalc.h \
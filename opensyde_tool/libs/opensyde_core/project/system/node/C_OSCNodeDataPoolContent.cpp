@@ -56,9 +56,11 @@ const sint32 C_OSCNodeDataPoolContent::mhs32_AccessError = C_RANGE;
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCNodeDataPoolContent::C_OSCNodeDataPoolContent(void) :
    me_Type(eUINT8),
-   mq_Array(false)
+   mq_Array(false),
+   mu32_DataSize(0U)
 {
-   mc_Data.resize(1, 0U); //matching uint8 type
+   (void)std::memset(&this->mu_Storage, 0, sizeof(this->mu_Storage));
+   this->m_ResizeData(1U); //matching uint8 type
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -70,8 +72,17 @@ C_OSCNodeDataPoolContent::C_OSCNodeDataPoolContent(void) :
 C_OSCNodeDataPoolContent::C_OSCNodeDataPoolContent(const C_OSCNodeDataPoolContent & orc_Source) :
    me_Type(orc_Source.me_Type),
    mq_Array(orc_Source.mq_Array),
-   mc_Data(orc_Source.mc_Data)
+   mu32_DataSize(orc_Source.mu32_DataSize)
 {
+   if (orc_Source.mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+   {
+      this->mu_Storage.pu8_Heap = new uint8[orc_Source.mu32_DataSize];
+      (void)std::memcpy(this->mu_Storage.pu8_Heap, orc_Source.mu_Storage.pu8_Heap, orc_Source.mu32_DataSize);
+   }
+   else
+   {
+      this->mu_Storage = orc_Source.mu_Storage;
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -86,9 +97,31 @@ C_OSCNodeDataPoolContent & C_OSCNodeDataPoolContent::operator =(const C_OSCNodeD
 {
    if (this != &orc_Source)
    {
+      if ((this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE) && (this->mu32_DataSize == orc_Source.mu32_DataSize))
+      {
+         //same array size: re-use heap storage
+         (void)std::memcpy(this->mu_Storage.pu8_Heap, orc_Source.mu_Storage.pu8_Heap, orc_Source.mu32_DataSize);
+      }
+      else
+      {
+         U_Storage u_Storage = orc_Source.mu_Storage;
+
+         //allocate first so we stay unchanged if this throws
+         if (orc_Source.mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+         {
+            u_Storage.pu8_Heap = new uint8[orc_Source.mu32_DataSize];
+            (void)std::memcpy(u_Storage.pu8_Heap, orc_Source.mu_Storage.pu8_Heap, orc_Source.mu32_DataSize);
+         }
+         //release heap storage of a previous array value
+         if (this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+         {
+            delete[] this->mu_Storage.pu8_Heap;
+         }
+         this->mu_Storage = u_Storage;
+      }
       this->me_Type = orc_Source.me_Type;
       this->mq_Array = orc_Source.mq_Array;
-      this->mc_Data = orc_Source.mc_Data;
+      this->mu32_DataSize = orc_Source.mu32_DataSize;
    }
 
    return (*this);
@@ -100,6 +133,10 @@ C_OSCNodeDataPoolContent & C_OSCNodeDataPoolContent::operator =(const C_OSCNodeD
 //----------------------------------------------------------------------------------------------------------------------
 C_OSCNodeDataPoolContent::~C_OSCNodeDataPoolContent(void)
 {
+   if (this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+   {
+      delete[] this->mu_Storage.pu8_Heap;
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -115,7 +152,7 @@ void C_OSCNodeDataPoolContent::CalcHash(uint32 & oru32_HashValue) const
 {
    stw_scl::C_SCLChecksums::CalcCRC32(&this->me_Type, sizeof(this->me_Type), oru32_HashValue);
    stw_scl::C_SCLChecksums::CalcCRC32(&this->mq_Array, sizeof(this->mq_Array), oru32_HashValue);
-   stw_scl::C_SCLChecksums::CalcCRC32(&this->mc_Data[0], static_cast<uint32>(this->mc_Data.size()),
+   stw_scl::C_SCLChecksums::CalcCRC32(this->m_GetData(), this->mu32_DataSize,
                                       oru32_HashValue);
 }
 
@@ -188,7 +225,7 @@ void C_OSCNodeDataPoolContent::CalcHashElement(uint32 & oru32_HashValue, const u
    else
    {
       //Just one element
-      stw_scl::C_SCLChecksums::CalcCRC32(&this->mc_Data[0], static_cast<uint32>(this->mc_Data.size()),
+      stw_scl::C_SCLChecksums::CalcCRC32(this->m_GetData(), this->mu32_DataSize,
                                          oru32_HashValue);
    }
 }
@@ -211,7 +248,7 @@ template <typename T> void C_OSCNodeDataPoolContent::m_SetValue(const T & orc_Va
       {
          this->mc_CriticalSection.Acquire();
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&this->mc_Data[0], &orc_Value, sizeof(orc_Value));
+         (void)std::memcpy(this->m_GetData(), &orc_Value, sizeof(orc_Value));
          this->mc_CriticalSection.Release();
       }
       else
@@ -243,7 +280,7 @@ template <typename T> void C_OSCNodeDataPoolContent::m_GetValue(const E_Type oe_
       {
          this->mc_CriticalSection.Acquire();
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&orc_Value, &this->mc_Data[0], sizeof(orc_Value));
+         (void)std::memcpy(&orc_Value, this->m_GetData(), sizeof(orc_Value));
          this->mc_CriticalSection.Release();
       }
       else
@@ -656,9 +693,9 @@ template <typename T> void C_OSCNodeDataPoolContent::m_SetValueArray(const T & o
       if (this->me_Type == oe_Type)
       {
          this->mc_CriticalSection.Acquire();
-         mc_Data.resize(orc_Value.size() * sizeof(orc_Value[0]));
+         this->m_ResizeData(static_cast<uint32>(orc_Value.size() * sizeof(orc_Value[0])));
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&this->mc_Data[0], &orc_Value[0], this->mc_Data.size());
+         (void)std::memcpy(this->m_GetData(), &orc_Value[0], this->mu32_DataSize);
          this->mc_CriticalSection.Release();
       }
       else
@@ -698,7 +735,7 @@ template <typename T> void C_OSCNodeDataPoolContent::m_SetValueArrayElement(cons
             this->mc_CriticalSection.Acquire();
             //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
             //lint -e{9114} //range of parameter is safe for sizeof result to fit in
-            (void)std::memcpy(&this->mc_Data[ou32_Index * (sizeof(orc_Value))], &orc_Value, sizeof(orc_Value));
+            (void)std::memcpy(&this->m_GetData()[ou32_Index * (sizeof(orc_Value))], &orc_Value, sizeof(orc_Value));
             this->mc_CriticalSection.Release();
          }
          else
@@ -734,9 +771,9 @@ template <typename T> void C_OSCNodeDataPoolContent::m_GetValueArray(const E_Typ
       if (this->me_Type == oe_Type)
       {
          this->mc_CriticalSection.Acquire();
-         orc_Result.resize(this->mc_Data.size() / sizeof(orc_Result[0]));
+         orc_Result.resize(this->mu32_DataSize / sizeof(orc_Result[0]));
          //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
-         (void)std::memcpy(&orc_Result[0], &this->mc_Data[0], this->mc_Data.size());
+         (void)std::memcpy(&orc_Result[0], this->m_GetData(), this->mu32_DataSize);
          this->mc_CriticalSection.Release();
       }
       else
@@ -776,7 +813,7 @@ template <typename T> void C_OSCNodeDataPoolContent::m_GetValueArrayElement(cons
             this->mc_CriticalSection.Acquire();
             //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
             //lint -e{9114} //range of parameter is safe for sizeof result to fit in
-            (void)std::memcpy(&orc_Result, &this->mc_Data[ou32_Index * sizeof(orc_Result)], sizeof(orc_Result));
+            (void)std::memcpy(&orc_Result, &this->m_GetData()[ou32_Index * sizeof(orc_Result)], sizeof(orc_Result));
             this->mc_CriticalSection.Release();
          }
          else
@@ -1257,21 +1294,21 @@ void C_OSCNodeDataPoolContent::SetArraySize(const uint32 & oru32_Size)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(oru32_Size, 0U);
+         this->m_ResizeData(oru32_Size);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(static_cast<size_t>(oru32_Size * 2), 0U);
+         this->m_ResizeData(oru32_Size * 2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(static_cast<size_t>(oru32_Size * 4), 0U);
+         this->m_ResizeData(oru32_Size * 4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(static_cast<size_t>(oru32_Size * 8), 0U);
+         this->m_ResizeData(oru32_Size * 8U);
          break;
       default:
          throw C_OSCNodeDataPoolContent::mhs32_TypeError;
@@ -1302,21 +1339,21 @@ uint32 C_OSCNodeDataPoolContent::GetArraySize(void) const
       {
       case eUINT8:
       case eSINT8:
-         u32_Retval = this->mc_Data.size();
+         u32_Retval = this->mu32_DataSize;
          break;
       case eUINT16:
       case eSINT16:
-         u32_Retval = static_cast<uint32>(this->mc_Data.size() / 2);
+         u32_Retval = this->mu32_DataSize / 2U;
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         u32_Retval = static_cast<uint32>(this->mc_Data.size() / 4);
+         u32_Retval = this->mu32_DataSize / 4U;
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         u32_Retval = static_cast<uint32>(this->mc_Data.size() / 8);
+         u32_Retval = this->mu32_DataSize / 8U;
          break;
       default:
          throw C_OSCNodeDataPoolContent::mhs32_TypeError;
@@ -1363,21 +1400,21 @@ void C_OSCNodeDataPoolContent::SetType(const E_Type & ore_Value)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(1);
+         this->m_ResizeData(1U);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(2);
+         this->m_ResizeData(2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(4);
+         this->m_ResizeData(4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(8);
+         this->m_ResizeData(8U);
          break;
       default:
          throw C_OSCNodeDataPoolContent::mhs32_TypeError;
@@ -1502,21 +1539,21 @@ void C_OSCNodeDataPoolContent::SetType(const E_Type & ore_Value)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(u32_Size);
+         this->m_ResizeData(u32_Size);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(static_cast<size_t>(u32_Size * 2));
+         this->m_ResizeData(u32_Size * 2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(static_cast<size_t>(u32_Size * 4));
+         this->m_ResizeData(u32_Size * 4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(static_cast<size_t>(u32_Size * 8));
+         this->m_ResizeData(u32_Size * 8U);
          break;
       default:
          throw C_OSCNodeDataPoolContent::mhs32_TypeError;
@@ -1692,21 +1729,21 @@ void C_OSCNodeDataPoolContent::SetArray(const bool oq_Value)
       {
       case eUINT8:
       case eSINT8:
-         this->mc_Data.resize(1);
+         this->m_ResizeData(1U);
          break;
       case eUINT16:
       case eSINT16:
-         this->mc_Data.resize(2);
+         this->m_ResizeData(2U);
          break;
       case eUINT32:
       case eSINT32:
       case eFLOAT32:
-         this->mc_Data.resize(4);
+         this->m_ResizeData(4U);
          break;
       case eUINT64:
       case eSINT64:
       case eFLOAT64:
-         this->mc_Data.resize(8);
+         this->m_ResizeData(8U);
          break;
       default:
          throw C_OSCNodeDataPoolContent::mhs32_TypeError;
@@ -1724,7 +1761,7 @@ void C_OSCNodeDataPoolContent::SetArray(const bool oq_Value)
 //----------------------------------------------------------------------------------------------------------------------
 uint32 C_OSCNodeDataPoolContent::GetSizeByte(void) const
 {
-   return mc_Data.size();
+   return this->mu32_DataSize;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3177,179 +3214,9 @@ void C_OSCNodeDataPoolContent::m_GetBaseTypeArray(const uint32 & oru32_Index, bo
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCNodeDataPoolContent::SetValueFromBigEndianBlob(const std::vector<uint8> & orc_Data)
 {
-   sint32 s32_Return = C_NO_ERR;
-   //using unions is not nice but more portable than reinterpret_casting
-   //lint -e{9018}  //cf. comment above
-   union U_Union32
-   {
-      uint32 u32_Value;
-      float32 f32_Value;
-   };
-
-   //lint -e{9018}  //cf. comment above
-   union U_Union64
-   {
-      uint64 u64_Value;
-      float64 f64_Value;
-   };
+   const uint8 * const pu8_Data = (orc_Data.size() > 0UL) ? &orc_Data[0] : NULL;
 
-   //is size correct ?
-   if (this->GetSizeByte() != orc_Data.size())
-   {
-      s32_Return = C_CONFIG;
-   }
-   else
-   {
-      if (this->GetArray() == false)
-      {
-         //plain type
-         switch (this->me_Type)
-         {
-         case eUINT8: ///< Data type unsigned 8 bit integer
-            this->SetValueU8(orc_Data[0]);
-            break;
-         case eUINT16: ///< Data type unsigned 16 bit integer
-            this->SetValueU16(static_cast<uint16>((static_cast<uint16>(orc_Data[0]) << 8U)) + orc_Data[1]);
-            break;
-         case eUINT32: ///< Data type unsigned 32 bit integer
-            this->SetValueU32(mh_BinaryToUInt32Big(&orc_Data[0]));
-            break;
-         case eUINT64: ///< Data type unsigned 64 bit integer
-            this->SetValueU64(mh_BinaryToUInt64Big(&orc_Data[0]));
-            break;
-         case eSINT8: ///< Data type signed 8 bit integer
-            this->SetValueS8(orc_Data[0]);
-            break;
-         case eSINT16: ///< Data type signed 16 bit integer
-            this->SetValueS16(
-               static_cast<sint16>(static_cast<uint16>((static_cast<uint16>(orc_Data[0]) << 8U))) + orc_Data[1]);
-            break;
-         case eSINT32: ///< Data type signed 32 bit integer
-            this->SetValueS32(static_cast<sint32>(mh_BinaryToUInt32Big(&orc_Data[0])));
-            break;
-         case eSINT64: ///< Data type signed 64 bit integer
-            this->SetValueS64(static_cast<sint64>(mh_BinaryToUInt64Big(&orc_Data[0])));
-            break;
-         case eFLOAT32: ///< Data type 32 bit floating point
-            U_Union32 u_Value32;
-            u_Value32.u32_Value = mh_BinaryToUInt32Big(&orc_Data[0]);
-            this->SetValueF32(u_Value32.f32_Value);
-            break;
-         case eFLOAT64: ///< Data type 64 bit floating point
-            U_Union64 u_Value64;
-            u_Value64.u64_Value = mh_BinaryToUInt64Big(&orc_Data[0]);
-            this->SetValueF64(u_Value64.f64_Value);
-            break;
-         default:
-            break;
-         }
-      }
-      else
-      {
-         //array type
-         //we set up the array here and assign in one go to ensure data consistency
-         uint32 u32_ArrayIndex;
-         std::vector<uint16> c_Data16;
-         std::vector<uint32> c_Data32;
-         std::vector<uint64> c_Data64;
-         std::vector<sint8> c_DataS8;
-         std::vector<sint16> c_DataS16;
-         std::vector<sint32> c_DataS32;
-         std::vector<sint64> c_DataS64;
-         std::vector<float32> c_DataF32;
-         std::vector<float64> c_DataF64;
-         switch (this->me_Type)
-         {
-         case eUINT8:
-            this->SetValueAU8(orc_Data);
-            break;
-         case eUINT16:
-            c_Data16.resize(orc_Data.size() / 2);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_Data16[u32_ArrayIndex] =
-                  static_cast<uint16>((static_cast<uint16>(orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)]) << 8U)) +
-                  orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) + 1U];
-            }
-            this->SetValueAU16(c_Data16);
-            break;
-         case eUINT32: ///< Data type unsigned 32 bit integer
-            c_Data32.resize(orc_Data.size() / 4);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_Data32[u32_ArrayIndex] = mh_BinaryToUInt32Big(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-            }
-            this->SetValueAU32(c_Data32);
-            break;
-         case eUINT64: ///< Data type unsigned 64 bit integer
-            c_Data64.resize(orc_Data.size() / 8);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_Data64[u32_ArrayIndex] = mh_BinaryToUInt64Big(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-            }
-            this->SetValueAU64(c_Data64);
-            break;
-         case eSINT8: ///< Data type signed 8 bit integer
-            c_DataS8.resize(orc_Data.size());
-            (void)std::memcpy(&c_DataS8[0], &orc_Data[0], orc_Data.size());
-            this->SetValueAS8(c_DataS8);
-            break;
-         case eSINT16: ///< Data type signed 16 bit integer
-            c_DataS16.resize(orc_Data.size() / 2);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_DataS16[u32_ArrayIndex] =
-                  static_cast<sint16>(
-                     static_cast<uint16>((static_cast<uint16>(orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)]) <<
-                                          8U)) +
-                     orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) + 1U]);
-            }
-            this->SetValueAS16(c_DataS16);
-            break;
-         case eSINT32: ///< Data type unsigned 32 bit integer
-            c_DataS32.resize(orc_Data.size() / 4);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_DataS32[u32_ArrayIndex] =
-                  static_cast<sint32>(mh_BinaryToUInt32Big(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]));
-            }
-            this->SetValueAS32(c_DataS32);
-            break;
-         case eSINT64: ///< Data type unsigned 64 bit integer
-            c_DataS64.resize(orc_Data.size() / 8);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_DataS64[u32_ArrayIndex] =
-                  static_cast<sint64>(mh_BinaryToUInt64Big(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]));
-            }
-            this->SetValueAS64(c_DataS64);
-            break;
-         case eFLOAT32: ///< Data type 32 bit floating point
-            U_Union32 u_Value32;
-            c_DataF32.resize(orc_Data.size() / 4);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               u_Value32.u32_Value = mh_BinaryToUInt32Big(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-               c_DataF32[u32_ArrayIndex] = u_Value32.f32_Value;
-            }
-            this->SetValueAF32(c_DataF32);
-            break;
-         case eFLOAT64: ///< Data type 64 bit floating point
-            U_Union64 u_Value64;
-            c_DataF64.resize(orc_Data.size() / 8);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               u_Value64.u64_Value = mh_BinaryToUInt64Big(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-               c_DataF64[u32_ArrayIndex] = u_Value64.f64_Value;
-            }
-            this->SetValueAF64(c_DataF64);
-            break;
-         default:
-            break;
-         }
-      }
-   }
-   return s32_Return;
+   return this->SetValueFromBigEndianBlob(pu8_Data, static_cast<uint32>(orc_Data.size()));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3367,181 +3234,9 @@ sint32 C_OSCNodeDataPoolContent::SetValueFromBigEndianBlob(const std::vector<uin
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_OSCNodeDataPoolContent::SetValueFromLittleEndianBlob(const std::vector<uint8> & orc_Data)
 {
-   sint32 s32_Return = C_NO_ERR;
+   const uint8 * const pu8_Data = (orc_Data.size() > 0UL) ? &orc_Data[0] : NULL;
 
-   //using unions is not nice but more portable than reinterpret_casting
-   //lint -e{9018}  //cf. comment above
-   union U_Union32
-   {
-      uint32 u32_Value;
-      float32 f32_Value;
-   };
-
-   //lint -e{9018}  //cf. comment above
-   union U_Union64
-   {
-      uint64 u64_Value;
-      float64 f64_Value;
-   };
-
-   //is size correct ?
-   if (this->GetSizeByte() != orc_Data.size())
-   {
-      s32_Return = C_CONFIG;
-   }
-   else
-   {
-      if (this->GetArray() == false)
-      {
-         //plain type
-         switch (this->me_Type)
-         {
-         case eUINT8: ///< Data type unsigned 8 bit integer
-            this->SetValueU8(orc_Data[0]);
-            break;
-         case eUINT16: ///< Data type unsigned 16 bit integer
-            this->SetValueU16(static_cast<uint16>((static_cast<uint16>(orc_Data[1]) << 8U)) + orc_Data[0]);
-            break;
-         case eUINT32: ///< Data type unsigned 32 bit integer
-            this->SetValueU32(mh_BinaryToUInt32Little(&orc_Data[0]));
-            break;
-         case eUINT64: ///< Data type unsigned 64 bit integer
-            this->SetValueU64(mh_BinaryToUInt64Little(&orc_Data[0]));
-            break;
-         case eSINT8: ///< Data type signed 8 bit integer
-            this->SetValueS8(orc_Data[0]);
-            break;
-         case eSINT16: ///< Data type signed 16 bit integer
-            this->SetValueS16(static_cast<sint16>(static_cast<uint16>((static_cast<uint16>(orc_Data[1]) << 8U)) +
-                                                  orc_Data[0]));
-            break;
-         case eSINT32: ///< Data type signed 32 bit integer
-            this->SetValueS32(static_cast<sint32>(mh_BinaryToUInt32Little(&orc_Data[0])));
-            break;
-         case eSINT64: ///< Data type signed 64 bit integer
-            this->SetValueS64(static_cast<sint64>(mh_BinaryToUInt64Little(&orc_Data[0])));
-            break;
-         case eFLOAT32: ///< Data type 32 bit floating point
-            U_Union32 u_Value32;
-            u_Value32.u32_Value = mh_BinaryToUInt32Little(&orc_Data[0]);
-            this->SetValueF32(u_Value32.f32_Value);
-            break;
-         case eFLOAT64: ///< Data type 64 bit floating point
-            U_Union64 u_Value64;
-            u_Value64.u64_Value = mh_BinaryToUInt64Little(&orc_Data[0]);
-            this->SetValueF64(u_Value64.f64_Value);
-            break;
-         default:
-            break;
-         }
-      }
-      else
-      {
-         //array type
-         //we set up the array here and assign in one go to ensure data consistency
-         uint32 u32_ArrayIndex;
-         std::vector<uint16> c_Data16;
-         std::vector<uint32> c_Data32;
-         std::vector<uint64> c_Data64;
-         std::vector<sint8> c_DataS8;
-         std::vector<sint16> c_DataS16;
-         std::vector<sint32> c_DataS32;
-         std::vector<sint64> c_DataS64;
-         std::vector<float32> c_DataF32;
-         std::vector<float64> c_DataF64;
-         switch (this->me_Type)
-         {
-         case eUINT8:
-            this->SetValueAU8(orc_Data);
-            break;
-         case eUINT16:
-            c_Data16.resize(orc_Data.size() / 2);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_Data16[u32_ArrayIndex] =
-                  static_cast<uint16>(static_cast<uint16>(orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) + 1U]) <<
-                                      8U) +
-                  orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)];
-            }
-            this->SetValueAU16(c_Data16);
-            break;
-         case eUINT32: ///< Data type unsigned 32 bit integer
-            c_Data32.resize(orc_Data.size() / 4);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_Data32[u32_ArrayIndex] = mh_BinaryToUInt32Little(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-            }
-            this->SetValueAU32(c_Data32);
-            break;
-         case eUINT64: ///< Data type unsigned 64 bit integer
-            c_Data64.resize(orc_Data.size() / 8);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_Data64[u32_ArrayIndex] = mh_BinaryToUInt64Little(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-            }
-            this->SetValueAU64(c_Data64);
-            break;
-         case eSINT8: ///< Data type signed 8 bit integer
-            c_DataS8.resize(orc_Data.size());
-            (void)std::memcpy(&c_DataS8[0], &orc_Data[0], orc_Data.size());
-            this->SetValueAS8(c_DataS8);
-            break;
-         case eSINT16: ///< Data type signed 16 bit integer
-            c_DataS16.resize(orc_Data.size() / 2);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_DataS16[u32_ArrayIndex] =
-                  static_cast<sint16>(
-                     static_cast<uint16>(static_cast<uint16>(orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) + 1U]) <<
-                                         8U) +
-                     orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)]);
-            }
-            this->SetValueAS16(c_DataS16);
-            break;
-         case eSINT32: ///< Data type unsigned 32 bit integer
-            c_DataS32.resize(orc_Data.size() / 4);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_DataS32[u32_ArrayIndex] =
-                  static_cast<sint32>(mh_BinaryToUInt32Little(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]));
-            }
-            this->SetValueAS32(c_DataS32);
-            break;
-         case eSINT64: ///< Data type unsigned 64 bit integer
-            c_DataS64.resize(orc_Data.size() / 8);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               c_DataS64[u32_ArrayIndex] =
-                  static_cast<sint64>(mh_BinaryToUInt64Little(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]));
-            }
-            this->SetValueAS64(c_DataS64);
-            break;
-         case eFLOAT32: ///< Data type 32 bit floating point
-            U_Union32 u_Value32;
-            c_DataF32.resize(orc_Data.size() / 4);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               u_Value32.u32_Value = mh_BinaryToUInt32Little(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-               c_DataF32[u32_ArrayIndex] = u_Value32.f32_Value;
-            }
-            this->SetValueAF32(c_DataF32);
-            break;
-         case eFLOAT64: ///< Data type 64 bit floating point
-            U_Union64 u_Value64;
-            c_DataF64.resize(orc_Data.size() / 8);
-            for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-            {
-               u_Value64.u64_Value = mh_BinaryToUInt64Little(&orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-               c_DataF64[u32_ArrayIndex] = u_Value64.f64_Value;
-            }
-            this->SetValueAF64(c_DataF64);
-            break;
-         default:
-            break;
-         }
-      }
-   }
-   return s32_Return;
+   return this->SetValueFromLittleEndianBlob(pu8_Data, static_cast<uint32>(orc_Data.size()));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -3555,164 +3250,12 @@ sint32 C_OSCNodeDataPoolContent::SetValueFromLittleEndianBlob(const std::vector<
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCNodeDataPoolContent::GetValueAsBigEndianBlob(std::vector<uint8> & orc_Data) const
 {
-   //using unions is not nice but more portable than reinterpret_casting
-   //lint -e{9018}  //cf. comment above
-   union U_Union32
-   {
-      uint32 u32_Value;
-      float32 f32_Value;
-   };
-
-   //lint -e{9018}  //cf. comment above
-   union U_Union64
-   {
-      uint64 u64_Value;
-      float64 f64_Value;
-   };
-
    //set size ...
    orc_Data.resize(this->GetSizeByte());
 
-   if (this->GetArray() == false)
+   if (orc_Data.size() > 0UL)
    {
-      uint16 u16_Value;
-      U_Union32 u_Value32;
-      U_Union64 u_Value64;
-      //plain type
-      switch (this->me_Type)
-      {
-      case eUINT8: ///< Data type unsigned 8 bit integer
-         orc_Data[0] = this->GetValueU8();
-         break;
-      case eUINT16: ///< Data type unsigned 16 bit integer
-         u16_Value = this->GetValueU16();
-         orc_Data[0] = static_cast<uint8>(u16_Value >> 8U);
-         orc_Data[1] = static_cast<uint8>(u16_Value);
-         break;
-      case eUINT32: ///< Data type unsigned 32 bit integer
-         mh_UInt32ToBinaryBig(this->GetValueU32(), &orc_Data[0]);
-         break;
-      case eUINT64: ///< Data type unsigned 64 bit integer
-         mh_UInt64ToBinaryBig(this->GetValueU64(), &orc_Data[0]);
-         break;
-      case eSINT8: ///< Data type signed 8 bit integer
-         orc_Data[0] = this->GetValueS8();
-         break;
-      case eSINT16: ///< Data type signed 16 bit integer
-         u16_Value = static_cast<uint16>(this->GetValueS16());
-         orc_Data[0] = static_cast<uint8>(u16_Value >> 8U);
-         orc_Data[1] = static_cast<uint8>(u16_Value);
-         break;
-      case eSINT32: ///< Data type signed 32 bit integer
-         mh_UInt32ToBinaryBig(static_cast<uint32>(this->GetValueS32()), &orc_Data[0]);
-         break;
-      case eSINT64: ///< Data type signed 64 bit integer
-         mh_UInt64ToBinaryBig(static_cast<uint64>(this->GetValueS64()), &orc_Data[0]);
-         break;
-      case eFLOAT32: ///< Data type 32 bit floating point
-         u_Value32.f32_Value = this->GetValueF32();
-         mh_UInt32ToBinaryBig(u_Value32.u32_Value, &orc_Data[0]);
-         break;
-      case eFLOAT64: ///< Data type 64 bit floating point
-         u_Value64.f64_Value = this->GetValueF64();
-         mh_UInt64ToBinaryBig(u_Value64.u64_Value, &orc_Data[0]);
-         break;
-      default:
-         break;
-      }
-   }
-   else
-   {
-      //array type
-      //we set up the array here and assign in one go to ensure data consistency
-      uint32 u32_ArrayIndex;
-      std::vector<uint16> c_Data16;
-      std::vector<uint32> c_Data32;
-      std::vector<uint64> c_Data64;
-      std::vector<sint8> c_DataS8;
-      std::vector<sint16> c_DataS16;
-      std::vector<sint32> c_DataS32;
-      std::vector<sint64> c_DataS64;
-      std::vector<float32> c_DataF32;
-      std::vector<float64> c_DataF64;
-      switch (this->me_Type)
-      {
-      case eUINT8:
-         orc_Data = this->GetValueAU8();
-         break;
-      case eUINT16:
-         c_Data16 = this->GetValueAU16();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)] = static_cast<uint8>(c_Data16[u32_ArrayIndex] >> 8U);
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) + 1] = static_cast<uint8>(c_Data16[u32_ArrayIndex]);
-         }
-         break;
-      case eUINT32: ///< Data type unsigned 32 bit integer
-         c_Data32 = this->GetValueAU32();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt32ToBinaryBig(c_Data32[u32_ArrayIndex], &orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-         }
-         break;
-      case eUINT64: ///< Data type unsigned 64 bit integer
-         c_Data64 = this->GetValueAU64();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt64ToBinaryBig(c_Data64[u32_ArrayIndex], &orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-         }
-         break;
-      case eSINT8: ///< Data type signed 8 bit integer
-         c_DataS8 = this->GetValueAS8();
-         (void)std::memcpy(&orc_Data[0], &c_DataS8[0], orc_Data.size());
-         break;
-      case eSINT16: ///< Data type signed 16 bit integer
-         c_DataS16 = this->GetValueAS16();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)] =
-               static_cast<uint8>(static_cast<uint16>(c_DataS16[u32_ArrayIndex]) >> 8U);
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) +
-                     1] = static_cast<uint8>(static_cast<uint16>(c_DataS16[u32_ArrayIndex]));
-         }
-         break;
-      case eSINT32: ///< Data type unsigned 32 bit integer
-         c_DataS32 = this->GetValueAS32();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt32ToBinaryBig(static_cast<uint32>(c_DataS32[u32_ArrayIndex]),
-                                 &orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-         }
-         break;
-      case eSINT64: ///< Data type unsigned 64 bit integer
-         c_DataS64 = this->GetValueAS64();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt64ToBinaryBig(static_cast<uint64>(c_DataS64[u32_ArrayIndex]),
-                                 &orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-         }
-         break;
-      case eFLOAT32: ///< Data type 32 bit floating point
-         U_Union32 u_Value32;
-         c_DataF32 = this->GetValueAF32();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            u_Value32.f32_Value = c_DataF32[u32_ArrayIndex];
-            mh_UInt32ToBinaryBig(u_Value32.u32_Value, &orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-         }
-         break;
-      case eFLOAT64: ///< Data type 64 bit floating point
-         U_Union64 u_Value64;
-         c_DataF64 = this->GetValueAF64();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            u_Value64.f64_Value = c_DataF64[u32_ArrayIndex];
-            mh_UInt64ToBinaryBig(u_Value64.u64_Value, &orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-         }
-         break;
-      default:
-         break;
-      }
+      (void)this->GetValueAsBigEndianBlob(&orc_Data[0], static_cast<uint32>(orc_Data.size()));
    }
 }
 
@@ -3883,163 +3426,478 @@ void C_OSCNodeDataPoolContent::mh_UInt32ToBinaryLittle(const uint32 ou32_Data, u
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCNodeDataPoolContent::GetValueAsLittleEndianBlob(std::vector<uint8> & orc_Data) const
 {
-   //using unions is not nice but more portable than reinterpret_casting
-   //lint -e{9018}  //cf. comment above
-   union U_Union32
+   //set size ...
+   orc_Data.resize(this->GetSizeByte());
+
+   if (orc_Data.size() > 0UL)
    {
-      uint32 u32_Value;
-      float32 f32_Value;
-   };
+      (void)this->GetValueAsLittleEndianBlob(&orc_Data[0], static_cast<uint32>(orc_Data.size()));
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set value from big endian BLOB
+
+   Convert BLOB to values directly into the internal storage.
+   Considers configured element type.
+
+   \param[in]  opu8_Data   data to set
+   \param[in]  ou32_Size   number of bytes in opu8_Data
 
-   //lint -e{9018}  //cf. comment above
-   union U_Union64
+   \return
+   C_NO_ERR   value set
+   C_CONFIG   ou32_Size does not match our size
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCNodeDataPoolContent::SetValueFromBigEndianBlob(const uint8 * const opu8_Data, const uint32 ou32_Size)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   //is size correct ?
+   if (this->GetSizeByte() != ou32_Size)
+   {
+      s32_Return = C_CONFIG;
+   }
+   else
    {
-      uint64 u64_Value;
-      float64 f64_Value;
-   };
+      this->m_SetValueFromBlob(0U, opu8_Data, ou32_Size, true);
+   }
+   return s32_Return;
+}
 
-   //set size ...
-   orc_Data.resize(this->GetSizeByte());
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set value from little endian BLOB
 
-   if (this->GetArray() == false)
+   Convert BLOB to values directly into the internal storage.
+   Considers configured element type.
+
+   \param[in]  opu8_Data   data to set
+   \param[in]  ou32_Size   number of bytes in opu8_Data
+
+   \return
+   C_NO_ERR   value set
+   C_CONFIG   ou32_Size does not match our size
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCNodeDataPoolContent::SetValueFromLittleEndianBlob(const uint8 * const opu8_Data, const uint32 ou32_Size)
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   //is size correct ?
+   if (this->GetSizeByte() != ou32_Size)
    {
-      uint16 u16_Value;
-      U_Union32 u_Value32;
-      U_Union64 u_Value64;
-      //plain type
-      switch (this->me_Type)
-      {
-      case eUINT8: ///< Data type unsigned 8 bit integer
-         orc_Data[0] = this->GetValueU8();
-         break;
-      case eUINT16: ///< Data type unsigned 16 bit integer
-         u16_Value = this->GetValueU16();
-         orc_Data[1] = static_cast<uint8>(u16_Value >> 8U);
-         orc_Data[0] = static_cast<uint8>(u16_Value);
-         break;
-      case eUINT32: ///< Data type unsigned 32 bit integer
-         mh_UInt32ToBinaryLittle(this->GetValueU32(), &orc_Data[0]);
-         break;
-      case eUINT64: ///< Data type unsigned 64 bit integer
-         mh_UInt64ToBinaryLittle(this->GetValueU64(), &orc_Data[0]);
-         break;
-      case eSINT8: ///< Data type signed 8 bit integer
-         orc_Data[0] = this->GetValueS8();
-         break;
-      case eSINT16: ///< Data type signed 16 bit integer
-         u16_Value = static_cast<uint16>(this->GetValueS16());
-         orc_Data[1] = static_cast<uint8>(u16_Value >> 8U);
-         orc_Data[0] = static_cast<uint8>(u16_Value);
-         break;
-      case eSINT32: ///< Data type signed 32 bit integer
-         mh_UInt32ToBinaryLittle(static_cast<uint32>(this->GetValueS32()), &orc_Data[0]);
-         break;
-      case eSINT64: ///< Data type signed 64 bit integer
-         mh_UInt64ToBinaryLittle(static_cast<uint64>(this->GetValueS64()), &orc_Data[0]);
-         break;
-      case eFLOAT32: ///< Data type 32 bit floating point
-         u_Value32.f32_Value = this->GetValueF32();
-         mh_UInt32ToBinaryLittle(u_Value32.u32_Value, &orc_Data[0]);
-         break;
-      case eFLOAT64: ///< Data type 64 bit floating point
-         u_Value64.f64_Value = this->GetValueF64();
-         mh_UInt64ToBinaryLittle(u_Value64.u64_Value, &orc_Data[0]);
-         break;
-      default:
-         break;
-      }
+      s32_Return = C_CONFIG;
    }
    else
    {
-      //array type
-      //we set up the array here and assign in one go to ensure data consistency
-      uint32 u32_ArrayIndex;
-      std::vector<uint16> c_Data16;
-      std::vector<uint32> c_Data32;
-      std::vector<uint64> c_Data64;
-      std::vector<sint8> c_DataS8;
-      std::vector<sint16> c_DataS16;
-      std::vector<sint32> c_DataS32;
-      std::vector<sint64> c_DataS64;
-      std::vector<float32> c_DataF32;
-      std::vector<float64> c_DataF64;
-      switch (this->me_Type)
+      this->m_SetValueFromBlob(0U, opu8_Data, ou32_Size, false);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get values as big endian BLOB
+
+   Convert content value to BLOB directly from the internal storage.
+   Considers configured element type.
+
+   \param[out]  opu8_Data   data to set
+   \param[in]   ou32_Size   number of bytes available in opu8_Data
+
+   \return
+   C_NO_ERR   value written to the first GetSizeByte() bytes of opu8_Data
+   C_RANGE    ou32_Size is smaller than our size; nothing written
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCNodeDataPoolContent::GetValueAsBigEndianBlob(uint8 * const opu8_Data, const uint32 ou32_Size) const
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (ou32_Size < this->GetSizeByte())
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->m_GetValueAsBlob(opu8_Data, true);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set array elements from big endian BLOB
+
+   Convert BLOB to values directly into the internal storage, starting at the element ou32_FirstIndex.
+   All other elements keep their value.
+   Considers configured element type.
+
+   \param[in]  ou32_FirstIndex   index of first element to set
+   \param[in]  opu8_Data         data to set
+   \param[in]  ou32_Size         number of bytes in opu8_Data; must be a multiple of the element size
+
+   \return
+   C_NO_ERR   values set
+   C_RANGE    ou32_Size is not a multiple of the element size or the elements exceed the array size
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCNodeDataPoolContent::SetValueElementsFromBigEndianBlob(const uint32 ou32_FirstIndex,
+                                                                  const uint8 * const opu8_Data, const uint32 ou32_Size)
+{
+   sint32 s32_Return = C_NO_ERR;
+   const uint32 u32_ElementSize = this->m_GetElementSize();
+   const uint32 u32_NumElements = this->GetSizeByte() / u32_ElementSize;
+
+   if (((ou32_Size % u32_ElementSize) != 0U) || (ou32_FirstIndex > u32_NumElements) ||
+       ((ou32_Size / u32_ElementSize) > (u32_NumElements - ou32_FirstIndex)))
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->m_SetValueFromBlob(ou32_FirstIndex * u32_ElementSize, opu8_Data, ou32_Size, true);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get values as little endian BLOB
+
+   Convert content value to BLOB directly from the internal storage.
+   Considers configured element type.
+
+   \param[out]  opu8_Data   data to set
+   \param[in]   ou32_Size   number of bytes available in opu8_Data
+
+   \return
+   C_NO_ERR   value written to the first GetSizeByte() bytes of opu8_Data
+   C_RANGE    ou32_Size is smaller than our size; nothing written
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCNodeDataPoolContent::GetValueAsLittleEndianBlob(uint8 * const opu8_Data, const uint32 ou32_Size) const
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (ou32_Size < this->GetSizeByte())
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->m_GetValueAsBlob(opu8_Data, false);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Set array elements from little endian BLOB
+
+   Convert BLOB to values directly into the internal storage, starting at the element ou32_FirstIndex.
+   All other elements keep their value.
+   Considers configured element type.
+
+   \param[in]  ou32_FirstIndex   index of first element to set
+   \param[in]  opu8_Data         data to set
+   \param[in]  ou32_Size         number of bytes in opu8_Data; must be a multiple of the element size
+
+   \return
+   C_NO_ERR   values set
+   C_RANGE    ou32_Size is not a multiple of the element size or the elements exceed the array size
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_OSCNodeDataPoolContent::SetValueElementsFromLittleEndianBlob(const uint32 ou32_FirstIndex,
+                                                                     const uint8 * const opu8_Data,
+                                                                     const uint32 ou32_Size)
+{
+   sint32 s32_Return = C_NO_ERR;
+   const uint32 u32_ElementSize = this->m_GetElementSize();
+   const uint32 u32_NumElements = this->GetSizeByte() / u32_ElementSize;
+
+   if (((ou32_Size % u32_ElementSize) != 0U) || (ou32_FirstIndex > u32_NumElements) ||
+       ((ou32_Size / u32_ElementSize) > (u32_NumElements - ou32_FirstIndex)))
+   {
+      s32_Return = C_RANGE;
+   }
+   else
+   {
+      this->m_SetValueFromBlob(ou32_FirstIndex * u32_ElementSize, opu8_Data, ou32_Size, false);
+   }
+   return s32_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: set value from BLOB
+
+   All elements are converted in one go from the BLOB to the internal storage.
+   As signed and floating point values are stored with the bit pattern of the unsigned type of the same size only the
+   element size is relevant for the conversion.
+
+   \param[in]  ou32_Offset    byte offset in the internal storage to write the first element to
+   \param[in]  opu8_Data      data to set
+   \param[in]  ou32_Size      number of bytes in opu8_Data (caller is responsible to check the range)
+   \param[in]  oq_BigEndian   true: BLOB is big endian; false: BLOB is little endian
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCNodeDataPoolContent::m_SetValueFromBlob(const uint32 ou32_Offset, const uint8 * const opu8_Data,
+                                                  const uint32 ou32_Size, const bool oq_BigEndian)
+{
+   if (ou32_Size > 0UL)
+   {
+      const uint32 u32_ElementSize = this->m_GetElementSize();
+
+      this->mc_CriticalSection.Acquire();
+      if (u32_ElementSize == 1U)
       {
-      case eUINT8:
-         orc_Data = this->GetValueAU8();
-         break;
-      case eUINT16:
-         c_Data16 = this->GetValueAU16();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) + 1] = static_cast<uint8>(c_Data16[u32_ArrayIndex] >> 8U);
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U)] = static_cast<uint8>(c_Data16[u32_ArrayIndex]);
-         }
-         break;
-      case eUINT32: ///< Data type unsigned 32 bit integer
-         c_Data32 = this->GetValueAU32();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt32ToBinaryLittle(c_Data32[u32_ArrayIndex], &orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-         }
-         break;
-      case eUINT64: ///< Data type unsigned 64 bit integer
-         c_Data64 = this->GetValueAU64();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt64ToBinaryLittle(c_Data64[u32_ArrayIndex], &orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
-         }
-         break;
-      case eSINT8: ///< Data type signed 8 bit integer
-         c_DataS8 = this->GetValueAS8();
-         (void)std::memcpy(&orc_Data[0], &c_DataS8[0], orc_Data.size());
-         break;
-      case eSINT16: ///< Data type signed 16 bit integer
-         c_DataS16 = this->GetValueAS16();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            orc_Data[static_cast<size_t>(u32_ArrayIndex * 2U) +
-                     1] = static_cast<uint8>(static_cast<uint16>(c_DataS16[u32_ArrayIndex]) >> 8U);
-            orc_Data[static_cast<size_t>(u32_ArrayIndex *
-                                         2U)] = static_cast<uint8>(static_cast<uint16>(c_DataS16[u32_ArrayIndex]));
-         }
-         break;
-      case eSINT32: ///< Data type signed 32 bit integer
-         c_DataS32 = this->GetValueAS32();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
-         {
-            mh_UInt32ToBinaryLittle(static_cast<uint32>(c_DataS32[u32_ArrayIndex]),
-                                    &orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
-         }
-         break;
-      case eSINT64: ///< Data type signed 64 bit integer
-         c_DataS64 = this->GetValueAS64();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
+         (void)std::memcpy(&this->m_GetData()[ou32_Offset], opu8_Data, ou32_Size);
+      }
+      else
+      {
+         uint8 * const pu8_Target = &this->m_GetData()[ou32_Offset];
+         uint16 u16_Value;
+         uint32 u32_Value;
+         uint64 u64_Value;
+
+         for (uint32 u32_Pos = 0U; u32_Pos < ou32_Size; u32_Pos += u32_ElementSize)
          {
-            mh_UInt64ToBinaryLittle(static_cast<uint64>(c_DataS64[u32_ArrayIndex]),
-                                    &orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
+            switch (u32_ElementSize)
+            {
+            case 2U:
+               if (oq_BigEndian == true)
+               {
+                  u16_Value = static_cast<uint16>(static_cast<uint16>(opu8_Data[u32_Pos]) << 8U) +
+                              opu8_Data[u32_Pos + 1U];
+               }
+               else
+               {
+                  u16_Value = static_cast<uint16>(static_cast<uint16>(opu8_Data[u32_Pos + 1U]) << 8U) +
+                              opu8_Data[u32_Pos];
+               }
+               (void)std::memcpy(&pu8_Target[u32_Pos], &u16_Value, sizeof(u16_Value));
+               break;
+            case 4U:
+               u32_Value = (oq_BigEndian == true) ? mh_BinaryToUInt32Big(&opu8_Data[u32_Pos]) :
+                           mh_BinaryToUInt32Little(&opu8_Data[u32_Pos]);
+               //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
+               (void)std::memcpy(&pu8_Target[u32_Pos], &u32_Value, sizeof(u32_Value));
+               break;
+            default:
+               u64_Value = (oq_BigEndian == true) ? mh_BinaryToUInt64Big(&opu8_Data[u32_Pos]) :
+                           mh_BinaryToUInt64Little(&opu8_Data[u32_Pos]);
+               //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
+               (void)std::memcpy(&pu8_Target[u32_Pos], &u64_Value, sizeof(u64_Value));
+               break;
+            }
          }
-         break;
-      case eFLOAT32: ///< Data type 32 bit floating point
-         U_Union32 u_Value32;
-         c_DataF32 = this->GetValueAF32();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
+      }
+      this->mc_CriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: get value as BLOB
+
+   All elements are converted in one go from the internal storage to the BLOB.
+   As signed and floating point values are stored with the bit pattern of the unsigned type of the same size only the
+   element size is relevant for the conversion.
+
+   \param[out]  opu8_Data      data to set (caller is responsible to pass a buffer of GetSizeByte() bytes)
+   \param[in]   oq_BigEndian   true: create big endian BLOB; false: create little endian BLOB
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCNodeDataPoolContent::m_GetValueAsBlob(uint8 * const opu8_Data, const bool oq_BigEndian) const
+{
+   const uint32 u32_Size = this->mu32_DataSize;
+
+   if (u32_Size > 0UL)
+   {
+      const uint32 u32_ElementSize = this->m_GetElementSize();
+
+      this->mc_CriticalSection.Acquire();
+      if (u32_ElementSize == 1U)
+      {
+         (void)std::memcpy(opu8_Data, this->m_GetData(), u32_Size);
+      }
+      else
+      {
+         const uint8 * const pu8_Source = this->m_GetData();
+         uint16 u16_Value;
+         uint32 u32_Value;
+         uint64 u64_Value;
+
+         for (uint32 u32_Pos = 0U; u32_Pos < u32_Size; u32_Pos += u32_ElementSize)
          {
-            u_Value32.f32_Value = c_DataF32[u32_ArrayIndex];
-            mh_UInt32ToBinaryLittle(u_Value32.u32_Value, &orc_Data[static_cast<size_t>(u32_ArrayIndex * 4U)]);
+            switch (u32_ElementSize)
+            {
+            case 2U:
+               (void)std::memcpy(&u16_Value, &pu8_Source[u32_Pos], sizeof(u16_Value));
+               if (oq_BigEndian == true)
+               {
+                  opu8_Data[u32_Pos] = static_cast<uint8>(u16_Value >> 8U);
+                  opu8_Data[u32_Pos + 1U] = static_cast<uint8>(u16_Value);
+               }
+               else
+               {
+                  opu8_Data[u32_Pos + 1U] = static_cast<uint8>(u16_Value >> 8U);
+                  opu8_Data[u32_Pos] = static_cast<uint8>(u16_Value);
+               }
+               break;
+            case 4U:
+               //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
+               (void)std::memcpy(&u32_Value, &pu8_Source[u32_Pos], sizeof(u32_Value));
+               if (oq_BigEndian == true)
+               {
+                  mh_UInt32ToBinaryBig(u32_Value, &opu8_Data[u32_Pos]);
+               }
+               else
+               {
+                  mh_UInt32ToBinaryLittle(u32_Value, &opu8_Data[u32_Pos]);
+               }
+               break;
+            default:
+               //lint -e{9110} //we do not really use the bit representation; mc_Data is just our "BLOB" storage
+               (void)std::memcpy(&u64_Value, &pu8_Source[u32_Pos], sizeof(u64_Value));
+               if (oq_BigEndian == true)
+               {
+                  mh_UInt64ToBinaryBig(u64_Value, &opu8_Data[u32_Pos]);
+               }
+               else
+               {
+                  mh_UInt64ToBinaryLittle(u64_Value, &opu8_Data[u32_Pos]);
+               }
+               break;
+            }
          }
-         break;
-      case eFLOAT64: ///< Data type 64 bit floating point
-         U_Union64 u_Value64;
-         c_DataF64 = this->GetValueAF64();
-         for (u32_ArrayIndex = 0U; u32_ArrayIndex < this->GetArraySize(); u32_ArrayIndex++)
+      }
+      this->mc_CriticalSection.Release();
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Utility: get size of one element of the current type
+
+   \return
+   Type match:    size of one element in bytes
+   Type mismatch: Exception C_CONFIG
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCNodeDataPoolContent::m_GetElementSize(void) const
+{
+   uint32 u32_Retval = 1U;
+
+   switch (this->me_Type)
+   {
+   case eUINT8:
+   case eSINT8:
+      u32_Retval = 1U;
+      break;
+   case eUINT16:
+   case eSINT16:
+      u32_Retval = 2U;
+      break;
+   case eUINT32:
+   case eSINT32:
+   case eFLOAT32:
+      u32_Retval = 4U;
+      break;
+   case eUINT64:
+   case eSINT64:
+   case eFLOAT64:
+      u32_Retval = 8U;
+      break;
+   default:
+      throw C_OSCNodeDataPoolContent::mhs32_TypeError;
+      break;
+   }
+   return u32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pointer to contained value
+
+   \return
+   Start of local storage (value fits in) or heap storage (larger value)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint8 * C_OSCNodeDataPoolContent::m_GetData(void)
+{
+   uint8 * pu8_Retval;
+
+   if (this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+   {
+      pu8_Retval = this->mu_Storage.pu8_Heap;
+   }
+   else
+   {
+      pu8_Retval = &this->mu_Storage.au8_Local[0];
+   }
+   return pu8_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get pointer to contained value
+
+   \return
+   Start of local storage (value fits in) or heap storage (larger value)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const uint8 * C_OSCNodeDataPoolContent::m_GetData(void) const
+{
+   const uint8 * pu8_Retval;
+
+   if (this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+   {
+      pu8_Retval = this->mu_Storage.pu8_Heap;
+   }
+   else
+   {
+      pu8_Retval = &this->mu_Storage.au8_Local[0];
+   }
+   return pu8_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Resize contained value
+
+   Works like std::vector::resize: existing bytes are kept, new bytes are set to zero.
+   Values of up to mhu32_LOCAL_DATA_SIZE bytes are held in the local storage; only larger arrays use the heap.
+
+   \param[in]  ou32_Size  New size in bytes
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCNodeDataPoolContent::m_ResizeData(const uint32 ou32_Size)
+{
+   if (ou32_Size > mhu32_LOCAL_DATA_SIZE)
+   {
+      if (ou32_Size != this->mu32_DataSize)
+      {
+         //move to new heap storage
+         uint8 * const pu8_New = new uint8[ou32_Size];
+         const uint32 u32_Keep = (this->mu32_DataSize < ou32_Size) ? this->mu32_DataSize : ou32_Size;
+         (void)std::memcpy(pu8_New, this->m_GetData(), u32_Keep);
+         (void)std::memset(&pu8_New[u32_Keep], 0, ou32_Size - u32_Keep);
+         if (this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
          {
-            u_Value64.f64_Value = c_DataF64[u32_ArrayIndex];
-            mh_UInt64ToBinaryLittle(u_Value64.u64_Value, &orc_Data[static_cast<size_t>(u32_ArrayIndex * 8U)]);
+            delete[] this->mu_Storage.pu8_Heap;
          }
-         break;
-      default:
-         break;
+         this->mu_Storage.pu8_Heap = pu8_New;
+      }
+   }
+   else
+   {
+      if (this->mu32_DataSize > mhu32_LOCAL_DATA_SIZE)
+      {
+         //move from heap to local storage and release heap memory
+         uint8 * const pu8_Old = this->mu_Storage.pu8_Heap;
+         (void)std::memcpy(&this->mu_Storage.au8_Local[0], pu8_Old, ou32_Size);
+         delete[] pu8_Old;
+      }
+      else if (ou32_Size > this->mu32_DataSize)
+      {
+         (void)std::memset(&this->mu_Storage.au8_Local[this->mu32_DataSize], 0, ou32_Size - this->mu32_DataSize);
+      }
+      else
+      {
+         //shrinking within local storage: nothing to do
       }
    }
+   this->mu32_DataSize = ou32_Size;
 }
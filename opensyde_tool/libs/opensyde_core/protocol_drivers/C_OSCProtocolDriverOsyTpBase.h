@@ -87,6 +87,7 @@ protected:
 
    stw_types::sint32 m_AddToTxQueue(const C_OSCProtocolDriverOsyService & orc_Service);
    stw_types::sint32 m_AddToRxQueue(const C_OSCProtocolDriverOsyService & orc_Service);
+   stw_types::sint32 m_MoveToRxQueue(C_OSCProtocolDriverOsyService & orc_Service);
    stw_types::sint32 m_GetFromTxQueue(C_OSCProtocolDriverOsyService & orc_Service);
    stw_types::sint32 m_GetFromRxQueue(C_OSCProtocolDriverOsyService & orc_Service);
 
@@ -119,15 +119,32 @@ sint32 C_OSCProtocolDriverOsyTpIp::C_DoIpHeader::DecodeHeader(const std::vector<
 //----------------------------------------------------------------------------------------------------------------------
 void C_OSCProtocolDriverOsyTpIp::C_DoIpHeader::ComposeHeader(std::vector<uint8> & orc_Header) const
 {
+   uint8 au8_Header[hu8_DOIP_HEADER_SIZE];
+
+   this->ComposeHeader(au8_Header);
    orc_Header.resize(static_cast<uintn>(hu8_DOIP_HEADER_SIZE + u32_PayloadSize));
-   orc_Header[0] = 0x02U;         //protocol version DoIP ISO 13400-2:2012
-   orc_Header[1] = 0x02U ^ 0xFFU; //inverted protocol version
-   orc_Header[2] = static_cast<uint8>(u16_PayloadType >> 8U);
-   orc_Header[3] = static_cast<uint8>(u16_PayloadType & 0xFFU);
-   orc_Header[4] = static_cast<uint8>(u32_PayloadSize >> 24U);
-   orc_Header[5] = static_cast<uint8>(u32_PayloadSize >> 16U);
-   orc_Header[6] = static_cast<uint8>(u32_PayloadSize >> 8U);
-   orc_Header[7] = static_cast<uint8>(u32_PayloadSize);
+   (void)std::memcpy(&orc_Header[0], &au8_Header[0], hu8_DOIP_HEADER_SIZE);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Compose DoIp request header into fixed size buffer
+
+   Set up DoIp request header:
+   - DoIp header with version, payload type, payload size
+
+   \param[out]   orau8_Header       composed header
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCProtocolDriverOsyTpIp::C_DoIpHeader::ComposeHeader(uint8 (&orau8_Header)[hu8_DOIP_HEADER_SIZE]) const
+{
+   orau8_Header[0] = 0x02U;         //protocol version DoIP ISO 13400-2:2012
+   orau8_Header[1] = 0x02U ^ 0xFFU; //inverted protocol version
+   orau8_Header[2] = static_cast<uint8>(u16_PayloadType >> 8U);
+   orau8_Header[3] = static_cast<uint8>(u16_PayloadType & 0xFFU);
+   orau8_Header[4] = static_cast<uint8>(u32_PayloadSize >> 24U);
+   orau8_Header[5] = static_cast<uint8>(u32_PayloadSize >> 16U);
+   orau8_Header[6] = static_cast<uint8>(u32_PayloadSize >> 8U);
+   orau8_Header[7] = static_cast<uint8>(u32_PayloadSize);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -705,18 +722,20 @@ C_OSCProtocolDriverOsyTpIp::~C_OSCProtocolDriverOsyTpIp(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Compose DoIp request
+/*! \brief   Compose DoIp request header
 
-   Set up one DoIp frame:
+   Set up the header of one DoIp frame:
    - DoIp header with payload type "DiagnosticMessage"
-   - Service data as payload
+   - source and target address
+
+   The service data is not copied: it shall be sent directly after the header.
 
-   \param[in]    orc_Service    service to put into request
-   \param[out]   orc_Request    composed data, ready for sending via IP
+   \param[in]    orc_Service    service to compose request header for
+   \param[out]   orau8_Header   composed header, ready for sending via IP
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_OSCProtocolDriverOsyTpIp::m_ComposeRequest(const C_OSCProtocolDriverOsyService & orc_Service,
-                                                  std::vector<uint8> & orc_Request) const
+void C_OSCProtocolDriverOsyTpIp::m_ComposeRequestHeader(const C_OSCProtocolDriverOsyService & orc_Service,
+                                                        uint8 (&orau8_Header)[mhu8_REQUEST_HEADER_SIZE]) const
 {
    const uint16 u16_SourceAddress = (static_cast<uint16>(static_cast<uint16>(mc_ClientId.u8_BusIdentifier) << 7U) +
                                      mc_ClientId.u8_NodeIdentifier) + 1U;
@@ -726,6 +745,7 @@ void C_OSCProtocolDriverOsyTpIp::m_ComposeRequest(const C_OSCProtocolDriverOsySe
    const uint32 u32_RequestSizePayload = 2U + 2U + static_cast<uint32>(orc_Service.c_Data.size());
 
    C_DoIpHeader c_Header;
+   uint8 au8_DoIpHeader[C_DoIpHeader::hu8_DOIP_HEADER_SIZE];
 
    c_Header.u32_PayloadSize = u32_RequestSizePayload;
 
@@ -738,16 +758,15 @@ void C_OSCProtocolDriverOsyTpIp::m_ComposeRequest(const C_OSCProtocolDriverOsySe
       c_Header.u16_PayloadType = C_DoIpHeader::hu16_PAYLOAD_TYPE_CAN_ROUTING_WITHOUT_FC_REQ;
    }
 
-   c_Header.ComposeHeader(orc_Request);
+   c_Header.ComposeHeader(au8_DoIpHeader);
+   (void)std::memcpy(&orau8_Header[0], &au8_DoIpHeader[0], C_DoIpHeader::hu8_DOIP_HEADER_SIZE);
 
-   //add payload:
+   //start of payload:
    //source and target address:
-   orc_Request[8]  = static_cast<uint8>(u16_SourceAddress >> 8U);
-   orc_Request[9]  = static_cast<uint8>(u16_SourceAddress);
-   orc_Request[10] = static_cast<uint8>(u16_TargetAddress >> 8U);
-   orc_Request[11] = static_cast<uint8>(u16_TargetAddress);
-   //service:
-   (void)std::memcpy(&orc_Request[12], &orc_Service.c_Data[0], orc_Service.c_Data.size());
+   orau8_Header[8]  = static_cast<uint8>(u16_SourceAddress >> 8U);
+   orau8_Header[9]  = static_cast<uint8>(u16_SourceAddress);
+   orau8_Header[10] = static_cast<uint8>(u16_TargetAddress >> 8U);
+   orau8_Header[11] = static_cast<uint8>(u16_TargetAddress);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -785,11 +804,12 @@ sint32 C_OSCProtocolDriverOsyTpIp::Cycle(void)
          s32_Return = this->m_GetFromTxQueue(c_Service);
          if (s32_Return == C_NO_ERR)
          {
-            //send data on TCP:
-            std::vector<uint8> c_Request;
-            m_ComposeRequest(c_Service, c_Request);
+            //send data on TCP; header and service data are passed separately to avoid copying the service data:
+            uint8 au8_Header[mhu8_REQUEST_HEADER_SIZE];
+            m_ComposeRequestHeader(c_Service, au8_Header);
 
-            s32_Return = mpc_Dispatcher->SendTcp(this->mu32_DispatcherHandle, c_Request);
+            s32_Return = mpc_Dispatcher->SendTcpWithHeader(this->mu32_DispatcherHandle, &au8_Header[0],
+                                                           mhu8_REQUEST_HEADER_SIZE, c_Service.c_Data);
             if (s32_Return != C_NO_ERR)
             {
                m_LogWarningWithHeader("Could not send TCP request. Service data lost.", TGL_UTIL_FUNC_ID);
@@ -808,9 +828,10 @@ sint32 C_OSCProtocolDriverOsyTpIp::Cycle(void)
       }
 
       //read all incoming messages:
+      //the buffer is kept over all loops so reading headers does not need new allocations
+      std::vector<uint8> c_Data;
       while (s32_Return == C_NO_ERR)
       {
-         std::vector<uint8> c_Data;
          bool q_DataFromBuffer = false;
 
          //As the TCP transfer is stream based we must consider that we might not get "exactly" one service here.
@@ -902,10 +923,11 @@ sint32 C_OSCProtocolDriverOsyTpIp::Cycle(void)
                   switch (mc_RxState.c_ServiceHeader.u16_PayloadType)
                   {
                   case C_DoIpHeader::hu16_PAYLOAD_TYPE_DIAGNOSTIC_MESSAGE:
-                     c_Service.c_Data.resize(c_Data.size() - 4U);
-                     (void)std::memcpy(&c_Service.c_Data[0], &c_Data[4], c_Data.size() - 4U);
-                     //add to queue:
-                     s32_Return = m_AddToRxQueue(c_Service);
+                     //remove source and target address in place and hand over the buffer to the queue:
+                     c_Data.erase(c_Data.begin(), c_Data.begin() + 4);
+                     c_Service.c_Data.swap(c_Data);
+                     c_Service.q_CanTransferWithoutFlowControl = false;
+                     s32_Return = m_MoveToRxQueue(c_Service);
                      if (s32_Return != C_NO_ERR)
                      {
                         m_LogWarningWithHeader("Rx Queue overflow. Incoming TCP response dumped.", TGL_UTIL_FUNC_ID);
@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <vector>
+#include <list>
 #include <set>
 #include <map>
 #include "stwtypes.h"
@@ -132,7 +133,10 @@ protected:
    stw_types::sint32 m_StartRoutingIp2Ip(const stw_types::uint32 ou32_ActiveNode,
                                          stw_types::uint32 * const opu32_ErrorActiveNodeIndex);
    stw_types::sint32 m_StartRouting(const stw_types::uint32 ou32_ActiveNode,
-                                    stw_types::uint32 * const opu32_ErrorActiveNodeIndex);
+                                    stw_types::uint32 * const opu32_ErrorActiveNodeIndex,
+                                    std::map<stw_types::uint32,
+                                             std::set<std::vector<stw_types::uint8> > > * const opc_ConfiguredRouters =
+                                       NULL);
    void m_StopRouting(const stw_types::uint32 ou32_ActiveNode);
    void m_StopRoutingOfActiveNodes(void);
    stw_types::sint32 m_StopRoutingOfRoutingPoint(const stw_types::uint32 ou32_ActiveNode,
@@ -184,7 +188,21 @@ protected:
    virtual bool m_CheckInterfaceForFunctions(const C_OSCNodeComInterfaceSettings & orc_ComItfSettings) const = 0;
 
 private:
+   ///Result of the route calculation for one routing relevant configuration
+   class C_RouteCacheEntry
+   {
+   public:
+      std::vector<stw_types::uint32> c_Key; ///< Routing relevant configuration (see m_GetRouteCacheKey)
+      stw_types::sint32 s32_Result;
+      std::vector<stw_types::uint32> c_ActiveNodesIndexes;
+      std::vector<stw_opensyde_core::C_OSCRoutingRoute> c_Routes;
+   };
+
    static const stw_types::uint8 mhu8_NODE_ID_CLIENT = 126;
+   static const stw_types::uint32 mhu32_ROUTE_CACHE_SIZE = 8U;
+
+   static std::list<C_RouteCacheEntry> mhc_RouteCache; ///< Last calculated routes, most recently used first
+   static stw_tgl::C_TGLCriticalSection mhc_RouteCacheCriticalSection;
 
    stw_opensyde_core::C_OSCProtocolDriverOsyNode mc_ClientID; ///< Client/our own ID
    stw_types::uint32 mu32_ActiveNodeCount;                    ///< Active node count
@@ -210,6 +228,8 @@ private:
    stw_types::uint32 mu32_ActiveBusIndex;
 
    stw_types::sint32 m_InitRoutesAndActiveNodes(void);
+   void m_GetRouteCacheKey(const C_OSCRoutingCalculation::E_Mode oe_Mode, const bool oq_RoutingUsed,
+                           std::vector<stw_types::uint32> & orc_Key) const;
    stw_types::sint32 m_InitServerIds(void);
    stw_types::sint32 m_InitForCAN(void);
    stw_types::sint32 m_InitForEthernet(void);
@@ -362,6 +362,7 @@ sint32 C_OSCComMessageLogger::SetOsySysDefBus(const C_SCLString & orc_PathSystem
           (c_ItSysDef->second.c_OsySysDef.c_Buses[ou32_BusIndex].e_Type == C_OSCSystemBus::eCAN))
       {
          c_ItSysDef->second.u32_BusIndex = ou32_BusIndex;
+         this->m_UpdateOsySysDefMessageIndex();
          s32_Return = C_NO_ERR;
       }
       else
@@ -427,6 +428,7 @@ sint32 C_OSCComMessageLogger::RemoveDatabase(const C_SCLString & orc_Path)
 
       // Remove the entry
       this->mc_OsySysDefs.erase(c_ItSysDef);
+      this->m_UpdateOsySysDefMessageIndex();
 
       s32_Return = C_NO_ERR;
    }
@@ -473,6 +475,7 @@ sint32 C_OSCComMessageLogger::ActivateDatabase(const C_SCLString & orc_Path, con
             this->mc_ProtocolDec.RemoveOsySysDef(&(c_ItSysDef->second));
             this->mc_ProtocolHex.RemoveOsySysDef(&(c_ItSysDef->second));
          }
+         this->m_UpdateOsySysDefMessageIndex();
       }
    }
 
@@ -901,6 +904,8 @@ void C_OSCComMessageLogger::m_InsertOsySysDef(const C_SCLString & orc_PathSystem
 
    this->mc_ProtocolDec.AddOsySysDef(&(c_ItNewConfig->second));
    this->mc_ProtocolHex.AddOsySysDef(&(c_ItNewConfig->second));
+
+   this->m_UpdateOsySysDefMessageIndex();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -920,15 +925,47 @@ bool C_OSCComMessageLogger::m_CheckSysDef(const T_STWCAN_Msg_RX & orc_Msg)
 {
    bool q_Return = false;
 
+   const std::map<uint32, C_OsySysDefMessageLocation>::const_iterator c_ItLocation =
+      this->mc_OsySysDefMessageIndex.find(mh_GetMessageIndexKey(orc_Msg.u32_ID, (orc_Msg.u8_XTD == 1U)));
+
+   if (c_ItLocation != this->mc_OsySysDefMessageIndex.end())
+   {
+      this->mpc_OsySysDefMessage = c_ItLocation->second.pc_Message;
+      this->mpc_OsySysDefDataPoolList = c_ItLocation->second.pc_DataPoolList;
+      q_Return = c_ItLocation->second.q_DataPoolFound;
+   }
+   else
+   {
+      this->mpc_OsySysDefMessage = NULL;
+      this->mpc_OsySysDefDataPoolList = NULL;
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Updates the index of all CAN messages of the active system definitions
+
+   Must be called after each change of the registered system definitions, their bus or their activation.
+   If a CAN ID is used more than once, the message of the first system definition, node, protocol and message
+   in this order is registered.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_OSCComMessageLogger::m_UpdateOsySysDefMessageIndex(void)
+{
    std::map<stw_scl::C_SCLString, C_OSCComMessageLoggerOsySysDefConfig>::const_iterator c_ItSysDef;
 
+   this->mc_OsySysDefMessageIndex.clear();
    this->mpc_OsySysDefMessage = NULL;
    this->mpc_OsySysDefDataPoolList = NULL;
 
    for (c_ItSysDef = this->mc_OsySysDefs.begin(); c_ItSysDef != this->mc_OsySysDefs.end(); ++c_ItSysDef)
    {
+      const std::map<stw_scl::C_SCLString, bool>::const_iterator c_ItFlag =
+         this->mc_DatabaseActiveFlags.find(c_ItSysDef->first);
+
       // Check if the database is active
-      if (this->mc_DatabaseActiveFlags[c_ItSysDef->first] == true)
+      if ((c_ItFlag != this->mc_DatabaseActiveFlags.end()) && (c_ItFlag->second == true))
       {
          const C_OSCSystemDefinition & rc_OsySysDef = c_ItSysDef->second.c_OsySysDef;
          uint32 u32_NodeCounter;
@@ -955,7 +992,7 @@ bool C_OSCComMessageLogger::m_CheckSysDef(const T_STWCAN_Msg_RX & orc_Msg)
 
             if (q_IntfFound == true)
             {
-               // Check all messages of the node for this interface on this bus
+               // Register all messages of the node for this interface on this bus
                uint32 u32_ProtCounter;
 
                for (u32_ProtCounter = 0U; u32_ProtCounter < rc_Node.c_ComProtocols.size(); ++u32_ProtCounter)
@@ -967,57 +1004,56 @@ bool C_OSCComMessageLogger::m_CheckSysDef(const T_STWCAN_Msg_RX & orc_Msg)
                   {
                      const std::vector<C_OSCCanMessage> & rc_CanMsgContainerTx =
                         rc_CanProt.c_ComMessages[u32_IntfCounter].c_TxMessages;
+                     C_OsySysDefMessageLocation c_Location;
                      uint32 u32_CanMsgCounter;
 
+                     // Get the associated list
+                     c_Location.pc_DataPoolList = NULL;
+                     c_Location.q_DataPoolFound = false;
+                     tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
+                     if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
+                     {
+                        c_Location.pc_DataPoolList =
+                           C_OSCCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
+                                                               u32_IntfCounter, true);
+                        tgl_assert(c_Location.pc_DataPoolList != NULL);
+                        c_Location.q_DataPoolFound = true;
+                     }
+
                      for (u32_CanMsgCounter = 0U; u32_CanMsgCounter < rc_CanMsgContainerTx.size(); ++u32_CanMsgCounter)
                      {
                         const C_OSCCanMessage & rc_OscMsg = rc_CanMsgContainerTx[u32_CanMsgCounter];
 
                         // No check of dlc here, it will be checked for each signal
-                        if ((orc_Msg.u32_ID == rc_OscMsg.u32_CanId) &&
-                            ((orc_Msg.u8_XTD == 1U) == rc_OscMsg.q_IsExtended))
-                        {
-                           // Message matches
-                           this->mpc_OsySysDefMessage = &rc_OscMsg;
-
-                           // Get the associated list
-                           tgl_assert(rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size());
-                           if (rc_CanProt.u32_DataPoolIndex < rc_Node.c_DataPools.size())
-                           {
-                              this->mpc_OsySysDefDataPoolList =
-                                 C_OSCCanProtocol::h_GetComListConst(rc_Node.c_DataPools[rc_CanProt.u32_DataPoolIndex],
-                                                                     u32_IntfCounter, true);
-                              tgl_assert(this->mpc_OsySysDefDataPoolList != NULL);
-
-                              q_Return = true;
-                           }
-
-                           break;
-                        }
+                        // Insert does not replace an already registered message with the same CAN ID
+                        c_Location.pc_Message = &rc_OscMsg;
+                        this->mc_OsySysDefMessageIndex.insert(
+                           std::pair<uint32, C_OsySysDefMessageLocation>(
+                              mh_GetMessageIndexKey(rc_OscMsg.u32_CanId, rc_OscMsg.q_IsExtended), c_Location));
                      }
                   }
-
-                  if (this->mpc_OsySysDefMessage != NULL)
-                  {
-                     break;
-                  }
                }
             }
-
-            if (this->mpc_OsySysDefMessage != NULL)
-            {
-               break;
-            }
-         }
-
-         if (this->mpc_OsySysDefMessage != NULL)
-         {
-            break;
          }
       }
    }
+}
 
-   return q_Return;
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Get key of a CAN message for the message indexes
+
+   Used by all CAN ID based message indexes (including the ones of derived classes) to keep the key format in sync.
+
+   \param[in] ou32_CanId    CAN ID
+   \param[in] oq_IsExtended Flag if CAN ID is extended
+
+   \return
+   Key with extended flag in the highest bit
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_OSCComMessageLogger::mh_GetMessageIndexKey(const uint32 ou32_CanId, const bool oq_IsExtended)
+{
+   return (oq_IsExtended == true) ? (ou32_CanId | 0x80000000U) : ou32_CanId;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
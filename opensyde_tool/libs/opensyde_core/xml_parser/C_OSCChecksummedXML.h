@@ -42,16 +42,23 @@ class C_OSCChecksummedXML :
    public C_OSCXMLParser
 {
 private:
-   stw_types::uint16 mu16_CRCDepth;
-
-   void m_CalcXMLCRCNode(stw_types::uint16 & oru16_CRC);
-   stw_types::uint16 m_CalcXMLCRC(void);
+   static void mh_CalcCRCText(const stw_types::charn * const opcn_Text, stw_types::uint16 & oru16_CRC);
+   stw_types::uint16 m_CalcXMLCRC(void) const;
 
 public:
    C_OSCChecksummedXML(void);
 
    virtual stw_types::sint32 LoadFromFile(const stw_scl::C_SCLString & orc_FileName);
    virtual stw_types::sint32 SaveToFile(const stw_scl::C_SCLString & orc_FileName);
+
+   //building blocks of the CRC calculation; used by the streaming reader and writer
+   static const stw_types::uint16 hu16_CRC_START_VALUE;
+   static const stw_types::charn * const hpcn_CRC_ATTRIBUTE_NAME;
+
+   static void h_CalcCRCElementStart(const tinyxml2::XMLElement & orc_Element, const bool oq_IsRoot,
+                                     stw_types::uint16 & oru16_Depth, stw_types::uint16 & oru16_CRC);
+   static void h_CalcCRCElement(const tinyxml2::XMLElement & orc_Element, stw_types::uint16 & oru16_Depth,
+                                stw_types::uint16 & oru16_CRC);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
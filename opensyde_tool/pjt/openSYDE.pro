@@ -471,6 +471,7 @@ SOURCES += ../src/main.cpp \
     ../src/opensyde_gui_elements/group_box/C_OgeGbxTransparentDashboard.cpp \
     ../src/project_gui/system_views/dashboard/C_PuiSvDbChart.cpp \
     ../src/project_gui/system_views/dashboard/C_PuiSvDbToggle.cpp \
+    ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataSerieBuffer.cpp \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartWidget.cpp \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataSelectorWidget.cpp \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataItemWidget.cpp \
@@ -1299,6 +1300,7 @@ HEADERS  += \
     ../src/opensyde_gui_elements/group_box/C_OgeGbxTransparentDashboard.h \
     ../src/project_gui/system_views/dashboard/C_PuiSvDbChart.h \
     ../src/project_gui/system_views/dashboard/C_PuiSvDbToggle.h \
+    ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataSerieBuffer.h \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartWidget.h \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataSelectorWidget.h \
     ../src/system_views/dashboards/items/chart/C_SyvDaItChartDataItemWidget.h \
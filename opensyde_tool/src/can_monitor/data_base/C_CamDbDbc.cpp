@@ -64,6 +64,7 @@ void C_CamDbDbc::SetActive(const bool oq_Active)
 void C_CamDbDbc::SetData(const C_CieConverter::C_CIECommDefinition & orc_Data)
 {
    this->mc_Data = orc_Data;
+   this->m_FillMessageNamesById();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -135,7 +136,7 @@ void C_CamDbDbc::FindAllMessages(void)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Search for a message with this ID, return the first one found
+/*! \brief   Search for a message with this ID (see m_FillMessageNamesById for duplicate IDs)
 
    \param[in]   ou32_Id       CAN ID to search for
    \param[out]  orc_Message   Found message name (only valid if C_NO_ERR)
@@ -148,47 +149,13 @@ void C_CamDbDbc::FindAllMessages(void)
 sint32 C_CamDbDbc::FindMessageById(const uint32 ou32_Id, QString & orc_Message) const
 {
    sint32 s32_Retval = C_NOACT;
+   const QMap<uint32, QString>::const_iterator c_It = this->mc_MessageNamesById.find(ou32_Id);
 
-   //Each node
-   for (uint32 u32_ItNode = 0UL; (u32_ItNode < this->mc_Data.c_Nodes.size()) && (s32_Retval == C_NOACT);
-        ++u32_ItNode)
+   if (c_It != this->mc_MessageNamesById.end())
    {
-      const C_CieConverter::C_CIENode & rc_Node = this->mc_Data.c_Nodes[u32_ItNode];
-      //Each Rx message
-      for (uint32 u32_ItMessage = 0UL; (u32_ItMessage < rc_Node.c_RxMessages.size()) && (s32_Retval == C_NOACT);
-           ++u32_ItMessage)
-      {
-         const C_CieConverter::C_CIENodeMessage & rc_Message = rc_Node.c_RxMessages[u32_ItMessage];
-         if (rc_Message.c_CanMessage.u32_CanId == ou32_Id)
-         {
-            //Found match
-            orc_Message = rc_Message.c_CanMessage.c_Name.c_str();
-            s32_Retval = C_NO_ERR;
-         }
-      }
-      //Each Tx message
-      for (uint32 u32_ItMessage = 0UL; (u32_ItMessage < rc_Node.c_TxMessages.size()) && (s32_Retval == C_NOACT);
-           ++u32_ItMessage)
-      {
-         const C_CieConverter::C_CIENodeMessage & rc_Message = rc_Node.c_TxMessages[u32_ItMessage];
-         if (rc_Message.c_CanMessage.u32_CanId == ou32_Id)
-         {
-            //Found match
-            orc_Message = rc_Message.c_CanMessage.c_Name.c_str();
-            s32_Retval = C_NO_ERR;
-         }
-      }
-   }
-   //Unmapped messages
-   for (uint32 u32_ItMessage = 0UL; u32_ItMessage < this->mc_Data.c_UnmappedMessages.size(); ++u32_ItMessage)
-   {
-      const C_CieConverter::C_CIENodeMessage & rc_Message = this->mc_Data.c_UnmappedMessages[u32_ItMessage];
-      if (rc_Message.c_CanMessage.u32_CanId == ou32_Id)
-      {
-         //Found match
-         orc_Message = rc_Message.c_CanMessage.c_Name.c_str();
-         s32_Retval = C_NO_ERR;
-      }
+      //Found match
+      orc_Message = c_It.value();
+      s32_Retval = C_NO_ERR;
    }
    return s32_Retval;
 }
@@ -213,6 +180,11 @@ sint32 C_CamDbDbc::FindMessage(const QString & orc_Message)
    {
       s32_Retval = C_NO_ERR;
    }
+   else if (this->mq_FoundAll == true)
+   {
+      //All messages are known already, no need to search again
+      s32_Retval = C_NOACT;
+   }
    else
    {
       C_CamDbDbcMessageId c_Id;
@@ -322,6 +294,18 @@ const std::vector<QString> C_CamDbDbc::GetFoundMessages(void) const
    return c_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get names of all messages by CAN ID
+
+   \return
+   Message name for each CAN ID (see m_FillMessageNamesById)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const QMap<uint32, QString> & C_CamDbDbc::GetMessageNamesById(void) const
+{
+   return this->mc_MessageNamesById;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get DBC message
 
@@ -430,3 +414,49 @@ bool C_CamDbDbc::CheckHashForMessage(const QString & orc_Message, const uint32 o
    }
    return q_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store the message name for each CAN ID
+
+   Search order: Rx and Tx messages of each node, then unmapped messages.
+   The first message of the nodes is used for each CAN ID, but an unmapped message replaces it and the last unmapped
+   message with the same CAN ID is used.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamDbDbc::m_FillMessageNamesById(void)
+{
+   this->mc_MessageNamesById.clear();
+
+   //Each node
+   for (uint32 u32_ItNode = 0UL; u32_ItNode < this->mc_Data.c_Nodes.size(); ++u32_ItNode)
+   {
+      const C_CieConverter::C_CIENode & rc_Node = this->mc_Data.c_Nodes[u32_ItNode];
+      //Each Rx message
+      for (uint32 u32_ItMessage = 0UL; u32_ItMessage < rc_Node.c_RxMessages.size(); ++u32_ItMessage)
+      {
+         const C_CieConverter::C_CIECanMessage & rc_Message = rc_Node.c_RxMessages[u32_ItMessage].c_CanMessage;
+         //Use first occurance
+         if (!this->mc_MessageNamesById.contains(rc_Message.u32_CanId))
+         {
+            this->mc_MessageNamesById.insert(rc_Message.u32_CanId, rc_Message.c_Name.c_str());
+         }
+      }
+      //Each Tx message
+      for (uint32 u32_ItMessage = 0UL; u32_ItMessage < rc_Node.c_TxMessages.size(); ++u32_ItMessage)
+      {
+         const C_CieConverter::C_CIECanMessage & rc_Message = rc_Node.c_TxMessages[u32_ItMessage].c_CanMessage;
+         //Use first occurance
+         if (!this->mc_MessageNamesById.contains(rc_Message.u32_CanId))
+         {
+            this->mc_MessageNamesById.insert(rc_Message.u32_CanId, rc_Message.c_Name.c_str());
+         }
+      }
+   }
+   //Unmapped messages
+   for (uint32 u32_ItMessage = 0UL; u32_ItMessage < this->mc_Data.c_UnmappedMessages.size(); ++u32_ItMessage)
+   {
+      const C_CieConverter::C_CIECanMessage & rc_Message = this->mc_Data.c_UnmappedMessages[u32_ItMessage].c_CanMessage;
+      //Use last occurance
+      this->mc_MessageNamesById.insert(rc_Message.u32_CanId, rc_Message.c_Name.c_str());
+   }
+}
@@ -38,6 +38,7 @@ public:
 
    bool GetActive(void) const;
    const std::vector<QString> GetFoundMessages(void) const;
+   const QMap<stw_types::uint32, QString> & GetMessageNamesById(void) const;
    const C_CieConverter::C_CIECanMessage * GetDBCMessage(const QString & orc_Message, const bool oq_UseHash,
                                                          const stw_types::uint32 ou32_Hash) const;
    bool CheckHashForMessage(const QString & orc_Message, const stw_types::uint32 ou32_Hash) const;
@@ -48,6 +49,9 @@ private:
    C_CieConverter::C_CIECommDefinition mc_Data;
    QMap<QString, C_CamDbDbcMessageId> mc_FoundMessagesNodes;
    QMap<QString, C_CamDbDbcUnmappedMessageId> mc_FoundMessagesUnmapped;
+   QMap<stw_types::uint32, QString> mc_MessageNamesById;
+
+   void m_FillMessageNamesById(void);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -42,6 +42,7 @@ void C_CamDbHandler::RemoveAllFiles(void)
 {
    this->mc_DBCFiles.clear();
    this->mc_OSYFiles.clear();
+   this->mc_MessagesById.clear();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -53,6 +54,7 @@ void C_CamDbHandler::RemoveAllFiles(void)
 void C_CamDbHandler::RemoveDbcFile(const QString & orc_File)
 {
    this->mc_DBCFiles.remove(orc_File);
+   this->m_UpdateMessagesById();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -64,6 +66,7 @@ void C_CamDbHandler::RemoveDbcFile(const QString & orc_File)
 void C_CamDbHandler::RemoveOsyFile(const QString & orc_File)
 {
    this->mc_OSYFiles.remove(orc_File);
+   this->m_UpdateMessagesById();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -79,6 +82,7 @@ void C_CamDbHandler::AddDbcFile(const QString & orc_File, const C_CieConverter::
 
    c_New.SetData(orc_Data);
    this->mc_DBCFiles.insert(orc_File, c_New);
+   this->m_UpdateMessagesById();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -95,6 +99,7 @@ void C_CamDbHandler::AddOsyFile(const QString & orc_File,
 
    c_New.SetData(orc_Data);
    this->mc_OSYFiles.insert(orc_File, c_New);
+   this->m_UpdateMessagesById();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -160,26 +165,14 @@ void C_CamDbHandler::FindAllMessages(void)
 sint32 C_CamDbHandler::FindMessageById(const uint32 ou32_Id, QString & orc_File, QString & orc_Message) const
 {
    sint32 s32_Retval = C_NOACT;
+   const QMap<uint32, QPair<QString, QString> >::const_iterator c_It = this->mc_MessagesById.find(ou32_Id);
 
-   for (QMap<QString, C_CamDbOsy>::const_iterator c_It = this->mc_OSYFiles.begin();
-        (c_It != this->mc_OSYFiles.end()) && (s32_Retval == C_NOACT); ++c_It)
+   if (c_It != this->mc_MessagesById.end())
    {
-      s32_Retval = c_It->FindMessageById(ou32_Id, orc_Message);
-      if (s32_Retval == C_NO_ERR)
-      {
-         //Found match
-         orc_File = c_It.key();
-      }
-   }
-   for (QMap<QString, C_CamDbDbc>::const_iterator c_It = this->mc_DBCFiles.begin();
-        (c_It != this->mc_DBCFiles.end()) && (s32_Retval == C_NOACT); ++c_It)
-   {
-      s32_Retval = c_It->FindMessageById(ou32_Id, orc_Message);
-      if (s32_Retval == C_NO_ERR)
-      {
-         //Found match
-         orc_File = c_It.key();
-      }
+      //Found match
+      orc_File = c_It->first;
+      orc_Message = c_It->second;
+      s32_Retval = C_NO_ERR;
    }
    return s32_Retval;
 }
@@ -423,6 +416,10 @@ sint32 C_CamDbHandler::ReplaceOsyBusIndex(const QString & orc_File, const uint32
    if (c_It != this->mc_OSYFiles.end())
    {
       orq_Change = c_It->ReplaceOsyBusIndex(ou32_BusIndex);
+      if (orq_Change == true)
+      {
+         this->m_UpdateMessagesById();
+      }
       s32_Retval = C_NO_ERR;
    }
    return s32_Retval;
@@ -477,3 +474,42 @@ C_CamDbHandler * C_CamDbHandler::h_GetInstance(void)
 C_CamDbHandler::C_CamDbHandler(void)
 {
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update the file and message name for each CAN ID
+
+   First all OSY files are considered, then all DBC files. The first message found for a CAN ID is used.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamDbHandler::m_UpdateMessagesById(void)
+{
+   this->mc_MessagesById.clear();
+   for (QMap<QString, C_CamDbOsy>::const_iterator c_It = this->mc_OSYFiles.begin(); c_It != this->mc_OSYFiles.end();
+        ++c_It)
+   {
+      const QMap<uint32, QString> & rc_Messages = c_It->GetMessageNamesById();
+      for (QMap<uint32, QString>::const_iterator c_ItMessage = rc_Messages.begin();
+           c_ItMessage != rc_Messages.end(); ++c_ItMessage)
+      {
+         //Use first occurance
+         if (!this->mc_MessagesById.contains(c_ItMessage.key()))
+         {
+            this->mc_MessagesById.insert(c_ItMessage.key(), QPair<QString, QString>(c_It.key(), c_ItMessage.value()));
+         }
+      }
+   }
+   for (QMap<QString, C_CamDbDbc>::const_iterator c_It = this->mc_DBCFiles.begin(); c_It != this->mc_DBCFiles.end();
+        ++c_It)
+   {
+      const QMap<uint32, QString> & rc_Messages = c_It->GetMessageNamesById();
+      for (QMap<uint32, QString>::const_iterator c_ItMessage = rc_Messages.begin();
+           c_ItMessage != rc_Messages.end(); ++c_ItMessage)
+      {
+         //Use first occurance
+         if (!this->mc_MessagesById.contains(c_ItMessage.key()))
+         {
+            this->mc_MessagesById.insert(c_ItMessage.key(), QPair<QString, QString>(c_It.key(), c_ItMessage.value()));
+         }
+      }
+   }
+}
@@ -13,6 +13,7 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QMap>
+#include <QPair>
 #include "C_CamDbOsy.h"
 #include "C_CamDbDbc.h"
 #include "C_OSCCanMessage.h"
@@ -74,9 +75,12 @@ public:
 private:
    QMap<QString, C_CamDbDbc> mc_DBCFiles;
    QMap<QString, C_CamDbOsy> mc_OSYFiles;
+   QMap<stw_types::uint32, QPair<QString, QString> > mc_MessagesById; // File and message name for each CAN ID
    static C_CamDbHandler mhc_Instance;
 
    C_CamDbHandler(void);
+
+   void m_UpdateMessagesById(void);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -66,6 +66,7 @@ void C_CamDbOsy::SetActive(const bool oq_Active)
 void C_CamDbOsy::SetData(const stw_opensyde_core::C_OSCComMessageLoggerOsySysDefConfig & orc_Data)
 {
    this->mc_Data = orc_Data;
+   this->m_FillMessageNamesById();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -190,60 +191,13 @@ void C_CamDbOsy::FindAllMessages(void)
 sint32 C_CamDbOsy::FindMessageById(const uint32 ou32_Id, QString & orc_Message) const
 {
    sint32 s32_Retval = C_NOACT;
+   const QMap<uint32, QString>::const_iterator c_It = this->mc_MessageNamesById.find(ou32_Id);
 
-   std::vector<uint32> c_NodeIndexes;
-   std::vector<uint32> c_InterfaceIndexes;
-
-   this->mc_Data.c_OsySysDef.GetNodeIndexesOfBus(this->mc_Data.u32_BusIndex, c_NodeIndexes, c_InterfaceIndexes);
-   if (c_NodeIndexes.size() == c_InterfaceIndexes.size())
+   if (c_It != this->mc_MessageNamesById.end())
    {
-      //All found nodes & interfaces
-      for (uint32 u32_ItFoundItem = 0UL; (u32_ItFoundItem < c_NodeIndexes.size()) && (s32_Retval == C_NOACT);
-           ++u32_ItFoundItem)
-      {
-         if (c_NodeIndexes[u32_ItFoundItem] < this->mc_Data.c_OsySysDef.c_Nodes.size())
-         {
-            //Found node
-            const C_OSCNode & rc_Node = this->mc_Data.c_OsySysDef.c_Nodes[c_NodeIndexes[u32_ItFoundItem]];
-            //All protocols
-            for (uint8 u8_ItProt = 0U; (u8_ItProt < rc_Node.c_ComProtocols.size()) && (s32_Retval == C_NOACT);
-                 ++u8_ItProt)
-            {
-               const C_OSCCanProtocol & rc_Protocol = rc_Node.c_ComProtocols[u8_ItProt];
-               if (c_InterfaceIndexes[u32_ItFoundItem] < rc_Protocol.c_ComMessages.size())
-               {
-                  //Found container
-                  const C_OSCCanMessageContainer & rc_Container =
-                     rc_Protocol.c_ComMessages[c_InterfaceIndexes[u32_ItFoundItem]];
-                  //Each Rx message
-                  for (uint32 u32_ItMsg =
-                          0UL; (u32_ItMsg < rc_Container.c_RxMessages.size()) && (s32_Retval == C_NOACT);
-                       ++u32_ItMsg)
-                  {
-                     const C_OSCCanMessage & rc_Message = rc_Container.c_RxMessages[u32_ItMsg];
-                     if (rc_Message.u32_CanId == ou32_Id)
-                     {
-                        //Found match
-                        orc_Message = rc_Message.c_Name.c_str();
-                        s32_Retval = C_NO_ERR;
-                     }
-                  }
-                  //Each Tx message
-                  for (uint32 u32_ItMsg = 0UL;
-                       (u32_ItMsg < rc_Container.c_TxMessages.size()) && (s32_Retval == C_NOACT); ++u32_ItMsg)
-                  {
-                     const C_OSCCanMessage & rc_Message = rc_Container.c_TxMessages[u32_ItMsg];
-                     if (rc_Message.u32_CanId == ou32_Id)
-                     {
-                        //Found match
-                        orc_Message = rc_Message.c_Name.c_str();
-                        s32_Retval = C_NO_ERR;
-                     }
-                  }
-               }
-            }
-         }
-      }
+      //Found match
+      orc_Message = c_It.value();
+      s32_Retval = C_NO_ERR;
    }
    return s32_Retval;
 }
@@ -268,6 +222,11 @@ sint32 C_CamDbOsy::FindMessage(const QString & orc_Message)
    {
       s32_Retval = C_NO_ERR;
    }
+   else if (this->mq_FoundAll == true)
+   {
+      //All messages are known already, no need to search again
+      s32_Retval = C_NOACT;
+   }
    else
    {
       std::vector<uint32> c_NodeIndexes;
@@ -502,6 +461,18 @@ const stw_opensyde_core::C_OSCNodeDataPoolList * C_CamDbOsy::GetOSCList(const QS
    return pc_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get names of all messages by CAN ID
+
+   \return
+   First message name for each CAN ID
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const QMap<uint32, QString> & C_CamDbOsy::GetMessageNamesById(void) const
+{
+   return this->mc_MessageNamesById;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Replace the bus index
 
@@ -528,6 +499,7 @@ bool C_CamDbOsy::ReplaceOsyBusIndex(const uint32 ou32_BusIndex)
       this->mq_FoundAll = false;
       this->mc_FoundMessagesId.clear();
       this->mc_FoundMessagesListId.clear();
+      this->m_FillMessageNamesById();
       //Signal change
       q_Retval = true;
    }
@@ -558,3 +530,62 @@ bool C_CamDbOsy::CheckHashForMessage(const QString & orc_Message, const uint32 o
    }
    return q_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Store the first message name for each CAN ID of all messages on the current bus
+
+   Search order: for each node on the bus and each of its protocols the Rx messages, then the Tx messages
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_CamDbOsy::m_FillMessageNamesById(void)
+{
+   std::vector<uint32> c_NodeIndexes;
+   std::vector<uint32> c_InterfaceIndexes;
+
+   this->mc_MessageNamesById.clear();
+
+   this->mc_Data.c_OsySysDef.GetNodeIndexesOfBus(this->mc_Data.u32_BusIndex, c_NodeIndexes, c_InterfaceIndexes);
+   if (c_NodeIndexes.size() == c_InterfaceIndexes.size())
+   {
+      //All found nodes & interfaces
+      for (uint32 u32_ItFoundItem = 0UL; u32_ItFoundItem < c_NodeIndexes.size(); ++u32_ItFoundItem)
+      {
+         if (c_NodeIndexes[u32_ItFoundItem] < this->mc_Data.c_OsySysDef.c_Nodes.size())
+         {
+            //Found node
+            const C_OSCNode & rc_Node = this->mc_Data.c_OsySysDef.c_Nodes[c_NodeIndexes[u32_ItFoundItem]];
+            //All protocols
+            for (uint8 u8_ItProt = 0U; u8_ItProt < rc_Node.c_ComProtocols.size(); ++u8_ItProt)
+            {
+               const C_OSCCanProtocol & rc_Protocol = rc_Node.c_ComProtocols[u8_ItProt];
+               if (c_InterfaceIndexes[u32_ItFoundItem] < rc_Protocol.c_ComMessages.size())
+               {
+                  //Found container
+                  const C_OSCCanMessageContainer & rc_Container =
+                     rc_Protocol.c_ComMessages[c_InterfaceIndexes[u32_ItFoundItem]];
+                  //Each Rx message
+                  for (uint32 u32_ItMsg = 0UL; u32_ItMsg < rc_Container.c_RxMessages.size(); ++u32_ItMsg)
+                  {
+                     const C_OSCCanMessage & rc_Message = rc_Container.c_RxMessages[u32_ItMsg];
+                     //Use first occurance
+                     if (!this->mc_MessageNamesById.contains(rc_Message.u32_CanId))
+                     {
+                        this->mc_MessageNamesById.insert(rc_Message.u32_CanId, rc_Message.c_Name.c_str());
+                     }
+                  }
+                  //Each Tx message
+                  for (uint32 u32_ItMsg = 0UL; u32_ItMsg < rc_Container.c_TxMessages.size(); ++u32_ItMsg)
+                  {
+                     const C_OSCCanMessage & rc_Message = rc_Container.c_TxMessages[u32_ItMsg];
+                     //Use first occurance
+                     if (!this->mc_MessageNamesById.contains(rc_Message.u32_CanId))
+                     {
+                        this->mc_MessageNamesById.insert(rc_Message.u32_CanId, rc_Message.c_Name.c_str());
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
@@ -40,6 +40,7 @@ public:
 
    bool GetActive(void) const;
    const QMap<QString, C_CamDbOsyMessageId> & GetFoundMessages(void) const;
+   const QMap<stw_types::uint32, QString> & GetMessageNamesById(void) const;
    const stw_opensyde_core::C_OSCCanMessage * GetOSCMessage(const QString & orc_Message, const bool oq_UseHash,
                                                             const stw_types::uint32 ou32_Hash) const;
    const stw_opensyde_core::C_OSCNodeDataPoolList * GetOSCList(const QString & orc_Message, const bool oq_UseHash,
@@ -54,6 +55,9 @@ private:
    stw_opensyde_core::C_OSCComMessageLoggerOsySysDefConfig mc_Data;
    QMap<QString, C_CamDbOsyListId> mc_FoundMessagesListId;
    QMap<QString, C_CamDbOsyMessageId> mc_FoundMessagesId;
+   QMap<stw_types::uint32, QString> mc_MessageNamesById;
+
+   void m_FillMessageNamesById(void);
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
@@ -265,22 +265,24 @@ void C_GiSvDaParam::EditModeActiveChanged(const bool oq_Active)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_GiSvDaParam::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC)
+void C_GiSvDaParam::HandleManualOperationFinished(const C_OSCNodeDataPoolListElementId & orc_Id,
+                                                  const sint32 os32_Result, const uint8 ou8_NRC)
 {
    bool q_WidgetRelevant = false;
 
    if (this->mpc_ParamWidget != NULL)
    {
-      q_WidgetRelevant = this->mpc_ParamWidget->HandleManualOperationFinished(os32_Result, ou8_NRC);
+      q_WidgetRelevant = this->mpc_ParamWidget->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
    }
 
    if (q_WidgetRelevant == false)
    {
-      C_GiSvDaRectBaseGroup::HandleManualOperationFinished(os32_Result, ou8_NRC);
+      C_GiSvDaRectBaseGroup::HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
    }
 }
 
@@ -48,7 +48,8 @@ public:
    virtual void UpdateShowValue(void) override;
    virtual void ConnectionActiveChanged(const bool oq_Active) override;
    virtual void EditModeActiveChanged(const bool oq_Active) override;
-   virtual void HandleManualOperationFinished(const stw_types::sint32 os32_Result,
+   virtual void HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                              const stw_types::sint32 os32_Result,
                                               const stw_types::uint8 ou8_NRC) override;
    virtual void SetErrorForFailedCyclicElementIdRegistrations(
       const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_FailedIdRegisters,
@@ -638,13 +638,15 @@ bool C_GiSvDaRectBaseGroup::CallProperties(void)
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in] orc_Id      Service the result belongs to
    \param[in] os32_Result Operation result
    \param[in] ou8_NRC     Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_GiSvDaRectBaseGroup::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC)
+void C_GiSvDaRectBaseGroup::HandleManualOperationFinished(const C_OSCNodeDataPoolListElementId & orc_Id,
+                                                          const sint32 os32_Result, const uint8 ou8_NRC)
 {
-   if (this->mu32_NextManualActionIndex > 0)
+   if ((this->mu32_NextManualActionIndex > 0) && (this->m_IsPendingManualOperation(orc_Id) == true))
    {
       QGraphicsView * const pc_View = this->scene()->views().at(0);
       C_OgeWiCustomMessage c_Message(pc_View, C_OgeWiCustomMessage::E_Type::eERROR);
@@ -1958,6 +1960,40 @@ void C_GiSvDaRectBaseGroup::m_InitButton(void)
    this->mpc_ButtonGroup->setVisible(false);
 }  //lint !e429  //no memory leak because of adding pc_RectItem to the group and the Qt memory management
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Check if a finished service is the one started by the current manual operation
+
+   Services of nodes on different routes are executed in parallel, so a finished service may belong to any widget.
+
+   \param[in]  orc_Id   Service the result belongs to
+
+   \retval   true   Service belongs to the current manual operation of this item
+   \retval   false  Service belongs to another item or no manual operation is active
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_GiSvDaRectBaseGroup::m_IsPendingManualOperation(const C_OSCNodeDataPoolListElementId & orc_Id) const
+{
+   bool q_Retval = false;
+
+   if (this->mu32_NextManualActionIndex > 0UL)
+   {
+      C_PuiSvDbNodeDataPoolListElementId c_ElementId;
+      if (this->GetDataPoolElementIndex(this->mu32_NextManualActionIndex - 1UL, c_ElementId) == C_NO_ERR)
+      {
+         q_Retval = (((c_ElementId.u32_NodeIndex == orc_Id.u32_NodeIndex) &&
+                      (c_ElementId.u32_DataPoolIndex == orc_Id.u32_DataPoolIndex)) &&
+                     (c_ElementId.u32_ListIndex == orc_Id.u32_ListIndex)) &&
+                    (c_ElementId.u32_ElementIndex == orc_Id.u32_ElementIndex);
+      }
+      else
+      {
+         //Let the result handling report the invalid element
+         q_Retval = true;
+      }
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Trigger next manual read operation
 */
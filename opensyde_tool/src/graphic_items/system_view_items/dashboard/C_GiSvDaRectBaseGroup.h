@@ -69,7 +69,8 @@ public:
    virtual void EditModeActiveChanged(const bool oq_Active);
    virtual void SendCurrentValue(void);
    virtual bool CallProperties(void);
-   virtual void HandleManualOperationFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
+   virtual void HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                              const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
    virtual void SetErrorForFailedCyclicElementIdRegistrations(
       const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_FailedIdRegisters,
       const std::vector<QString> & orc_FailedIdErrorDetails);
@@ -179,6 +180,7 @@ private:
    void m_InitConflictIcon(void);
    void m_InitButton(void);
    void m_ManualRead(void);
+   bool m_IsPendingManualOperation(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id) const;
    bool m_IsOnTrigger(const stw_opensyde_gui_logic::C_PuiSvDbNodeDataPoolListElementId & orc_Id) const;
    void m_HandleGenericButtonClick(void);
    void m_UpdateErrorIconToolTip(void);
@@ -66,6 +66,8 @@ sintn main(sintn osn_Argc, charn * oapcn_Argv[])
       stw_opensyde_core::C_OSCLoggingHandler::h_SetWriteToConsoleActive(false);
       stw_opensyde_core::C_OSCLoggingHandler::h_SetWriteToFileActive(true);
       stw_opensyde_core::C_OSCLoggingHandler::h_SetCompleteLogFileLocation(c_FilePath.toStdString().c_str());
+      //Do not slow down communication by writing its log entries
+      stw_opensyde_core::C_OSCLoggingHandler::h_SetAsyncWriteActive(true);
 
       osc_write_log_info("Startup", static_cast<QString>("Starting openSYDE Version: " +
                                             stw_opensyde_gui_logic::C_Uti::h_GetApplicationVersion() +
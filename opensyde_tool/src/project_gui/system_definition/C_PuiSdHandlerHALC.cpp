@@ -19,6 +19,7 @@
 #include "C_OSCHALCMagicianUtil.h"
 #include "C_OSCHALCMagicianGenerator.h"
 #include "C_OSCHALCMagicianDatapoolListHandler.h"
+#include "C_OSCLoggingHandler.h"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
 using namespace stw_tgl;
@@ -489,6 +490,8 @@ sint32 C_PuiSdHandlerHALC::SetHALCConfig(const uint32 ou32_NodeIndex, const C_OS
    {
       C_OSCNode & rc_Node = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
       rc_Node.c_HALCConfig = orc_Config;
+      //tracked changes of the new configuration do not relate to the existing HAL Datapools
+      rc_Node.c_HALCConfig.SetDatapoolStructureChanged();
    }
    else
    {
@@ -1617,6 +1620,9 @@ sint32 C_PuiSdHandlerHALC::GetHALCRelevantIndicesForSelectedUseCase(const uint32
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  HALC generate datapools
 
+   If only values of the HALC configuration changed, the existing HAL Datapools are updated in place.
+   Otherwise the HAL Datapools are regenerated.
+
    \param[in]  ou32_NodeIndex    Node index
 
    \return
@@ -1632,121 +1638,15 @@ sint32 C_PuiSdHandlerHALC::HALCGenerateDatapools(const uint32 ou32_NodeIndex)
    if ((ou32_NodeIndex < this->mc_CoreDefinition.c_Nodes.size()) &&
        (ou32_NodeIndex < this->mc_UINodes.size()))
    {
-      C_OSCNode & rc_OSCNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
-      uint32 u32_DatapoolCounter;
-
-      stw_types::uint8 au8_SafeVersion[3] = {0};
-      stw_scl::C_SCLString c_SafeComment;
-      bool q_SafeScopeIsPrivate = true;
-      stw_types::sint32 s32_SafeDatablockIndex = -1;
-      bool q_SafeFound = false;
-
-      stw_types::uint8 au8_NonsafeVersion[3] = {0};
-      stw_scl::C_SCLString c_NonsafeComment;
-      bool q_NonsafeScopeIsPrivate = true;
-      stw_types::sint32 s32_NonsafeDatablockIndex = -1;
-      bool q_NonsafeFound = false;
-
-      // In case of existing HAL Datapools, safe Datapool specific properties
-      for (u32_DatapoolCounter = 0U; u32_DatapoolCounter < rc_OSCNode.c_DataPools.size(); ++u32_DatapoolCounter)
+      s32_Retval = this->m_UpdateHALCDatapools(ou32_NodeIndex);
+      if (s32_Retval != C_NO_ERR)
       {
-         const C_OSCNodeDataPool & rc_Datapool = rc_OSCNode.c_DataPools[u32_DatapoolCounter];
-         if (rc_Datapool.e_Type == C_OSCNodeDataPool::eHALC)
-         {
-            if (rc_Datapool.q_IsSafety == true)
-            {
-               memcpy(au8_SafeVersion, rc_Datapool.au8_Version, sizeof(au8_SafeVersion));
-               c_SafeComment = rc_Datapool.c_Comment;
-               q_SafeScopeIsPrivate = rc_Datapool.q_ScopeIsPrivate;
-               s32_SafeDatablockIndex = rc_Datapool.s32_RelatedDataBlockIndex;
-               q_SafeFound = true;
-            }
-            else
-            {
-               memcpy(au8_NonsafeVersion, rc_Datapool.au8_Version, sizeof(au8_NonsafeVersion));
-               c_NonsafeComment = rc_Datapool.c_Comment;
-               q_NonsafeScopeIsPrivate = rc_Datapool.q_ScopeIsPrivate;
-               s32_NonsafeDatablockIndex = rc_Datapool.s32_RelatedDataBlockIndex;
-               q_NonsafeFound = true;
-            }
-         }
-
-         if ((q_SafeFound == true) && (q_NonsafeFound == true))
-         {
-            break;
-         }
+         s32_Retval = this->m_RegenerateHALCDatapools(ou32_NodeIndex);
       }
-
-      //Clean up existing datapools
-      s32_Retval = this->HALCRemoveDatapools(ou32_NodeIndex, true);
-
       if (s32_Retval == C_NO_ERR)
       {
-         //Check if new datapools should be generated
-         if (rc_OSCNode.c_HALCConfig.c_FileString.IsEmpty() == false)
-         {
-            std::vector<C_OSCNodeDataPool> c_Datapools;
-            C_OSCHALCMagicianGenerator c_Magician(&rc_OSCNode);
-            s32_Retval = c_Magician.GenerateHALCDatapools(c_Datapools);
-            if (s32_Retval == C_NO_ERR)
-            {
-               C_PuiSdNode & rc_UiNode = this->mc_UINodes[ou32_NodeIndex];
-               tgl_assert(rc_OSCNode.c_DataPools.size() == rc_UiNode.c_UIDataPools.size());
-               if (rc_OSCNode.c_DataPools.size() == rc_UiNode.c_UIDataPools.size())
-               {
-                  std::vector<C_PuiSdNodeDataPool> c_UiDatapools;
-
-                  //Get ui datapools
-                  for (uint32 u32_It = 0UL; u32_It < c_Datapools.size(); ++u32_It)
-                  {
-                     const C_PuiSdNodeDataPool c_Tmp =
-                        C_PuiSdHandlerHALC::mh_GetUiDatapoolForOSCDataPool(c_Datapools[u32_It]);
-                     c_UiDatapools.push_back(c_Tmp);
-                  }
-                  //Add new datapools
-                  tgl_assert(c_Datapools.size() == c_UiDatapools.size());
-                  for (uint32 u32_It = 0UL; u32_It < c_Datapools.size(); ++u32_It)
-                  {
-                     C_OSCNodeDataPool & rc_Datapool = c_Datapools[u32_It];
-                     if (rc_Datapool.e_Type == C_OSCNodeDataPool::eHALC)
-                     {
-                        // Apply the saved Datapool properties
-                        if ((q_NonsafeFound == true) &&
-                            (rc_Datapool.q_IsSafety == false))
-                        {
-                           memcpy(rc_Datapool.au8_Version, au8_NonsafeVersion, sizeof(au8_NonsafeVersion));
-                           rc_Datapool.c_Comment = c_NonsafeComment;
-                           rc_Datapool.q_ScopeIsPrivate = q_NonsafeScopeIsPrivate;
-                           rc_Datapool.s32_RelatedDataBlockIndex = s32_NonsafeDatablockIndex;
-                        }
-                        else if ((q_SafeFound == true) &&
-                                 (rc_Datapool.q_IsSafety == true))
-                        {
-                           memcpy(rc_Datapool.au8_Version, au8_SafeVersion, sizeof(au8_SafeVersion));
-                           rc_Datapool.c_Comment = c_SafeComment;
-                           rc_Datapool.q_ScopeIsPrivate = q_SafeScopeIsPrivate;
-                           rc_Datapool.s32_RelatedDataBlockIndex = s32_SafeDatablockIndex;
-                        }
-                        else
-                        {
-                           // Nothing to do
-                        }
-                     }
-
-                     rc_OSCNode.c_DataPools.push_back(c_Datapools[u32_It]);
-                     rc_UiNode.c_UIDataPools.push_back(c_UiDatapools[u32_It]);
-                  }
-               }
-               else
-               {
-                  s32_Retval = C_RANGE;
-               }
-            }
-         }
+         this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex].c_HALCConfig.ResetDatapoolChanges();
       }
-
-      //Trigger sync
-      Q_EMIT (this->SigSyncNodeHALC(ou32_NodeIndex));
    }
    else
    {
@@ -1852,6 +1752,251 @@ bool C_PuiSdHandlerHALC::CheckHALCChannelNameAvailable(const uint32 ou32_NodeInd
    return q_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Apply changed values of HALC configuration to existing HAL Datapools
+
+   The lists of the existing HAL Datapools are handed to the HALC magician without copying.
+   Debug builds additionally generate the HAL Datapools completely and compare the result. If it differs, the update
+   is reported as not possible, so the caller regenerates the HAL Datapools.
+
+   \param[in]  ou32_NodeIndex    Node index (valid)
+
+   \return
+   C_NO_ERR Datapools updated
+   C_NOACT  HAL Datapools need to be regenerated (structure changed or no HAL Datapools)
+   C_CONFIG Configuration invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_PuiSdHandlerHALC::m_UpdateHALCDatapools(const uint32 ou32_NodeIndex)
+{
+   sint32 s32_Retval = C_NOACT;
+   C_OSCNode & rc_OSCNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+
+   if ((rc_OSCNode.c_HALCConfig.c_FileString.IsEmpty() == false) &&
+       (rc_OSCNode.c_HALCConfig.IsDatapoolStructureChanged() == false))
+   {
+      C_OSCNodeDataPool * pc_NonsafeDatapool = NULL;
+      C_OSCNodeDataPool * pc_SafeDatapool = NULL;
+
+      for (uint32 u32_ItDatapool = 0UL; u32_ItDatapool < rc_OSCNode.c_DataPools.size(); ++u32_ItDatapool)
+      {
+         C_OSCNodeDataPool & rc_Datapool = rc_OSCNode.c_DataPools[u32_ItDatapool];
+         if (rc_Datapool.e_Type == C_OSCNodeDataPool::eHALC)
+         {
+            if (rc_Datapool.q_IsSafety == true)
+            {
+               pc_SafeDatapool = &rc_Datapool;
+            }
+            else
+            {
+               pc_NonsafeDatapool = &rc_Datapool;
+            }
+         }
+      }
+
+      if ((pc_NonsafeDatapool != NULL) && (pc_SafeDatapool != NULL))
+      {
+         const C_OSCHALCMagicianGenerator c_Magician(&rc_OSCNode);
+         std::vector<C_OSCNodeDataPool> c_Datapools;
+         c_Datapools.resize(2UL);
+         c_Datapools[0UL].e_Type = C_OSCNodeDataPool::eHALC;
+         c_Datapools[0UL].q_IsSafety = false;
+         c_Datapools[1UL].e_Type = C_OSCNodeDataPool::eHALC;
+         c_Datapools[1UL].q_IsSafety = true;
+         //Hand over lists and take them back afterwards
+         c_Datapools[0UL].c_Lists.swap(pc_NonsafeDatapool->c_Lists);
+         c_Datapools[1UL].c_Lists.swap(pc_SafeDatapool->c_Lists);
+         s32_Retval = c_Magician.UpdateHALCDatapools(c_Datapools);
+#ifndef QT_NO_DEBUG
+         if (s32_Retval == C_NO_ERR)
+         {
+            std::vector<C_OSCNodeDataPool> c_Generated;
+            if ((c_Magician.GenerateHALCDatapools(c_Generated) == C_NO_ERR) &&
+                (C_PuiSdHandlerHALC::mh_CheckHALCDatapoolListsEqual(c_Datapools, c_Generated) == false))
+            {
+               osc_write_log_warning("HALC datapool generation",
+                                     "Update of HAL Datapools differs from complete generation.");
+               tgl_assert(false);
+               s32_Retval = C_NOACT;
+            }
+         }
+#endif
+         c_Datapools[0UL].c_Lists.swap(pc_NonsafeDatapool->c_Lists);
+         c_Datapools[1UL].c_Lists.swap(pc_SafeDatapool->c_Lists);
+      }
+   }
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Regenerate HAL Datapools
+
+   Remove existing HAL Datapools and generate new ones. Datapool properties of existing HAL Datapools are kept.
+
+   \param[in]  ou32_NodeIndex    Node index (valid)
+
+   \return
+   C_NO_ERR Datapool generated
+   C_CONFIG Configuration invalid
+   C_RANGE  Parameter invalid
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_PuiSdHandlerHALC::m_RegenerateHALCDatapools(const uint32 ou32_NodeIndex)
+{
+   sint32 s32_Retval;
+   C_OSCNode & rc_OSCNode = this->mc_CoreDefinition.c_Nodes[ou32_NodeIndex];
+   uint32 u32_DatapoolCounter;
+
+   stw_types::uint8 au8_SafeVersion[3] = {0};
+   stw_scl::C_SCLString c_SafeComment;
+   bool q_SafeScopeIsPrivate = true;
+   stw_types::sint32 s32_SafeDatablockIndex = -1;
+   bool q_SafeFound = false;
+
+   stw_types::uint8 au8_NonsafeVersion[3] = {0};
+   stw_scl::C_SCLString c_NonsafeComment;
+   bool q_NonsafeScopeIsPrivate = true;
+   stw_types::sint32 s32_NonsafeDatablockIndex = -1;
+   bool q_NonsafeFound = false;
+
+   // In case of existing HAL Datapools, safe Datapool specific properties
+   for (u32_DatapoolCounter = 0U; u32_DatapoolCounter < rc_OSCNode.c_DataPools.size(); ++u32_DatapoolCounter)
+   {
+      const C_OSCNodeDataPool & rc_Datapool = rc_OSCNode.c_DataPools[u32_DatapoolCounter];
+      if (rc_Datapool.e_Type == C_OSCNodeDataPool::eHALC)
+      {
+         if (rc_Datapool.q_IsSafety == true)
+         {
+            memcpy(au8_SafeVersion, rc_Datapool.au8_Version, sizeof(au8_SafeVersion));
+            c_SafeComment = rc_Datapool.c_Comment;
+            q_SafeScopeIsPrivate = rc_Datapool.q_ScopeIsPrivate;
+            s32_SafeDatablockIndex = rc_Datapool.s32_RelatedDataBlockIndex;
+            q_SafeFound = true;
+         }
+         else
+         {
+            memcpy(au8_NonsafeVersion, rc_Datapool.au8_Version, sizeof(au8_NonsafeVersion));
+            c_NonsafeComment = rc_Datapool.c_Comment;
+            q_NonsafeScopeIsPrivate = rc_Datapool.q_ScopeIsPrivate;
+            s32_NonsafeDatablockIndex = rc_Datapool.s32_RelatedDataBlockIndex;
+            q_NonsafeFound = true;
+         }
+      }
+
+      if ((q_SafeFound == true) && (q_NonsafeFound == true))
+      {
+         break;
+      }
+   }
+
+   //Clean up existing datapools
+   s32_Retval = this->HALCRemoveDatapools(ou32_NodeIndex, true);
+
+   if (s32_Retval == C_NO_ERR)
+   {
+      //Check if new datapools should be generated
+      if (rc_OSCNode.c_HALCConfig.c_FileString.IsEmpty() == false)
+      {
+         std::vector<C_OSCNodeDataPool> c_Datapools;
+         C_OSCHALCMagicianGenerator c_Magician(&rc_OSCNode);
+         s32_Retval = c_Magician.GenerateHALCDatapools(c_Datapools);
+         if (s32_Retval == C_NO_ERR)
+         {
+            C_PuiSdNode & rc_UiNode = this->mc_UINodes[ou32_NodeIndex];
+            tgl_assert(rc_OSCNode.c_DataPools.size() == rc_UiNode.c_UIDataPools.size());
+            if (rc_OSCNode.c_DataPools.size() == rc_UiNode.c_UIDataPools.size())
+            {
+               std::vector<C_PuiSdNodeDataPool> c_UiDatapools;
+
+               //Get ui datapools
+               for (uint32 u32_It = 0UL; u32_It < c_Datapools.size(); ++u32_It)
+               {
+                  const C_PuiSdNodeDataPool c_Tmp =
+                     C_PuiSdHandlerHALC::mh_GetUiDatapoolForOSCDataPool(c_Datapools[u32_It]);
+                  c_UiDatapools.push_back(c_Tmp);
+               }
+               //Add new datapools
+               tgl_assert(c_Datapools.size() == c_UiDatapools.size());
+               for (uint32 u32_It = 0UL; u32_It < c_Datapools.size(); ++u32_It)
+               {
+                  C_OSCNodeDataPool & rc_Datapool = c_Datapools[u32_It];
+                  if (rc_Datapool.e_Type == C_OSCNodeDataPool::eHALC)
+                  {
+                     // Apply the saved Datapool properties
+                     if ((q_NonsafeFound == true) &&
+                         (rc_Datapool.q_IsSafety == false))
+                     {
+                        memcpy(rc_Datapool.au8_Version, au8_NonsafeVersion, sizeof(au8_NonsafeVersion));
+                        rc_Datapool.c_Comment = c_NonsafeComment;
+                        rc_Datapool.q_ScopeIsPrivate = q_NonsafeScopeIsPrivate;
+                        rc_Datapool.s32_RelatedDataBlockIndex = s32_NonsafeDatablockIndex;
+                     }
+                     else if ((q_SafeFound == true) &&
+                              (rc_Datapool.q_IsSafety == true))
+                     {
+                        memcpy(rc_Datapool.au8_Version, au8_SafeVersion, sizeof(au8_SafeVersion));
+                        rc_Datapool.c_Comment = c_SafeComment;
+                        rc_Datapool.q_ScopeIsPrivate = q_SafeScopeIsPrivate;
+                        rc_Datapool.s32_RelatedDataBlockIndex = s32_SafeDatablockIndex;
+                     }
+                     else
+                     {
+                        // Nothing to do
+                     }
+                  }
+
+                  rc_OSCNode.c_DataPools.push_back(c_Datapools[u32_It]);
+                  rc_UiNode.c_UIDataPools.push_back(c_UiDatapools[u32_It]);
+               }
+            }
+            else
+            {
+               s32_Retval = C_RANGE;
+            }
+         }
+      }
+   }
+
+   //Trigger sync
+   Q_EMIT (this->SigSyncNodeHALC(ou32_NodeIndex));
+
+   return s32_Retval;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief  Check if updated HAL Datapool lists are the same as completely generated ones
+
+   \param[in]  orc_Updated     HAL Datapools updated by C_OSCHALCMagicianGenerator::UpdateHALCDatapools
+   \param[in]  orc_Generated   HAL Datapools generated by C_OSCHALCMagicianGenerator::GenerateHALCDatapools
+
+   \retval   true    All lists are equal
+   \retval   false   Lists differ
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_PuiSdHandlerHALC::mh_CheckHALCDatapoolListsEqual(const std::vector<C_OSCNodeDataPool> & orc_Updated,
+                                                        const std::vector<C_OSCNodeDataPool> & orc_Generated)
+{
+   bool q_Retval = (orc_Updated.size() == orc_Generated.size());
+
+   for (uint32 u32_ItDatapool = 0UL; (u32_ItDatapool < orc_Updated.size()) && (q_Retval == true); ++u32_ItDatapool)
+   {
+      const std::vector<C_OSCNodeDataPoolList> & rc_UpdatedLists = orc_Updated[u32_ItDatapool].c_Lists;
+      const std::vector<C_OSCNodeDataPoolList> & rc_GeneratedLists = orc_Generated[u32_ItDatapool].c_Lists;
+
+      q_Retval = (rc_UpdatedLists.size() == rc_GeneratedLists.size());
+      for (uint32 u32_ItList = 0UL; (u32_ItList < rc_UpdatedLists.size()) && (q_Retval == true); ++u32_ItList)
+      {
+         uint32 u32_HashUpdated = 0xFFFFFFFFUL;
+         uint32 u32_HashGenerated = 0xFFFFFFFFUL;
+         rc_UpdatedLists[u32_ItList].CalcHash(u32_HashUpdated);
+         rc_GeneratedLists[u32_ItList].CalcHash(u32_HashGenerated);
+         q_Retval = (u32_HashUpdated == u32_HashGenerated);
+      }
+   }
+   return q_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief  Get ui datapool for OSC data pool
 
@@ -185,8 +185,13 @@ public:
                                       const stw_types::uint32 * const opu32_ChannelIndexToSkip = NULL) const;
 
 private:
+   stw_types::sint32 m_UpdateHALCDatapools(const stw_types::uint32 ou32_NodeIndex);
+   stw_types::sint32 m_RegenerateHALCDatapools(const stw_types::uint32 ou32_NodeIndex);
+
    static C_PuiSdNodeDataPool mh_GetUiDatapoolForOSCDataPool(
       const stw_opensyde_core::C_OSCNodeDataPool & orc_OSCDatapool);
+   static bool mh_CheckHALCDatapoolListsEqual(const std::vector<stw_opensyde_core::C_OSCNodeDataPool> & orc_Updated,
+                                              const std::vector<stw_opensyde_core::C_OSCNodeDataPool> & orc_Generated);
 
    static stw_types::sint32 mh_GetIndexInVector(const std::vector<stw_opensyde_core::C_OSCHalcDefStruct> & orc_Structs,
                                                 const stw_types::uint32 ou32_StartingIndex,
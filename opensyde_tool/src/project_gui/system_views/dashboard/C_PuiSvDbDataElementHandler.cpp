@@ -64,9 +64,10 @@ C_PuiSvDbDataElementHandler::C_PuiSvDbDataElementHandler(const uint32 & oru32_Vi
    C_PuiSvDbDataElement(oru32_ViewIndex, oru32_DashboardIndex, ors32_DataIndex, ore_Type),
    mq_ReadItem(oq_ReadItem),
    mu32_WidgetDataPoolElementCountMaximum(ou32_MaximumDataElements),
-   mu32_WidgetDataPoolElementCount(0U)
+   mu32_WidgetDataPoolElementCount(0U),
+   mu32_RegistrationVersion(1U)
 {
-   this->mc_VecDataValues.resize(this->mu32_WidgetDataPoolElementCount);
+   this->mc_ValueQueues.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_VecNvmValue.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_VecNvmValueReceived.resize(this->mu32_WidgetDataPoolElementCount);
 }
@@ -100,10 +101,11 @@ sint32 C_PuiSvDbDataElementHandler::RegisterDataPoolElement(
       if (c_ItItem == this->mc_MappingDpElementToDataSerie.end())
       {
          this->mc_CriticalSection.Acquire();
-         // Use the current count of maps as index. It will be used as index for the vector mc_VecDataValues
+         // Use the current count of maps as index. It will be used as index for the vector mc_ValueQueues
          this->mc_MappingDpElementToDataSerie.insert(
             orc_WidgetDataPoolElementId,
             static_cast<uint32>(this->mc_MappingDpElementToDataSerie.size()));
+         ++this->mu32_RegistrationVersion;
 
          this->mc_MappingDpElementToScaling.insert(orc_WidgetDataPoolElementId, orc_DataPoolElementScaling);
 
@@ -164,6 +166,7 @@ void C_PuiSvDbDataElementHandler::RemoveDataPoolElement(
       const uint32 u32_ValueOfDeletedItem = c_ItItemDataSerie.value();
 
       this->mc_MappingDpElementToDataSerie.erase(c_ItItemDataSerie);
+      ++this->mu32_RegistrationVersion;
 
       // Update the counter
       this->m_SetWidgetDataPoolElementCount(this->mc_MappingDpElementToDataSerie.size());
@@ -210,6 +213,7 @@ void C_PuiSvDbDataElementHandler::ClearDataPoolElements(void)
 {
    this->mc_CriticalSection.Acquire();
    this->mc_MappingDpElementToDataSerie.clear();
+   ++this->mu32_RegistrationVersion;
    this->m_SetWidgetDataPoolElementCount(this->mc_MappingDpElementToDataSerie.size());
    this->mc_CriticalSection.Release();
 
@@ -386,36 +390,40 @@ bool C_PuiSvDbDataElementHandler::IsDataElementRegistered(
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Inserts a new received value to the widget queue
 
+   The matching data elements of the widget are stored in the handle, so they only need to be searched again
+   if the registered data elements have changed.
+   The queues reuse their memory, so no memory is allocated for a new value once the queues are warmed up.
+
    This function is thread safe.
 
-   \param[in]  orc_WidgetDataPoolElementId   Datapool element identificator
-   \param[in]  orc_NewValue                  New received value
+   \param[in,out]  orc_Handle       Data element of the new value and its resolved widget data elements
+   \param[in]      orc_NewValue     New received value
+   \param[in]      ou32_TimeStamp   Time stamp of new value in ms
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_PuiSvDbDataElementHandler::InsertNewValueIntoQueue(
-   const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
-   const C_PuiSvDbDataElementContent & orc_NewValue)
+void C_PuiSvDbDataElementHandler::InsertNewValueIntoQueue(C_DataElementHandle & orc_Handle,
+                                                          const C_OSCNodeDataPoolContent & orc_NewValue,
+                                                          const uint32 ou32_TimeStamp)
 {
-   QMap<stw_opensyde_gui_logic::C_PuiSvDbNodeDataPoolListElementId, stw_types::uint32>::iterator c_ItItem;
+   this->mc_CriticalSection.Acquire();
 
-   //manual find because match is unreliable
-   for (c_ItItem = this->mc_MappingDpElementToDataSerie.begin(); c_ItItem != this->mc_MappingDpElementToDataSerie.end();
-        ++c_ItItem)
+   if (orc_Handle.u32_RegistrationVersion != this->mu32_RegistrationVersion)
    {
-      // Get the correct data series
-      if (c_ItItem.key().CheckSameDataElement(orc_WidgetDataPoolElementId))
+      this->m_ResolveDataElementHandle(orc_Handle);
+   }
+
+   for (uint32 u32_It = 0U; u32_It < orc_Handle.c_WidgetDataPoolElementIndexes.size(); ++u32_It)
+   {
+      // Add the new value to the correct data series
+      const uint32 u32_DataSerieIndex = orc_Handle.c_WidgetDataPoolElementIndexes[u32_It];
+      if (u32_DataSerieIndex < this->mc_ValueQueues.size())
       {
-         // Add the new value to the correct data series
-         const uint32 u32_DataSerieIndex = c_ItItem.value();
-         if (static_cast<sintn>(u32_DataSerieIndex) < this->mc_VecDataValues.size())
-         {
-            this->mc_CriticalSection.Acquire();
-            this->mc_VecDataValues[u32_DataSerieIndex].push_back(orc_NewValue);
-            this->mc_CriticalSection.Release();
-         }
-         //Don't stop as there might be multiple matches
+         this->mc_ValueQueues[u32_DataSerieIndex].Push(orc_NewValue, orc_Handle.c_ArrayElementIndexes[u32_It],
+                                                       ou32_TimeStamp);
       }
    }
+
+   this->mc_CriticalSection.Release();
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -579,20 +587,18 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
 
    orc_Values.clear();
 
-   if ((static_cast<sintn>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
+   if ((ou32_WidgetDataPoolElementIndex < this->mc_ValueQueues.size()) &&
        ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false)))
    {
       this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      if (this->mc_ValueQueues[ou32_WidgetDataPoolElementIndex].q_LastValueReceived == true)
       {
-         const sintn sn_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
+         C_ValueQueue & rc_Queue = this->mc_ValueQueues[ou32_WidgetDataPoolElementIndex];
          uint32 u32_Counter;
          float64 f64_Temp;
 
          // Get the newest value
-         C_SdNdeDpContentUtil::h_GetValuesAsFloat64(
-            this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][sn_LastIndex],
-            orc_Values);
+         C_SdNdeDpContentUtil::h_GetValuesAsFloat64(rc_Queue.c_LastValue, orc_Values);
 
          // Scale all values
          if (oq_UseScaling == true)
@@ -612,7 +618,7 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsMs.size())
          {
             this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] =
-               this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][sn_LastIndex].GetTimeStamp();
+               rc_Queue.c_LastValue.GetTimeStamp();
          }
          //Set timestamp valid
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsValid.size())
@@ -622,7 +628,7 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
          }
 
          // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+         rc_Queue.Clear();
          s32_Return = C_NO_ERR;
       }
       else
@@ -670,19 +676,18 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
    sint32 s32_Return = C_RANGE;
    C_PuiSvDbNodeDataPoolListElementId c_Id;
 
-   if (((static_cast<sintn>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
+   if (((ou32_WidgetDataPoolElementIndex < this->mc_ValueQueues.size()) &&
         ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false))) && (
           this->GetDataPoolElementIndex(ou32_WidgetDataPoolElementIndex, c_Id) == C_NO_ERR))
    {
       this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      if (this->mc_ValueQueues[ou32_WidgetDataPoolElementIndex].q_LastValueReceived == true)
       {
-         const sintn sn_LastIndex = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() - 1;
+         C_ValueQueue & rc_Queue = this->mc_ValueQueues[ou32_WidgetDataPoolElementIndex];
          float64 f64_Temp;
          const uint32 u32_Index = c_Id.GetArrayElementIndexOrZero();
          // Get the newest value as float
-         C_SdNdeDpContentUtil::h_GetValueAsFloat64(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][
-                                                      sn_LastIndex], f64_Temp, u32_Index);
+         C_SdNdeDpContentUtil::h_GetValueAsFloat64(rc_Queue.c_LastValue, f64_Temp, u32_Index);
          // And calculate the scaling on the value
          if (oq_UseScaling == true)
          {
@@ -700,7 +705,7 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsMs.size())
          {
             this->mc_LastDataPoolElementTimeStampsMs[ou32_WidgetDataPoolElementIndex] =
-               this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex][sn_LastIndex].GetTimeStamp();
+               rc_Queue.c_LastValue.GetTimeStamp();
          }
          //Set timestamp valid
          if (ou32_WidgetDataPoolElementIndex < this->mc_LastDataPoolElementTimeStampsValid.size())
@@ -710,7 +715,7 @@ sint32 C_PuiSvDbDataElementHandler::m_GetLastValue(const uint32 ou32_WidgetDataP
          }
 
          // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+         rc_Queue.Clear();
          s32_Return = C_NO_ERR;
       }
       else
@@ -744,49 +749,40 @@ sint32 C_PuiSvDbDataElementHandler::m_GetAllValues(const uint32 ou32_WidgetDataP
                                                    const bool oq_UseScaling)
 {
    sint32 s32_Return = C_RANGE;
-   C_PuiSvDbNodeDataPoolListElementId c_Id;
 
-   if (((static_cast<sintn>(ou32_WidgetDataPoolElementIndex) < this->mc_VecDataValues.size()) &&
-        ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false))) && (
-          this->GetDataPoolElementIndex(ou32_WidgetDataPoolElementIndex, c_Id) == C_NO_ERR))
+   if ((ou32_WidgetDataPoolElementIndex < this->mc_ValueQueues.size()) &&
+       ((ou32_WidgetDataPoolElementIndex < this->mc_UsedScaling.size()) || (oq_UseScaling == false)))
    {
       this->mc_CriticalSection.Acquire();
-      if (this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size() > 0)
+      if (this->mc_ValueQueues[ou32_WidgetDataPoolElementIndex].u32_SampleCount > 0U)
       {
-         uint32 u32_Counter = 0U;
-         QList<C_PuiSvDbDataElementContent>::const_iterator c_ItItem;
+         C_ValueQueue & rc_Queue = this->mc_ValueQueues[ou32_WidgetDataPoolElementIndex];
 
          // Copy all values and scale the values if necessary
-         orc_Values.resize(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size());
-         orc_Timestamps.resize(this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].size());
-         for (c_ItItem = this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].begin();
-              c_ItItem != this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].end();
-              ++c_ItItem)
+         orc_Values.resize(static_cast<sintn>(rc_Queue.u32_SampleCount));
+         orc_Timestamps.resize(static_cast<sintn>(rc_Queue.u32_SampleCount));
+         for (uint32 u32_Counter = 0U; u32_Counter < rc_Queue.u32_SampleCount; ++u32_Counter)
          {
-            float64 f64_Value;
-            const uint32 u32_Index = c_Id.GetArrayElementIndexOrZero();
+            const C_ValueSample & rc_Sample = rc_Queue.GetSample(u32_Counter);
 
-            // Convert the value to a float64
-            C_SdNdeDpContentUtil::h_GetValueAsFloat64(*c_ItItem, f64_Value, u32_Index);
             // And calculate the scaling on the value
             if (oq_UseScaling == true)
             {
                orc_Values[u32_Counter] = C_OSCUtils::h_GetValueScaled(
-                  f64_Value,
+                  rc_Sample.f64_Value,
                   this->mc_UsedScaling[ou32_WidgetDataPoolElementIndex].f64_Factor,
                   this->mc_UsedScaling[ou32_WidgetDataPoolElementIndex].f64_Offset);
             }
             else
             {
-               orc_Values[u32_Counter] = f64_Value;
+               orc_Values[u32_Counter] = rc_Sample.f64_Value;
             }
             // Copy the timestamp
-            orc_Timestamps[u32_Counter] = (*c_ItItem).GetTimeStamp();
-            ++u32_Counter;
+            orc_Timestamps[u32_Counter] = rc_Sample.u32_TimeStamp;
          }
 
          // Remove all values for the next call
-         this->mc_VecDataValues[ou32_WidgetDataPoolElementIndex].clear();
+         rc_Queue.Clear();
          s32_Return = C_NO_ERR;
 
          //Save last timestamp
@@ -1114,7 +1110,7 @@ const QMap<C_PuiSvDbNodeDataPoolListElementId, uint32> & C_PuiSvDbDataElementHan
 void C_PuiSvDbDataElementHandler::m_SetWidgetDataPoolElementCount(const uint32 ou32_Count)
 {
    this->mu32_WidgetDataPoolElementCount = ou32_Count;
-   this->mc_VecDataValues.resize(this->mu32_WidgetDataPoolElementCount);
+   this->mc_ValueQueues.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_VecNvmValue.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_VecNvmValueReceived.resize(this->mu32_WidgetDataPoolElementCount);
    this->mc_LastDataPoolElementTimeStampsMs.resize(this->mu32_WidgetDataPoolElementCount);
@@ -1125,6 +1121,36 @@ void C_PuiSvDbDataElementHandler::m_SetWidgetDataPoolElementCount(const uint32 o
    this->mc_MinimumType.resize(this->mu32_WidgetDataPoolElementCount);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Search the widget data elements matching the data element of the handle
+
+   Expects the critical section to be acquired.
+
+   \param[in,out]  orc_Handle    Handle to update
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementHandler::m_ResolveDataElementHandle(C_DataElementHandle & orc_Handle) const
+{
+   QMap<C_PuiSvDbNodeDataPoolListElementId, uint32>::const_iterator c_ItItem;
+
+   orc_Handle.c_WidgetDataPoolElementIndexes.clear();
+   orc_Handle.c_ArrayElementIndexes.clear();
+
+   //manual find because match is unreliable
+   for (c_ItItem = this->mc_MappingDpElementToDataSerie.begin(); c_ItItem != this->mc_MappingDpElementToDataSerie.end();
+        ++c_ItItem)
+   {
+      if (c_ItItem.key().CheckSameDataElement(orc_Handle.c_ElementId))
+      {
+         orc_Handle.c_WidgetDataPoolElementIndexes.push_back(c_ItItem.value());
+         orc_Handle.c_ArrayElementIndexes.push_back(c_ItItem.key().GetArrayElementIndexOrZero());
+         //Don't stop as there might be multiple matches
+      }
+   }
+
+   orc_Handle.u32_RegistrationVersion = this->mu32_RegistrationVersion;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Get string for scaled value
 
@@ -1173,3 +1199,95 @@ QString C_PuiSvDbDataElementHandler::mh_GetStringForScaledValue(const float64 of
    }
    return c_Retval;
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   The registration version is invalid, so the handle gets resolved with the first value.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbDataElementHandler::C_DataElementHandle::C_DataElementHandle(void) :
+   u32_RegistrationVersion(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_PuiSvDbDataElementHandler::C_ValueQueue::C_ValueQueue(void) :
+   q_LastValueReceived(false),
+   u32_SampleCount(0U),
+   mu32_SampleStart(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add new received value
+
+   If the maximum number of values is reached, the oldest value is replaced.
+   The memory of the queue is reused, after the warm-up no memory is allocated anymore.
+
+   \param[in]  orc_Value               New received value
+   \param[in]  ou32_ArrayElementIndex  Array element index used by widget
+   \param[in]  ou32_TimeStamp          Time stamp of new value in ms
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementHandler::C_ValueQueue::Push(const C_OSCNodeDataPoolContent & orc_Value,
+                                                     const uint32 ou32_ArrayElementIndex, const uint32 ou32_TimeStamp)
+{
+   C_ValueSample c_Sample;
+   const uint32 u32_Size = static_cast<uint32>(this->mc_Samples.size());
+
+   // Assign base class only to avoid a temporary copy
+   static_cast<C_OSCNodeDataPoolContent &>(this->c_LastValue) = orc_Value;
+   this->c_LastValue.SetTimeStamp(ou32_TimeStamp);
+   this->q_LastValueReceived = true;
+
+   C_SdNdeDpContentUtil::h_GetValueAsFloat64(orc_Value, c_Sample.f64_Value, ou32_ArrayElementIndex);
+   c_Sample.u32_TimeStamp = ou32_TimeStamp;
+
+   if (this->u32_SampleCount < u32_Size)
+   {
+      this->mc_Samples[(this->mu32_SampleStart + this->u32_SampleCount) % u32_Size] = c_Sample;
+      ++this->u32_SampleCount;
+   }
+   else if (u32_Size < mhu32_MAXIMUM_SAMPLE_COUNT)
+   {
+      // Ring buffer did not wrap yet, so the start is still at the beginning
+      this->mc_Samples.push_back(c_Sample);
+      ++this->u32_SampleCount;
+   }
+   else
+   {
+      // Full: replace oldest value
+      this->mc_Samples[this->mu32_SampleStart] = c_Sample;
+      this->mu32_SampleStart = (this->mu32_SampleStart + 1U) % u32_Size;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all values (memory is kept for reuse)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_PuiSvDbDataElementHandler::C_ValueQueue::Clear(void)
+{
+   this->q_LastValueReceived = false;
+   this->u32_SampleCount = 0U;
+   this->mu32_SampleStart = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get received value
+
+   \param[in]  ou32_Index  Index of value (0 is the oldest value; must be smaller than u32_SampleCount)
+
+   \return
+   Received value
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_PuiSvDbDataElementHandler::C_ValueSample & C_PuiSvDbDataElementHandler::C_ValueQueue::GetSample(
+   const uint32 ou32_Index) const
+{
+   return this->mc_Samples[(this->mu32_SampleStart + ou32_Index) % this->mc_Samples.size()];
+}
@@ -15,6 +15,7 @@
 #include <QVector>
 #include <QList>
 #include <QMap>
+#include <vector>
 
 #include "stwtypes.h"
 
@@ -38,6 +39,18 @@ class C_PuiSvDbDataElementHandler :
    public C_PuiSvDbDataElement
 {
 public:
+   ///Data element of received values resolved to the matching data elements of one widget
+   class C_DataElementHandle
+   {
+   public:
+      C_DataElementHandle(void);
+
+      C_PuiSvDbNodeDataPoolListElementId c_ElementId;                ///< Data element of received values
+      std::vector<stw_types::uint32> c_WidgetDataPoolElementIndexes; ///< Matching widget data element indices
+      std::vector<stw_types::uint32> c_ArrayElementIndexes;          ///< Used array index of each matching element
+      stw_types::uint32 u32_RegistrationVersion;                     ///< Registration version of resolved indices
+   };
+
    C_PuiSvDbDataElementHandler(const stw_types::uint32 & oru32_ViewIndex,
                                const stw_types::uint32 & oru32_DashboardIndex,
                                const stw_types::sint32 & ors32_DataIndex, const E_Type & ore_Type,
@@ -59,8 +72,9 @@ public:
                                                C_PuiSvDbDataElementScaling & orc_DataPoolScaling) const;
    bool IsDataElementRegistered(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId) const;
 
-   void InsertNewValueIntoQueue(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
-                                const C_PuiSvDbDataElementContent & orc_NewValue);
+   void InsertNewValueIntoQueue(C_DataElementHandle & orc_Handle,
+                                const stw_opensyde_core::C_OSCNodeDataPoolContent & orc_NewValue,
+                                const stw_types::uint32 ou32_TimeStamp);
    void AddNewNvmValueIntoQueue(const C_PuiSvDbNodeDataPoolListElementId & orc_WidgetDataPoolElementId,
                                 const C_PuiSvDbDataElementContent & orc_NewValue);
    QString GetUnscaledValueAsScaledString(const stw_types::float64 of64_Value,
@@ -96,13 +110,44 @@ protected:
    const bool mq_ReadItem;
 
 private:
+   ///One received value of a data element reduced to the used array element
+   class C_ValueSample
+   {
+   public:
+      stw_types::float64 f64_Value; ///< Unscaled value
+      stw_types::uint32 u32_TimeStamp;
+   };
+
+   ///Received values of one data element since the last read of the widget
+   class C_ValueQueue
+   {
+   public:
+      C_ValueQueue(void);
+
+      void Push(const stw_opensyde_core::C_OSCNodeDataPoolContent & orc_Value,
+                const stw_types::uint32 ou32_ArrayElementIndex, const stw_types::uint32 ou32_TimeStamp);
+      void Clear(void);
+      const C_ValueSample & GetSample(const stw_types::uint32 ou32_Index) const;
+
+      C_PuiSvDbDataElementContent c_LastValue; ///< Newest received value with complete content
+      bool q_LastValueReceived;                ///< Flag if c_LastValue was received since the last read
+      stw_types::uint32 u32_SampleCount;       ///< Number of received values in c_Samples
+
+   private:
+      static const stw_types::uint32 mhu32_MAXIMUM_SAMPLE_COUNT = 65536U;
+
+      std::vector<C_ValueSample> mc_Samples; ///< Ring buffer, grows up to mhu32_MAXIMUM_SAMPLE_COUNT
+      stw_types::uint32 mu32_SampleStart;    ///< Position of oldest value in ring buffer
+   };
+
    const stw_types::uint32 mu32_WidgetDataPoolElementCountMaximum;
    stw_types::uint32 mu32_WidgetDataPoolElementCount;
-   // For each datapool element an own list
-   QVector<QList<C_PuiSvDbDataElementContent> > mc_VecDataValues;
+   stw_types::uint32 mu32_RegistrationVersion; ///< Changes with each change of the registered data elements
+   // For each datapool element an own queue
+   std::vector<C_ValueQueue> mc_ValueQueues;
    QVector<C_PuiSvDbDataElementContent> mc_VecNvmValue;
    QVector<bool> mc_VecNvmValueReceived;
-   // Mapping of datapool element id to index of datapool element list in mc_VecDataValues
+   // Mapping of datapool element id to index of datapool element list in mc_ValueQueues
    QMap<C_PuiSvDbNodeDataPoolListElementId, stw_types::uint32> mc_MappingDpElementToDataSerie;
    QMap<C_PuiSvDbNodeDataPoolListElementId,
         C_PuiSvDbDataElementScaling> mc_MappingDpElementToScaling; ///< Configured Scaling
@@ -127,6 +172,7 @@ private:
    mutable stw_tgl::C_TGLCriticalSection mc_CriticalSection;
 
    void m_SetWidgetDataPoolElementCount(const stw_types::uint32 ou32_Count);
+   void m_ResolveDataElementHandle(C_DataElementHandle & orc_Handle) const;
    static QString mh_GetStringForScaledValue(const stw_types::float64 of64_Value,
                                              const stw_opensyde_core::C_OSCNodeDataPoolContent::E_Type oe_Type);
 
@@ -15,12 +15,14 @@
 #include "precomp_headers.h"
 
 #include "stwerrors.h"
+#include "TGLTime.h"
 
 #include "C_SyvComDataDealer.h"
 #include "C_OSCLoggingHandler.h"
 #include "C_PuiSvDbDataElementContent.h"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_tgl;
 using namespace stw_types;
 using namespace stw_errors;
 using namespace stw_opensyde_gui_logic;
@@ -45,7 +47,8 @@ using namespace stw_opensyde_core;
 */
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDataDealer::C_SyvComDataDealer(void) :
-   C_OSCDataDealerNvmSafe()
+   C_OSCDataDealerNvmSafe(),
+   mu32_ReceivedEventCount(0U)
 {
 }
 
@@ -61,7 +64,8 @@ C_SyvComDataDealer::C_SyvComDataDealer(void) :
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDataDealer::C_SyvComDataDealer(C_OSCNode * const opc_Node, const uint32 ou32_NodeIndex,
                                        C_OSCDiagProtocolBase * const opc_DiagProtocol) :
-   C_OSCDataDealerNvmSafe(opc_Node, ou32_NodeIndex, opc_DiagProtocol)
+   C_OSCDataDealerNvmSafe(opc_Node, ou32_NodeIndex, opc_DiagProtocol),
+   mu32_ReceivedEventCount(0U)
 {
 }
 
@@ -74,6 +78,24 @@ C_SyvComDataDealer::~C_SyvComDataDealer(void)
    //nothing to do ...
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of async events received since last call and reset the counter
+
+   Used by the cycling thread of the driver to detect activity.
+   Only to be called by the thread which handles the async events.
+
+   \return
+   Number of received async events (values and errors)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvComDataDealer::GetAndResetReceivedEventCount(void)
+{
+   const uint32 u32_Count = this->mu32_ReceivedEventCount;
+
+   this->mu32_ReceivedEventCount = 0U;
+   return u32_Count;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Adds a widget to inform about new datapool events
 
@@ -82,43 +104,55 @@ C_SyvComDataDealer::~C_SyvComDataDealer(void)
 //----------------------------------------------------------------------------------------------------------------------
 void C_SyvComDataDealer::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_Widget)
 {
-   if (opc_Widget != NULL)
+   if ((opc_Widget != NULL) && (this->mpc_Node != NULL))
    {
       uint32 u32_Counter;
 
+      if (this->mc_ElementHandleOffsets.size() != this->mpc_Node->c_DataPools.size())
+      {
+         this->m_InitElementHandles();
+      }
+
       for (u32_Counter = 0U; u32_Counter < opc_Widget->GetWidgetDataPoolElementCount(); ++u32_Counter)
       {
          C_PuiSvDbNodeDataPoolListElementId c_DpElementId;
-         if (opc_Widget->GetDataPoolElementIndex(u32_Counter, c_DpElementId) == C_NO_ERR)
+         uint32 u32_Handle;
+
+         // Is it relevant for this data dealer (No handling of bus signals here)?
+         if (((opc_Widget->GetDataPoolElementIndex(u32_Counter, c_DpElementId) == C_NO_ERR) &&
+              (c_DpElementId.GetType() == C_PuiSvDbNodeDataPoolListElementId::eDATAPOOL_ELEMENT)) &&
+             ((c_DpElementId.u32_NodeIndex == this->GetNodeIndex()) &&
+              (this->m_GetElementHandle(c_DpElementId.u32_DataPoolIndex, c_DpElementId.u32_ListIndex,
+                                        c_DpElementId.u32_ElementIndex, u32_Handle) == true)))
          {
-            // Is it relevant for this data dealer (No handling of bus signals here)?
-            if ((c_DpElementId.GetType() == C_PuiSvDbNodeDataPoolListElementId::eDATAPOOL_ELEMENT) &&
-                (c_DpElementId.u32_NodeIndex == this->GetNodeIndex()))
-            {
-               QMap<C_OSCNodeDataPoolListElementId,
-                    QList<C_PuiSvDbDataElementHandler *> >::iterator c_ItElement;
-
-               // Is there an entry?
-               c_ItElement = this->mc_AllWidgets.find(c_DpElementId);
+            std::vector<C_SyvComDataDealerWidgetRegistration> & rc_Registrations =
+               this->mc_WidgetRegistrations[u32_Handle];
+            bool q_Found = false;
 
-               // Add the widget to the map
-               if (c_ItElement != this->mc_AllWidgets.end())
+            //Check if not already contained
+            for (uint32 u32_ItRegistration = 0U; u32_ItRegistration < rc_Registrations.size(); ++u32_ItRegistration)
+            {
+               if (rc_Registrations[u32_ItRegistration].pc_Handler == opc_Widget)
                {
-                  //Check if not already contained
-                  if (c_ItElement.value().contains(opc_Widget) == false)
-                  {
-                     // There is a list for this datapool element already
-                     c_ItElement.value().push_back(opc_Widget);
-                  }
+                  q_Found = true;
+                  break;
                }
-               else
-               {
-                  // The map has no entry for this datapool element. Add a new list with this widget
-                  QList<C_PuiSvDbDataElementHandler *> c_List;
+            }
 
-                  c_List.push_back(opc_Widget);
-                  this->mc_AllWidgets.insert(c_DpElementId, c_List);
-               }
+            if (q_Found == false)
+            {
+               C_SyvComDataDealerWidgetRegistration c_Registration;
+
+               c_Registration.pc_Handler = opc_Widget;
+               // Base data element; all widget data elements using this element are resolved by the handle
+               c_Registration.c_Handle.c_ElementId =
+                  C_PuiSvDbNodeDataPoolListElementId(C_OSCNodeDataPoolListElementId(this->mu32_NodeIndex,
+                                                                                    c_DpElementId.u32_DataPoolIndex,
+                                                                                    c_DpElementId.u32_ListIndex,
+                                                                                    c_DpElementId.u32_ElementIndex),
+                                                     C_PuiSvDbNodeDataPoolListElementId::eDATAPOOL_ELEMENT, false,
+                                                     0UL);
+               rc_Registrations.push_back(c_Registration);
             }
          }
       }
@@ -254,32 +288,28 @@ sint32 C_SyvComDataDealer::NvmReadList(const uint32 ou32_DataPoolIndex, const ui
 void C_SyvComDataDealer::m_OnReadDataPoolEventReceived(const uint8 ou8_DataPoolIndex, const uint16 ou16_ListIndex,
                                                        const uint16 ou16_ElementIndex)
 {
+   ++this->mu32_ReceivedEventCount;
    if (this->mpc_Node != NULL)
    {
-      QMap<C_OSCNodeDataPoolListElementId,
-           QList<C_PuiSvDbDataElementHandler *> >::const_iterator c_ItElement;
-      C_OSCNodeDataPoolListElementId c_ElementId(this->mu32_NodeIndex, ou8_DataPoolIndex, ou16_ListIndex,
-                                                 ou16_ElementIndex);
-
-      // Get the correct list with all pointers to the widgets which are showing this datapool element
-      c_ItElement = this->mc_AllWidgets.find(c_ElementId);
-
-      if (c_ItElement != this->mc_AllWidgets.end())
+      uint32 u32_Handle;
+      const C_OSCNodeDataPoolListElement * const pc_Element =
+         this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex);
+
+      // Get the correct list with all widgets which are showing this datapool element
+      if (((pc_Element != NULL) &&
+           (this->m_GetElementHandle(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex, u32_Handle) == true)) &&
+          (this->mc_WidgetRegistrations[u32_Handle].empty() == false))
       {
-         const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
-         QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
-         const C_OSCNodeDataPoolContent * const pc_ElementContent =
-            &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_Value;
-         // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-         C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         std::vector<C_SyvComDataDealerWidgetRegistration> & rc_Registrations =
+            this->mc_WidgetRegistrations[u32_Handle];
+         const uint32 u32_TimeStamp = TGL_GetTickCount();
 
-         for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
+         for (uint32 u32_ItRegistration = 0U; u32_ItRegistration < rc_Registrations.size(); ++u32_ItRegistration)
          {
+            C_SyvComDataDealerWidgetRegistration & rc_Registration = rc_Registrations[u32_ItRegistration];
             // Update the value
-            (*c_ItWidget)->InsertNewValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
-                                                                                      C_PuiSvDbNodeDataPoolListElementId
-                                                                                      ::eDATAPOOL_ELEMENT, false, 0UL),
-                                                   c_DbContent);
+            rc_Registration.pc_Handler->InsertNewValueIntoQueue(rc_Registration.c_Handle, pc_Element->c_Value,
+                                                                u32_TimeStamp);
          }
       }
       else
@@ -307,29 +337,24 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventReceived(const uint8 ou8_DataPoolI
 void C_SyvComDataDealer::m_OnReadDataPoolEventErrorReceived(const uint8 ou8_DataPoolIndex, const uint16 ou16_ListIndex,
                                                             const uint16 ou16_ElementIndex, const uint8 ou8_ErrorCode)
 {
+   ++this->mu32_ReceivedEventCount;
    if (this->mpc_Node != NULL)
    {
-      QMap<C_OSCNodeDataPoolListElementId,
-           QList<C_PuiSvDbDataElementHandler *> >::const_iterator c_ItElement;
-      C_OSCNodeDataPoolListElementId c_ElementId(this->mu32_NodeIndex, ou8_DataPoolIndex, ou16_ListIndex,
-                                                 ou16_ElementIndex);
+      uint32 u32_Handle;
 
-      // Get the correct list with all pointers to the widgets which are showing this datapool element
-      c_ItElement = this->mc_AllWidgets.find(c_ElementId);
-
-      if (c_ItElement != this->mc_AllWidgets.end())
+      // Get the correct list with all widgets which are showing this datapool element
+      if ((this->m_GetElementHandle(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex, u32_Handle) == true) &&
+          (this->mc_WidgetRegistrations[u32_Handle].empty() == false))
       {
-         const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
-         QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
+         const std::vector<C_SyvComDataDealerWidgetRegistration> & rc_Registrations =
+            this->mc_WidgetRegistrations[u32_Handle];
 
-         for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
+         for (uint32 u32_ItRegistration = 0U; u32_ItRegistration < rc_Registrations.size(); ++u32_ItRegistration)
          {
+            const C_SyvComDataDealerWidgetRegistration & rc_Registration = rc_Registrations[u32_ItRegistration];
             // Update the value
-            (*c_ItWidget)->RegisterDataPoolElementCyclicError(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
-                                                                                                 C_PuiSvDbNodeDataPoolListElementId
-                                                                                                 ::eDATAPOOL_ELEMENT,
-                                                                                                 false, 0UL),
-                                                              ou8_ErrorCode);
+            rc_Registration.pc_Handler->RegisterDataPoolElementCyclicError(rc_Registration.c_Handle.c_ElementId,
+                                                                           ou8_ErrorCode);
          }
       }
       else
@@ -345,32 +370,28 @@ void C_SyvComDataDealer::m_OnReadDataPoolEventErrorReceived(const uint8 ou8_Data
 void C_SyvComDataDealer::m_OnReadDataPoolNvmEventReceived(const uint8 ou8_DataPoolIndex, const uint16 ou16_ListIndex,
                                                           const uint16 ou16_ElementIndex)
 {
+   ++this->mu32_ReceivedEventCount;
    if (this->mpc_Node != NULL)
    {
-      QMap<C_OSCNodeDataPoolListElementId,
-           QList<C_PuiSvDbDataElementHandler *> >::const_iterator c_ItElement;
-      C_OSCNodeDataPoolListElementId c_ElementId(this->mu32_NodeIndex, ou8_DataPoolIndex, ou16_ListIndex,
-                                                 ou16_ElementIndex);
-
-      // Get the correct list with all pointers to the widgets which are showing this datapool element
-      c_ItElement = this->mc_AllWidgets.find(c_ElementId);
-
-      if (c_ItElement != this->mc_AllWidgets.end())
+      uint32 u32_Handle;
+      const C_OSCNodeDataPoolListElement * const pc_Element =
+         this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex);
+
+      // Get the correct list with all widgets which are showing this datapool element
+      if (((pc_Element != NULL) &&
+           (this->m_GetElementHandle(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex, u32_Handle) == true)) &&
+          (this->mc_WidgetRegistrations[u32_Handle].empty() == false))
       {
-         const QList<C_PuiSvDbDataElementHandler *> & rc_ListWidgets = c_ItElement.value();
-         QList<C_PuiSvDbDataElementHandler *>::const_iterator c_ItWidget;
-         const C_OSCNodeDataPoolContent * const pc_ElementContent =
-            &this->mpc_Node->GetDataPoolListElement(ou8_DataPoolIndex, ou16_ListIndex, ou16_ElementIndex)->c_NvmValue;
+         const std::vector<C_SyvComDataDealerWidgetRegistration> & rc_Registrations =
+            this->mc_WidgetRegistrations[u32_Handle];
          // Create the necessary instance with a copy of the content. The timestamp will be filled in the constructor
-         C_PuiSvDbDataElementContent c_DbContent(*pc_ElementContent);
+         const C_PuiSvDbDataElementContent c_DbContent(pc_Element->c_NvmValue);
 
-         for (c_ItWidget = rc_ListWidgets.begin(); c_ItWidget != rc_ListWidgets.end(); ++c_ItWidget)
+         for (uint32 u32_ItRegistration = 0U; u32_ItRegistration < rc_Registrations.size(); ++u32_ItRegistration)
          {
+            const C_SyvComDataDealerWidgetRegistration & rc_Registration = rc_Registrations[u32_ItRegistration];
             // Update the value
-            (*c_ItWidget)->AddNewNvmValueIntoQueue(C_PuiSvDbNodeDataPoolListElementId(c_ElementId,
-                                                                                      C_PuiSvDbNodeDataPoolListElementId
-                                                                                      ::eDATAPOOL_ELEMENT, false, 0UL),
-                                                   c_DbContent);
+            rc_Registration.pc_Handler->AddNewNvmValueIntoQueue(rc_Registration.c_Handle.c_ElementId, c_DbContent);
          }
       }
       else
@@ -383,3 +404,71 @@ void C_SyvComDataDealer::m_OnReadDataPoolNvmEventReceived(const uint8 ou8_DataPo
       }
    }
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Assign a dense handle to each data element of the node
+
+   The handle is used as index for the widget registrations, so no search is necessary for each received value.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDataDealer::m_InitElementHandles(void)
+{
+   uint32 u32_Handle = 0U;
+
+   this->mc_ElementHandleOffsets.clear();
+   this->mc_ElementHandleOffsets.resize(this->mpc_Node->c_DataPools.size());
+   for (uint32 u32_ItDataPool = 0U; u32_ItDataPool < this->mpc_Node->c_DataPools.size(); ++u32_ItDataPool)
+   {
+      const C_OSCNodeDataPool & rc_DataPool = this->mpc_Node->c_DataPools[u32_ItDataPool];
+      std::vector<uint32> & rc_Offsets = this->mc_ElementHandleOffsets[u32_ItDataPool];
+
+      rc_Offsets.resize(rc_DataPool.c_Lists.size());
+      for (uint32 u32_ItList = 0U; u32_ItList < rc_DataPool.c_Lists.size(); ++u32_ItList)
+      {
+         rc_Offsets[u32_ItList] = u32_Handle;
+         u32_Handle += static_cast<uint32>(rc_DataPool.c_Lists[u32_ItList].c_Elements.size());
+      }
+   }
+
+   this->mc_WidgetRegistrations.clear();
+   this->mc_WidgetRegistrations.resize(u32_Handle);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get handle of data element
+
+   \param[in]   ou32_DataPoolIndex   Datapool index
+   \param[in]   ou32_ListIndex       List index
+   \param[in]   ou32_ElementIndex    Element index
+   \param[out]  oru32_Handle         Handle of data element (index of mc_WidgetRegistrations)
+
+   \return
+   true     Handle found
+   false    Data element does not exist or no widget was registered yet
+*/
+//----------------------------------------------------------------------------------------------------------------------
+bool C_SyvComDataDealer::m_GetElementHandle(const uint32 ou32_DataPoolIndex, const uint32 ou32_ListIndex,
+                                            const uint32 ou32_ElementIndex, uint32 & oru32_Handle) const
+{
+   bool q_Return = false;
+
+   if (((ou32_DataPoolIndex < this->mc_ElementHandleOffsets.size()) &&
+        (ou32_ListIndex < this->mc_ElementHandleOffsets[ou32_DataPoolIndex].size())) &&
+       (ou32_ElementIndex <
+        this->mpc_Node->c_DataPools[ou32_DataPoolIndex].c_Lists[ou32_ListIndex].c_Elements.size()))
+   {
+      oru32_Handle = this->mc_ElementHandleOffsets[ou32_DataPoolIndex][ou32_ListIndex] + ou32_ElementIndex;
+      q_Return = (oru32_Handle < this->mc_WidgetRegistrations.size());
+   }
+
+   return q_Return;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComDataDealer::C_SyvComDataDealerWidgetRegistration::C_SyvComDataDealerWidgetRegistration(void) :
+   pc_Handler(NULL)
+{
+}
@@ -10,8 +10,7 @@
 #define C_SYVCOMDATADEALER_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
-#include <QMap>
-#include <QList>
+#include <vector>
 
 #include "stwtypes.h"
 
@@ -40,6 +39,7 @@ public:
    virtual ~C_SyvComDataDealer(void);
 
    void RegisterWidget(C_PuiSvDbDataElementHandler * const opc_Widget);
+   stw_types::uint32 GetAndResetReceivedEventCount(void);
 
    virtual stw_types::sint32 DataPoolRead(const stw_types::uint8 ou8_DataPoolIndex,
                                           const stw_types::uint16 ou16_ListIndex,
@@ -65,7 +65,27 @@ protected:
                                                  const stw_types::uint16 ou16_ElementIndex);
 
 private:
-   QMap<stw_opensyde_core::C_OSCNodeDataPoolListElementId, QList<C_PuiSvDbDataElementHandler *> > mc_AllWidgets;
+   class C_SyvComDataDealerWidgetRegistration
+   {
+   public:
+      C_SyvComDataDealerWidgetRegistration(void);
+
+      // Widget to inform
+      C_PuiSvDbDataElementHandler * pc_Handler;
+      // Data element resolved to the matching data elements of the widget
+      C_PuiSvDbDataElementHandler::C_DataElementHandle c_Handle;
+   };
+
+   // Element handle of the first element of each list; Handle of an element: offset of list + element index
+   std::vector<std::vector<stw_types::uint32> > mc_ElementHandleOffsets;
+   // Registered widgets for each element handle
+   std::vector<std::vector<C_SyvComDataDealerWidgetRegistration> > mc_WidgetRegistrations;
+   // Number of received async events since last call of GetAndResetReceivedEventCount
+   stw_types::uint32 mu32_ReceivedEventCount;
+
+   void m_InitElementHandles(void);
+   bool m_GetElementHandle(const stw_types::uint32 ou32_DataPoolIndex, const stw_types::uint32 ou32_ListIndex,
+                           const stw_types::uint32 ou32_ElementIndex, stw_types::uint32 & oru32_Handle) const;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
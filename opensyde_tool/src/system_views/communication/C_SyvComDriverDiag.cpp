@@ -14,6 +14,8 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h"
 
+#include <map>
+
 #include "stwerrors.h"
 
 #include "C_SyvComDriverDiag.h"
@@ -59,14 +61,13 @@ using namespace stw_opensyde_gui_logic;
 //----------------------------------------------------------------------------------------------------------------------
 C_SyvComDriverDiag::C_SyvComDriverDiag(const uint32 ou32_ViewIndex) :
    C_OSCComDriverProtocol(),
+   mu32_CycleActivityCount(0U),
+   mu32_IdleWaitTime(1U),
    mu32_ViewIndex(ou32_ViewIndex),
    mpc_CanDllDispatcher(NULL),
    mpc_EthernetDispatcher(NULL)
 {
    mpc_AsyncThread = new C_SyvComDriverThread(&C_SyvComDriverDiag::mh_ThreadFunc, this);
-
-   connect(&this->mc_PollingThread, &C_SyvComPollingThreadDiag::finished, this,
-           &C_SyvComDriverDiag::m_HandlePollingFinished);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -85,14 +86,19 @@ C_SyvComDriverDiag::~C_SyvComDriverDiag(void)
    delete mpc_AsyncThread;
    mpc_AsyncThread = NULL;
 
-   if (this->mc_PollingThread.isRunning() == true)
+   for (uint32 u32_ItThread = 0U; u32_ItThread < this->mc_PollingThreads.size(); ++u32_ItThread)
    {
-      this->mc_PollingThread.requestInterruption();
-
-      if (this->mc_PollingThread.wait(2000U) == false)
+      C_SyvComPollingThreadDiag * const pc_PollingThread = this->mc_PollingThreads[u32_ItThread];
+      if (pc_PollingThread->isRunning() == true)
       {
-         // Not finished yet
-         osc_write_log_warning("Closing diagnostic driver", "Waiting time for stopping polling thread was not enough");
+         pc_PollingThread->requestInterruption();
+
+         if (pc_PollingThread->wait(2000U) == false)
+         {
+            // Not finished yet
+            osc_write_log_warning("Closing diagnostic driver",
+                                  "Waiting time for stopping polling thread was not enough");
+         }
       }
    }
 
@@ -111,6 +117,12 @@ C_SyvComDriverDiag::~C_SyvComDriverDiag(void)
       this->mc_DataDealers[u32_DealerIndex] = NULL;
    }
 
+   for (uint32 u32_ItThread = 0U; u32_ItThread < this->mc_PollingThreads.size(); ++u32_ItThread)
+   {
+      delete this->mc_PollingThreads[u32_ItThread];
+      this->mc_PollingThreads[u32_ItThread] = NULL;
+   }
+
    if (mpc_CanDllDispatcher != NULL)
    {
       this->mpc_CanDllDispatcher->CAN_Exit();
@@ -630,6 +642,8 @@ void C_SyvComDriverDiag::StopCycling(void)
    if (this->mpc_AsyncThread != NULL)
    {
       this->mpc_AsyncThread->requestInterruption();
+      // Do not wait for the end of the current idle phase
+      this->mpc_AsyncThread->Wakeup();
       if (this->mpc_AsyncThread->wait(2000U) == false)
       {
          // Not finished yet
@@ -662,7 +676,7 @@ sint32 C_SyvComDriverDiag::SendTesterPresentWithoutDefectNodes(void)
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollDataPoolRead(const uint32 ou32_NodeIndex, const uint8 ou8_DataPoolIndex,
@@ -670,15 +684,17 @@ sint32 C_SyvComDriverDiag::PollDataPoolRead(const uint32 ou32_NodeIndex, const u
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartDataPoolRead((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
-                                                      ou16_ListIndex, ou16_ElementIndex);
+      s32_Return = pc_PollingThread->StartDataPoolRead((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
+                                                       ou16_ListIndex, ou16_ElementIndex);
    }
    return s32_Return;
 }
@@ -693,7 +709,7 @@ sint32 C_SyvComDriverDiag::PollDataPoolRead(const uint32 ou32_NodeIndex, const u
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollDataPoolWrite(const uint32 ou32_NodeIndex, const uint8 ou8_DataPoolIndex,
@@ -701,15 +717,17 @@ sint32 C_SyvComDriverDiag::PollDataPoolWrite(const uint32 ou32_NodeIndex, const
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartDataPoolWrite((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
-                                                       ou16_ListIndex, ou16_ElementIndex);
+      s32_Return = pc_PollingThread->StartDataPoolWrite((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
+                                                        ou16_ListIndex, ou16_ElementIndex);
    }
    return s32_Return;
 }
@@ -724,7 +742,7 @@ sint32 C_SyvComDriverDiag::PollDataPoolWrite(const uint32 ou32_NodeIndex, const
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollNvmRead(const uint32 ou32_NodeIndex, const uint8 ou8_DataPoolIndex,
@@ -732,15 +750,17 @@ sint32 C_SyvComDriverDiag::PollNvmRead(const uint32 ou32_NodeIndex, const uint8
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmRead((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
-                                                 ou16_ListIndex, ou16_ElementIndex);
+      s32_Return = pc_PollingThread->StartNvmRead((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
+                                                  ou16_ListIndex, ou16_ElementIndex);
    }
    return s32_Return;
 }
@@ -755,7 +775,7 @@ sint32 C_SyvComDriverDiag::PollNvmRead(const uint32 ou32_NodeIndex, const uint8
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollNvmWrite(const uint32 ou32_NodeIndex, const uint8 ou8_DataPoolIndex,
@@ -763,15 +783,17 @@ sint32 C_SyvComDriverDiag::PollNvmWrite(const uint32 ou32_NodeIndex, const uint8
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmWrite((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
-                                                  ou16_ListIndex, ou16_ElementIndex);
+      s32_Return = pc_PollingThread->StartNvmWrite((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
+                                                   ou16_ListIndex, ou16_ElementIndex);
    }
    return s32_Return;
 }
@@ -785,7 +807,7 @@ sint32 C_SyvComDriverDiag::PollNvmWrite(const uint32 ou32_NodeIndex, const uint8
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollNvmReadList(const uint32 ou32_NodeIndex, const uint8 ou8_DataPoolIndex,
@@ -794,15 +816,17 @@ sint32 C_SyvComDriverDiag::PollNvmReadList(const uint32 ou32_NodeIndex, const ui
    sint32 s32_Return;
    bool q_Found;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex, &q_Found);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (q_Found == false))
+
+   if (((u32_ActiveIndex >= mc_DataDealers.size()) || (q_Found == false)) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmReadList((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
-                                                     ou16_ListIndex);
+      s32_Return = pc_PollingThread->StartNvmReadList((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
+                                                      ou16_ListIndex);
    }
    return s32_Return;
 }
@@ -815,7 +839,7 @@ sint32 C_SyvComDriverDiag::PollNvmReadList(const uint32 ou32_NodeIndex, const ui
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollSafeNvmWriteChangedElements(const uint32 ou32_NodeIndex,
@@ -823,14 +847,16 @@ sint32 C_SyvComDriverDiag::PollSafeNvmWriteChangedElements(const uint32 ou32_Nod
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmSafeWriteChangedValues((*mc_DataDealers[u32_ActiveIndex]), orc_ListIds);
+      s32_Return = pc_PollingThread->StartNvmSafeWriteChangedValues((*mc_DataDealers[u32_ActiveIndex]), orc_ListIds);
    }
    return s32_Return;
 }
@@ -838,16 +864,28 @@ sint32 C_SyvComDriverDiag::PollSafeNvmWriteChangedElements(const uint32 ou32_Nod
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Gets the output of PollSafeNvmWriteChangedElements
 
+   \param[in]   ou32_NodeIndex         Node index the service was started for
    \param[out]  orc_ChangedElements    All changed elements
 
    \return
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_NO_ERR  output returned
+   C_BUSY    previously started polled communication still going on
+   C_RANGE   node index out of range
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_SyvComDriverDiag::GetPollSafeNvmWriteChangedElementsOutput(
-   std::vector<C_OSCNodeDataPoolListElementId> & orc_ChangedElements) const
+sint32 C_SyvComDriverDiag::GetPollSafeNvmWriteChangedElementsOutput(const uint32 ou32_NodeIndex,
+                                                                    std::vector<C_OSCNodeDataPoolListElementId> & orc_ChangedElements)
+const
 {
-   return this->mc_PollingThread.GetNvmSafeWriteChangedValuesOutput(orc_ChangedElements);
+   sint32 s32_Return = C_RANGE;
+   const C_SyvComPollingThreadDiag * const pc_PollingThread =
+      this->m_GetPollingThread(this->m_GetActiveIndex(ou32_NodeIndex));
+
+   if (pc_PollingThread != NULL)
+   {
+      s32_Return = pc_PollingThread->GetNvmSafeWriteChangedValuesOutput(orc_ChangedElements);
+   }
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -859,21 +897,23 @@ sint32 C_SyvComDriverDiag::GetPollSafeNvmWriteChangedElementsOutput(
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollSafeNvmReadValues(const uint32 ou32_NodeIndex)
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmSafeReadValues(*mc_DataDealers[u32_ActiveIndex]);
+      s32_Return = pc_PollingThread->StartNvmSafeReadValues(*mc_DataDealers[u32_ActiveIndex]);
    }
    return s32_Return;
 }
@@ -883,16 +923,27 @@ sint32 C_SyvComDriverDiag::PollSafeNvmReadValues(const uint32 ou32_NodeIndex)
 
    Must be called after the thread was finished after calling NvmSafeReadValues
 
+   \param[in]   ou32_NodeIndex         Node index the service was started for
    \param[out]  orpc_ParamNodeValues   Pointer to node with read values
 
    \return
    C_NO_ERR   result returned
    C_BUSY     previously started polled communication still going on
+   C_RANGE    node index out of range
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_SyvComDriverDiag::GetPollNvmSafeReadValuesOutput(const C_OSCNode * & orpc_ParamNodeValues) const
+sint32 C_SyvComDriverDiag::GetPollNvmSafeReadValuesOutput(const uint32 ou32_NodeIndex,
+                                                          const C_OSCNode * & orpc_ParamNodeValues) const
 {
-   return this->mc_PollingThread.GetNvmSafeReadValuesOutput(orpc_ParamNodeValues);
+   sint32 s32_Return = C_RANGE;
+   const C_SyvComPollingThreadDiag * const pc_PollingThread =
+      this->m_GetPollingThread(this->m_GetActiveIndex(ou32_NodeIndex));
+
+   if (pc_PollingThread != NULL)
+   {
+      s32_Return = pc_PollingThread->GetNvmSafeReadValuesOutput(orpc_ParamNodeValues);
+   }
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -904,21 +955,23 @@ sint32 C_SyvComDriverDiag::GetPollNvmSafeReadValuesOutput(const C_OSCNode * & or
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollSafeNvmSafeWriteCrcs(const uint32 ou32_NodeIndex)
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmSafeWriteCrcs(*mc_DataDealers[u32_ActiveIndex]);
+      s32_Return = pc_PollingThread->StartNvmSafeWriteCrcs(*mc_DataDealers[u32_ActiveIndex]);
    }
    return s32_Return;
 }
@@ -934,7 +987,7 @@ sint32 C_SyvComDriverDiag::PollSafeNvmSafeWriteCrcs(const uint32 ou32_NodeIndex)
 
    \return
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollNvmNotifyOfChanges(const uint32 ou32_NodeIndex, const uint8 ou8_DataPoolIndex,
@@ -942,15 +995,17 @@ sint32 C_SyvComDriverDiag::PollNvmNotifyOfChanges(const uint32 ou32_NodeIndex, c
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmNotifyOfChanges((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
-                                                            ou16_ListIndex);
+      s32_Return = pc_PollingThread->StartNvmNotifyOfChanges((*mc_DataDealers[u32_ActiveIndex]), ou8_DataPoolIndex,
+                                                             ou16_ListIndex);
    }
    return s32_Return;
 }
@@ -958,16 +1013,28 @@ sint32 C_SyvComDriverDiag::PollNvmNotifyOfChanges(const uint32 ou32_NodeIndex, c
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Gets the output of PollSafeNvmWriteChangedElements
 
+   \param[in]   ou32_NodeIndex               Node index the service was started for
    \param[out]  orq_ApplicationAcknowledge   true: positive acknowledge from server
                                              false: negative acknowledge from server
 
    \return
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_NO_ERR  output returned
+   C_BUSY    previously started polled communication still going on
+   C_RANGE   node index out of range
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_SyvComDriverDiag::GetPollNvmNotifyOfChangesOutput(bool & orq_ApplicationAcknowledge) const
+sint32 C_SyvComDriverDiag::GetPollNvmNotifyOfChangesOutput(const uint32 ou32_NodeIndex,
+                                                           bool & orq_ApplicationAcknowledge) const
 {
-   return this->mc_PollingThread.GetNvmNotifyOfChangesOutput(orq_ApplicationAcknowledge);
+   sint32 s32_Return = C_RANGE;
+   const C_SyvComPollingThreadDiag * const pc_PollingThread =
+      this->m_GetPollingThread(this->m_GetActiveIndex(ou32_NodeIndex));
+
+   if (pc_PollingThread != NULL)
+   {
+      s32_Return = pc_PollingThread->GetNvmNotifyOfChangesOutput(orq_ApplicationAcknowledge);
+   }
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -975,17 +1042,27 @@ sint32 C_SyvComDriverDiag::GetPollNvmNotifyOfChangesOutput(bool & orq_Applicatio
 
    Can be used to extract the results of one service execution after it has finished.
 
-   \param[out]  ors32_Result  result code of executed service function
-                              for possible values see the DataDealer's function documentation
+   \param[in]   ou32_NodeIndex   Node index the service was started for
+   \param[out]  ors32_Result     result code of executed service function
+                                 for possible values see the DataDealer's function documentation
 
    \return
    C_NO_ERR   result code read
    C_BUSY     previously started polled communication still going on
+   C_RANGE    node index out of range
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_SyvComDriverDiag::GetPollResults(sint32 & ors32_Result) const
+sint32 C_SyvComDriverDiag::GetPollResults(const uint32 ou32_NodeIndex, sint32 & ors32_Result) const
 {
-   return this->mc_PollingThread.GetResults(ors32_Result);
+   sint32 s32_Return = C_RANGE;
+   const C_SyvComPollingThreadDiag * const pc_PollingThread =
+      this->m_GetPollingThread(this->m_GetActiveIndex(ou32_NodeIndex));
+
+   if (pc_PollingThread != NULL)
+   {
+      s32_Return = pc_PollingThread->GetResults(ors32_Result);
+   }
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -993,17 +1070,27 @@ sint32 C_SyvComDriverDiag::GetPollResults(sint32 & ors32_Result) const
 
    Can be used to extract the results of one service execution after it has finished.
 
-   \param[out]  oru8_NRC   negative response code of executed service function
-                           for possible values see the DataDealer's function documentation
+   \param[in]   ou32_NodeIndex   Node index the service was started for
+   \param[out]  oru8_NRC         negative response code of executed service function
+                                 for possible values see the DataDealer's function documentation
 
    \return
    C_NO_ERR       result code read
    C_BUSY         previously started polled communication still going on
+   C_RANGE        node index out of range
 */
 //----------------------------------------------------------------------------------------------------------------------
-sint32 C_SyvComDriverDiag::GetPollResultNRC(uint8 & oru8_NRC) const
+sint32 C_SyvComDriverDiag::GetPollResultNRC(const uint32 ou32_NodeIndex, uint8 & oru8_NRC) const
 {
-   return this->mc_PollingThread.GetNegativeResponseCode(oru8_NRC);
+   sint32 s32_Return = C_RANGE;
+   const C_SyvComPollingThreadDiag * const pc_PollingThread =
+      this->m_GetPollingThread(this->m_GetActiveIndex(ou32_NodeIndex));
+
+   if (pc_PollingThread != NULL)
+   {
+      s32_Return = pc_PollingThread->GetNegativeResponseCode(oru8_NRC);
+   }
+   return s32_Return;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -1050,7 +1137,7 @@ sint32 C_SyvComDriverDiag::NvmSafeClearInternalContent(const uint32 ou32_NodeInd
    \return
    C_NO_ERR  started polling
    C_RANGE   node index out of range
-   C_BUSY    polling thread already busy (only one polled function possible in parallel)
+   C_BUSY    polling thread of node already busy (only one polled function per route possible in parallel)
 */
 //----------------------------------------------------------------------------------------------------------------------
 sint32 C_SyvComDriverDiag::PollNvmSafeReadParameterValues(const uint32 ou32_NodeIndex,
@@ -1058,15 +1145,17 @@ sint32 C_SyvComDriverDiag::PollNvmSafeReadParameterValues(const uint32 ou32_Node
 {
    sint32 s32_Return;
    const uint32 u32_ActiveIndex = this->m_GetActiveIndex(ou32_NodeIndex);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = this->m_GetPollingThread(u32_ActiveIndex);
 
-   if (u32_ActiveIndex >= mc_DataDealers.size())
+
+   if ((u32_ActiveIndex >= mc_DataDealers.size()) || (pc_PollingThread == NULL))
    {
       s32_Return = C_RANGE;
    }
    else
    {
-      s32_Return = mc_PollingThread.StartNvmSafeReadParameterValues((*mc_DataDealers[u32_ActiveIndex]),
-                                                                    orc_ListIds);
+      s32_Return = pc_PollingThread->StartNvmSafeReadParameterValues((*mc_DataDealers[u32_ActiveIndex]),
+                                                                     orc_ListIds);
    }
    return s32_Return;
 }
@@ -1312,7 +1401,7 @@ void C_SyvComDriverDiag::RegisterWidget(C_PuiSvDbDataElementHandler * const opc_
                   c_WidgetRegistration.pc_Handler = opc_Widget;
                   c_WidgetRegistration.q_IsExtended = pc_CanMsg->q_IsExtended;
                   c_WidgetRegistration.u16_Dlc = pc_CanMsg->u16_Dlc;
-                  c_WidgetRegistration.c_ElementId = c_DpElementId;
+                  c_WidgetRegistration.c_Handle.c_ElementId = c_DpElementId;
                   // Save the value content to have the content instance with the correct type as template for
                   // the new values
                   c_WidgetRegistration.c_ElementContent = pc_Element->c_Value;
@@ -1512,20 +1601,21 @@ bool C_SyvComDriverDiag::m_CheckInterfaceForFunctions(const C_OSCNodeComInterfac
 void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, const bool oq_IsTx)
 {
    C_OSCComDriverBase::m_HandleCanMessage(orc_Msg, oq_IsTx);
-   QMap<stw_types::uint32, QList<C_SyvComDriverDiagWidgetRegistration> >::const_iterator c_ItElement;
+   ++this->mu32_CycleActivityCount;
+   QMap<stw_types::uint32, QList<C_SyvComDriverDiagWidgetRegistration> >::iterator c_ItElement;
 
    // Check if this CAN message id is relevant
    c_ItElement = this->mc_AllWidgets.find(orc_Msg.u32_ID);
 
    if (c_ItElement != this->mc_AllWidgets.end())
    {
-      const QList<C_SyvComDriverDiagWidgetRegistration> & rc_Registrations = c_ItElement.value();
-      QList<C_SyvComDriverDiagWidgetRegistration>::const_iterator c_ItRegistration;
+      QList<C_SyvComDriverDiagWidgetRegistration> & rc_Registrations = c_ItElement.value();
+      QList<C_SyvComDriverDiagWidgetRegistration>::iterator c_ItRegistration;
 
       // Iterate through all widget registrations
       for (c_ItRegistration = rc_Registrations.begin(); c_ItRegistration != rc_Registrations.end(); ++c_ItRegistration)
       {
-         const C_SyvComDriverDiagWidgetRegistration & rc_WidgetRegistration = *c_ItRegistration;
+         C_SyvComDriverDiagWidgetRegistration & rc_WidgetRegistration = *c_ItRegistration;
 
          // Is the CAN message as expected
          if (((orc_Msg.u8_XTD == 1U) == rc_WidgetRegistration.q_IsExtended) &&
@@ -1586,21 +1676,20 @@ void C_SyvComDriverDiag::m_HandleCanMessage(const T_STWCAN_Msg_RX & orc_Msg, con
 
             if (q_SignalFits == true)
             {
-               C_PuiSvDbDataElementContent c_Content;
                const uint64 u64_TimeStamp = orc_Msg.u64_TimeStamp / 1000U;
 
                // Get the content
-               c_Content = rc_WidgetRegistration.c_ElementContent;
-               C_OSCCanUtil::h_GetSignalValue(orc_Msg.au8_Data, rc_WidgetRegistration.c_Signal, c_Content);
-               c_Content.SetTimeStamp(static_cast<uint32>(u64_TimeStamp));
+               C_OSCCanUtil::h_GetSignalValue(orc_Msg.au8_Data, rc_WidgetRegistration.c_Signal,
+                                              rc_WidgetRegistration.c_ElementContent);
 
-               rc_WidgetRegistration.pc_Handler->InsertNewValueIntoQueue(rc_WidgetRegistration.c_ElementId,
-                                                                         c_Content);
+               rc_WidgetRegistration.pc_Handler->InsertNewValueIntoQueue(rc_WidgetRegistration.c_Handle,
+                                                                         rc_WidgetRegistration.c_ElementContent,
+                                                                         static_cast<uint32>(u64_TimeStamp));
             }
             else if (q_DlcErrorPossible == true)
             {
                //Error message for widget
-               rc_WidgetRegistration.pc_Handler->SetErrorForInvalidDlc(rc_WidgetRegistration.c_ElementId,
+               rc_WidgetRegistration.pc_Handler->SetErrorForInvalidDlc(rc_WidgetRegistration.c_Handle.c_ElementId,
                                                                        orc_Msg.u8_DLC);
             }
             else
@@ -1839,6 +1928,8 @@ sint32 C_SyvComDriverDiag::m_InitDataDealer(void)
                s32_Retval = C_CONFIG;
             }
          }
+
+         this->m_InitPollingThreads();
       }
       else
       {
@@ -1854,6 +1945,71 @@ sint32 C_SyvComDriverDiag::m_InitDataDealer(void)
    return s32_Retval;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Create polling threads for all active nodes
+
+   Services for nodes which are reached via different first nodes of their route do not share any server, router or
+   connection of the PC, so they are executed in parallel by separate polling threads.
+   Nodes behind the same first node share its thread, as routers handle only one routed request at a time.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverDiag::m_InitPollingThreads(void)
+{
+   std::map<uint32, uint32> c_FirstNodeToThreadIndex;
+
+   this->mc_PollingThreadIndexes.resize(this->mc_ActiveNodesIndexes.size());
+   for (uint32 u32_ItActiveNode = 0U; u32_ItActiveNode < this->mc_ActiveNodesIndexes.size(); ++u32_ItActiveNode)
+   {
+      const uint32 u32_NodeIndex = this->mc_ActiveNodesIndexes[u32_ItActiveNode];
+      C_OSCRoutingRoute c_Route(u32_NodeIndex);
+      uint32 u32_FirstNodeIndex = u32_NodeIndex;
+      std::map<uint32, uint32>::const_iterator c_ItThread;
+
+      this->GetRouteOfNode(u32_NodeIndex, c_Route);
+      if (c_Route.c_VecRoutePoints.size() > 0UL)
+      {
+         u32_FirstNodeIndex = c_Route.c_VecRoutePoints[0].u32_NodeIndex;
+      }
+
+      c_ItThread = c_FirstNodeToThreadIndex.find(u32_FirstNodeIndex);
+      if (c_ItThread != c_FirstNodeToThreadIndex.end())
+      {
+         this->mc_PollingThreadIndexes[u32_ItActiveNode] = c_ItThread->second;
+      }
+      else
+      {
+         C_SyvComPollingThreadDiag * const pc_PollingThread = new C_SyvComPollingThreadDiag();
+         const uint32 u32_ThreadIndex = static_cast<uint32>(this->mc_PollingThreads.size());
+
+         connect(pc_PollingThread, &C_SyvComPollingThreadDiag::finished, this,
+                 &C_SyvComDriverDiag::m_HandlePollingFinished);
+         this->mc_PollingThreadIndexes[u32_ItActiveNode] = u32_ThreadIndex;
+         c_FirstNodeToThreadIndex[u32_FirstNodeIndex] = u32_ThreadIndex;
+         this->mc_PollingThreads.push_back(pc_PollingThread);
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get polling thread used for active node
+
+   \param[in]  ou32_ActiveIndex   Active node index
+
+   \return
+   Polling thread (NULL if active node index out of range)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComPollingThreadDiag * C_SyvComDriverDiag::m_GetPollingThread(const uint32 ou32_ActiveIndex) const
+{
+   C_SyvComPollingThreadDiag * pc_Retval = NULL;
+
+   if (ou32_ActiveIndex < this->mc_PollingThreadIndexes.size())
+   {
+      pc_Retval = this->mc_PollingThreads[this->mc_PollingThreadIndexes[ou32_ActiveIndex]];
+   }
+   return pc_Retval;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Initialize the necessary routing configuration to start the routing for diagnosis
 
@@ -1907,6 +2063,9 @@ sint32 C_SyvComDriverDiag::m_StartRoutingDiag(QString & orc_ErrorDetails, std::s
 
    if (s32_Return == C_NO_ERR)
    {
+      // Routing configurations already set up on the routers, so shared routers are configured only once
+      std::map<uint32, std::set<std::vector<uint8> > > c_ConfiguredRouters;
+
       // Search nodes which needs routing
       for (u32_ActiveNodeCounter = 0U; u32_ActiveNodeCounter < this->mc_ActiveNodesIndexes.size();
            ++u32_ActiveNodeCounter)
@@ -1917,7 +2076,7 @@ sint32 C_SyvComDriverDiag::m_StartRoutingDiag(QString & orc_ErrorDetails, std::s
          tgl_assert(pc_Node != NULL);
          if (pc_Node != NULL)
          {
-            s32_Return = this->m_StartRouting(u32_ActiveNodeCounter, &u32_ErrorActiveNodeIndex);
+            s32_Return = this->m_StartRouting(u32_ActiveNodeCounter, &u32_ErrorActiveNodeIndex, &c_ConfiguredRouters);
 
             tgl_assert(pc_Node->pc_DeviceDefinition != NULL);
             // Reconnect is only supported by openSYDE nodes
@@ -2444,6 +2603,14 @@ sint32 C_SyvComDriverDiag::m_Cycle(void)
       }
    }
 
+   for (uint32 u32_Counter = 0U; u32_Counter < this->mc_DataDealers.size(); ++u32_Counter)
+   {
+      if (this->mc_DataDealers[u32_Counter] != NULL)
+      {
+         this->mu32_CycleActivityCount += this->mc_DataDealers[u32_Counter]->GetAndResetReceivedEventCount();
+      }
+   }
+
    return C_NO_ERR;
 }
 
@@ -2465,6 +2632,11 @@ void C_SyvComDriverDiag::mh_ThreadFunc(void * const opv_Instance)
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Function for continuous calling by thread.
+
+   The thread yields once per cycle. As long as messages or events are received it waits only 1 ms.
+   Without activity the thread waits with increasing time (up to mhu32_MAXIMUM_IDLE_WAIT_TIME),
+   but never beyond the next tester present deadline.
+   Incoming responses do not wake the thread, so the idle waiting time directly adds to the response latency.
 */
 //----------------------------------------------------------------------------------------------------------------------
 void C_SyvComDriverDiag::m_ThreadFunc(void)
@@ -2472,6 +2644,8 @@ void C_SyvComDriverDiag::m_ThreadFunc(void)
    static uint32 hu32_LastSentTesterPresent = 0U;
    static uint32 hu32_LastSentDebugTest = 0U;
    uint32 u32_CurrentTime;
+   uint32 u32_NextTesterPresent;
+   uint32 u32_WaitTime;
 
    if (hu32_LastSentTesterPresent == 0U)
    {
@@ -2482,7 +2656,7 @@ void C_SyvComDriverDiag::m_ThreadFunc(void)
 
    u32_CurrentTime = stw_tgl::TGL_GetTickCount();
 
-   if (u32_CurrentTime > (hu32_LastSentTesterPresent + 1000U))
+   if (u32_CurrentTime > (hu32_LastSentTesterPresent + mhu32_TESTER_PRESENT_INTERVAL))
    {
       hu32_LastSentTesterPresent = u32_CurrentTime;
       this->SendTesterPresent();
@@ -2497,14 +2671,55 @@ void C_SyvComDriverDiag::m_ThreadFunc(void)
       // nothing to do
    }
 
+   this->mu32_CycleActivityCount = 0U;
+
    // Handle datapool events
    this->m_Cycle();
 
    // Handle CAN message / com signal input
    this->DistributeMessages();
 
-   //rescind CPU time to other threads ...
-   stw_tgl::TGL_Sleep(1);
+   //All queues were emptied in this cycle, so always rescind CPU time to other threads:
+   //continuous bus traffic must not keep this thread spinning
+   if (this->mu32_CycleActivityCount > 0U)
+   {
+      // Wait the minimum time and react fast again when it gets quiet
+      this->mu32_IdleWaitTime = 1U;
+      u32_WaitTime = 1U;
+   }
+   else
+   {
+      u32_WaitTime = this->mu32_IdleWaitTime;
+      if (this->mu32_IdleWaitTime < mhu32_MAXIMUM_IDLE_WAIT_TIME)
+      {
+         this->mu32_IdleWaitTime = this->mu32_IdleWaitTime * 2U;
+         if (this->mu32_IdleWaitTime > mhu32_MAXIMUM_IDLE_WAIT_TIME)
+         {
+            this->mu32_IdleWaitTime = mhu32_MAXIMUM_IDLE_WAIT_TIME;
+         }
+      }
+   }
+
+   // Do not miss the tester present deadline
+   u32_NextTesterPresent = hu32_LastSentTesterPresent + mhu32_TESTER_PRESENT_INTERVAL + 1U;
+   u32_CurrentTime = stw_tgl::TGL_GetTickCount();
+   if (u32_NextTesterPresent <= u32_CurrentTime)
+   {
+      u32_WaitTime = 0U;
+   }
+   else if ((u32_NextTesterPresent - u32_CurrentTime) < u32_WaitTime)
+   {
+      u32_WaitTime = u32_NextTesterPresent - u32_CurrentTime;
+   }
+   else
+   {
+      // nothing to do
+   }
+
+   if (u32_WaitTime > 0U)
+   {
+      this->mpc_AsyncThread->WaitForWakeup(u32_WaitTime);
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -2513,14 +2728,25 @@ void C_SyvComDriverDiag::m_ThreadFunc(void)
 //----------------------------------------------------------------------------------------------------------------------
 void C_SyvComDriverDiag::m_HandlePollingFinished(void)
 {
-   sint32 s32_Result;
-   uint8 u8_NRC;
-
-   tgl_assert(this->mc_PollingThread.GetResults(s32_Result) == C_NO_ERR);
-   tgl_assert(this->mc_PollingThread.GetNegativeResponseCode(u8_NRC) == C_NO_ERR);
-   //Start with next one
-   this->mc_PollingThread.AcceptNextRequest();
-   Q_EMIT this->SigPollingFinished(s32_Result, u8_NRC);
+   C_SyvComPollingThreadDiag * const pc_PollingThread = dynamic_cast<C_SyvComPollingThreadDiag *>(this->sender());
+
+   tgl_assert(pc_PollingThread != NULL);
+   if (pc_PollingThread != NULL)
+   {
+      sint32 s32_Result;
+      uint8 u8_NRC;
+      C_OSCNodeDataPoolListElementId c_Id;
+
+      tgl_assert(pc_PollingThread->GetResults(s32_Result) == C_NO_ERR);
+      tgl_assert(pc_PollingThread->GetNegativeResponseCode(u8_NRC) == C_NO_ERR);
+      tgl_assert(pc_PollingThread->GetServiceId(c_Id) == C_NO_ERR);
+      //Start with next one
+      pc_PollingThread->AcceptNextRequest();
+      //Responses received by the polling thread in the meantime are waiting for the cycling thread
+      this->mpc_AsyncThread->Wakeup();
+      //Polling threads of different routes run in parallel: report which service the result belongs to
+      Q_EMIT this->SigPollingFinished(c_Id, s32_Result, u8_NRC);
+   }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
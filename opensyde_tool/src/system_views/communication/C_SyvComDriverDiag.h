@@ -70,17 +70,20 @@ public:
                                      const stw_types::uint16 ou16_ListIndex);
    stw_types::sint32 PollSafeNvmWriteChangedElements(const stw_types::uint32 ou32_NodeIndex,
                                                      const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListId> & orc_ListIds);
-   stw_types::sint32 GetPollSafeNvmWriteChangedElementsOutput(
-      std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_ChangedElements) const;
+   stw_types::sint32 GetPollSafeNvmWriteChangedElementsOutput(const stw_types::uint32 ou32_NodeIndex,
+                                                              std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_ChangedElements)
+   const;
    stw_types::sint32 PollSafeNvmReadValues(const stw_types::uint32 ou32_NodeIndex);
-   stw_types::sint32 GetPollNvmSafeReadValuesOutput(const stw_opensyde_core::C_OSCNode * (&orpc_ParamNodeValues)) const;
+   stw_types::sint32 GetPollNvmSafeReadValuesOutput(const stw_types::uint32 ou32_NodeIndex,
+                                                    const stw_opensyde_core::C_OSCNode * (&orpc_ParamNodeValues)) const;
    stw_types::sint32 PollSafeNvmSafeWriteCrcs(const stw_types::uint32 ou32_NodeIndex);
    stw_types::sint32 PollNvmNotifyOfChanges(const stw_types::uint32 ou32_NodeIndex,
                                             const stw_types::uint8 ou8_DataPoolIndex,
                                             const stw_types::uint16 ou16_ListIndex);
-   stw_types::sint32 GetPollNvmNotifyOfChangesOutput(bool & orq_ApplicationAcknowledge) const;
-   stw_types::sint32 GetPollResults(stw_types::sint32 & ors32_Result) const;
-   stw_types::sint32 GetPollResultNRC(stw_types::uint8 & oru8_NRC) const;
+   stw_types::sint32 GetPollNvmNotifyOfChangesOutput(const stw_types::uint32 ou32_NodeIndex,
+                                                     bool & orq_ApplicationAcknowledge) const;
+   stw_types::sint32 GetPollResults(const stw_types::uint32 ou32_NodeIndex, stw_types::sint32 & ors32_Result) const;
+   stw_types::sint32 GetPollResultNRC(const stw_types::uint32 ou32_NodeIndex, stw_types::uint8 & oru8_NRC) const;
 
    stw_types::sint32 NvmSafeClearInternalContent(const stw_types::uint32 ou32_NodeIndex) const;
    stw_types::sint32 PollNvmSafeReadParameterValues(const stw_types::uint32 ou32_NodeIndex,
@@ -101,7 +104,8 @@ public:
    //lint -save -e1736
 Q_SIGNALS:
    //lint -restore
-   void SigPollingFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
+   void SigPollingFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                           const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
 
 protected:
    virtual bool m_GetRoutingMode(stw_opensyde_core::C_OSCRoutingCalculation::E_Mode & ore_Mode) const override;
@@ -132,19 +136,24 @@ private:
       // Information to identify CAN message
       stw_types::uint16 u16_Dlc;
       bool q_IsExtended;
-      // Identification of value for widget
-      C_PuiSvDbNodeDataPoolListElementId c_ElementId;
+      // Identification of value for widget resolved to the matching data elements of the widget
+      C_PuiSvDbDataElementHandler::C_DataElementHandle c_Handle;
       // Signal for showing in widget
       stw_opensyde_core::C_OSCCanSignal c_Signal;
       // In case of a multiplexed signal in c_Signal, this is the multiplexer signal which must have the matching value
       // If c_Signal is no multiplexed signal, this is not relevant
       stw_opensyde_core::C_OSCCanSignal c_MultiplexerSignal;
-      // And the content as information about the type
+      // And the content as information about the type (reused for decoding the received values)
       stw_opensyde_core::C_OSCNodeDataPoolContent c_ElementContent;
    };
 
    C_SyvComDriverThread * mpc_AsyncThread; ///< Thread for handling all async messages
-   C_SyvComPollingThreadDiag mc_PollingThread;
+   stw_types::uint32 mu32_CycleActivityCount; ///< Received CAN messages and async events in current cycle
+   stw_types::uint32 mu32_IdleWaitTime;       ///< Current waiting time of thread in ms if there is no activity
+   // Polling threads for services of the application. Nodes reached via the same first node of their route share one
+   // thread, so there is never more than one outstanding request on one route. All threads may run in parallel.
+   std::vector<C_SyvComPollingThreadDiag *> mc_PollingThreads;
+   std::vector<stw_types::uint32> mc_PollingThreadIndexes; ///< Index of used polling thread for each active node
 
    std::vector<stw_opensyde_core::C_OSCDiagProtocolBase *> mc_DiagProtocols; ///< Holds created
                                                                              // instances
@@ -171,6 +180,8 @@ private:
    void m_InitDiagProtocolKfx(stw_opensyde_core::C_OSCDiagProtocolKfx * const opc_DiagProtocolKefex) const;
    stw_types::sint32 m_InitDiagProtocol(void);
    stw_types::sint32 m_InitDataDealer(void);
+   void m_InitPollingThreads(void);
+   C_SyvComPollingThreadDiag * m_GetPollingThread(const stw_types::uint32 ou32_ActiveIndex) const;
    stw_types::sint32 m_StartRoutingDiag(QString & orc_ErrorDetails, std::set<stw_types::uint32> & orc_ErrorActiveNodes);
    stw_types::sint32 m_StartDiagServers(QString & orc_ErrorDetails);
    stw_types::sint32 m_GetAllDatapoolMetadata(const stw_types::uint32 ou32_ActiveNodeIndex, QString & orc_ErrorDetails);
@@ -182,6 +193,9 @@ private:
                                                stw_opensyde_core::C_OSCProtocolDriverOsy::C_DataPoolMetaData & orc_Metadata)
    const;
 
+   static const stw_types::uint32 mhu32_TESTER_PRESENT_INTERVAL = 1000U; ///< ms
+   static const stw_types::uint32 mhu32_MAXIMUM_IDLE_WAIT_TIME = 1U;     ///< ms
+
    stw_types::sint32 m_Cycle(void);
    static void mh_ThreadFunc(void * const opv_Instance);
    void m_ThreadFunc(void);
@@ -13,6 +13,7 @@
 #include "C_SyvComDriverThread.h"
 
 /* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
 using namespace stw_opensyde_gui_logic;
 
 /* -- Module Global Constants --------------------------------------------------------------------------------------- */
@@ -39,10 +40,44 @@ C_SyvComDriverThread::C_SyvComDriverThread(const PR_ThreadFunction opr_ThreadFun
                                            QObject * const opc_Parent) :
    QThread(opc_Parent),
    mpr_ThreadFunc(opr_ThreadFunc),
-   mpv_FuncInstance(opv_Instance)
+   mpv_FuncInstance(opv_Instance),
+   mq_WakeupRequested(false)
 {
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wake up the thread function waiting in WaitForWakeup
+
+   Can be called by any thread. If the thread function is not waiting, the next WaitForWakeup returns immediately.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverThread::Wakeup(void)
+{
+   this->mc_WakeupMutex.lock();
+   this->mq_WakeupRequested = true;
+   this->mc_WakeupCondition.wakeAll();
+   this->mc_WakeupMutex.unlock();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Wait until timeout, call of Wakeup or interruption request
+
+   To be called by the thread function instead of a fixed sleep.
+
+   \param[in]  ou32_TimeoutMs   Maximum waiting time in ms
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComDriverThread::WaitForWakeup(const uint32 ou32_TimeoutMs)
+{
+   this->mc_WakeupMutex.lock();
+   if ((this->mq_WakeupRequested == false) && (this->isInterruptionRequested() == false))
+   {
+      (void)this->mc_WakeupCondition.wait(&this->mc_WakeupMutex, static_cast<unsigned long>(ou32_TimeoutMs));
+   }
+   this->mq_WakeupRequested = false;
+   this->mc_WakeupMutex.unlock();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Thread function which is executed by the thread
 */
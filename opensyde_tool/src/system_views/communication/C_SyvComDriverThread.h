@@ -13,6 +13,10 @@
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "stwtypes.h"
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 namespace stw_opensyde_gui_logic
@@ -32,6 +36,9 @@ public:
    C_SyvComDriverThread(PR_ThreadFunction const opr_ThreadFunc, void * const opv_Instance,
                         QObject * const opc_Parent = NULL);
 
+   void Wakeup(void);
+   void WaitForWakeup(const stw_types::uint32 ou32_TimeoutMs);
+
 protected:
    virtual void run(void);
 
@@ -42,6 +49,9 @@ private:
 
    const PR_ThreadFunction mpr_ThreadFunc;
    void * const mpv_FuncInstance;
+   QMutex mc_WakeupMutex;
+   QWaitCondition mc_WakeupCondition;
+   bool mq_WakeupRequested; ///< Protected by mc_WakeupMutex
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
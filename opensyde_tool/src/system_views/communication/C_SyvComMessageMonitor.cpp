@@ -263,7 +263,7 @@ sint32 C_SyvComMessageMonitor::GetDbcFile(const C_SCLString & orc_PathDbc,
 {
    sint32 s32_Return = C_RANGE;
 
-   std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition>::iterator c_ItDbc;
+   std::map<stw_scl::C_SCLString, std::shared_ptr<const C_CieConverter::C_CIECommDefinition> >::const_iterator c_ItDbc;
 
    this->mc_CriticalSectionConfig.Acquire();
 
@@ -271,7 +271,7 @@ sint32 C_SyvComMessageMonitor::GetDbcFile(const C_SCLString & orc_PathDbc,
    if (c_ItDbc != this->mc_DbcFiles.end())
    {
       // Copy the DBC definition
-      orc_DbcDefinition = c_ItDbc->second;
+      orc_DbcDefinition = *c_ItDbc->second;
       s32_Return = C_NO_ERR;
    }
 
@@ -296,14 +296,16 @@ sint32 C_SyvComMessageMonitor::RemoveDatabase(const C_SCLString & orc_Path)
 {
    sint32 s32_Return = C_NOACT;
 
-   std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition>::iterator c_ItDbc;
+   std::map<stw_scl::C_SCLString, std::shared_ptr<const C_CieConverter::C_CIECommDefinition> >::iterator c_ItDbc;
 
    this->mc_CriticalSectionConfig.Acquire();
    c_ItDbc = this->mc_DbcFiles.find(orc_Path);
    if (c_ItDbc != this->mc_DbcFiles.end())
    {
       // Remove the entry
+      // The definition itself stays valid until the receive path does not use the previous lookup anymore
       this->mc_DbcFiles.erase(c_ItDbc);
+      this->m_UpdateDbcMessageLookup();
 
       s32_Return = C_NO_ERR;
    }
@@ -336,6 +338,10 @@ sint32 C_SyvComMessageMonitor::ActivateDatabase(const C_SCLString & orc_Path, co
    //Logger handling
    this->mc_CriticalSectionConfig.Acquire();
    s32_Return = C_OSCComMessageLogger::ActivateDatabase(orc_Path, oq_Active);
+   if (s32_Return == C_NO_ERR)
+   {
+      this->m_UpdateDbcMessageLookup();
+   }
    this->mc_CriticalSectionConfig.Release();
 
    return s32_Return;
@@ -852,11 +858,18 @@ bool C_SyvComMessageMonitor::m_InterpretSysDef(C_OSCComMessageLoggerData & orc_M
 bool C_SyvComMessageMonitor::m_CheckInterpretation(stw_opensyde_core::C_OSCComMessageLoggerData & orc_MessageData)
 {
    bool q_Return = false;
-   const C_CieConverter::C_CIECanMessage * pc_DbcMessage = this->m_CheckDbcFile(orc_MessageData.c_CanMsg);
+   // No lock necessary: the lookup and the referenced DBC definitions are not changed anymore after publishing and
+   // are kept alive by this reference until the interpretation is finished
+   const std::shared_ptr<const C_DbcMessageLookup> c_Lookup = std::atomic_load(&this->mc_DbcMessageLookup);
 
-   if (pc_DbcMessage != NULL)
+   if (c_Lookup.get() != NULL)
    {
-      q_Return = this->m_InterpretDbcFile(pc_DbcMessage, orc_MessageData);
+      const C_CieConverter::C_CIECanMessage * const pc_DbcMessage = c_Lookup->Find(orc_MessageData.c_CanMsg);
+
+      if (pc_DbcMessage != NULL)
+      {
+         q_Return = this->m_InterpretDbcFile(pc_DbcMessage, orc_MessageData);
+      }
    }
    return q_Return;
 }
@@ -921,13 +934,19 @@ sint32 C_SyvComMessageMonitor::m_AddDbcFile(const C_SCLString & orc_PathDbc)
       if ((s32_Return == C_NO_ERR) ||
           (s32_Return == C_WARN))
       {
+         const std::shared_ptr<const C_CieConverter::C_CIECommDefinition> c_SharedDefinition =
+            std::make_shared<const C_CieConverter::C_CIECommDefinition>(c_DbcDefinition);
+
          this->mc_CriticalSectionConfig.Acquire();
-         this->mc_DbcFiles.insert(std::pair<C_SCLString, C_CieConverter::C_CIECommDefinition>(orc_PathDbc,
-                                                                                              c_DbcDefinition));
+         this->mc_DbcFiles.insert(
+            std::pair<C_SCLString, std::shared_ptr<const C_CieConverter::C_CIECommDefinition> >(orc_PathDbc,
+                                                                                                 c_SharedDefinition));
 
          // Register the database in the activation flag map
          this->mc_DatabaseActiveFlags.insert(std::pair<C_SCLString, bool>(orc_PathDbc, true));
 
+         this->m_UpdateDbcMessageLookup();
+
          this->mc_CriticalSectionConfig.Release();
       }
    }
@@ -936,107 +955,63 @@ sint32 C_SyvComMessageMonitor::m_AddDbcFile(const C_SCLString & orc_PathDbc)
 }
 
 //----------------------------------------------------------------------------------------------------------------------
-/*! \brief   Checks if a matching CAN message is defined in at least one registered DBC file
+/*! \brief   Rebuilds the lookup of all messages of the active DBC files and publishes it for the receive path
 
-   This function is thread safe.
-
-   \param[in]  orc_Msg  Current CAN message
-
-   \return
-   Pointer     Matching CAN message found and pointer to message is returned
-   NULL        No matching CAN message found
+   Must be called with locked mc_CriticalSectionConfig after each change of the DBC files or their activation.
+   If a CAN ID is used more than once, the first message of the first DBC file is registered
+   (Tx messages of all nodes, then Rx messages, then unmapped messages).
 */
 //----------------------------------------------------------------------------------------------------------------------
-const C_CieConverter::C_CIECanMessage * C_SyvComMessageMonitor::m_CheckDbcFile(const T_STWCAN_Msg_RX & orc_Msg)
+void C_SyvComMessageMonitor::m_UpdateDbcMessageLookup(void)
 {
-   const C_CieConverter::C_CIECanMessage * pc_DbcMessage = NULL;
+   const std::shared_ptr<C_DbcMessageLookup> c_Lookup = std::make_shared<C_DbcMessageLookup>();
 
-   std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition>::const_iterator c_ItDbc;
+   std::map<stw_scl::C_SCLString, std::shared_ptr<const C_CieConverter::C_CIECommDefinition> >::const_iterator c_ItDbc;
 
-   this->mc_CriticalSectionConfig.Acquire();
-
-   // Search for CAN message in all DBC files
    for (c_ItDbc = this->mc_DbcFiles.begin(); c_ItDbc != this->mc_DbcFiles.end(); ++c_ItDbc)
    {
+      const std::map<stw_scl::C_SCLString, bool>::const_iterator c_ItFlag =
+         this->mc_DatabaseActiveFlags.find(c_ItDbc->first);
+
       // Check if the database is active
-      if (this->mc_DatabaseActiveFlags[c_ItDbc->first] == true)
+      if ((c_ItFlag != this->mc_DatabaseActiveFlags.end()) && (c_ItFlag->second == true))
       {
+         const C_CieConverter::C_CIECommDefinition & rc_Definition = *c_ItDbc->second;
          uint32 u32_NodeCounter;
 
+         c_Lookup->c_Definitions.push_back(c_ItDbc->second);
+
          //Nodes
-         for (u32_NodeCounter = 0U; u32_NodeCounter < c_ItDbc->second.c_Nodes.size(); ++u32_NodeCounter)
+         for (u32_NodeCounter = 0U; u32_NodeCounter < rc_Definition.c_Nodes.size(); ++u32_NodeCounter)
          {
-            const C_CieConverter::C_CIENode & rc_Node = c_ItDbc->second.c_Nodes[u32_NodeCounter];
+            const C_CieConverter::C_CIENode & rc_Node = rc_Definition.c_Nodes[u32_NodeCounter];
             uint32 u32_MsgCounter;
 
             for (u32_MsgCounter = 0U; u32_MsgCounter < rc_Node.c_TxMessages.size(); ++u32_MsgCounter)
             {
-               const C_CieConverter::C_CIECanMessage & rc_Msg = rc_Node.c_TxMessages[u32_MsgCounter].c_CanMessage;
-
-               // No check of dlc here, it will be checked for each signal
-               if ((orc_Msg.u32_ID == rc_Msg.u32_CanId) &&
-                   ((orc_Msg.u8_XTD == 1U) == rc_Msg.q_IsExtended))
-               {
-                  // Matching CAN message found
-                  pc_DbcMessage = &rc_Msg;
-                  break;
-               }
+               c_Lookup->Add(rc_Node.c_TxMessages[u32_MsgCounter].c_CanMessage);
             }
-
-            if (pc_DbcMessage == NULL)
+            for (u32_MsgCounter = 0U; u32_MsgCounter < rc_Node.c_RxMessages.size(); ++u32_MsgCounter)
             {
-               // Not found yet, search in Rx messages
-               for (u32_MsgCounter = 0U; u32_MsgCounter < rc_Node.c_RxMessages.size(); ++u32_MsgCounter)
-               {
-                  const C_CieConverter::C_CIECanMessage & rc_Msg = rc_Node.c_RxMessages[u32_MsgCounter].c_CanMessage;
-
-                  // No check of dlc here, it will be checked for each signal
-                  if ((orc_Msg.u32_ID == rc_Msg.u32_CanId) &&
-                      ((orc_Msg.u8_XTD == 1U) == rc_Msg.q_IsExtended))
-                  {
-                     // Matching CAN message found
-                     pc_DbcMessage = &rc_Msg;
-                     break;
-                  }
-               }
-            }
-
-            if (pc_DbcMessage != NULL)
-            {
-               break;
+               c_Lookup->Add(rc_Node.c_RxMessages[u32_MsgCounter].c_CanMessage);
             }
          }
 
          //Unmapped messages
-         if (pc_DbcMessage == NULL)
+         for (uint32 u32_ItMessage = 0U; u32_ItMessage < rc_Definition.c_UnmappedMessages.size(); ++u32_ItMessage)
          {
-            for (uint32 u32_ItMessage = 0U; u32_ItMessage < c_ItDbc->second.c_UnmappedMessages.size(); ++u32_ItMessage)
-            {
-               const C_CieConverter::C_CIECanMessage & rc_Msg =
-                  c_ItDbc->second.c_UnmappedMessages[u32_ItMessage].c_CanMessage;
-
-               // No check of dlc here, it will be checked for each signal
-               if ((orc_Msg.u32_ID == rc_Msg.u32_CanId) &&
-                   ((orc_Msg.u8_XTD == 1U) == rc_Msg.q_IsExtended))
-               {
-                  // Matching CAN message found
-                  pc_DbcMessage = &rc_Msg;
-                  break;
-               }
-            }
+            c_Lookup->Add(rc_Definition.c_UnmappedMessages[u32_ItMessage].c_CanMessage);
          }
       }
    }
 
-   this->mc_CriticalSectionConfig.Release();
-
-   return pc_DbcMessage;
+   std::atomic_store(&this->mc_DbcMessageLookup, std::shared_ptr<const C_DbcMessageLookup>(c_Lookup));
 }
 
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Checks if a matching CAN message is defined in at least one registered DBC file and interprets the data
 
-   This function is thread safe.
+   This function is thread safe as long as opc_DbcMessage is part of a published DBC message lookup.
 
    \param[in]      opc_DbcMessage   Detected DBC message for current CAN message
    \param[in,out]  orc_MessageData  Message data target for the interpretation
@@ -1051,8 +1026,6 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CIECanMe
 {
    bool q_Return = false;
 
-   this->mc_CriticalSectionConfig.Acquire();
-
    if (opc_DbcMessage != NULL)
    {
       uint32 u32_Counter;
@@ -1124,8 +1097,6 @@ bool C_SyvComMessageMonitor::m_InterpretDbcFile(const C_CieConverter::C_CIECanMe
       q_Return = true;
    }
 
-   this->mc_CriticalSectionConfig.Release();
-
    return q_Return;
 }
 
@@ -1226,3 +1197,71 @@ void C_SyvComMessageMonitor::m_ThreadFunc(void)
 
    this->mpc_LoadingThread->requestInterruption();
 }
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvComMessageMonitor::C_DbcMessageLookup::C_DbcMessageLookup(void) :
+   mc_MessagesStandardId(0x800U, NULL)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Registers a DBC message
+
+   An already registered message with the same CAN ID is not replaced.
+
+   \param[in]  orc_Message  DBC message (must stay valid as long as the lookup is used)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvComMessageMonitor::C_DbcMessageLookup::Add(const C_CieConverter::C_CIECanMessage & orc_Message)
+{
+   if ((orc_Message.q_IsExtended == false) && (orc_Message.u32_CanId < this->mc_MessagesStandardId.size()))
+   {
+      if (this->mc_MessagesStandardId[orc_Message.u32_CanId] == NULL)
+      {
+         this->mc_MessagesStandardId[orc_Message.u32_CanId] = &orc_Message;
+      }
+   }
+   else
+   {
+      // Same key format as the system definition message index of the logger
+      const uint32 u32_Key = mh_GetMessageIndexKey(orc_Message.u32_CanId, orc_Message.q_IsExtended);
+      this->mc_MessagesExtendedId.insert(
+         std::pair<uint32, const C_CieConverter::C_CIECanMessage *>(u32_Key, &orc_Message));
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Searches the DBC message of a received CAN message
+
+   \param[in]  orc_Msg  Received CAN message
+
+   \return
+   Pointer     Matching DBC message
+   NULL        No matching DBC message registered
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_CieConverter::C_CIECanMessage * C_SyvComMessageMonitor::C_DbcMessageLookup::Find(
+   const T_STWCAN_Msg_RX & orc_Msg) const
+{
+   const C_CieConverter::C_CIECanMessage * pc_Message = NULL;
+
+   if ((orc_Msg.u8_XTD != 1U) && (orc_Msg.u32_ID < this->mc_MessagesStandardId.size()))
+   {
+      pc_Message = this->mc_MessagesStandardId[orc_Msg.u32_ID];
+   }
+   else
+   {
+      const uint32 u32_Key = mh_GetMessageIndexKey(orc_Msg.u32_ID, (orc_Msg.u8_XTD == 1U));
+      const std::map<uint32, const C_CieConverter::C_CIECanMessage *>::const_iterator c_It =
+         this->mc_MessagesExtendedId.find(u32_Key);
+      if (c_It != this->mc_MessagesExtendedId.end())
+      {
+         pc_Message = c_It->second;
+      }
+   }
+
+   return pc_Message;
+}
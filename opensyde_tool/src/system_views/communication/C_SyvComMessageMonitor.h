@@ -12,6 +12,7 @@
 #define C_SYVCOMMESSAGEMONITOR_H
 
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <memory>
 #include <QString>
 #include <QList>
 #include <QVector>
@@ -118,12 +119,30 @@ private:
       eADD_DBC_FILE
    };
 
+   // Immutable lookup of the messages of all active DBC files by CAN ID
+   class C_DbcMessageLookup
+   {
+   public:
+      C_DbcMessageLookup(void);
+
+      void Add(const C_CieConverter::C_CIECanMessage & orc_Message);
+      const C_CieConverter::C_CIECanMessage * Find(const stw_can::T_STWCAN_Msg_RX & orc_Msg) const;
+
+      // Keeps the referenced DBC definitions alive as long as the lookup is used
+      std::vector<std::shared_ptr<const C_CieConverter::C_CIECommDefinition> > c_Definitions;
+
+   private:
+      std::vector<const C_CieConverter::C_CIECanMessage *> mc_MessagesStandardId;
+      // Extended IDs and out of range standard IDs (key see C_OSCComMessageLogger::mh_GetMessageIndexKey)
+      std::map<stw_types::uint32, const C_CieConverter::C_CIECanMessage *> mc_MessagesExtendedId;
+   };
+
    //Avoid call
    C_SyvComMessageMonitor(const C_SyvComMessageMonitor &);
    C_SyvComMessageMonitor & operator =(const C_SyvComMessageMonitor &);
 
    stw_types::sint32 m_AddDbcFile(const stw_scl::C_SCLString & orc_PathDbc);
-   const C_CieConverter::C_CIECanMessage * m_CheckDbcFile(const stw_can::T_STWCAN_Msg_RX & orc_Msg);
+   void m_UpdateDbcMessageLookup(void);
    bool m_InterpretDbcFile(const C_CieConverter::C_CIECanMessage * const opc_DbcMessage,
                            stw_opensyde_core::C_OSCComMessageLoggerData & orc_MessageData) const;
    static void mh_InterpretDbcFileCanSignal(stw_opensyde_core::C_OSCComMessageLoggerData & orc_MessageData,
@@ -158,7 +177,9 @@ private:
    stw_types::uint32 mu32_FilteredMessages;
 
    // DBC files
-   std::map<stw_scl::C_SCLString, C_CieConverter::C_CIECommDefinition> mc_DbcFiles;
+   std::map<stw_scl::C_SCLString, std::shared_ptr<const C_CieConverter::C_CIECommDefinition> > mc_DbcFiles;
+   // Snapshot for the receive path. Only accessed with std::atomic_load and std::atomic_store.
+   std::shared_ptr<const C_DbcMessageLookup> mc_DbcMessageLookup;
 };
 
 /* -- Extern Global Variables --------------------------------------------------------------------------------------- */
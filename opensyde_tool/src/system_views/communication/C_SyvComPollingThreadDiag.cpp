@@ -84,6 +84,7 @@ void C_SyvComPollingThreadDiag::m_SetRunParams(const C_SyvComPollingThreadDiag::
    mpc_Dealer = &orc_Dealer;
    mu8_DataPoolIndex = ou8_DataPoolIndex;
    mu16_ListIndex = ou16_ListIndex;
+   mu16_ElementIndex = 0U;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -100,6 +101,9 @@ void C_SyvComPollingThreadDiag::m_SetRunParams(const C_SyvComPollingThreadDiag::
 {
    me_Service = oe_Service;
    mpc_Dealer = &orc_Dealer;
+   mu8_DataPoolIndex = 0U;
+   mu16_ListIndex = 0U;
+   mu16_ElementIndex = 0U;
    mc_ListIds = orc_ListIds;
 }
 
@@ -115,6 +119,9 @@ void C_SyvComPollingThreadDiag::m_SetRunParams(const C_SyvComPollingThreadDiag::
 {
    me_Service = oe_Service;
    mpc_Dealer = &orc_Dealer;
+   mu8_DataPoolIndex = 0U;
+   mu16_ListIndex = 0U;
+   mu16_ElementIndex = 0U;
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -643,6 +650,43 @@ sint32 C_SyvComPollingThreadDiag::GetNegativeResponseCode(uint8 & oru8_NRC) cons
    return s32_Return;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get the target of the previously started service execution
+
+   Services on a complete list report element index 0.
+   Services on several lists or on the whole node report Datapool, list and element index 0.
+
+   \param[out]  orc_Id   node, Datapool, list and element index the service was started for
+
+   \return
+   C_NO_ERR       ID returned
+   C_BUSY         previously started polled communication still going on
+   C_UNKNOWN_ERR  no service was started yet
+*/
+//----------------------------------------------------------------------------------------------------------------------
+sint32 C_SyvComPollingThreadDiag::GetServiceId(stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id) const
+{
+   sint32 s32_Return = C_NO_ERR;
+
+   if (this->isRunning() == true)
+   {
+      s32_Return = C_BUSY;
+   }
+   else if (this->mpc_Dealer == NULL)
+   {
+      s32_Return = C_UNKNOWN_ERR;
+   }
+   else
+   {
+      orc_Id.u32_NodeIndex = this->mpc_Dealer->GetNodeIndex();
+      orc_Id.u32_DataPoolIndex = this->mu8_DataPoolIndex;
+      orc_Id.u32_ListIndex = this->mu16_ListIndex;
+      orc_Id.u32_ElementIndex = this->mu16_ElementIndex;
+   }
+
+   return s32_Return;
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Reset flag to accept next request
 */
@@ -109,6 +109,7 @@ public:
 
    stw_types::sint32 GetResults(stw_types::sint32 & ors32_Result) const;
    stw_types::sint32 GetNegativeResponseCode(stw_types::uint8 & oru8_NRC) const;
+   stw_types::sint32 GetServiceId(stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id) const;
    void AcceptNextRequest(void);
 };
 
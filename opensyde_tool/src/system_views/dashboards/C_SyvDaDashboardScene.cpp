@@ -1067,11 +1067,14 @@ void C_SyvDaDashboardScene::UpdateTransmissionConfiguration(void) const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardScene::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC) const
+void C_SyvDaDashboardScene::HandleManualOperationFinished(
+   const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id, const sint32 os32_Result,
+   const uint8 ou8_NRC) const
 {
    const QList<QGraphicsItem *> & rc_Items = this->items();
 
@@ -1082,7 +1085,7 @@ void C_SyvDaDashboardScene::HandleManualOperationFinished(const sint32 os32_Resu
       C_GiSvDaRectBaseGroup * const pc_Item = dynamic_cast<C_GiSvDaRectBaseGroup *>(*c_ItItem);
       if (pc_Item != NULL)
       {
-         pc_Item->HandleManualOperationFinished(os32_Result, ou8_NRC);
+         pc_Item->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
       }
    }
 }
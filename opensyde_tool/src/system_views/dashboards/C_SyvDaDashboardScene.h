@@ -82,7 +82,8 @@ public:
    void ConnectionActiveChanged(const bool oq_Active) const;
    void UpdateShowValues(void) const;
    void UpdateTransmissionConfiguration(void) const;
-   void HandleManualOperationFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC) const;
+   void HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                      const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC) const;
    void SetErrorForFailedCyclicElementIdRegistrations(
       const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_FailedIdRegisters,
       const std::vector<QString> & orc_FailedIdErrorDetails) const;
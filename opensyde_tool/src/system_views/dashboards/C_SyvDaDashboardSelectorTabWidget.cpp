@@ -562,11 +562,13 @@ sint32 C_SyvDaDashboardSelectorTabWidget::GetDashboardIndexForTabIndex(const sin
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardSelectorTabWidget::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC)
+void C_SyvDaDashboardSelectorTabWidget::HandleManualOperationFinished(
+   const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id, const sint32 os32_Result, const uint8 ou8_NRC)
 {
    for (sint32 s32_Counter = 0; s32_Counter < this->count(); ++s32_Counter)
    {
@@ -576,14 +578,14 @@ void C_SyvDaDashboardSelectorTabWidget::HandleManualOperationFinished(const sint
 
       if (pc_WidgetRef != NULL)
       {
-         pc_WidgetRef->HandleManualOperationFinished(os32_Result, ou8_NRC);
+         pc_WidgetRef->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
       }
    }
 
    for (QList<C_SyvDaTearOffWidget *>::const_iterator c_ItItem = this->mc_TearedOffWidgets.begin();
         c_ItItem != this->mc_TearedOffWidgets.end(); ++c_ItItem)
    {
-      (*c_ItItem)->HandleManualOperationFinished(os32_Result, ou8_NRC);
+      (*c_ItItem)->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
    }
 }
 
@@ -55,7 +55,8 @@ public:
    void UpdateTransmissionConfiguration(void);
    stw_types::sint32 GetDashboardIndexForTabIndex(const stw_types::sint32 os32_TabIndex,
                                                   stw_types::uint32 & oru32_DashboardIndex) const;
-   void HandleManualOperationFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
+   void HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                      const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
    void SetErrorForFailedCyclicElementIdRegistrations(
       const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_FailedIdRegisters,
       const std::vector<QString> & orc_FailedIdErrorDetails);
@@ -323,15 +323,18 @@ void C_SyvDaDashboardWidget::UpdateTransmissionConfiguration(void) const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardWidget::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC) const
+void C_SyvDaDashboardWidget::HandleManualOperationFinished(
+   const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id, const sint32 os32_Result,
+   const uint8 ou8_NRC) const
 {
    if (this->mpc_Scene != NULL)
    {
-      this->mpc_Scene->HandleManualOperationFinished(os32_Result, ou8_NRC);
+      this->mpc_Scene->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
    }
 }
 
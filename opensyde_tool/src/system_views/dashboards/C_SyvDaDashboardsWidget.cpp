@@ -919,57 +919,74 @@ void C_SyvDaDashboardsWidget::m_NvmReadList(const C_OSCNodeDataPoolListId & orc_
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaDashboardsWidget::m_HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC)
+void C_SyvDaDashboardsWidget::m_HandleManualOperationFinished(const C_OSCNodeDataPoolListElementId & orc_Id,
+                                                              const sint32 os32_Result, const uint8 ou8_NRC)
 {
-   this->mpc_Ui->pc_TabWidget->HandleManualOperationFinished(os32_Result, ou8_NRC);
+   this->mpc_Ui->pc_TabWidget->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
    if (this->mpc_ComDriver != NULL)
    {
-      if (this->mc_MissedReadNvmOperations.size() > 0)
+      // Operations of nodes on different routes are executed in parallel,
+      // so retry all missed operations; the ones of still busy nodes stay missed
+      std::set<C_OSCNodeDataPoolListId>::iterator c_ItNvmList = this->mc_MissedReadNvmOperations.begin();
+      std::set<C_OSCNodeDataPoolListElementId>::iterator c_ItElement;
+
+      while (c_ItNvmList != this->mc_MissedReadNvmOperations.end())
       {
-         const C_OSCNodeDataPoolListId c_Id = *this->mc_MissedReadNvmOperations.begin();
+         const C_OSCNodeDataPoolListId c_Id = *c_ItNvmList;
          const sint32 s32_Return =
             this->mpc_ComDriver->PollNvmReadList(c_Id.u32_NodeIndex, static_cast<uint8>(c_Id.u32_DataPoolIndex),
                                                  static_cast<uint16>(c_Id.u32_ListIndex));
          //Error handling
          if (s32_Return != C_BUSY)
          {
-            this->mc_MissedReadNvmOperations.erase(this->mc_MissedReadNvmOperations.begin());
+            c_ItNvmList = this->mc_MissedReadNvmOperations.erase(c_ItNvmList);
+         }
+         else
+         {
+            ++c_ItNvmList;
          }
       }
-      else
+
+      c_ItElement = this->mc_MissedReadOperations.begin();
+      while (c_ItElement != this->mc_MissedReadOperations.end())
+      {
+         const C_OSCNodeDataPoolListElementId c_Id = *c_ItElement;
+         const sint32 s32_Return =
+            this->mpc_ComDriver->PollDataPoolRead(c_Id.u32_NodeIndex, static_cast<uint8>(c_Id.u32_DataPoolIndex),
+                                                  static_cast<uint16>(c_Id.u32_ListIndex),
+                                                  static_cast<uint16>(c_Id.u32_ElementIndex));
+         //Error handling
+         if (s32_Return != C_BUSY)
+         {
+            c_ItElement = this->mc_MissedReadOperations.erase(c_ItElement);
+         }
+         else
+         {
+            ++c_ItElement;
+         }
+      }
+
+      c_ItElement = this->mc_MissedWriteOperations.begin();
+      while (c_ItElement != this->mc_MissedWriteOperations.end())
       {
-         if (this->mc_MissedReadOperations.size() > 0)
+         const C_OSCNodeDataPoolListElementId c_Id = *c_ItElement;
+         const sint32 s32_Return =
+            this->mpc_ComDriver->PollDataPoolWrite(c_Id.u32_NodeIndex, static_cast<uint8>(c_Id.u32_DataPoolIndex),
+                                                   static_cast<uint16>(c_Id.u32_ListIndex),
+                                                   static_cast<uint16>(c_Id.u32_ElementIndex));
+         //Error handling
+         if (s32_Return != C_BUSY)
          {
-            const C_OSCNodeDataPoolListElementId c_Id = *this->mc_MissedReadOperations.begin();
-            const sint32 s32_Return =
-               this->mpc_ComDriver->PollDataPoolRead(c_Id.u32_NodeIndex, static_cast<uint8>(c_Id.u32_DataPoolIndex),
-                                                     static_cast<uint16>(c_Id.u32_ListIndex),
-                                                     static_cast<uint16>(c_Id.u32_ElementIndex));
-            //Error handling
-            if (s32_Return != C_BUSY)
-            {
-               this->mc_MissedReadOperations.erase(this->mc_MissedReadOperations.begin());
-            }
+            c_ItElement = this->mc_MissedWriteOperations.erase(c_ItElement);
          }
          else
          {
-            if (this->mc_MissedWriteOperations.size() > 0)
-            {
-               const C_OSCNodeDataPoolListElementId c_Id = *this->mc_MissedWriteOperations.begin();
-               const sint32 s32_Return =
-                  this->mpc_ComDriver->PollDataPoolWrite(c_Id.u32_NodeIndex, static_cast<uint8>(c_Id.u32_DataPoolIndex),
-                                                         static_cast<uint16>(c_Id.u32_ListIndex),
-                                                         static_cast<uint16>(c_Id.u32_ElementIndex));
-               //Error handling
-               if (s32_Return != C_BUSY)
-               {
-                  this->mc_MissedWriteOperations.erase(this->mc_MissedWriteOperations.begin());
-               }
-            }
+            ++c_ItElement;
          }
       }
    }
@@ -94,7 +94,8 @@ private:
                         const stw_types::uint16 ou16_ListIndex, const stw_types::uint16 ou16_ElementIndex);
    void m_DataPoolRead(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Index);
    void m_NvmReadList(const stw_opensyde_core::C_OSCNodeDataPoolListId & orc_Index);
-   void m_HandleManualOperationFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
+   void m_HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                        const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
    void m_ConnectStepFinished(void);
    void m_HandleConnectionResult(const stw_types::sint32 os32_Result, const QString & orc_Message,
                                  const QString & orc_MessageDetails);
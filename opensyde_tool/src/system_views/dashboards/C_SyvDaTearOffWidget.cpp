@@ -305,15 +305,18 @@ void C_SyvDaTearOffWidget::Save(void) const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        Negative response code, if any
 */
 //----------------------------------------------------------------------------------------------------------------------
-void C_SyvDaTearOffWidget::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC) const
+void C_SyvDaTearOffWidget::HandleManualOperationFinished(
+   const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id, const sint32 os32_Result,
+   const uint8 ou8_NRC) const
 {
    if (this->mpc_Dashboard != NULL)
    {
-      this->mpc_Dashboard->HandleManualOperationFinished(os32_Result, ou8_NRC);
+      this->mpc_Dashboard->HandleManualOperationFinished(orc_Id, os32_Result, ou8_NRC);
    }
 }
 
@@ -54,7 +54,8 @@ public:
    void SetDarkMode(const bool oq_Active);
    void SetEnabled(const bool oq_Enabled) const;
    void Save(void) const;
-   void HandleManualOperationFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC) const;
+   void HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                      const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC) const;
    void SetErrorForFailedCyclicElementIdRegistrations(
       const std::vector<stw_opensyde_core::C_OSCNodeDataPoolListElementId> & orc_FailedIdRegisters,
       const std::vector<QString> & orc_FailedIdErrorDetails) const;
@@ -0,0 +1,302 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Fixed capacity sample buffer of one chart data series (implementation)
+
+   Stores the received samples of one chart data series in a ring buffer.
+   If the capacity is reached the oldest samples are overwritten, so memory usage stays constant
+   however long the chart is running.
+
+   For drawing only the samples of the visible time range are needed. These are reduced with M4 decimation:
+   the range is split into one bucket per pixel and of each bucket only the first, minimum, maximum and last
+   sample are kept. The drawn line is the same as with all samples, but the number of points handed to the
+   chart does not depend on the sample rate anymore.
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include "precomp_headers.h"
+
+#include <algorithm>
+
+#include "C_SyvDaItChartDataSerieBuffer.h"
+
+/* -- Used Namespaces ----------------------------------------------------------------------------------------------- */
+using namespace stw_types;
+using namespace stw_opensyde_gui_logic;
+
+/* -- Module Global Constants --------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+/* -- Global Variables ---------------------------------------------------------------------------------------------- */
+
+/* -- Module Global Variables --------------------------------------------------------------------------------------- */
+
+/* -- Module Global Function Prototypes ----------------------------------------------------------------------------- */
+
+/* -- Implementation ------------------------------------------------------------------------------------------------ */
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Default constructor
+
+   \param[in]  ou32_Capacity  Maximum number of stored samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+C_SyvDaItChartDataSerieBuffer::C_SyvDaItChartDataSerieBuffer(const uint32 ou32_Capacity) :
+   mu32_Capacity((ou32_Capacity > 0U) ? ou32_Capacity : 1U),
+   mu32_Start(0U)
+{
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Remove all samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartDataSerieBuffer::Clear(void)
+{
+   this->mc_Samples.clear();
+   this->mu32_Start = 0U;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Add sample
+
+   The time of the samples must not decrease. If the buffer is full the oldest sample is replaced.
+
+   \param[in]  of64_Time   Time of sample
+   \param[in]  of64_Value  Value of sample
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartDataSerieBuffer::Append(const float64 of64_Time, const float64 of64_Value)
+{
+   C_Sample c_Sample;
+
+   c_Sample.f64_Time = of64_Time;
+   c_Sample.f64_Value = of64_Value;
+
+   if (this->mc_Samples.size() < this->mu32_Capacity)
+   {
+      this->mc_Samples.push_back(c_Sample);
+   }
+   else
+   {
+      this->mc_Samples[this->mu32_Start] = c_Sample;
+      this->mu32_Start = (this->mu32_Start + 1U) % this->mu32_Capacity;
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get number of stored samples
+
+   \return
+   Number of stored samples
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvDaItChartDataSerieBuffer::GetSize(void) const
+{
+   return static_cast<uint32>(this->mc_Samples.size());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get sample
+
+   \param[in]  ou32_Index  Index of sample (0 is the oldest sample; must be smaller than GetSize())
+
+   \return
+   Sample
+*/
+//----------------------------------------------------------------------------------------------------------------------
+const C_SyvDaItChartDataSerieBuffer::C_Sample & C_SyvDaItChartDataSerieBuffer::GetSample(const uint32 ou32_Index) const
+{
+   return this->mc_Samples[(this->mu32_Start + ou32_Index) % this->mc_Samples.size()];
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Get samples to draw a time range
+
+   Contains the last sample before and the first sample after the time range so the line reaches the borders.
+   If there are more samples than four per bucket only first, minimum, maximum and last sample of each bucket
+   are returned.
+
+   \param[in]   of64_TimeMin     Start of time range
+   \param[in]   of64_TimeMax     End of time range (must be greater than of64_TimeMin; else nothing is returned)
+   \param[in]   ou32_BucketCount Number of buckets (usually width of drawing area in pixel; 0: nothing is returned)
+   \param[out]  orc_Samples      Samples in ascending time order
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartDataSerieBuffer::GetDecimatedSamples(const float64 of64_TimeMin, const float64 of64_TimeMax,
+                                                        const uint32 ou32_BucketCount,
+                                                        std::vector<C_Sample> & orc_Samples) const
+{
+   orc_Samples.clear();
+
+   // Without buckets or with an empty time range there is nothing to draw (and no valid bucket width)
+   if ((this->mc_Samples.empty() == false) && (ou32_BucketCount > 0U) && (of64_TimeMax > of64_TimeMin))
+   {
+      uint32 u32_First = this->m_LowerBound(of64_TimeMin);
+      uint32 u32_End = this->m_UpperBound(of64_TimeMax);
+
+      // Neighbors outside of the range
+      if (u32_First > 0U)
+      {
+         --u32_First;
+      }
+      if (u32_End < this->GetSize())
+      {
+         ++u32_End;
+      }
+
+      if (((u32_End - u32_First) / 4U) < ou32_BucketCount)
+      {
+         // Nothing to reduce
+         orc_Samples.reserve(u32_End - u32_First);
+         for (uint32 u32_It = u32_First; u32_It < u32_End; ++u32_It)
+         {
+            orc_Samples.push_back(this->GetSample(u32_It));
+         }
+      }
+      else
+      {
+         const float64 f64_BucketWidth = (of64_TimeMax - of64_TimeMin) / static_cast<float64>(ou32_BucketCount);
+         uint32 u32_Position = (this->mu32_Start + u32_First) % this->GetSize();
+         sint64 s64_CurrentBucket = 0;
+         uint32 au32_Selected[4] = {0U, 0U, 0U, 0U}; // first, minimum, maximum, last
+         float64 f64_Min = 0.0;
+         float64 f64_Max = 0.0;
+
+         orc_Samples.reserve((static_cast<uintn>(ou32_BucketCount) + 2U) * 4U);
+
+         // One additional iteration to finish the last bucket
+         for (uint32 u32_It = u32_First; u32_It <= u32_End; ++u32_It)
+         {
+            sint64 s64_Bucket = static_cast<sint64>(ou32_BucketCount) + 1;
+            float64 f64_Value = 0.0;
+
+            if (u32_It < u32_End)
+            {
+               // Walk the ring buffer directly, GetSample is too slow for each sample
+               const C_Sample & rc_Sample = this->mc_Samples[u32_Position];
+               ++u32_Position;
+               if (u32_Position >= this->GetSize())
+               {
+                  u32_Position = 0U;
+               }
+
+               f64_Value = rc_Sample.f64_Value;
+               if (rc_Sample.f64_Time < of64_TimeMin)
+               {
+                  s64_Bucket = -1;
+               }
+               else if (rc_Sample.f64_Time >= of64_TimeMax)
+               {
+                  s64_Bucket = static_cast<sint64>(ou32_BucketCount);
+               }
+               else
+               {
+                  // Not negative here, so truncation is the same as floor
+                  s64_Bucket = static_cast<sint64>((rc_Sample.f64_Time - of64_TimeMin) / f64_BucketWidth);
+               }
+            }
+
+            if ((u32_It == u32_First) || (s64_Bucket != s64_CurrentBucket))
+            {
+               if (u32_It != u32_First)
+               {
+                  // Finish last bucket: add selected samples in time order without duplicates
+                  std::sort(&au32_Selected[0], &au32_Selected[4]);
+                  for (uint32 u32_Selected = 0U; u32_Selected < 4U; ++u32_Selected)
+                  {
+                     if ((u32_Selected == 0U) || (au32_Selected[u32_Selected] != au32_Selected[u32_Selected - 1U]))
+                     {
+                        orc_Samples.push_back(this->GetSample(au32_Selected[u32_Selected]));
+                     }
+                  }
+               }
+               // Start new bucket
+               s64_CurrentBucket = s64_Bucket;
+               au32_Selected[0] = u32_It;
+               au32_Selected[1] = u32_It;
+               au32_Selected[2] = u32_It;
+               au32_Selected[3] = u32_It;
+               f64_Min = f64_Value;
+               f64_Max = f64_Value;
+            }
+            else
+            {
+               if (f64_Value < f64_Min)
+               {
+                  au32_Selected[1] = u32_It;
+                  f64_Min = f64_Value;
+               }
+               if (f64_Value > f64_Max)
+               {
+                  au32_Selected[2] = u32_It;
+                  f64_Max = f64_Value;
+               }
+               au32_Selected[3] = u32_It;
+            }
+         }
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find first sample not before time
+
+   \param[in]  of64_Time   Time to search for
+
+   \return
+   Index of first sample with time >= of64_Time (GetSize() if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvDaItChartDataSerieBuffer::m_LowerBound(const float64 of64_Time) const
+{
+   uint32 u32_Low = 0U;
+   uint32 u32_High = this->GetSize();
+
+   while (u32_Low < u32_High)
+   {
+      const uint32 u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->GetSample(u32_Mid).f64_Time < of64_Time)
+      {
+         u32_Low = u32_Mid + 1U;
+      }
+      else
+      {
+         u32_High = u32_Mid;
+      }
+   }
+   return u32_Low;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Find first sample after time
+
+   \param[in]  of64_Time   Time to search for
+
+   \return
+   Index of first sample with time > of64_Time (GetSize() if there is none)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+uint32 C_SyvDaItChartDataSerieBuffer::m_UpperBound(const float64 of64_Time) const
+{
+   uint32 u32_Low = 0U;
+   uint32 u32_High = this->GetSize();
+
+   while (u32_Low < u32_High)
+   {
+      const uint32 u32_Mid = u32_Low + ((u32_High - u32_Low) / 2U);
+      if (this->GetSample(u32_Mid).f64_Time > of64_Time)
+      {
+         u32_High = u32_Mid;
+      }
+      else
+      {
+         u32_Low = u32_Mid + 1U;
+      }
+   }
+   return u32_Low;
+}
@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------------------------------------------------
+/*!
+   \file
+   \brief       Fixed capacity sample buffer of one chart data series (header)
+
+   See cpp file for detailed description
+
+   \copyright   Copyright 2026 Sensor-Technik Wiedemann GmbH. All rights reserved.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef C_SYVDAITCHARTDATASERIEBUFFER_H
+#define C_SYVDAITCHARTDATASERIEBUFFER_H
+
+/* -- Includes ------------------------------------------------------------------------------------------------------ */
+#include <vector>
+#include "stwtypes.h"
+
+/* -- Namespace ----------------------------------------------------------------------------------------------------- */
+namespace stw_opensyde_gui_logic
+{
+/* -- Global Constants ---------------------------------------------------------------------------------------------- */
+
+/* -- Types --------------------------------------------------------------------------------------------------------- */
+
+class C_SyvDaItChartDataSerieBuffer
+{
+public:
+   ///One received value
+   class C_Sample
+   {
+   public:
+      stw_types::float64 f64_Time;
+      stw_types::float64 f64_Value;
+   };
+
+   ///Default capacity: 200000 samples * 16 bytes = 3.2 MB per series.
+   ///With the fastest cyclic update rate (10 ms) this keeps more than 30 minutes for scrolling back.
+   static const stw_types::uint32 hu32_DEFAULT_CAPACITY = 200000U;
+
+   explicit C_SyvDaItChartDataSerieBuffer(const stw_types::uint32 ou32_Capacity = hu32_DEFAULT_CAPACITY);
+
+   void Clear(void);
+   void Append(const stw_types::float64 of64_Time, const stw_types::float64 of64_Value);
+   stw_types::uint32 GetSize(void) const;
+   const C_Sample & GetSample(const stw_types::uint32 ou32_Index) const;
+   void GetDecimatedSamples(const stw_types::float64 of64_TimeMin, const stw_types::float64 of64_TimeMax,
+                            const stw_types::uint32 ou32_BucketCount, std::vector<C_Sample> & orc_Samples) const;
+
+private:
+   stw_types::uint32 mu32_Capacity;
+   std::vector<C_Sample> mc_Samples; ///< ring buffer, grows up to capacity
+   stw_types::uint32 mu32_Start;     ///< position of oldest sample in ring buffer
+
+   stw_types::uint32 m_LowerBound(const stw_types::float64 of64_Time) const;
+   stw_types::uint32 m_UpperBound(const stw_types::float64 of64_Time) const;
+};
+
+/* -- Extern Global Variables --------------------------------------------------------------------------------------- */
+} //end of namespace
+
+#endif
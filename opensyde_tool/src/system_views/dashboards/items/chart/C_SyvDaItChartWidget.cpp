@@ -10,7 +10,10 @@
 /* -- Includes ------------------------------------------------------------------------------------------------------ */
 #include "precomp_headers.h"
 
+#include <algorithm>
+
 #include <QPen>
+#include <QPointF>
 
 #include "stwerrors.h"
 
@@ -172,6 +175,8 @@ C_SyvDaItChartWidget::C_SyvDaItChartWidget(const uint32 ou32_ViewIndex, const ui
            this, &C_SyvDaItChartWidget::m_ZoomReseted);
    connect(this->mpc_ChartView, &C_OgeChaViewBase::SigScrolled,
            this, &C_SyvDaItChartWidget::m_Scrolled);
+   connect(this->mpc_AxisTime, &QValueAxis::rangeChanged,
+           this, &C_SyvDaItChartWidget::m_TimeAxisRangeChanged);
 
    this->SetDisplayStyle(C_PuiSvDbWidgetBase::eOPENSYDE, false);
    this->SetWidthOfDataSeriesSelector(330);
@@ -328,6 +333,7 @@ void C_SyvDaItChartWidget::SetDrawingActive(const bool oq_Active)
          }
       }
    }
+   this->m_UpdateDataSeriesPoints(true);
 }
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -703,6 +709,10 @@ bool C_SyvDaItChartWidget::RemoveDataSerie(C_PuiSvDbNodeDataPoolListElementId &
          delete this->mc_DataPoolElementsDataSeries[u32_DataPoolElementConfigIndex];
          this->mc_DataPoolElementsDataSeries.erase(
             this->mc_DataPoolElementsDataSeries.begin() + u32_DataPoolElementConfigIndex);
+         this->mc_DataPoolElementsDataBuffers.erase(
+            this->mc_DataPoolElementsDataBuffers.begin() + u32_DataPoolElementConfigIndex);
+         this->mc_DataPoolElementsDataChanged.erase(
+            this->mc_DataPoolElementsDataChanged.begin() + u32_DataPoolElementConfigIndex);
       }
 
       // Remove used color
@@ -747,6 +757,7 @@ bool C_SyvDaItChartWidget::RemoveDataSerie(C_PuiSvDbNodeDataPoolListElementId &
          tgl_assert(this->mc_Data.RemoveElement(u32_DataPoolElementConfigIndex) == C_NO_ERR);
          this->mc_DataPoolElementContentMin.erase(
             this->mc_DataPoolElementContentMin.begin() + u32_DataPoolElementConfigIndex);
+         this->m_UpdateElementIdToDataPoolElementConfigIndexes();
       }
    }
 
@@ -832,19 +843,21 @@ void C_SyvDaItChartWidget::AddDataSerieContent(const C_PuiSvDbNodeDataPoolListEl
                                                const QVector<uint32> & orc_Timestamps)
 {
    // Find the correct data series
-   if (orc_Values.size() > 0)
-   {
-      uint32 u32_ConfigCounter;
+   const std::map<C_PuiSvDbNodeDataPoolListElementId, std::vector<uint32> >::const_iterator c_ItIndexes =
+      this->mc_ElementIdToDataPoolElementConfigIndexes.find(orc_DataPoolElementId);
 
-      for (u32_ConfigCounter = 0U; u32_ConfigCounter < this->mc_Data.c_DataPoolElementsConfig.size();
-           ++u32_ConfigCounter)
+   if ((orc_Values.size() > 0) && (c_ItIndexes != this->mc_ElementIdToDataPoolElementConfigIndexes.end()))
+   {
+      for (uint32 u32_It = 0U; u32_It < c_ItIndexes->second.size(); ++u32_It)
       {
+         const uint32 u32_ConfigCounter = c_ItIndexes->second[u32_It];
          const C_PuiSvDbNodeDataPoolListElementId & rc_CurDataPoolElementId =
             this->mc_Data.c_DataPoolElementsConfig[u32_ConfigCounter].c_ElementId;
          if ((rc_CurDataPoolElementId == orc_DataPoolElementId) &&
              (u32_ConfigCounter < this->mc_DataPoolElementsDataSeries.size()))
          {
             QLineSeries * const pc_LineSerie = this->mc_DataPoolElementsDataSeries[u32_ConfigCounter];
+            C_SyvDaItChartDataSerieBuffer & rc_Buffer = this->mc_DataPoolElementsDataBuffers[u32_ConfigCounter];
 
             if (pc_LineSerie != NULL)
             {
@@ -919,8 +932,10 @@ void C_SyvDaItChartWidget::AddDataSerieContent(const C_PuiSvDbNodeDataPoolListEl
                      }
                   }
 
-                  pc_LineSerie->append(f64_Timestamp, f64_Value);
+                  rc_Buffer.Append(f64_Timestamp, f64_Value);
                }
+               // Line series gets updated with the next time axis update
+               this->mc_DataPoolElementsDataChanged[u32_ConfigCounter] = true;
 
                // Show the last value in the selector widget
                C_OSCNodeDataPoolContentUtil::h_SetValueInContent(f64_Value, c_Tmp, u32_Index);
@@ -984,11 +999,12 @@ void C_SyvDaItChartWidget::UpdateTimeAxis(void)
          this->mf64_MaxTime = static_cast<float64>(u32_NextTimeStamp);
 
          // Do not use the new maximum for the axis. In case of zooming, we need an dynamic adaption
-         this->mpc_AxisTime->setMax(this->mpc_AxisTime->max() + f64_Diff);
-
-         // Adapt minimum
-         this->mpc_AxisTime->setMin(this->mpc_AxisTime->min() + f64_Diff);
+         // Adapt minimum too (in one call, so the line series get updated only once)
+         this->mpc_AxisTime->setRange(this->mpc_AxisTime->min() + f64_Diff, this->mpc_AxisTime->max() + f64_Diff);
       }
+
+      // Show the new values of the line series not updated by the range change
+      this->m_UpdateDataSeriesPoints(false);
    }
 }
 
@@ -1153,6 +1169,9 @@ void C_SyvDaItChartWidget::m_AddDataSerie(const stw_types::uint32 ou32_DataPoolE
    pc_Serie->attachAxis(this->mpc_AxisValueInvisible);
    pc_Serie->setVisible(this->mc_Data.c_DataPoolElementsActive[ou32_DataPoolElementConfigIndex]);
    this->mc_DataPoolElementsDataSeries.push_back(pc_Serie);
+   this->mc_DataPoolElementsDataBuffers.push_back(C_SyvDaItChartDataSerieBuffer());
+   this->mc_DataPoolElementsDataChanged.push_back(false);
+   this->m_UpdateElementIdToDataPoolElementConfigIndexes();
 
    // Set the axis for the new data serie
    this->SelectDataSeriesAxis(ou32_DataPoolElementConfigIndex);
@@ -1168,6 +1187,8 @@ void C_SyvDaItChartWidget::m_ResetChart(void)
         ++u32_CounterItem)
    {
       this->mc_DataPoolElementsDataSeries[u32_CounterItem]->clear();
+      this->mc_DataPoolElementsDataBuffers[u32_CounterItem].Clear();
+      this->mc_DataPoolElementsDataChanged[u32_CounterItem] = false;
    }
 
    // Reset the range
@@ -1183,6 +1204,72 @@ void C_SyvDaItChartWidget::m_ResetChart(void)
    this->mpc_AxisTime->setMin(0.0);
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update association of data element ids to data series
+
+   Called on each change of the data element configuration.
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartWidget::m_UpdateElementIdToDataPoolElementConfigIndexes(void)
+{
+   this->mc_ElementIdToDataPoolElementConfigIndexes.clear();
+   for (uint32 u32_ConfigCounter = 0U; u32_ConfigCounter < this->mc_Data.c_DataPoolElementsConfig.size();
+        ++u32_ConfigCounter)
+   {
+      this->mc_ElementIdToDataPoolElementConfigIndexes[
+         this->mc_Data.c_DataPoolElementsConfig[u32_ConfigCounter].c_ElementId].push_back(u32_ConfigCounter);
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Hand the visible values of the data series to the line series
+
+   The values are decimated to a few points per pixel of the plot area,
+   so the drawing effort does not depend on the number of received values.
+
+   \param[in]  oq_All   true: update all line series (visible time range changed)
+                        false: update line series with new values only
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartWidget::m_UpdateDataSeriesPoints(const bool oq_All)
+{
+   const uint32 u32_BucketCount = static_cast<uint32>(std::max(this->mpc_Chart->plotArea().width(), 1.0));
+
+   for (uint32 u32_Counter = 0U; u32_Counter < this->mc_DataPoolElementsDataSeries.size(); ++u32_Counter)
+   {
+      QLineSeries * const pc_LineSerie = this->mc_DataPoolElementsDataSeries[u32_Counter];
+
+      if (((oq_All == true) || (this->mc_DataPoolElementsDataChanged[u32_Counter] == true)) &&
+          (pc_LineSerie->isVisible() == true))
+      {
+         QVector<QPointF> c_Points;
+
+         this->mc_DataPoolElementsDataBuffers[u32_Counter].GetDecimatedSamples(this->mpc_AxisTime->min(),
+                                                                              this->mpc_AxisTime->max(),
+                                                                              u32_BucketCount,
+                                                                              this->mc_VisibleSamples);
+         c_Points.reserve(static_cast<sintn>(this->mc_VisibleSamples.size()));
+         for (uint32 u32_Sample = 0U; u32_Sample < this->mc_VisibleSamples.size(); ++u32_Sample)
+         {
+            c_Points.push_back(QPointF(this->mc_VisibleSamples[u32_Sample].f64_Time,
+                                       this->mc_VisibleSamples[u32_Sample].f64_Value));
+         }
+         // Replacing all points at once is much faster than appending each point
+         pc_LineSerie->replace(c_Points);
+         this->mc_DataPoolElementsDataChanged[u32_Counter] = false;
+      }
+   }
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/*! \brief   Update line series for new visible time range (zooming, scrolling or running time)
+*/
+//----------------------------------------------------------------------------------------------------------------------
+void C_SyvDaItChartWidget::m_TimeAxisRangeChanged(void)
+{
+   this->m_UpdateDataSeriesPoints(true);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 QColor C_SyvDaItChartWidget::m_GetColor(void)
 {
@@ -1214,6 +1301,9 @@ void C_SyvDaItChartWidget::m_DataItemToggled(const stw_types::uint32 ou32_DataPo
    if (ou32_DataPoolElementConfigIndex < this->mc_DataPoolElementsDataSeries.size())
    {
       this->mc_DataPoolElementsDataSeries[ou32_DataPoolElementConfigIndex]->setVisible(oq_Checked);
+      // Hidden line series are not updated
+      this->mc_DataPoolElementsDataChanged[ou32_DataPoolElementConfigIndex] = true;
+      this->m_UpdateDataSeriesPoints(false);
    }
 
    if (ou32_DataPoolElementConfigIndex < this->mc_Data.c_DataPoolElementsActive.size())
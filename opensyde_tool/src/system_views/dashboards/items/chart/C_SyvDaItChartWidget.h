@@ -19,6 +19,7 @@
 #include <QValueAxis>
 #include <QColor>
 #include <vector>
+#include <map>
 
 /* -- Namespace ----------------------------------------------------------------------------------------------------- */
 
@@ -31,6 +32,7 @@
 #include "C_PuiSvDbNodeDataPoolListElementId.h"
 #include "C_PuiSvDbWidgetBase.h"
 #include "C_PuiSvDbChart.h"
+#include "C_SyvDaItChartDataSerieBuffer.h"
 
 namespace Ui
 {
@@ -124,6 +126,12 @@ private:
    stw_types::float64 mf64_CurrentTimeSlot;
 
    std::vector<QtCharts::QLineSeries *> mc_DataPoolElementsDataSeries;
+   // Received values of each data series. Only the visible part is handed to the line series
+   std::vector<stw_opensyde_gui_logic::C_SyvDaItChartDataSerieBuffer> mc_DataPoolElementsDataBuffers;
+   std::vector<bool> mc_DataPoolElementsDataChanged;
+   std::vector<stw_opensyde_gui_logic::C_SyvDaItChartDataSerieBuffer::C_Sample> mc_VisibleSamples;
+   std::map<stw_opensyde_gui_logic::C_PuiSvDbNodeDataPoolListElementId,
+            std::vector<stw_types::uint32> > mc_ElementIdToDataPoolElementConfigIndexes;
    std::vector<stw_types::uint32> mc_DataPoolElementsDataColorIndexes;
    // Saving for each datapool element the minimum content to have the type
    std::vector<stw_opensyde_core::C_OSCNodeDataPoolContent> mc_DataPoolElementContentMin;
@@ -139,6 +147,9 @@ private:
                        const bool oq_Invalid = false, const QString & orc_InvalidPlaceholderName = "",
                        const stw_opensyde_core::C_OSCNodeDataPool::E_Type oe_InvalidPlaceholderDataPoolType = stw_opensyde_core::C_OSCNodeDataPool::eDIAG, const QString & orc_ToolTipErrorTextHeading = "", const QString & orc_ToolTipErrorText = "");
    void m_ResetChart(void);
+   void m_UpdateElementIdToDataPoolElementConfigIndexes(void);
+   void m_UpdateDataSeriesPoints(const bool oq_All);
+   void m_TimeAxisRangeChanged(void);
    QColor m_GetColor(void);
    void m_DataItemToggled(const stw_types::uint32 ou32_DataPoolElementConfigIndex, const bool oq_Checked);
    void m_DataItemSelected(const stw_types::uint32 ou32_DataPoolElementConfigIndex);
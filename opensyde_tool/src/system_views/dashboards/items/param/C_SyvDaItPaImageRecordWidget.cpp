@@ -582,7 +582,8 @@ void C_SyvDaItPaImageRecordWidget::m_ReadElementsOfNode(const QString & orc_Comm
       else
       {
          sint32 s32_ServiceResult;
-         s32_Return = this->mrc_ComDriver.GetPollResults(s32_ServiceResult);
+         s32_Return = this->mrc_ComDriver.GetPollResults(this->mc_AllNodeIndexes[this->mu32_CurrentNode],
+                                                         s32_ServiceResult);
 
          if (s32_Return == C_NO_ERR)
          {
@@ -1178,7 +1179,7 @@ void C_SyvDaItPaImageRecordWidget::m_ReportErrorNvmSafeReadParameterValues(const
    QString c_Details = "";
    QString c_Description;
    C_OgeWiCustomMessage c_Message(this);
-   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(u8_NRC);
+   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(this->mc_AllNodeIndexes[this->mu32_CurrentNode], u8_NRC);
 
    tgl_assert(s32_Return == C_NO_ERR);
 
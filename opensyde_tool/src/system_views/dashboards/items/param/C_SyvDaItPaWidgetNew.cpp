@@ -196,6 +196,7 @@ void C_SyvDaItPaWidgetNew::UpdateECUValues(void) const
 //----------------------------------------------------------------------------------------------------------------------
 /*! \brief   Handle manual user operation finished event
 
+   \param[in]  orc_Id         Service the result belongs to
    \param[in]  os32_Result    Operation result
    \param[in]  ou8_NRC        NRC
 
@@ -204,11 +205,23 @@ void C_SyvDaItPaWidgetNew::UpdateECUValues(void) const
    false Operation was not relevant and was not handled
 */
 //----------------------------------------------------------------------------------------------------------------------
-bool C_SyvDaItPaWidgetNew::HandleManualOperationFinished(const sint32 os32_Result, const uint8 ou8_NRC)
+bool C_SyvDaItPaWidgetNew::HandleManualOperationFinished(const C_OSCNodeDataPoolListElementId & orc_Id,
+                                                         const sint32 os32_Result, const uint8 ou8_NRC)
 {
    bool q_Return = this->mq_ReadActive;
    sint32 s32_Result = os32_Result;
 
+   //Services of nodes on other routes run in parallel: only handle the result of the list read started here
+   if ((q_Return == true) && (this->mu32_ListCounter > 0UL) &&
+       ((this->mu32_ListCounter - 1UL) < this->mc_ListIds.size()))
+   {
+      const C_OSCNodeDataPoolListElementId & rc_PendingId =
+         this->mc_ListIds[static_cast<uintn>(this->mu32_ListCounter) - 1U];
+      q_Return = ((rc_PendingId.u32_NodeIndex == orc_Id.u32_NodeIndex) &&
+                  (rc_PendingId.u32_DataPoolIndex == orc_Id.u32_DataPoolIndex)) &&
+                 (rc_PendingId.u32_ListIndex == orc_Id.u32_ListIndex);
+   }
+
    if (q_Return == true)
    {
 
@@ -46,7 +46,8 @@ public:
    void ConnectionActiveChanged(const bool oq_Active);
    void SetSyvComDriver(stw_opensyde_gui_logic::C_SyvComDriverDiag & orc_ComDriver);
    void UpdateECUValues(void) const;
-   bool HandleManualOperationFinished(const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
+   bool HandleManualOperationFinished(const stw_opensyde_core::C_OSCNodeDataPoolListElementId & orc_Id,
+                                      const stw_types::sint32 os32_Result, const stw_types::uint8 ou8_NRC);
    void SetDark(const bool oq_Value) const;
 
    void ButtonAddClicked(void);
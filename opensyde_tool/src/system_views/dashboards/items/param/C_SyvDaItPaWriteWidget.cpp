@@ -67,6 +67,8 @@ C_SyvDaItPaWriteWidget::C_SyvDaItPaWriteWidget(stw_opensyde_gui_elements::C_OgeP
    mpc_Ui(new Ui::C_SyvDaItPaWriteWidget),
    mpc_ParentDialog(&orc_Parent),
    mrc_ComDriver(orc_ComDriver),
+   mu32_NotificationNodeIndex(0U),
+   mq_NotificationResultConsumed(false),
    me_Step(eBEFOREWRITE),
    mu32_CurrentNode(0U),
    mq_RequestPending(false)
@@ -392,7 +394,8 @@ void C_SyvDaItPaWriteWidget::m_WriteChangedElementsOfNode(void)
       else
       {
          sint32 s32_ServiceResult;
-         s32_Return = this->mrc_ComDriver.GetPollResults(s32_ServiceResult);
+         s32_Return = this->mrc_ComDriver.GetPollResults(this->mc_AllNodeIndexes[this->mu32_CurrentNode],
+                                                         s32_ServiceResult);
 
          if (s32_Return == C_NO_ERR)
          {
@@ -401,6 +404,7 @@ void C_SyvDaItPaWriteWidget::m_WriteChangedElementsOfNode(void)
             {
                // Get the output parameter
                this->mrc_ComDriver.GetPollSafeNvmWriteChangedElementsOutput(
+                  this->mc_AllNodeIndexes[this->mu32_CurrentNode],
                   this->mc_ChangedElementsForEachNode[this->mu32_CurrentNode]);
 
                // Prepare the next node
@@ -480,7 +484,8 @@ void C_SyvDaItPaWriteWidget::m_ReadBackElementsOfNode(void)
       else
       {
          sint32 s32_ServiceResult;
-         s32_Return = this->mrc_ComDriver.GetPollResults(s32_ServiceResult);
+         s32_Return = this->mrc_ComDriver.GetPollResults(this->mc_AllNodeIndexes[this->mu32_CurrentNode],
+                                                         s32_ServiceResult);
 
          if (s32_Return == C_NO_ERR)
          {
@@ -488,7 +493,8 @@ void C_SyvDaItPaWriteWidget::m_ReadBackElementsOfNode(void)
             if (s32_ServiceResult == C_NO_ERR)
             {
                // Get the output parameter
-               this->mrc_ComDriver.GetPollNvmSafeReadValuesOutput(this->mc_ReadNodeValues[this->mu32_CurrentNode]);
+               this->mrc_ComDriver.GetPollNvmSafeReadValuesOutput(this->mc_AllNodeIndexes[this->mu32_CurrentNode],
+                                                                  this->mc_ReadNodeValues[this->mu32_CurrentNode]);
 
                // Prepare the next node
                this->mq_RequestPending = false;
@@ -791,7 +797,8 @@ void C_SyvDaItPaWriteWidget::m_WriteCrcOfNode(void)
       else
       {
          sint32 s32_ServiceResult;
-         s32_Return = this->mrc_ComDriver.GetPollResults(s32_ServiceResult);
+         s32_Return = this->mrc_ComDriver.GetPollResults(this->mc_AllNodeIndexes[this->mu32_CurrentNode],
+                                                         s32_ServiceResult);
 
          if (s32_Return == C_NO_ERR)
          {
@@ -861,8 +868,10 @@ bool C_SyvDaItPaWriteWidget::m_SendNotification(void)
       this->mc_NotificationResult.clear();
       this->mc_NotificationResult.reserve(this->mc_RelevantLists.size());
       this->mc_NotificationIterator = this->mc_RelevantLists.begin();
+      this->mq_NotificationResultConsumed = false;
 
       this->me_Step = eSEND_NOTIFICATION;
+      this->mu32_NotificationNodeIndex = (*this->mc_NotificationIterator).u32_NodeIndex;
       this->mrc_ComDriver.PollNvmNotifyOfChanges((*this->mc_NotificationIterator).u32_NodeIndex,
                                                  static_cast<uint8>((*this->mc_NotificationIterator).u32_DataPoolIndex),
                                                  static_cast<uint16>((*this->mc_NotificationIterator).u32_ListIndex));
@@ -881,13 +890,20 @@ void C_SyvDaItPaWriteWidget::m_SendNextNotification(void)
 {
    sint32 s32_Result;
 
-   if (this->mrc_ComDriver.GetPollResults(s32_Result) == C_NO_ERR)
+   if (this->mrc_ComDriver.GetPollResults(this->mu32_NotificationNodeIndex, s32_Result) == C_NO_ERR)
    {
       if (s32_Result == C_NO_ERR)
       {
-         bool q_Ack;
-         tgl_assert(this->mrc_ComDriver.GetPollNvmNotifyOfChangesOutput(q_Ack) == C_NO_ERR);
-         this->mc_NotificationResult.push_back(q_Ack);
+         //The result of the last notification stays available until the next one was started successfully
+         //(e.g. the next one might be rejected as busy) so only store it once
+         if (this->mq_NotificationResultConsumed == false)
+         {
+            bool q_Ack;
+            tgl_assert(this->mrc_ComDriver.GetPollNvmNotifyOfChangesOutput(this->mu32_NotificationNodeIndex,
+                                                                           q_Ack) == C_NO_ERR);
+            this->mc_NotificationResult.push_back(q_Ack);
+            this->mq_NotificationResultConsumed = true;
+         }
          if (this->mc_NotificationIterator != this->mc_RelevantLists.end())
          {
             if (this->mrc_ComDriver.PollNvmNotifyOfChanges((*this->mc_NotificationIterator).u32_NodeIndex,
@@ -897,6 +913,8 @@ void C_SyvDaItPaWriteWidget::m_SendNextNotification(void)
                                                                                u32_ListIndex)) ==
                 C_NO_ERR)
             {
+               this->mu32_NotificationNodeIndex = (*this->mc_NotificationIterator).u32_NodeIndex;
+               this->mq_NotificationResultConsumed = false;
                //Important iterator step (strange notation because of lint)
                this->mc_NotificationIterator.operator ++();
             }
@@ -1242,7 +1260,7 @@ void C_SyvDaItPaWriteWidget::m_ReportErrorNvmSafeWriteChangedValues(const sint32
    QString c_Details;
    QString c_Description;
    C_OgeWiCustomMessage c_Message(this, C_OgeWiCustomMessage::E_Type::eERROR);
-   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(u8_NRC);
+   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(this->mc_AllNodeIndexes[this->mu32_CurrentNode], u8_NRC);
 
    tgl_assert(s32_Return == C_NO_ERR);
    switch (os32_ErrorCode)
@@ -1335,7 +1353,7 @@ void C_SyvDaItPaWriteWidget::m_ReportErrorNvmSafeReadValues(const sint32 os32_Er
    QString c_Details;
    QString c_Description;
    C_OgeWiCustomMessage c_Message(this);
-   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(u8_NRC);
+   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(this->mc_AllNodeIndexes[this->mu32_CurrentNode], u8_NRC);
 
    tgl_assert(s32_Return == C_NO_ERR);
 
@@ -1432,7 +1450,7 @@ void C_SyvDaItPaWriteWidget::m_ReportErrorNvmSafeWriteCrcs(const sint32 os32_Err
    QString c_Details;
    QString c_Description;
    C_OgeWiCustomMessage c_Message(this);
-   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(u8_NRC);
+   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(this->mc_AllNodeIndexes[this->mu32_CurrentNode], u8_NRC);
 
    tgl_assert(s32_Return == C_NO_ERR);
 
@@ -1542,7 +1560,7 @@ void C_SyvDaItPaWriteWidget::m_ReportErrorNvmNotifyOfChanges(const sint32 os32_E
    QString c_Details;
    QString c_Description;
    C_OgeWiCustomMessage c_Message(this);
-   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(u8_NRC);
+   sint32 s32_Return = this->mrc_ComDriver.GetPollResultNRC(this->mu32_NotificationNodeIndex, u8_NRC);
 
    tgl_assert(s32_Return == C_NO_ERR);
 
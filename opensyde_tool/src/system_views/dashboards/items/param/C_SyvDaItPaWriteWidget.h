@@ -125,6 +125,8 @@ private:
 
    std::set<stw_opensyde_core::C_OSCNodeDataPoolListId>::const_iterator mc_NotificationIterator;
    std::vector<bool> mc_NotificationResult;
+   stw_types::uint32 mu32_NotificationNodeIndex; ///< Node index of last started notification
+   bool mq_NotificationResultConsumed; ///< Result of last started notification already stored
 
    QTimer mc_Timer;
    E_Step me_Step;